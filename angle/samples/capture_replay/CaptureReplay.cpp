@@ -0,0 +1,285 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// CaptureReplay.cpp: Plays back a trace recorded by running an application with the
+// ANGLE_CAPTURE_FILE environment variable set, one captured frame per frame, and reports the CPU
+// time that each frame took to issue and to swap.
+//
+// The trace is replayed in a new context, which creates the same object names as the captured one
+// as long as the calls are the same, so names are not remapped.
+
+#include "SampleApplication.h"
+#include "libANGLE/FrameCaptureFormat.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+
+template <typename... Params>
+struct TypeList
+{
+};
+
+// The parameters are read one at a time, so that they are read in order
+template <typename Function, typename... Read>
+void ReplayParams(Function function, gl::CaptureReader *reader, TypeList<>, Read... read)
+{
+    function(read...);
+}
+
+template <typename Function, typename Next, typename... Rest, typename... Read>
+void ReplayParams(Function function, gl::CaptureReader *reader, TypeList<Next, Rest...>, Read... read)
+{
+    Next next;
+    reader->read(&next);
+    ReplayParams(function, reader, TypeList<Rest...>(), read..., next);
+}
+
+template <typename Result, typename... Params>
+void ReplayCall(Result (GL_APIENTRY *function)(Params...), gl::CaptureReader *reader)
+{
+    ReplayParams(function, reader, TypeList<Params...>());
+}
+
+bool ReadTrace(const char *path, std::vector<uint8_t> *trace)
+{
+    FILE *file = fopen(path, "rb");
+    if (file == nullptr)
+    {
+        return false;
+    }
+
+    uint8_t buffer[64 * 1024];
+    size_t readSize = 0;
+    while ((readSize = fread(buffer, 1, sizeof(buffer), file)) > 0)
+    {
+        trace->insert(trace->end(), buffer, buffer + readSize);
+    }
+
+    bool succeeded = (ferror(file) == 0);
+    fclose(file);
+    return succeeded;
+}
+
+// The window takes the size of the surface of the first captured frame
+void GetSurfaceSize(const std::vector<uint8_t> &trace, GLint *width, GLint *height)
+{
+    gl::CaptureReader reader(trace.data(), trace.size());
+    gl::CallID id;
+    while (reader.nextCall(&id))
+    {
+        if (id == gl::CALL_SwapBuffers)
+        {
+            reader.read(width);
+            reader.read(height);
+            return;
+        }
+    }
+}
+
+struct FrameTime
+{
+    size_t callCount;
+    double callTime;
+    double swapTime;
+};
+
+}
+
+class CaptureReplaySample : public SampleApplication
+{
+  public:
+    CaptureReplaySample(const std::vector<uint8_t> &trace, GLint clientVersion, GLint width, GLint height)
+        : SampleApplication("CaptureReplay", width, height, clientVersion),
+          mReader(trace.data(), trace.size()),
+          mTimer(CreateTimer()),
+          mReplayedFrame(false),
+          mFailed(false)
+    {
+    }
+
+    virtual void draw()
+    {
+        FrameTime frame = { 0, 0.0, 0.0 };
+
+        mTimer->start();
+        bool ended = !replayFrame(&frame.callCount);
+        mTimer->stop();
+
+        frame.callTime = mTimer->getElapsedTime();
+        mReplayedFrame = (frame.callCount > 0);
+        if (mReplayedFrame)
+        {
+            mFrames.push_back(frame);
+        }
+
+        if (ended)
+        {
+            exit();
+        }
+    }
+
+    virtual void swap()
+    {
+        if (!mReplayedFrame)
+        {
+            return;
+        }
+
+        mTimer->start();
+        SampleApplication::swap();
+        mTimer->stop();
+
+        mFrames.back().swapTime = mTimer->getElapsedTime();
+    }
+
+    virtual void destroy()
+    {
+        if (mFailed)
+        {
+            std::cerr << "The trace is corrupt after frame " << mFrames.size() << "." << std::endl;
+        }
+
+        std::cout << "frame, calls, call ms, swap ms" << std::endl;
+        std::cout << std::fixed << std::setprecision(3);
+        for (size_t frameIndex = 0; frameIndex < mFrames.size(); frameIndex++)
+        {
+            const FrameTime &frame = mFrames[frameIndex];
+            std::cout << frameIndex << ", " << frame.callCount << ", " << frame.callTime * 1000.0 << ", "
+                      << frame.swapTime * 1000.0 << std::endl;
+        }
+
+        // The first frame also holds the setup of the application, so it is left out of the summary
+        if (mFrames.size() > 1)
+        {
+            std::vector<double> frameTimes;
+            for (size_t frameIndex = 1; frameIndex < mFrames.size(); frameIndex++)
+            {
+                frameTimes.push_back((mFrames[frameIndex].callTime + mFrames[frameIndex].swapTime) * 1000.0);
+            }
+            std::sort(frameTimes.begin(), frameTimes.end());
+
+            double total = 0.0;
+            for (size_t frameIndex = 0; frameIndex < frameTimes.size(); frameIndex++)
+            {
+                total += frameTimes[frameIndex];
+            }
+
+            std::cout << "frames " << frameTimes.size() << ", mean " << total / frameTimes.size() << " ms, median "
+                      << frameTimes[frameTimes.size() / 2] << " ms, min " << frameTimes.front() << " ms, max "
+                      << frameTimes.back() << " ms" << std::endl;
+        }
+    }
+
+  private:
+    // Returns false once the trace has ended
+    bool replayFrame(size_t *callCount)
+    {
+        gl::CallID id;
+        while (mReader.nextCall(&id))
+        {
+            if (id == gl::CALL_SwapBuffers)
+            {
+                return true;
+            }
+
+            replayCall(id);
+            (*callCount)++;
+
+            if (mReader.hasError())
+            {
+                mFailed = true;
+                return false;
+            }
+        }
+
+        return false;
+    }
+
+    void replayCall(gl::CallID id)
+    {
+        // The sync objects that FenceSync returns are mapped to the ones it returned when captured
+        if (id == gl::CALL_FenceSync)
+        {
+            GLenum condition = 0;
+            GLbitfield flags = 0;
+            uint64_t capturedSync = 0;
+            mReader.read(&condition);
+            mReader.read(&flags);
+            mReader.readSync(&capturedSync);
+            mReader.mapSync(capturedSync, glFenceSync(condition, flags));
+            return;
+        }
+
+        switch (id)
+        {
+          case gl::CALL_UpdateMappedBuffer:
+            {
+                GLenum target = 0;
+                const void *contents = nullptr;
+                mReader.read(&target);
+                mReader.read(&contents);
+
+                void *mapped = nullptr;
+                glGetBufferPointerv(target, GL_BUFFER_MAP_POINTER, &mapped);
+                if (mapped != nullptr && contents != nullptr)
+                {
+                    memcpy(mapped, contents, mReader.getMemorySize());
+                }
+            }
+            break;
+
+#define ANGLE_REPLAY_CALL(Name) \
+          case gl::CALL_##Name: \
+            ReplayCall(gl##Name, &mReader); \
+            break;
+
+          ANGLE_CAPTURED_CALLS(ANGLE_REPLAY_CALL)
+
+#undef ANGLE_REPLAY_CALL
+
+          default:
+            mFailed = true;
+            break;
+        }
+    }
+
+    gl::CaptureReader mReader;
+    std::unique_ptr<Timer> mTimer;
+    std::vector<FrameTime> mFrames;
+    bool mReplayedFrame;
+    bool mFailed;
+};
+
+int main(int argc, char **argv)
+{
+    if (argc < 2)
+    {
+        std::cerr << "Usage: capture_replay <trace file>" << std::endl;
+        return -1;
+    }
+
+    std::vector<uint8_t> trace;
+    GLint clientVersion = 0;
+    if (!ReadTrace(argv[1], &trace) || !gl::CaptureReader(trace.data(), trace.size()).readHeader(&clientVersion))
+    {
+        std::cerr << "Could not read a trace from " << argv[1] << "." << std::endl;
+        return -1;
+    }
+
+    GLint width = 1280;
+    GLint height = 720;
+    GetSurfaceSize(trace, &width, &height);
+
+    CaptureReplaySample app(trace, clientVersion, width, height);
+    return app.run();
+}
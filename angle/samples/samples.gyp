@@ -67,6 +67,14 @@
                 ],
             },
         },
+        {
+            'target_name': 'capture_replay',
+            'type': 'executable',
+            'dependencies': [ 'sample_util' ],
+            'includes': [ '../build/common_defines.gypi', ],
+            'include_dirs': [ '../include', '../src', ],
+            'sources': [ 'capture_replay/CaptureReplay.cpp', ],
+        },
         {
             'target_name': 'hello_triangle',
             'type': 'executable',
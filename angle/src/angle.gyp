@@ -17,6 +17,7 @@
         'angle_enable_d3d11%': 0,
         'angle_enable_gl%': 0,
         'angle_enable_hlsl%': 0,
+        'angle_enable_null%': 0,
         'conditions':
         [
             ['OS=="win"',
@@ -29,6 +30,7 @@
             ['OS=="linux"',
             {
                 'angle_enable_gl%': 1,
+                'angle_enable_null%': 1,
             }],
         ],
     },
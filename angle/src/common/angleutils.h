@@ -168,4 +168,7 @@ std::string FormatString(const char *fmt, ...);
 // Hidden enum for the NULL D3D device type.
 #define EGL_PLATFORM_ANGLE_DEVICE_TYPE_NULL_ANGLE 0x6AC0
 
+// Hidden enum for the null renderer type, which does no rendering at all.
+#define EGL_PLATFORM_ANGLE_TYPE_NULL_ANGLE 0x6AC1
+
 #endif // COMMON_ANGLEUTILS_H_
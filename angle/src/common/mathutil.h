@@ -138,6 +138,40 @@ inline bool supportsSSE2()
 #endif
 }
 
+inline bool supportsF16C()
+{
+#if defined(ANGLE_PLATFORM_WINDOWS) && !defined(_M_ARM)
+    static bool checked = false;
+    static bool supports = false;
+
+    if (checked)
+    {
+        return supports;
+    }
+
+    int info[4];
+    __cpuid(info, 0);
+
+    if (info[0] >= 1)
+    {
+        __cpuid(info, 1);
+
+        // The F16C instructions have VEX encodings, so the OS must also save the AVX registers
+        bool f16c = ((info[2] >> 29) & 1) != 0;
+        bool avx = ((info[2] >> 28) & 1) != 0;
+        bool osxsave = ((info[2] >> 27) & 1) != 0;
+        supports = f16c && avx && osxsave && (_xgetbv(0) & 0x6) == 0x6;
+    }
+
+    checked = true;
+
+    return supports;
+#else
+    UNIMPLEMENTED();
+    return false;
+#endif
+}
+
 template <typename destType, typename sourceType>
 destType bitCast(const sourceType &source)
 {
@@ -181,6 +215,16 @@ inline unsigned short float32ToFloat16(float fp32)
 
 float float16ToFloat32(unsigned short h);
 
+// Convert count values at once, with the same results as the conversions of single values. They
+// use the F16C or SSE2 instructions when the processor has them.
+void float16ToFloat32N(const unsigned short *input, size_t count, float *output);
+void float32ToFloat16N(const float *input, size_t count, unsigned short *output);
+
+void float16ToFloat32N_SSE2(const unsigned short *input, size_t count, float *output);
+void float32ToFloat16N_SSE2(const float *input, size_t count, unsigned short *output);
+void float16ToFloat32N_F16C(const unsigned short *input, size_t count, float *output);
+void float32ToFloat16N_F16C(const float *input, size_t count, unsigned short *output);
+
 unsigned int convertRGBFloatsTo999E5(float red, float green, float blue);
 void convert999E5toRGBFloats(unsigned int input, float *red, float *green, float *blue);
 
@@ -10,8 +10,15 @@
 #include "common/mathutil.h"
 #include "common/platform.h"
 
+#include <algorithm>
 #include <set>
 
+// SSE2 is part of the x64 baseline; 32-bit x86 builds only get it when the compiler targets it.
+#if defined(ANGLE_USE_SSE) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#  include <emmintrin.h>
+#  define ANGLE_INDEX_RANGE_SSE2
+#endif
+
 #if defined(ANGLE_ENABLE_WINDOWS_STORE)
 #  include <wrl.h>
 #  include <wrl/wrappers/corewrappers.h>
@@ -399,6 +406,123 @@ GLenum LayerIndexToCubeMapTextureTarget(size_t index)
     return FirstCubeMapTextureTarget + static_cast<GLenum>(index);
 }
 
+template <class IndexType>
+static void UpdateTypedIndexRange(const IndexType *indices, GLsizei count, IndexType *minIndex, IndexType *maxIndex)
+{
+    for (GLsizei i = 0; i < count; i++)
+    {
+        if (*minIndex > indices[i]) *minIndex = indices[i];
+        if (*maxIndex < indices[i]) *maxIndex = indices[i];
+    }
+}
+
+#if defined(ANGLE_INDEX_RANGE_SSE2)
+
+// The SSE2 kernels keep a running minimum and maximum per lane and fold the lanes together at
+// the end; the scalar loop picks up whatever doesn't fill a whole register. SSE2 only compares
+// unsigned bytes and signed words and dwords, so wider indices are biased into the signed range
+// first.
+static GLsizei UpdateIndexRangeSSE2(const GLubyte *indices, GLsizei count, GLubyte *minIndex, GLubyte *maxIndex)
+{
+    const GLsizei laneCount = 16;
+    const GLsizei vectorCount = count - (count % laneCount);
+    if (vectorCount == 0)
+    {
+        return 0;
+    }
+
+    __m128i minValues = _mm_set1_epi8(static_cast<char>(*minIndex));
+    __m128i maxValues = _mm_set1_epi8(static_cast<char>(*maxIndex));
+    for (GLsizei i = 0; i < vectorCount; i += laneCount)
+    {
+        __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(indices + i));
+        minValues = _mm_min_epu8(minValues, values);
+        maxValues = _mm_max_epu8(maxValues, values);
+    }
+
+    GLubyte minLanes[laneCount];
+    GLubyte maxLanes[laneCount];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(minLanes), minValues);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(maxLanes), maxValues);
+    for (GLsizei lane = 0; lane < laneCount; lane++)
+    {
+        *minIndex = std::min(*minIndex, minLanes[lane]);
+        *maxIndex = std::max(*maxIndex, maxLanes[lane]);
+    }
+
+    return vectorCount;
+}
+
+static GLsizei UpdateIndexRangeSSE2(const GLushort *indices, GLsizei count, GLushort *minIndex, GLushort *maxIndex)
+{
+    const GLsizei laneCount = 8;
+    const GLsizei vectorCount = count - (count % laneCount);
+    if (vectorCount == 0)
+    {
+        return 0;
+    }
+
+    const __m128i bias = _mm_set1_epi16(static_cast<short>(0x8000));
+    __m128i minValues = _mm_xor_si128(_mm_set1_epi16(static_cast<short>(*minIndex)), bias);
+    __m128i maxValues = _mm_xor_si128(_mm_set1_epi16(static_cast<short>(*maxIndex)), bias);
+    for (GLsizei i = 0; i < vectorCount; i += laneCount)
+    {
+        __m128i values = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(indices + i)), bias);
+        minValues = _mm_min_epi16(minValues, values);
+        maxValues = _mm_max_epi16(maxValues, values);
+    }
+
+    GLushort minLanes[laneCount];
+    GLushort maxLanes[laneCount];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(minLanes), _mm_xor_si128(minValues, bias));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(maxLanes), _mm_xor_si128(maxValues, bias));
+    for (GLsizei lane = 0; lane < laneCount; lane++)
+    {
+        *minIndex = std::min(*minIndex, minLanes[lane]);
+        *maxIndex = std::max(*maxIndex, maxLanes[lane]);
+    }
+
+    return vectorCount;
+}
+
+static GLsizei UpdateIndexRangeSSE2(const GLuint *indices, GLsizei count, GLuint *minIndex, GLuint *maxIndex)
+{
+    const GLsizei laneCount = 4;
+    const GLsizei vectorCount = count - (count % laneCount);
+    if (vectorCount == 0)
+    {
+        return 0;
+    }
+
+    const __m128i bias = _mm_set1_epi32(static_cast<int>(0x80000000u));
+    __m128i minValues = _mm_xor_si128(_mm_set1_epi32(static_cast<int>(*minIndex)), bias);
+    __m128i maxValues = _mm_xor_si128(_mm_set1_epi32(static_cast<int>(*maxIndex)), bias);
+    for (GLsizei i = 0; i < vectorCount; i += laneCount)
+    {
+        __m128i values = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(indices + i)), bias);
+
+        // There is no dword min or max in SSE2, so select with the comparison masks
+        __m128i smaller = _mm_cmpgt_epi32(minValues, values);
+        minValues = _mm_or_si128(_mm_and_si128(smaller, values), _mm_andnot_si128(smaller, minValues));
+        __m128i larger = _mm_cmpgt_epi32(values, maxValues);
+        maxValues = _mm_or_si128(_mm_and_si128(larger, values), _mm_andnot_si128(larger, maxValues));
+    }
+
+    GLuint minLanes[laneCount];
+    GLuint maxLanes[laneCount];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(minLanes), _mm_xor_si128(minValues, bias));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(maxLanes), _mm_xor_si128(maxValues, bias));
+    for (GLsizei lane = 0; lane < laneCount; lane++)
+    {
+        *minIndex = std::min(*minIndex, minLanes[lane]);
+        *maxIndex = std::max(*maxIndex, maxLanes[lane]);
+    }
+
+    return vectorCount;
+}
+
+#endif // ANGLE_INDEX_RANGE_SSE2
+
 template <class IndexType>
 static RangeUI ComputeTypedIndexRange(const IndexType *indices, GLsizei count)
 {
@@ -406,11 +530,11 @@ static RangeUI ComputeTypedIndexRange(const IndexType *indices, GLsizei count)
     IndexType minIndex = indices[0];
     IndexType maxIndex = indices[0];
 
-    for (GLsizei i = 1; i < count; i++)
-    {
-        if (minIndex > indices[i]) minIndex = indices[i];
-        if (maxIndex < indices[i]) maxIndex = indices[i];
-    }
+    GLsizei processed = 0;
+#if defined(ANGLE_INDEX_RANGE_SSE2)
+    processed = UpdateIndexRangeSSE2(indices, count, &minIndex, &maxIndex);
+#endif
+    UpdateTypedIndexRange(indices + processed, count - processed, &minIndex, &maxIndex);
 
     return RangeUI(static_cast<GLuint>(minIndex), static_cast<GLuint>(maxIndex));
 }
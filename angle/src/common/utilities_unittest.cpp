@@ -10,6 +10,9 @@
 
 #include "common/utilities.h"
 
+#include <algorithm>
+#include <vector>
+
 namespace
 {
 
@@ -52,4 +55,62 @@ TEST(ParseUniformName, TrailingWhitespace)
     EXPECT_EQ(GL_INVALID_INDEX, index);
 }
 
+template <typename IndexType>
+void CheckIndexRanges(GLenum type, const std::vector<IndexType> &indices)
+{
+    // Cover every alignment and every remainder the vector loops leave behind
+    for (size_t offset = 0; offset < 20; offset++)
+    {
+        for (size_t count = 1; offset + count <= indices.size(); count += (count < 40 ? 1 : 37))
+        {
+            auto first = indices.begin() + offset;
+            IndexType expectedMin = *std::min_element(first, first + count);
+            IndexType expectedMax = *std::max_element(first, first + count);
+
+            gl::RangeUI range = gl::ComputeIndexRange(type, &indices[offset], static_cast<GLsizei>(count));
+            EXPECT_EQ(static_cast<GLuint>(expectedMin), range.start) << "offset " << offset << " count " << count;
+            EXPECT_EQ(static_cast<GLuint>(expectedMax), range.end) << "offset " << offset << " count " << count;
+        }
+    }
+}
+
+template <typename IndexType>
+std::vector<IndexType> MakeIndices(size_t count, IndexType largest)
+{
+    std::vector<IndexType> indices(count);
+    unsigned int seed = 1;
+    for (size_t i = 0; i < count; i++)
+    {
+        seed = seed * 1103515245u + 12345u;
+        indices[i] = static_cast<IndexType>((seed >> 8) % 1000 + 500);
+    }
+
+    // Put the extremes of the type in the middle of the data
+    indices[count / 2] = largest;
+    indices[count / 3] = 0;
+    return indices;
+}
+
+TEST(ComputeIndexRange, UnsignedByte)
+{
+    std::vector<GLubyte> indices(300);
+    for (size_t i = 0; i < indices.size(); i++)
+    {
+        indices[i] = static_cast<GLubyte>((i * 37 + 11) % 200 + 20);
+    }
+    indices[150] = 0xFF;
+    indices[77] = 0;
+    CheckIndexRanges(GL_UNSIGNED_BYTE, indices);
+}
+
+TEST(ComputeIndexRange, UnsignedShort)
+{
+    CheckIndexRanges(GL_UNSIGNED_SHORT, MakeIndices<GLushort>(300, 0xFFFF));
+}
+
+TEST(ComputeIndexRange, UnsignedInt)
+{
+    CheckIndexRanges(GL_UNSIGNED_INT, MakeIndices<GLuint>(300, 0xFFFFFFFF));
+}
+
 }
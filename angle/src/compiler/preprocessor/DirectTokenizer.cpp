@@ -0,0 +1,717 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "DirectTokenizer.h"
+
+#include <cassert>
+
+#include "DiagnosticsBase.h"
+#include "Token.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define PP_USE_SSE2
+#include <emmintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+namespace pp
+{
+
+namespace
+{
+
+inline bool IsHorizontalSpace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\v' || c == '\f';
+}
+
+inline bool IsDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+inline bool IsOctalDigit(char c)
+{
+    return c >= '0' && c <= '7';
+}
+
+inline bool IsHexDigit(char c)
+{
+    return IsDigit(c) || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+}
+
+inline bool IsIdentifierStart(char c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+}
+
+inline bool IsIdentifierChar(char c)
+{
+    return IsIdentifierStart(c) || IsDigit(c);
+}
+
+// Characters that may follow the leading digits of a PP_NUMBER.
+inline bool IsNumberChar(char c)
+{
+    return IsIdentifierChar(c) || c == '.';
+}
+
+inline bool IsNewline(char c)
+{
+    return c == '\n' || c == '\r';
+}
+
+// Length of the NEWLINE at |p|: \n, \r or \r\n.
+inline size_t NewlineLength(const char *p, const char *end)
+{
+    return (p[0] == '\r' && p + 1 < end && p[1] == '\n') ? 2 : 1;
+}
+
+inline size_t CountDigits(const char *p, const char *end)
+{
+    const char *start = p;
+    while (p < end && IsDigit(*p))
+        ++p;
+    return p - start;
+}
+
+// Length of the up to two [uU] suffixes the integer constant rules accept.
+inline size_t CountUnsignedSuffix(const char *p, const char *end)
+{
+    size_t count = 0;
+    while (count < 2 && p + count < end && (p[count] == 'u' || p[count] == 'U'))
+        ++count;
+    return count;
+}
+
+// Length of {EXPONENT_PART} at |p|, or 0 if there is none.
+size_t ExponentLength(const char *p, const char *end)
+{
+    if (p >= end || (*p != 'e' && *p != 'E'))
+        return 0;
+
+    const char *digits = p + 1;
+    if (digits < end && (*digits == '+' || *digits == '-'))
+        ++digits;
+
+    size_t count = CountDigits(digits, end);
+    return count > 0 ? (digits + count) - p : 0;
+}
+
+#if defined(PP_USE_SSE2)
+inline unsigned int CountTrailingZeros(unsigned int mask)
+{
+    assert(mask != 0);
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return index;
+#else
+    return __builtin_ctz(mask);
+#endif
+}
+#endif
+
+// Returns the first character in [p, end) that is not in [ \t\v\f].
+const char *SkipHorizontalSpace(const char *p, const char *end)
+{
+    // Most runs are a single space between two tokens.
+    if (p == end || !IsHorizontalSpace(*p))
+        return p;
+
+#if defined(PP_USE_SSE2)
+    const __m128i space = _mm_set1_epi8(' ');
+    // \t \n \v \f \r are contiguous; \n and \r are excluded below.
+    const __m128i controlMin = _mm_set1_epi8('\t' - 1);
+    const __m128i controlMax = _mm_set1_epi8('\r' + 1);
+    const __m128i newline = _mm_set1_epi8('\n');
+    const __m128i carriageReturn = _mm_set1_epi8('\r');
+    while (end - p >= 16)
+    {
+        __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+        __m128i control = _mm_and_si128(_mm_cmpgt_epi8(chars, controlMin),
+                                        _mm_cmplt_epi8(chars, controlMax));
+        __m128i breaks = _mm_or_si128(_mm_cmpeq_epi8(chars, newline),
+                                      _mm_cmpeq_epi8(chars, carriageReturn));
+        __m128i blank = _mm_or_si128(_mm_cmpeq_epi8(chars, space),
+                                     _mm_andnot_si128(breaks, control));
+        unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(blank)) ^ 0xFFFF;
+        if (mask != 0)
+            return p + CountTrailingZeros(mask);
+        p += 16;
+    }
+#endif
+
+    while (p < end && IsHorizontalSpace(*p))
+        ++p;
+    return p;
+}
+
+// Returns the first \r or \n in [p, end), or end.
+const char *FindNewline(const char *p, const char *end)
+{
+#if defined(PP_USE_SSE2)
+    const __m128i newline = _mm_set1_epi8('\n');
+    const __m128i carriageReturn = _mm_set1_epi8('\r');
+    while (end - p >= 16)
+    {
+        __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+        __m128i breaks = _mm_or_si128(_mm_cmpeq_epi8(chars, newline),
+                                      _mm_cmpeq_epi8(chars, carriageReturn));
+        unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(breaks));
+        if (mask != 0)
+            return p + CountTrailingZeros(mask);
+        p += 16;
+    }
+#endif
+
+    while (p < end && !IsNewline(*p))
+        ++p;
+    return p;
+}
+
+// Returns the first *, \r or \n in [p, end), or end.
+const char *FindCommentBreak(const char *p, const char *end)
+{
+#if defined(PP_USE_SSE2)
+    const __m128i star = _mm_set1_epi8('*');
+    const __m128i newline = _mm_set1_epi8('\n');
+    const __m128i carriageReturn = _mm_set1_epi8('\r');
+    while (end - p >= 16)
+    {
+        __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+        __m128i breaks = _mm_or_si128(_mm_cmpeq_epi8(chars, newline),
+                                      _mm_cmpeq_epi8(chars, carriageReturn));
+        breaks = _mm_or_si128(breaks, _mm_cmpeq_epi8(chars, star));
+        unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(breaks));
+        if (mask != 0)
+            return p + CountTrailingZeros(mask);
+        p += 16;
+    }
+#endif
+
+    while (p < end && *p != '*' && !IsNewline(*p))
+        ++p;
+    return p;
+}
+
+}  // namespace anonymous
+
+DirectTokenizer::DirectTokenizer(Diagnostics *diagnostics)
+    : mDiagnostics(diagnostics),
+      mBegin(NULL),
+      mCursor(NULL),
+      mEnd(NULL),
+      mFileNumber(0),
+      mLineNumber(1),
+      mLeadingSpace(false),
+      mLineStart(true),
+      mInComment(false),
+      mMaxTokenSize(256)
+{
+}
+
+DirectTokenizer::~DirectTokenizer()
+{
+}
+
+bool DirectTokenizer::init(size_t count, const char * const string[], const int length[])
+{
+    if ((count > 0) && (string == 0))
+        return false;
+
+    mInput = Input(count, string, length);
+
+    // The common single-string case is scanned in place. Multiple strings are
+    // joined once so that tokens can straddle string boundaries, just like
+    // they do in the flex scanner buffer.
+    if (count == 1)
+    {
+        mBegin = mInput.string(0);
+        mEnd = mBegin + mInput.length(0);
+    }
+    else
+    {
+        size_t total = 0;
+        for (size_t i = 0; i < count; ++i)
+            total += mInput.length(i);
+
+        mBuffer.clear();
+        mBuffer.reserve(total);
+        for (size_t i = 0; i < count; ++i)
+            mBuffer.append(mInput.string(i), mInput.length(i));
+
+        mBegin = mBuffer.data();
+        mEnd = mBegin + mBuffer.size();
+    }
+    mCursor = mBegin;
+
+    mScanLoc = Input::Location();
+    mFileNumber = 0;
+    mLineNumber = 1;
+    mLeadingSpace = false;
+    mLineStart = true;
+    mInComment = false;
+    return true;
+}
+
+void DirectTokenizer::setFileNumber(int file)
+{
+    mFileNumber = file;
+}
+
+void DirectTokenizer::setLineNumber(int line)
+{
+    mLineNumber = line;
+}
+
+void DirectTokenizer::setMaxTokenSize(size_t maxTokenSize)
+{
+    mMaxTokenSize = maxTokenSize;
+}
+
+void DirectTokenizer::lex(Token *token)
+{
+    token->type = scan(token);
+    if (token->text.size() > mMaxTokenSize)
+    {
+        mDiagnostics->report(Diagnostics::PP_TOKEN_TOO_LONG,
+                             token->location, token->text);
+        token->text.erase(mMaxTokenSize);
+    }
+
+    token->flags = 0;
+
+    token->setAtStartOfLine(mLineStart);
+    mLineStart = token->type == '\n';
+
+    token->setHasLeadingSpace(mLeadingSpace);
+    mLeadingSpace = false;
+}
+
+void DirectTokenizer::beginMatch(size_t length, SourceLocation *location)
+{
+    // Advance the scan location to the string the match starts in. Empty
+    // strings are skipped over but still bump the file number.
+    while ((mScanLoc.sIndex < mInput.count()) &&
+           (mScanLoc.cIndex >= mInput.length(mScanLoc.sIndex)))
+    {
+        mScanLoc.cIndex -= mInput.length(mScanLoc.sIndex++);
+        ++mFileNumber;
+        mLineNumber = 1;
+    }
+    location->file = mFileNumber;
+    location->line = mLineNumber;
+
+    mScanLoc.cIndex += length;
+    mCursor += length;
+}
+
+void DirectTokenizer::skipBlockComment(SourceLocation *location)
+{
+    while (mCursor < mEnd)
+    {
+        char c = *mCursor;
+        if (c == '*')
+        {
+            if (mCursor + 1 < mEnd && mCursor[1] == '/')
+            {
+                beginMatch(2, location);
+                // The comment is replaced by a single space.
+                mLeadingSpace = true;
+                mInComment = false;
+                return;
+            }
+            beginMatch(1, location);
+        }
+        else if (IsNewline(c))
+        {
+            // Line breaks are just counted - not returned.
+            beginMatch(NewlineLength(mCursor, mEnd), location);
+            ++mLineNumber;
+        }
+        else
+        {
+            beginMatch(FindCommentBreak(mCursor, mEnd) - mCursor, location);
+        }
+    }
+}
+
+int DirectTokenizer::matchNumber(size_t *length) const
+{
+    const char *begin = mCursor;
+    const char *end = mEnd;
+
+    // Anything that starts with a digit or .digit must be a number. The
+    // catch-all PP_NUMBER rule always matches, so the token is the longest of
+    // the three rules with ties going to CONST_INT, then CONST_FLOAT.
+    const char *p = begin;
+    while (p < end && IsNumberChar(*p))
+        ++p;
+    size_t numberLength = p - begin;
+
+    size_t intLength = 0;
+    if (begin[0] != '0' && begin[0] != '.')
+    {
+        intLength = CountDigits(begin, end);
+        intLength += CountUnsignedSuffix(begin + intLength, end);
+    }
+    else if (begin[0] == '0')
+    {
+        size_t octalLength = 1;
+        while (begin + octalLength < end && IsOctalDigit(begin[octalLength]))
+            ++octalLength;
+        octalLength += CountUnsignedSuffix(begin + octalLength, end);
+
+        size_t hexLength = 0;
+        if (begin + 2 < end && (begin[1] == 'x' || begin[1] == 'X') && IsHexDigit(begin[2]))
+        {
+            hexLength = 3;
+            while (begin + hexLength < end && IsHexDigit(begin[hexLength]))
+                ++hexLength;
+            hexLength += CountUnsignedSuffix(begin + hexLength, end);
+        }
+
+        intLength = octalLength > hexLength ? octalLength : hexLength;
+    }
+
+    size_t floatLength = 0;
+    size_t integerDigits = CountDigits(begin, end);
+    const char *fraction = begin + integerDigits;
+    if (fraction < end && *fraction == '.')
+    {
+        size_t fractionDigits = CountDigits(fraction + 1, end);
+        if (integerDigits > 0 || fractionDigits > 0)
+        {
+            const char *q = fraction + 1 + fractionDigits;
+            q += ExponentLength(q, end);
+            if (q < end && (*q == 'f' || *q == 'F'))
+                ++q;
+            floatLength = q - begin;
+        }
+    }
+    else
+    {
+        size_t exponentLength = ExponentLength(fraction, end);
+        if (exponentLength > 0)
+        {
+            const char *q = fraction + exponentLength;
+            if (q < end && (*q == 'f' || *q == 'F'))
+                ++q;
+            floatLength = q - begin;
+        }
+    }
+
+    size_t longest = numberLength;
+    if (intLength > longest)
+        longest = intLength;
+    if (floatLength > longest)
+        longest = floatLength;
+
+    *length = longest;
+    if (intLength == longest)
+        return Token::CONST_INT;
+    if (floatLength == longest)
+        return Token::CONST_FLOAT;
+    return Token::PP_NUMBER;
+}
+
+int DirectTokenizer::scan(Token *token)
+{
+    SourceLocation *location = &token->location;
+    for (;;)
+    {
+        if (mInComment)
+        {
+            skipBlockComment(location);
+            if (mInComment)
+                break;
+        }
+        if (mCursor == mEnd)
+            break;
+
+        const char *start = mCursor;
+        char c = *start;
+        // Every character compared against below is non-zero.
+        char next = start + 1 < mEnd ? start[1] : '\0';
+        int type = 0;
+        size_t length = 1;
+
+        switch (c)
+        {
+          case ' ':
+          case '\t':
+          case '\v':
+          case '\f':
+            beginMatch(SkipHorizontalSpace(start, mEnd) - start, location);
+            mLeadingSpace = true;
+            continue;
+
+          case '\n':
+          case '\r':
+            beginMatch(NewlineLength(start, mEnd), location);
+            ++mLineNumber;
+            token->text.assign(1, '\n');
+            return '\n';
+
+          case '\\':
+            if (IsNewline(next))
+            {
+                beginMatch(1 + NewlineLength(start + 1, mEnd), location);
+                ++mLineNumber;
+                continue;
+            }
+            type = Token::PP_OTHER;
+            break;
+
+          case '/':
+            if (next == '/')
+            {
+                // Line comment.
+                beginMatch(FindNewline(start + 2, mEnd) - start, location);
+                continue;
+            }
+            if (next == '*')
+            {
+                beginMatch(2, location);
+                mInComment = true;
+                continue;
+            }
+            if (next == '=')
+            {
+                type = Token::OP_DIV_ASSIGN;
+                length = 2;
+            }
+            else
+            {
+                type = c;
+            }
+            break;
+
+          case '#':
+            // # is only valid at start of line for preprocessor directives.
+            type = mLineStart ? Token::PP_HASH : Token::PP_OTHER;
+            break;
+
+          case '0': case '1': case '2': case '3': case '4':
+          case '5': case '6': case '7': case '8': case '9':
+            type = matchNumber(&length);
+            break;
+
+          case '.':
+            type = IsDigit(next) ? matchNumber(&length) : c;
+            break;
+
+          case '+':
+            if (next == '+')
+            {
+                type = Token::OP_INC;
+                length = 2;
+            }
+            else if (next == '=')
+            {
+                type = Token::OP_ADD_ASSIGN;
+                length = 2;
+            }
+            else
+            {
+                type = c;
+            }
+            break;
+
+          case '-':
+            if (next == '-')
+            {
+                type = Token::OP_DEC;
+                length = 2;
+            }
+            else if (next == '=')
+            {
+                type = Token::OP_SUB_ASSIGN;
+                length = 2;
+            }
+            else
+            {
+                type = c;
+            }
+            break;
+
+          case '<':
+          case '>':
+            if (next == c)
+            {
+                if (start + 2 < mEnd && start[2] == '=')
+                {
+                    type = c == '<' ? Token::OP_LEFT_ASSIGN : Token::OP_RIGHT_ASSIGN;
+                    length = 3;
+                }
+                else
+                {
+                    type = c == '<' ? Token::OP_LEFT : Token::OP_RIGHT;
+                    length = 2;
+                }
+            }
+            else if (next == '=')
+            {
+                type = c == '<' ? Token::OP_LE : Token::OP_GE;
+                length = 2;
+            }
+            else
+            {
+                type = c;
+            }
+            break;
+
+          case '=':
+            if (next == '=')
+            {
+                type = Token::OP_EQ;
+                length = 2;
+            }
+            else
+            {
+                type = c;
+            }
+            break;
+
+          case '!':
+            if (next == '=')
+            {
+                type = Token::OP_NE;
+                length = 2;
+            }
+            else
+            {
+                type = c;
+            }
+            break;
+
+          case '&':
+            if (next == '&')
+            {
+                type = Token::OP_AND;
+                length = 2;
+            }
+            else if (next == '=')
+            {
+                type = Token::OP_AND_ASSIGN;
+                length = 2;
+            }
+            else
+            {
+                type = c;
+            }
+            break;
+
+          case '^':
+            if (next == '^')
+            {
+                type = Token::OP_XOR;
+                length = 2;
+            }
+            else if (next == '=')
+            {
+                type = Token::OP_XOR_ASSIGN;
+                length = 2;
+            }
+            else
+            {
+                type = c;
+            }
+            break;
+
+          case '|':
+            if (next == '|')
+            {
+                type = Token::OP_OR;
+                length = 2;
+            }
+            else if (next == '=')
+            {
+                type = Token::OP_OR_ASSIGN;
+                length = 2;
+            }
+            else
+            {
+                type = c;
+            }
+            break;
+
+          case '*':
+            if (next == '=')
+            {
+                type = Token::OP_MUL_ASSIGN;
+                length = 2;
+            }
+            else
+            {
+                type = c;
+            }
+            break;
+
+          case '%':
+            if (next == '=')
+            {
+                type = Token::OP_MOD_ASSIGN;
+                length = 2;
+            }
+            else
+            {
+                type = c;
+            }
+            break;
+
+          case '[': case ']': case '(': case ')': case '{': case '}':
+          case ',': case '~': case ':': case ';': case '?':
+            type = c;
+            break;
+
+          default:
+            if (IsIdentifierStart(c))
+            {
+                const char *p = start + 1;
+                while (p < mEnd && IsIdentifierChar(*p))
+                    ++p;
+                type = Token::IDENTIFIER;
+                length = p - start;
+            }
+            else
+            {
+                type = Token::PP_OTHER;
+            }
+            break;
+        }
+
+        beginMatch(length, location);
+        token->text.assign(start, length);
+        return type;
+    }
+
+    // End of input. The flex scanner does not run its per-match bookkeeping
+    // here, so only trailing empty strings move the location.
+    size_t sIndexMax = mInput.count() ? mInput.count() - 1 : 0;
+    if (mScanLoc.sIndex != sIndexMax)
+    {
+        mScanLoc.sIndex = sIndexMax;
+        mScanLoc.cIndex = 0;
+        mFileNumber = static_cast<int>(sIndexMax);
+        mLineNumber = 1;
+    }
+    location->file = mFileNumber;
+    location->line = mLineNumber;
+    token->text.clear();
+
+    if (mInComment)
+    {
+        mDiagnostics->report(Diagnostics::PP_EOF_IN_COMMENT,
+                             SourceLocation(mFileNumber, mLineNumber), "");
+    }
+    return Token::LAST;
+}
+
+}  // namespace pp
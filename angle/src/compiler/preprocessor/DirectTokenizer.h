@@ -0,0 +1,85 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#ifndef COMPILER_PREPROCESSOR_DIRECTTOKENIZER_H_
+#define COMPILER_PREPROCESSOR_DIRECTTOKENIZER_H_
+
+#include <string>
+
+#include "Input.h"
+#include "TokenizerBase.h"
+#include "pp_utils.h"
+
+namespace pp
+{
+
+class Diagnostics;
+struct SourceLocation;
+
+// Hand-written replacement for the flex-generated Tokenizer. It scans the
+// shader source in place instead of copying it through Input::read into a
+// scanner buffer, and only touches the token text once, when the token is
+// handed out. Whitespace and comment bodies are skipped 16 bytes at a time
+// with SSE2 where available.
+//
+// Tokens, locations and diagnostics are identical to the ones Tokenizer
+// produces, including the file and line numbering of tokens that straddle
+// the boundary between two source strings.
+class DirectTokenizer : public TokenizerBase
+{
+  public:
+    DirectTokenizer(Diagnostics *diagnostics);
+    ~DirectTokenizer();
+
+    virtual bool init(size_t count, const char * const string[], const int length[]);
+
+    virtual void setFileNumber(int file);
+    virtual void setLineNumber(int line);
+    virtual void setMaxTokenSize(size_t maxTokenSize);
+
+    virtual void lex(Token *token);
+
+  private:
+    PP_DISALLOW_COPY_AND_ASSIGN(DirectTokenizer);
+
+    // Scans the next token into |token| and returns its type.
+    int scan(Token *token);
+
+    // Bookkeeping done by the flex scanner before every matched rule: moves
+    // the scan location into the string the match starts in, records the
+    // location and consumes the match.
+    void beginMatch(size_t length, SourceLocation *location);
+
+    // Consumes the body of a block comment up to and including "*/".
+    // Leaves mInComment set if the input ends first.
+    void skipBlockComment(SourceLocation *location);
+
+    // Returns the type and length of the numeric token at mCursor.
+    int matchNumber(size_t *length) const;
+
+    Diagnostics *mDiagnostics;
+
+    Input mInput;
+    // Concatenated source, only used when there is more than one string.
+    std::string mBuffer;
+    const char *mBegin;
+    const char *mCursor;
+    const char *mEnd;
+
+    // Equivalent of Tokenizer::Context::scanLoc.
+    Input::Location mScanLoc;
+    int mFileNumber;
+    int mLineNumber;
+
+    bool mLeadingSpace;
+    bool mLineStart;
+    bool mInComment;
+    size_t mMaxTokenSize;
+};
+
+}  // namespace pp
+
+#endif  // COMPILER_PREPROCESSOR_DIRECTTOKENIZER_H_
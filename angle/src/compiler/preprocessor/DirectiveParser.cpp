@@ -16,7 +16,7 @@
 #include "ExpressionParser.h"
 #include "MacroExpander.h"
 #include "Token.h"
-#include "Tokenizer.h"
+#include "TokenizerBase.h"
 
 namespace {
 enum DirectiveType
@@ -206,7 +206,7 @@ class DefinedParser : public Lexer
     Diagnostics *mDiagnostics;
 };
 
-DirectiveParser::DirectiveParser(Tokenizer *tokenizer,
+DirectiveParser::DirectiveParser(TokenizerBase *tokenizer,
                                  MacroSet *macroSet,
                                  Diagnostics *diagnostics,
                                  DirectiveHandler *directiveHandler)
@@ -17,12 +17,12 @@ namespace pp
 
 class Diagnostics;
 class DirectiveHandler;
-class Tokenizer;
+class TokenizerBase;
 
 class DirectiveParser : public Lexer
 {
   public:
-    DirectiveParser(Tokenizer *tokenizer,
+    DirectiveParser(TokenizerBase *tokenizer,
                     MacroSet *macroSet,
                     Diagnostics *diagnostics,
                     DirectiveHandler *directiveHandler);
@@ -73,7 +73,7 @@ class DirectiveParser : public Lexer
     bool mSeenNonPreprocessorToken; // Tracks if a non-preprocessor token has been seen yet.  Some macros, such as
                                     // #extension must be declared before all shader code.
     std::vector<ConditionalBlock> mConditionalStack;
-    Tokenizer *mTokenizer;
+    TokenizerBase *mTokenizer;
     MacroSet *mMacroSet;
     Diagnostics *mDiagnostics;
     DirectiveHandler *mDirectiveHandler;
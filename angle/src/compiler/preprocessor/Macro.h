@@ -7,15 +7,15 @@
 #ifndef COMPILER_PREPROCESSOR_MACRO_H_
 #define COMPILER_PREPROCESSOR_MACRO_H_
 
-#include <map>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
+#include "Token.h"
+
 namespace pp
 {
 
-struct Token;
-
 struct Macro
 {
     enum Type
@@ -29,7 +29,9 @@ struct Macro
     Macro()
         : predefined(false),
           disabled(false),
-          type(kTypeObj)
+          type(kTypeObj),
+          memoGeneration(0),
+          memoMacroFree(false)
     {
     }
     bool equals(const Macro &other) const;
@@ -41,9 +43,72 @@ struct Macro
     std::string name;
     Parameters parameters;
     Replacements replacements;
+
+    // Whether none of the replacement tokens names a macro, as computed by
+    // the MacroExpander for MacroSet::generation() == memoGeneration. The
+    // expansion of such an object-like macro is final and is not rescanned.
+    mutable unsigned int memoGeneration;
+    mutable bool memoMacroFree;
 };
 
-typedef std::map<std::string, Macro> MacroSet;
+// Hashed table of the defined macros. Every change to the set bumps the
+// generation, which invalidates the expansion memos on the Macros.
+class MacroSet
+{
+  public:
+    typedef std::unordered_map<std::string, Macro> Map;
+    typedef Map::value_type value_type;
+    typedef Map::iterator iterator;
+    typedef Map::const_iterator const_iterator;
+
+    MacroSet()
+        : mGeneration(1)
+    {
+    }
+
+    iterator find(const std::string &name)
+    {
+        return mMacros.find(name);
+    }
+    const_iterator find(const std::string &name) const
+    {
+        return mMacros.find(name);
+    }
+    iterator end()
+    {
+        return mMacros.end();
+    }
+    const_iterator end() const
+    {
+        return mMacros.end();
+    }
+
+    std::pair<iterator, bool> insert(const value_type &value)
+    {
+        ++mGeneration;
+        return mMacros.insert(value);
+    }
+    void erase(iterator iter)
+    {
+        ++mGeneration;
+        mMacros.erase(iter);
+    }
+    // The caller may modify the returned macro, so this counts as a change.
+    Macro &operator[](const std::string &name)
+    {
+        ++mGeneration;
+        return mMacros[name];
+    }
+
+    unsigned int generation() const
+    {
+        return mGeneration;
+    }
+
+  private:
+    Map mMacros;
+    unsigned int mGeneration;
+};
 
 }  // namespace pp
 
@@ -20,15 +20,15 @@ class TokenLexer : public Lexer
  public:
     typedef std::vector<Token> TokenVector;
 
-    TokenLexer(TokenVector *tokens)
+    TokenLexer(const TokenVector *tokens)
+        : mIter(tokens->begin()),
+          mEnd(tokens->end())
     {
-        tokens->swap(mTokens);
-        mIter = mTokens.begin();
     }
 
     virtual void lex(Token *token)
     {
-        if (mIter == mTokens.end())
+        if (mIter == mEnd)
         {
             token->reset();
             token->type = Token::LAST;
@@ -42,16 +42,83 @@ class TokenLexer : public Lexer
  private:
     PP_DISALLOW_COPY_AND_ASSIGN(TokenLexer);
 
-    TokenVector mTokens;
     TokenVector::const_iterator mIter;
+    TokenVector::const_iterator mEnd;
 };
 
+MacroExpander::BufferPool::BufferPool()
+{
+}
+
+MacroExpander::BufferPool::~BufferPool()
+{
+    for (std::size_t i = 0; i < mContexts.size(); ++i)
+    {
+        delete mContexts[i];
+    }
+    for (std::size_t i = 0; i < mArgs.size(); ++i)
+    {
+        delete mArgs[i];
+    }
+}
+
+MacroExpander::MacroContext *MacroExpander::BufferPool::acquireContext()
+{
+    if (mContexts.empty())
+        return new MacroContext;
+
+    MacroContext *context = mContexts.back();
+    mContexts.pop_back();
+    return context;
+}
+
+void MacroExpander::BufferPool::releaseContext(MacroContext *context)
+{
+    context->macro = 0;
+    context->index = 0;
+    context->replacements.clear();
+    context->rescan = true;
+    assert(context->args.empty());
+    mContexts.push_back(context);
+}
+
+MacroExpander::MacroArg *MacroExpander::BufferPool::acquireArg()
+{
+    if (mArgs.empty())
+        return new MacroArg;
+
+    MacroArg *arg = mArgs.back();
+    mArgs.pop_back();
+    return arg;
+}
+
+void MacroExpander::BufferPool::releaseArg(MacroArg *arg)
+{
+    arg->clear();
+    mArgs.push_back(arg);
+}
+
 MacroExpander::MacroExpander(Lexer *lexer,
                              MacroSet *macroSet,
                              Diagnostics *diagnostics)
     : mLexer(lexer),
       mMacroSet(macroSet),
-      mDiagnostics(diagnostics)
+      mDiagnostics(diagnostics),
+      mOwnedPool(new BufferPool),
+      mPool(mOwnedPool.get()),
+      mHasReserveToken(false)
+{
+}
+
+MacroExpander::MacroExpander(Lexer *lexer,
+                             MacroSet *macroSet,
+                             Diagnostics *diagnostics,
+                             BufferPool *pool)
+    : mLexer(lexer),
+      mMacroSet(macroSet),
+      mDiagnostics(diagnostics),
+      mPool(pool),
+      mHasReserveToken(false)
 {
 }
 
@@ -59,7 +126,7 @@ MacroExpander::~MacroExpander()
 {
     for (std::size_t i = 0; i < mContextStack.size(); ++i)
     {
-        delete mContextStack[i];
+        mPool->releaseContext(mContextStack[i]);
     }
 }
 
@@ -75,6 +142,10 @@ void MacroExpander::lex(Token *token)
         if (token->expansionDisabled())
             break;
 
+        // The expansion of a macro-free object-like macro is final.
+        if (!mContextStack.empty() && !mContextStack.back()->rescan)
+            break;
+
         MacroSet::const_iterator iter = mMacroSet->find(token->text);
         if (iter == mMacroSet->end())
             break;
@@ -99,10 +170,10 @@ void MacroExpander::lex(Token *token)
 
 void MacroExpander::getToken(Token *token)
 {
-    if (mReserveToken.get())
+    if (mHasReserveToken)
     {
-        *token = *mReserveToken;
-        mReserveToken.reset();
+        *token = mReserveToken;
+        mHasReserveToken = false;
         return;
     }
 
@@ -132,8 +203,9 @@ void MacroExpander::ungetToken(const Token &token)
     }
     else
     {
-        assert(!mReserveToken.get());
-        mReserveToken.reset(new Token(token));
+        assert(!mHasReserveToken);
+        mReserveToken = token;
+        mHasReserveToken = true;
     }
 }
 
@@ -155,16 +227,18 @@ bool MacroExpander::pushMacro(const Macro &macro, const Token &identifier)
     assert(identifier.type == Token::IDENTIFIER);
     assert(identifier.text == macro.name);
 
-    std::vector<Token> replacements;
-    if (!expandMacro(macro, identifier, &replacements))
+    MacroContext *context = mPool->acquireContext();
+    if (!expandMacro(macro, identifier, context))
+    {
+        mPool->releaseContext(context);
         return false;
+    }
 
     // Macro is disabled for expansion until it is popped off the stack.
     macro.disabled = true;
 
-    MacroContext *context = new MacroContext;
     context->macro = &macro;
-    context->replacements.swap(replacements);
+    context->rescan = (macro.type != Macro::kTypeObj) || !isMacroFree(macro);
     mContextStack.push_back(context);
     return true;
 }
@@ -179,14 +253,15 @@ void MacroExpander::popMacro()
     assert(context->empty());
     assert(context->macro->disabled);
     context->macro->disabled = false;
-    delete context;
+    mPool->releaseContext(context);
 }
 
 bool MacroExpander::expandMacro(const Macro &macro,
                                 const Token &identifier,
-                                std::vector<Token> *replacements)
+                                MacroContext *context)
 {
-    replacements->clear();
+    std::vector<Token> *replacements = &context->replacements;
+    assert(replacements->empty());
     if (macro.type == Macro::kTypeObj)
     {
         replacements->assign(macro.replacements.begin(),
@@ -216,12 +291,14 @@ bool MacroExpander::expandMacro(const Macro &macro,
     else
     {
         assert(macro.type == Macro::kTypeFunc);
-        std::vector<MacroArg> args;
-        args.reserve(macro.parameters.size());
-        if (!collectMacroArgs(macro, identifier, &args))
-            return false;
+        std::vector<MacroArg *> *args = &context->args;
+        bool collected = collectMacroArgs(macro, identifier, args);
+        if (collected)
+            replaceMacroParams(macro, *args, replacements);
 
-        replaceMacroParams(macro, args, replacements);
+        releaseMacroArgs(args);
+        if (!collected)
+            return false;
     }
 
     for (std::size_t i = 0; i < replacements->size(); ++i)
@@ -241,13 +318,13 @@ bool MacroExpander::expandMacro(const Macro &macro,
 
 bool MacroExpander::collectMacroArgs(const Macro &macro,
                                      const Token &identifier,
-                                     std::vector<MacroArg> *args)
+                                     std::vector<MacroArg *> *args)
 {
     Token token;
     getToken(&token);
     assert(token.type == '(');
 
-    args->push_back(MacroArg());
+    args->push_back(mPool->acquireArg());
     for (int openParens = 1; openParens != 0; )
     {
         getToken(&token);
@@ -277,7 +354,7 @@ bool MacroExpander::collectMacroArgs(const Macro &macro,
             // the comma tokens between matching inner parentheses do not
             // seperate arguments.
             if (openParens == 1)
-                args->push_back(MacroArg());
+                args->push_back(mPool->acquireArg());
             isArg = openParens != 1;
             break;
           default:
@@ -286,19 +363,19 @@ bool MacroExpander::collectMacroArgs(const Macro &macro,
         }
         if (isArg)
         {
-            MacroArg &arg = args->back();
+            MacroArg *arg = args->back();
             // Initial whitespace is not part of the argument.
-            if (arg.empty())
+            if (arg->empty())
                 token.setHasLeadingSpace(false);
-            arg.push_back(token);
+            arg->push_back(token);
         }
     }
 
     const Macro::Parameters &params = macro.parameters;
     // If there is only one empty argument, it is equivalent to no argument.
-    if (params.empty() && (args->size() == 1) && args->front().empty())
+    if (params.empty() && (args->size() == 1) && args->front()->empty())
     {
-        args->clear();
+        releaseMacroArgs(args);
     }
     // Validate the number of arguments.
     if (args->size() != params.size())
@@ -315,23 +392,27 @@ bool MacroExpander::collectMacroArgs(const Macro &macro,
     // inserted into the macro body.
     for (std::size_t i = 0; i < args->size(); ++i)
     {
-        MacroArg &arg = args->at(i);
-        TokenLexer lexer(&arg);
-        MacroExpander expander(&lexer, mMacroSet, mDiagnostics);
-
-        arg.clear();
-        expander.lex(&token);
-        while (token.type != Token::LAST)
+        MacroArg *arg = args->at(i);
+        MacroArg *expanded = mPool->acquireArg();
         {
-            arg.push_back(token);
+            TokenLexer lexer(arg);
+            MacroExpander expander(&lexer, mMacroSet, mDiagnostics, mPool);
+
             expander.lex(&token);
+            while (token.type != Token::LAST)
+            {
+                expanded->push_back(token);
+                expander.lex(&token);
+            }
         }
+        mPool->releaseArg(arg);
+        args->at(i) = expanded;
     }
     return true;
 }
 
 void MacroExpander::replaceMacroParams(const Macro &macro,
-                                       const std::vector<MacroArg> &args,
+                                       const std::vector<MacroArg *> &args,
                                        std::vector<Token> *replacements)
 {
     for (std::size_t i = 0; i < macro.replacements.size(); ++i)
@@ -355,7 +436,7 @@ void MacroExpander::replaceMacroParams(const Macro &macro,
         }
 
         std::size_t iArg = std::distance(macro.parameters.begin(), iter);
-        const MacroArg &arg = args[iArg];
+        const MacroArg &arg = *args[iArg];
         if (arg.empty())
         {
             continue;
@@ -368,5 +449,37 @@ void MacroExpander::replaceMacroParams(const Macro &macro,
     }
 }
 
+void MacroExpander::releaseMacroArgs(std::vector<MacroArg *> *args)
+{
+    for (std::size_t i = 0; i < args->size(); ++i)
+    {
+        mPool->releaseArg(args->at(i));
+    }
+    args->clear();
+}
+
+bool MacroExpander::isMacroFree(const Macro &macro) const
+{
+    assert(macro.type == Macro::kTypeObj);
+    if (macro.memoGeneration == mMacroSet->generation())
+        return macro.memoMacroFree;
+
+    bool macroFree = true;
+    for (std::size_t i = 0; i < macro.replacements.size(); ++i)
+    {
+        const Token &repl = macro.replacements[i];
+        if ((repl.type == Token::IDENTIFIER) &&
+            (mMacroSet->find(repl.text) != mMacroSet->end()))
+        {
+            macroFree = false;
+            break;
+        }
+    }
+
+    macro.memoGeneration = mMacroSet->generation();
+    macro.memoMacroFree = macroFree;
+    return macroFree;
+}
+
 }  // namespace pp
 
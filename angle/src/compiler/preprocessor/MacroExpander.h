@@ -13,6 +13,7 @@
 
 #include "Lexer.h"
 #include "Macro.h"
+#include "Token.h"
 #include "pp_utils.h"
 
 namespace pp
@@ -31,6 +32,35 @@ class MacroExpander : public Lexer
   private:
     PP_DISALLOW_COPY_AND_ASSIGN(MacroExpander);
 
+    struct MacroContext;
+    typedef std::vector<Token> MacroArg;
+
+    // Recycles macro contexts and argument buffers together with the
+    // capacity of their token vectors, so that expanding the same macros
+    // over and over does not allocate. Shared with the expanders created
+    // to pre-expand macro arguments.
+    class BufferPool
+    {
+      public:
+        BufferPool();
+        ~BufferPool();
+
+        MacroContext *acquireContext();
+        void releaseContext(MacroContext *context);
+
+        MacroArg *acquireArg();
+        void releaseArg(MacroArg *arg);
+
+      private:
+        PP_DISALLOW_COPY_AND_ASSIGN(BufferPool);
+
+        std::vector<MacroContext *> mContexts;
+        std::vector<MacroArg *> mArgs;
+    };
+
+    MacroExpander(Lexer *lexer, MacroSet *macroSet, Diagnostics *diagnostics,
+                  BufferPool *pool);
+
     void getToken(Token *token);
     void ungetToken(const Token &token);
     bool isNextTokenLeftParen();
@@ -40,25 +70,35 @@ class MacroExpander : public Lexer
 
     bool expandMacro(const Macro &macro,
                      const Token &identifier,
-                     std::vector<Token> *replacements);
+                     MacroContext *context);
 
-    typedef std::vector<Token> MacroArg;
     bool collectMacroArgs(const Macro &macro,
                           const Token &identifier,
-                          std::vector<MacroArg> *args);
+                          std::vector<MacroArg *> *args);
     void replaceMacroParams(const Macro &macro,
-                            const std::vector<MacroArg> &args,
+                            const std::vector<MacroArg *> &args,
                             std::vector<Token> *replacements);
+    void releaseMacroArgs(std::vector<MacroArg *> *args);
+
+    // Returns true if no token in the replacement list of the object-like
+    // macro names a macro, memoized on the macro.
+    bool isMacroFree(const Macro &macro) const;
 
     struct MacroContext
     {
         const Macro *macro;
         std::size_t index;
         std::vector<Token> replacements;
+        // False if the replacements cannot contain macro names, so that the
+        // tokens do not need to be looked up again.
+        bool rescan;
+        // Arguments of the function-like macro being expanded.
+        std::vector<MacroArg *> args;
 
         MacroContext()
             : macro(0),
-              index(0)
+              index(0),
+              rescan(true)
         {
         }
         bool empty() const
@@ -80,7 +120,11 @@ class MacroExpander : public Lexer
     MacroSet *mMacroSet;
     Diagnostics *mDiagnostics;
 
-    std::auto_ptr<Token> mReserveToken;
+    std::auto_ptr<BufferPool> mOwnedPool;
+    BufferPool *mPool;
+
+    bool mHasReserveToken;
+    Token mReserveToken;
     std::vector<MacroContext *> mContextStack;
 };
 
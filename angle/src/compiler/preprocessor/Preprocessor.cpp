@@ -11,10 +11,10 @@
 
 #include "DiagnosticsBase.h"
 #include "DirectiveParser.h"
+#include "DirectTokenizer.h"
 #include "Macro.h"
 #include "MacroExpander.h"
 #include "Token.h"
-#include "Tokenizer.h"
 
 namespace pp
 {
@@ -23,7 +23,7 @@ struct PreprocessorImpl
 {
     Diagnostics *diagnostics;
     MacroSet macroSet;
-    Tokenizer tokenizer;
+    DirectTokenizer tokenizer;
     DirectiveParser directiveParser;
     MacroExpander macroExpander;
 
@@ -8,7 +8,7 @@
 #define COMPILER_PREPROCESSOR_TOKENIZER_H_
 
 #include "Input.h"
-#include "Lexer.h"
+#include "TokenizerBase.h"
 #include "pp_utils.h"
 
 namespace pp
@@ -16,7 +16,9 @@ namespace pp
 
 class Diagnostics;
 
-class Tokenizer : public Lexer
+// Flex-generated tokenizer. See DirectTokenizer for the hand-written
+// equivalent used by the Preprocessor.
+class Tokenizer : public TokenizerBase
 {
   public:
     struct Context
@@ -36,11 +38,11 @@ class Tokenizer : public Lexer
     Tokenizer(Diagnostics *diagnostics);
     ~Tokenizer();
 
-    bool init(size_t count, const char * const string[], const int length[]);
+    virtual bool init(size_t count, const char * const string[], const int length[]);
 
-    void setFileNumber(int file);
-    void setLineNumber(int line);
-    void setMaxTokenSize(size_t maxTokenSize);
+    virtual void setFileNumber(int file);
+    virtual void setLineNumber(int line);
+    virtual void setMaxTokenSize(size_t maxTokenSize);
 
     virtual void lex(Token *token);
 
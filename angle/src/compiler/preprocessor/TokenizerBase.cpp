@@ -0,0 +1,16 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#include "TokenizerBase.h"
+
+namespace pp
+{
+
+TokenizerBase::~TokenizerBase()
+{
+}
+
+}  // namespace pp
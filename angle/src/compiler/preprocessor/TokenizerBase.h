@@ -0,0 +1,34 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+#ifndef COMPILER_PREPROCESSOR_TOKENIZERBASE_H_
+#define COMPILER_PREPROCESSOR_TOKENIZERBASE_H_
+
+#include <stddef.h>
+
+#include "Lexer.h"
+
+namespace pp
+{
+
+// Base class for lexers that produce preprocessing tokens from the shader
+// source strings. The DirectiveParser drives one of these and adjusts its
+// location for #line directives.
+class TokenizerBase : public Lexer
+{
+  public:
+    virtual ~TokenizerBase();
+
+    virtual bool init(size_t count, const char * const string[], const int length[]) = 0;
+
+    virtual void setFileNumber(int file) = 0;
+    virtual void setLineNumber(int line) = 0;
+    virtual void setMaxTokenSize(size_t maxTokenSize) = 0;
+};
+
+}  // namespace pp
+
+#endif  // COMPILER_PREPROCESSOR_TOKENIZERBASE_H_
@@ -53,6 +53,9 @@ public:
     virtual TranslatorHLSL* getAsTranslatorHLSL() { return 0; }
 #endif // ANGLE_ENABLE_HLSL
 
+    // Exposed for memory statistics in tests.
+    const TPoolAllocator &getAllocator() const { return allocator; }
+
 protected:
     // Memory allocator. Allocates and tracks memory required by the compiler.
     // Deallocates all memory when compiler is destructed.
@@ -1186,11 +1186,13 @@ TString TOutputGLSLBase::hashName(const TString &name)
 {
     if (mHashFunction == NULL || name.empty())
         return name;
-    NameMap::const_iterator it = mNameMap.find(name.c_str());
-    if (it != mNameMap.end())
+    // Find the name and the place to insert it with a single lookup.
+    TPersistString key(name.c_str(), name.length());
+    NameMap::iterator it = mNameMap.lower_bound(key);
+    if (it != mNameMap.end() && it->first == key)
         return it->second.c_str();
     TString hashedName = TIntermTraverser::hash(name, mHashFunction);
-    mNameMap[name.c_str()] = hashedName.c_str();
+    mNameMap.insert(it, NameMap::value_type(key, hashedName.c_str()));
     return hashedName;
 }
 
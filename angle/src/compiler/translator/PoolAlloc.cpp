@@ -56,7 +56,9 @@ TPoolAllocator::TPoolAllocator(int growthIncrement, int allocationAlignment) :
     freeList(0),
     inUseList(0),
     numCalls(0),
-    totalBytes(0)
+    totalBytes(0),
+    bytesInUse(0),
+    peakBytesInUse(0)
 {
     //
     // Don't allow page sizes we know are smaller than all common
@@ -182,6 +184,7 @@ void TPoolAllocator::pop()
         inUseList->~tHeader();
         
         tHeader* nextInUse = inUseList->nextPage;
+        bytesInUse -= inUseList->pageCount * pageSize;
         if (inUseList->pageCount > 1)
             delete [] reinterpret_cast<char*>(inUseList);
         else {
@@ -254,6 +257,7 @@ void* TPoolAllocator::allocate(size_t numBytes)
         // Use placement-new to initialize header
         new(memory) tHeader(inUseList, (numBytesToAlloc + pageSize - 1) / pageSize);
         inUseList = memory;
+        trackPageInUse(inUseList->pageCount);
 
         currentPageOffset = pageSize;  // make next allocation come from a new page
 
@@ -277,6 +281,7 @@ void* TPoolAllocator::allocate(size_t numBytes)
     // Use placement-new to initialize header
     new(memory) tHeader(inUseList, 1);
     inUseList = memory;
+    trackPageInUse(1);
     
     unsigned char* ret = reinterpret_cast<unsigned char *>(inUseList) + headerSkip;
     currentPageOffset = (headerSkip + allocationSize + alignmentMask) & ~alignmentMask;
@@ -145,6 +145,13 @@ public:
     //
     void* allocate(size_t numBytes);
 
+    //
+    // Memory currently obtained from the OS for in-use pages, and the high
+    // water mark of that since the allocator was created.
+    //
+    size_t getBytesInUse() const { return bytesInUse; }
+    size_t getPeakBytesInUse() const { return peakBytesInUse; }
+
     //
     // There is no deallocate.  The point of this class is that
     // deallocation can be skipped by the user of it, as the model
@@ -194,6 +201,12 @@ protected:
         return TAllocation::offsetAllocation(memory);
     }
 
+    void trackPageInUse(size_t pageCount) {
+        bytesInUse += pageCount * pageSize;
+        if (bytesInUse > peakBytesInUse)
+            peakBytesInUse = bytesInUse;
+    }
+
     size_t pageSize;        // granularity of allocation from the OS
     size_t alignment;       // all returned allocations will be aligned at 
                             // this granularity, which will be a power of 2
@@ -208,6 +221,8 @@ protected:
 
     int numCalls;           // just an interesting statistic
     size_t totalBytes;      // just an interesting statistic
+    size_t bytesInUse;      // size of the pages on inUseList
+    size_t peakBytesInUse;  // high water mark of bytesInUse
 private:
     TPoolAllocator& operator=(const TPoolAllocator&);  // dont allow assignment operator
     TPoolAllocator(const TPoolAllocator&);  // dont allow default copy constructor
@@ -34,8 +34,8 @@ TFunction::~TFunction()
 //
 TSymbolTableLevel::~TSymbolTableLevel()
 {
-    for (tLevel::iterator it = level.begin(); it != level.end(); ++it)
-        delete (*it).second;
+    for (EntryList::iterator it = mEntries.begin(); it != mEntries.end(); ++it)
+        delete it->symbol;
 }
 
 bool TSymbolTableLevel::insert(TSymbol *symbol)
@@ -43,9 +43,7 @@ bool TSymbolTableLevel::insert(TSymbol *symbol)
     symbol->setUniqueId(TSymbolTable::nextUniqueId());
 
     // returning true means symbol was added to the table
-    tInsertResult result = level.insert(tLevelPair(symbol->getMangledName(), symbol));
-
-    return result.second;
+    return insert(symbol->getMangledName(), symbol);
 }
 
 bool TSymbolTableLevel::insertUnmangled(TFunction *function)
@@ -53,23 +51,75 @@ bool TSymbolTableLevel::insertUnmangled(TFunction *function)
     function->setUniqueId(TSymbolTable::nextUniqueId());
 
     // returning true means symbol was added to the table
-    tInsertResult result = level.insert(tLevelPair(function->getName(), function));
+    return insert(function->getName(), function);
+}
+
+bool TSymbolTableLevel::insert(const TString &name, TSymbol *symbol)
+{
+    // Keep the load factor at or below 3/4.
+    if ((mCount + 1) * 4 > mEntries.size() * 3)
+        grow();
+
+    TSymbolKey key(name);
+    size_t mask = mEntries.size() - 1;
+    for (size_t index = key.getHash() & mask; ; index = (index + 1) & mask)
+    {
+        Entry &entry = mEntries[index];
+        if (entry.symbol == NULL)
+        {
+            entry.hash = key.getHash();
+            entry.name = name;
+            entry.symbol = symbol;
+            ++mCount;
+            return true;
+        }
+        if (entry.hash == key.getHash() && entry.name == name)
+            return false;
+    }
+}
+
+void TSymbolTableLevel::grow()
+{
+    Entry empty = { 0, TString(), NULL };
+    EntryList entries;
+    entries.resize(mEntries.empty() ? 16 : mEntries.size() * 2, empty);
 
-    return result.second;
+    size_t mask = entries.size() - 1;
+    for (EntryList::iterator it = mEntries.begin(); it != mEntries.end(); ++it)
+    {
+        if (it->symbol == NULL)
+            continue;
+
+        size_t index = it->hash & mask;
+        while (entries[index].symbol != NULL)
+            index = (index + 1) & mask;
+        entries[index].hash = it->hash;
+        entries[index].name.swap(it->name);
+        entries[index].symbol = it->symbol;
+    }
+    mEntries.swap(entries);
 }
 
-TSymbol *TSymbolTableLevel::find(const TString &name) const
+TSymbol *TSymbolTableLevel::find(const TSymbolKey &key) const
 {
-    tLevel::const_iterator it = level.find(name);
-    if (it == level.end())
+    if (mCount == 0)
         return 0;
-    else
-        return (*it).second;
+
+    size_t mask = mEntries.size() - 1;
+    for (size_t index = key.getHash() & mask; ; index = (index + 1) & mask)
+    {
+        const Entry &entry = mEntries[index];
+        if (entry.symbol == NULL)
+            return 0;
+        if (entry.hash == key.getHash() && entry.name == key.getName())
+            return entry.symbol;
+    }
 }
 
 TSymbol *TSymbolTable::find(const TString &name, int shaderVersion,
                             bool *builtIn, bool *sameScope) const
 {
+    TSymbolKey key(name);
     int level = currentLevel();
     TSymbol *symbol;
 
@@ -80,7 +130,7 @@ TSymbol *TSymbolTable::find(const TString &name, int shaderVersion,
         if (level == ESSL1_BUILTINS && shaderVersion != 100)
             level--;
 
-        symbol = table[level]->find(name);
+        symbol = table[level]->find(key);
     }
     while (symbol == 0 && --level >= 0);
 
@@ -95,6 +145,7 @@ TSymbol *TSymbolTable::find(const TString &name, int shaderVersion,
 TSymbol *TSymbolTable::findBuiltIn(
     const TString &name, int shaderVersion) const
 {
+    TSymbolKey key(name);
     for (int level = LAST_BUILTIN_LEVEL; level >= 0; level--)
     {
         if (level == ESSL3_BUILTINS && shaderVersion != 300)
@@ -102,7 +153,7 @@ TSymbol *TSymbolTable::findBuiltIn(
         if (level == ESSL1_BUILTINS && shaderVersion != 100)
             level--;
 
-        TSymbol *symbol = table[level]->find(name);
+        TSymbol *symbol = table[level]->find(key);
 
         if (symbol)
             return symbol;
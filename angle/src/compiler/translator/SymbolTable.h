@@ -37,6 +37,44 @@
 #include "compiler/translator/InfoSink.h"
 #include "compiler/translator/IntermNode.h"
 
+// A symbol table key: a name together with its hash. Lookups hash the name
+// once and reuse the hash at every level of the table, where the hash is
+// compared before the characters are.
+class TSymbolKey
+{
+  public:
+    explicit TSymbolKey(const TString &name)
+        : mName(&name),
+          mHash(Hash(name.c_str(), name.length()))
+    {
+    }
+
+    const TString &getName() const
+    {
+        return *mName;
+    }
+    size_t getHash() const
+    {
+        return mHash;
+    }
+
+    // FNV-1a.
+    static size_t Hash(const char *name, size_t length)
+    {
+        size_t hash = static_cast<size_t>(2166136261u);
+        for (size_t i = 0; i < length; ++i)
+        {
+            hash ^= static_cast<unsigned char>(name[i]);
+            hash *= static_cast<size_t>(16777619u);
+        }
+        return hash;
+    }
+
+  private:
+    const TString *mName;
+    size_t mHash;
+};
+
 // Symbol base class. (Can build functions or variables out of these...)
 class TSymbol : angle::NonCopyable
 {
@@ -209,7 +247,7 @@ class TFunction : public TSymbol
     void addParameter(TParameter &p)
     { 
         parameters.push_back(p);
-        mangledName = mangledName + p.type->getMangledName();
+        mangledName += p.type->getMangledName();
     }
 
     const TString &getMangledName() const
@@ -270,12 +308,8 @@ class TInterfaceBlockName : public TSymbol
 class TSymbolTableLevel
 {
   public:
-    typedef TMap<TString, TSymbol *> tLevel;
-    typedef tLevel::const_iterator const_iterator;
-    typedef const tLevel::value_type tLevelPair;
-    typedef std::pair<tLevel::iterator, bool> tInsertResult;
-
     TSymbolTableLevel()
+        : mCount(0)
     {
     }
     ~TSymbolTableLevel();
@@ -285,10 +319,30 @@ class TSymbolTableLevel
     // Insert a function using its unmangled name as the key.
     bool insertUnmangled(TFunction *function);
 
-    TSymbol *find(const TString &name) const;
+    TSymbol *find(const TString &name) const
+    {
+        return find(TSymbolKey(name));
+    }
+    TSymbol *find(const TSymbolKey &key) const;
 
   protected:
-    tLevel level;
+    // Open addressing with linear probing. Symbols are never removed from a
+    // level; the whole level goes away when its scope is popped. The key is
+    // a copy of the name, since a function's mangled name still changes
+    // when parameters are added to it after it has been inserted.
+    struct Entry
+    {
+        size_t hash;
+        TString name;
+        TSymbol *symbol;
+    };
+    typedef TVector<Entry> EntryList;
+
+    bool insert(const TString &name, TSymbol *symbol);
+    void grow();
+
+    EntryList mEntries;
+    size_t mCount;
 };
 
 // Define ESymbolLevel as int rather than an enum since level can go
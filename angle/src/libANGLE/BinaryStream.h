@@ -14,6 +14,7 @@
 
 #include <cstddef>
 #include <string>
+#include <type_traits>
 #include <vector>
 #include <stdint.h>
 
@@ -29,9 +30,22 @@ void StaticAssertIsFundamental()
 #endif
 }
 
+template <typename T>
+void StaticAssertIsTriviallyCopyable()
+{
+    // c++11 STL is not available on OSX or Android
+#if !defined(ANGLE_PLATFORM_APPLE) && !defined(ANGLE_PLATFORM_ANDROID)
+    static_assert(std::is_trivially_copyable<T>::value, "T must be trivially copyable.");
+#endif
+}
+
 namespace gl
 {
 
+// Arrays of fixed-size records start at this alignment from the beginning of the stream, so that
+// a binary loaded at an aligned address, such as a mapped file, can be read in place.
+const size_t BinaryArrayAlignment = 8;
+
 class BinaryInputStream : angle::NonCopyable
 {
   public:
@@ -102,6 +116,45 @@ class BinaryInputStream : angle::NonCopyable
         mOffset += length;
     }
 
+    // Reads an array written by BinaryOutputStream::writeArray with a single copy.
+    template <typename T>
+    void readArray(std::vector<T> *outValues)
+    {
+        size_t count = 0;
+        const uint8_t *values = readArrayBytes<T>(&count);
+        if (mError)
+        {
+            return;
+        }
+
+        outValues->resize(count);
+        if (count > 0)
+        {
+            memcpy(&(*outValues)[0], values, count * sizeof(T));
+        }
+    }
+
+    // Returns a pointer into the stream to an array written by BinaryOutputStream::writeArray,
+    // or null if the stream is invalid or the array is not aligned well enough to be used there.
+    template <typename T>
+    const T *readArrayInPlace(size_t *countOut)
+    {
+        const uint8_t *values = readArrayBytes<T>(countOut);
+        if (mError || reinterpret_cast<uintptr_t>(values) % std::alignment_of<T>::value != 0)
+        {
+            return nullptr;
+        }
+        return reinterpret_cast<const T *>(values);
+    }
+
+    // Returns a pointer to the next length bytes of the stream and skips over them.
+    const uint8_t *readBytesInPlace(size_t length)
+    {
+        const uint8_t *bytes = mData + mOffset;
+        skip(length);
+        return mError ? nullptr : bytes;
+    }
+
     void skip(size_t length)
     {
         if (mOffset + length > mLength)
@@ -139,6 +192,25 @@ class BinaryInputStream : angle::NonCopyable
     const uint8_t *mData;
     size_t mLength;
 
+    template <typename T>
+    const uint8_t *readArrayBytes(size_t *countOut)
+    {
+        StaticAssertIsTriviallyCopyable<T>();
+
+        *countOut = readInt<size_t>();
+        skip(rx::roundUp(mOffset, BinaryArrayAlignment) - mOffset);
+        if (mError || *countOut > (mLength - mOffset) / sizeof(T))
+        {
+            mError = true;
+            *countOut = 0;
+            return nullptr;
+        }
+
+        const uint8_t *bytes = mData + mOffset;
+        mOffset += *countOut * sizeof(T);
+        return bytes;
+    }
+
     template <typename T>
     void read(T *v, size_t num)
     {
@@ -191,6 +263,20 @@ class BinaryOutputStream : angle::NonCopyable
         write(bytes, count);
     }
 
+    // Writes an array of fixed-size records as one aligned block. See BinaryInputStream::readArray
+    // and BinaryInputStream::readArrayInPlace.
+    template <typename T>
+    void writeArray(const T *values, size_t count)
+    {
+        StaticAssertIsTriviallyCopyable<T>();
+
+        writeInt(count);
+        mData.resize(rx::roundUp(mData.size(), BinaryArrayAlignment), 0);
+
+        const char *asBytes = reinterpret_cast<const char *>(values);
+        mData.insert(mData.end(), asBytes, asBytes + count * sizeof(T));
+    }
+
     size_t length() const
     {
         return mData.size();
@@ -9,12 +9,19 @@
 // [OpenGL ES 2.0.24] section 2.9 page 21.
 
 #include "libANGLE/Buffer.h"
+#include "libANGLE/formatutils.h"
 #include "libANGLE/renderer/BufferImpl.h"
 #include "libANGLE/renderer/Renderer.h"
 
+#include <algorithm>
+
 namespace gl
 {
 
+// Index ranges spanning fewer blocks than this are cheaper to compute directly than through the
+// block summary, which also reads the partial blocks at both ends.
+static const size_t MinIndexRangeSummaryBlocks = 4;
+
 Buffer::Buffer(rx::BufferImpl *impl, GLuint id)
     : RefCountObject(id),
       mBuffer(impl),
@@ -43,8 +50,14 @@ Error Buffer::bufferData(const void *data, GLsizeiptr size, GLenum usage)
     }
 
     mIndexRangeCache.clear();
+    mIndexRangeSummary.clear();
     mUsage = usage;
-    mSize = size;
+
+    if (mSize != size)
+    {
+        mSize = size;
+        notifyStateChange();
+    }
 
     return error;
 }
@@ -58,6 +71,7 @@ Error Buffer::bufferSubData(const void *data, GLsizeiptr size, GLintptr offset)
     }
 
     mIndexRangeCache.invalidateRange(static_cast<unsigned int>(offset), static_cast<unsigned int>(size));
+    mIndexRangeSummary.invalidateRange(static_cast<size_t>(offset), static_cast<size_t>(size));
 
     return error;
 }
@@ -71,6 +85,7 @@ Error Buffer::copyBufferSubData(Buffer* source, GLintptr sourceOffset, GLintptr
     }
 
     mIndexRangeCache.invalidateRange(static_cast<unsigned int>(destOffset), static_cast<unsigned int>(size));
+    mIndexRangeSummary.invalidateRange(static_cast<size_t>(destOffset), static_cast<size_t>(size));
 
     return error;
 }
@@ -94,6 +109,8 @@ Error Buffer::map(GLenum access)
     mAccess = access;
     mAccessFlags = GL_MAP_WRITE_BIT;
     mIndexRangeCache.clear();
+    mIndexRangeSummary.clear();
+    notifyStateChange();
 
     return error;
 }
@@ -124,8 +141,11 @@ Error Buffer::mapRange(GLintptr offset, GLsizeiptr length, GLbitfield access)
     if ((access & GL_MAP_WRITE_BIT) > 0)
     {
         mIndexRangeCache.invalidateRange(static_cast<unsigned int>(offset), static_cast<unsigned int>(length));
+        mIndexRangeSummary.invalidateRange(static_cast<size_t>(offset), static_cast<size_t>(length));
     }
 
+    notifyStateChange();
+
     return error;
 }
 
@@ -146,6 +166,7 @@ Error Buffer::unmap(GLboolean *result)
     mMapLength = 0;
     mAccess = GL_WRITE_ONLY_OES;
     mAccessFlags = 0;
+    notifyStateChange();
 
     return error;
 }
@@ -153,11 +174,13 @@ Error Buffer::unmap(GLboolean *result)
 void Buffer::onTransformFeedback()
 {
     mIndexRangeCache.clear();
+    mIndexRangeSummary.clear();
 }
 
 void Buffer::onPixelUnpack()
 {
     mIndexRangeCache.clear();
+    mIndexRangeSummary.clear();
 }
 
 Error Buffer::getIndexRange(GLenum type, size_t offset, size_t count, gl::RangeUI *outRange) const
@@ -167,7 +190,7 @@ Error Buffer::getIndexRange(GLenum type, size_t offset, size_t count, gl::RangeU
         return gl::Error(GL_NO_ERROR);
     }
 
-    Error error = mBuffer->getIndexRange(type, offset, count, outRange);
+    Error error = computeIndexRange(type, offset, count, outRange);
     if (error.isError())
     {
         return error;
@@ -178,4 +201,78 @@ Error Buffer::getIndexRange(GLenum type, size_t offset, size_t count, gl::RangeU
     return Error(GL_NO_ERROR);
 }
 
+Error Buffer::computeIndexRange(GLenum type, size_t offset, size_t count, RangeUI *outRange) const
+{
+    const size_t blockSize = IndexRangeSummary::BlockSize;
+    const size_t indexSize = GetTypeInfo(type).bytes;
+    const size_t end = offset + count * indexSize;
+
+    // The blocks only line up with the indices when the offset is a multiple of the index size
+    if (offset % indexSize != 0 || count * indexSize < MinIndexRangeSummaryBlocks * blockSize)
+    {
+        return mBuffer->getIndexRange(type, offset, count, outRange);
+    }
+
+    if (mIndexRangeSummary.getType() != type)
+    {
+        mIndexRangeSummary.reset(type, static_cast<size_t>(mSize));
+    }
+
+    // Whole blocks come from the summary, the partial blocks at either end are read directly
+    const size_t firstBlock = (offset + blockSize - 1) / blockSize;
+    const size_t lastBlock = std::min(end / blockSize, mIndexRangeSummary.getBlockCount());
+    ASSERT(firstBlock < lastBlock);
+
+    if (mIndexRangeSummary.getDirtyBlockCount() > 0)
+    {
+        for (size_t block = firstBlock; block < lastBlock; block++)
+        {
+            if (!mIndexRangeSummary.isBlockDirty(block))
+            {
+                continue;
+            }
+
+            const size_t blockStart = mIndexRangeSummary.getBlockStart(block);
+            const size_t blockEnd = mIndexRangeSummary.getBlockEnd(block);
+
+            RangeUI blockRange;
+            Error error = mBuffer->getIndexRange(type, blockStart, (blockEnd - blockStart) / indexSize, &blockRange);
+            if (error.isError())
+            {
+                return error;
+            }
+            mIndexRangeSummary.setBlockRange(block, blockRange);
+        }
+    }
+
+    RangeUI range = mIndexRangeSummary.getRange(firstBlock, lastBlock);
+
+    const size_t headEnd = firstBlock * blockSize;
+    if (offset < headEnd)
+    {
+        RangeUI headRange;
+        Error error = mBuffer->getIndexRange(type, offset, (headEnd - offset) / indexSize, &headRange);
+        if (error.isError())
+        {
+            return error;
+        }
+        range = RangeUI(std::min(range.start, headRange.start), std::max(range.end, headRange.end));
+    }
+
+    const size_t tailStart = mIndexRangeSummary.getBlockEnd(lastBlock - 1);
+    if (tailStart < end)
+    {
+        RangeUI tailRange;
+        Error error = mBuffer->getIndexRange(type, tailStart, (end - tailStart) / indexSize, &tailRange);
+        if (error.isError())
+        {
+            return error;
+        }
+        range = RangeUI(std::min(range.start, tailRange.start), std::max(range.end, tailRange.end));
+    }
+
+    *outRange = range;
+    return Error(GL_NO_ERROR);
+}
+
 }
@@ -14,6 +14,8 @@
 #include "common/angleutils.h"
 #include "libANGLE/Error.h"
 #include "libANGLE/IndexRangeCache.h"
+#include "libANGLE/IndexRangeSummary.h"
+#include "libANGLE/Observer.h"
 #include "libANGLE/RefCountObject.h"
 
 namespace rx
@@ -24,7 +26,8 @@ class BufferImpl;
 namespace gl
 {
 
-class Buffer : public RefCountObject
+// Observers are notified when the buffer is resized, mapped or unmapped.
+class Buffer : public RefCountObject, public Subject
 {
   public:
     Buffer(rx::BufferImpl *impl, GLuint id);
@@ -55,6 +58,8 @@ class Buffer : public RefCountObject
     rx::BufferImpl *getImplementation() const { return mBuffer; }
 
   private:
+    Error computeIndexRange(GLenum type, size_t offset, size_t count, RangeUI *outRange) const;
+
     rx::BufferImpl *mBuffer;
 
     GLenum mUsage;
@@ -67,6 +72,7 @@ class Buffer : public RefCountObject
     GLint64 mMapLength;
 
     mutable IndexRangeCache mIndexRangeCache;
+    mutable IndexRangeSummary mIndexRangeSummary;
 };
 
 }
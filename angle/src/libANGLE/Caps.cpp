@@ -5,6 +5,7 @@
 //
 
 #include "libANGLE/Caps.h"
+#include "libANGLE/formatutils.h"
 #include "common/debug.h"
 #include "common/angleutils.h"
 
@@ -58,7 +59,20 @@ GLuint TextureCaps::getNearestSamples(GLuint requestedSamples) const
 
 void TextureCapsMap::insert(GLenum internalFormat, const TextureCaps &caps)
 {
-    mCapsMap.insert(std::make_pair(internalFormat, caps));
+    if (!mCapsMap.insert(std::make_pair(internalFormat, caps)).second)
+    {
+        return;
+    }
+
+    size_t formatIndex = GetInternalFormatIndex(internalFormat);
+    if (formatIndex != InvalidInternalFormatIndex)
+    {
+        if (mIndexedCaps.empty())
+        {
+            mIndexedCaps.resize(GetInternalFormatCount());
+        }
+        mIndexedCaps[formatIndex] = caps;
+    }
 }
 
 void TextureCapsMap::remove(GLenum internalFormat)
@@ -67,12 +81,25 @@ void TextureCapsMap::remove(GLenum internalFormat)
     if (i != mCapsMap.end())
     {
         mCapsMap.erase(i);
+
+        size_t formatIndex = GetInternalFormatIndex(internalFormat);
+        if (formatIndex != InvalidInternalFormatIndex)
+        {
+            mIndexedCaps[formatIndex] = TextureCaps();
+        }
     }
 }
 
 const TextureCaps &TextureCapsMap::get(GLenum internalFormat) const
 {
     static TextureCaps defaultUnsupportedTexture;
+
+    size_t formatIndex = GetInternalFormatIndex(internalFormat);
+    if (formatIndex != InvalidInternalFormatIndex)
+    {
+        return (formatIndex < mIndexedCaps.size()) ? mIndexedCaps[formatIndex] : defaultUnsupportedTexture;
+    }
+
     InternalFormatToCapsMap::const_iterator iter = mCapsMap.find(internalFormat);
     return (iter != mCapsMap.end()) ? iter->second : defaultUnsupportedTexture;
 }
@@ -62,6 +62,9 @@ class TextureCapsMap
   private:
     typedef std::map<GLenum, TextureCaps> InternalFormatToCapsMap;
     InternalFormatToCapsMap mCapsMap;
+
+    // The same caps, indexed by GetInternalFormatIndex so that get() doesn't search the map
+    std::vector<TextureCaps> mIndexedCaps;
 };
 
 struct Extensions
@@ -9,6 +9,7 @@
 
 #include "libANGLE/Context.h"
 
+#include <algorithm>
 #include <iterator>
 #include <sstream>
 
@@ -89,7 +90,7 @@ Context::Context(const egl::Config *config, int clientVersion, const Context *sh
     mState.initializeZeroTextures(mZeroTextures);
 
     // Allocate default FBO
-    mFramebufferMap[0] = new Framebuffer(mCaps, mRenderer, 0);
+    mFramebufferMap.assign(0, new Framebuffer(mCaps, mRenderer, 0));
 
     bindVertexArray(0);
     bindArrayBuffer(0);
@@ -130,31 +131,33 @@ Context::~Context()
 {
     mState.reset();
 
-    while (!mFramebufferMap.empty())
+    // Delete the framebuffers in reverse order to destroy the framebuffer zero last.
+    std::vector<GLuint> framebufferHandles = mFramebufferMap.getHandles();
+    std::sort(framebufferHandles.begin(), framebufferHandles.end());
+    for (auto handle = framebufferHandles.rbegin(); handle != framebufferHandles.rend(); ++handle)
     {
-        // Delete the framebuffer in reverse order to destroy the framebuffer zero last.
-        deleteFramebuffer(mFramebufferMap.rbegin()->first);
+        deleteFramebuffer(*handle);
     }
 
-    while (!mFenceNVMap.empty())
+    for (GLuint handle : mFenceNVMap.getHandles())
     {
-        deleteFenceNV(mFenceNVMap.begin()->first);
+        deleteFenceNV(handle);
     }
 
-    while (!mQueryMap.empty())
+    for (GLuint handle : mQueryMap.getHandles())
     {
-        deleteQuery(mQueryMap.begin()->first);
+        deleteQuery(handle);
     }
 
-    while (!mVertexArrayMap.empty())
+    for (GLuint handle : mVertexArrayMap.getHandles())
     {
-        deleteVertexArray(mVertexArrayMap.begin()->first);
+        deleteVertexArray(handle);
     }
 
     mTransformFeedbackZero.set(NULL);
-    while (!mTransformFeedbackMap.empty())
+    for (GLuint handle : mTransformFeedbackMap.getHandles())
     {
-        deleteTransformFeedback(mTransformFeedbackMap.begin()->first);
+        deleteTransformFeedback(handle);
     }
 
     for (auto &zeroTexture : mZeroTextures)
@@ -186,8 +189,12 @@ void Context::makeCurrent(egl::Surface *surface)
         mHasBeenCurrent = true;
     }
 
+    // The renderer may be shared with other contexts, so nothing it has applied
+    // can be assumed to match this context's state.
+    mState.setAllDirtyBits();
+
     // Update default framebuffer
-    Framebuffer *defaultFBO = mFramebufferMap[0];
+    Framebuffer *defaultFBO = mFramebufferMap.query(0);
 
     GLenum drawBufferState = GL_BACK;
     defaultFBO->setDrawBuffers(1, &drawBufferState);
@@ -226,7 +233,7 @@ void Context::makeCurrent(egl::Surface *surface)
 
 void Context::releaseSurface()
 {
-    Framebuffer *defaultFBO = mFramebufferMap[0];
+    Framebuffer *defaultFBO = mFramebufferMap.query(0);
     defaultFBO->resetAttachment(GL_BACK);
     defaultFBO->resetAttachment(GL_DEPTH);
     defaultFBO->resetAttachment(GL_STENCIL);
@@ -285,7 +292,7 @@ GLuint Context::createVertexArray()
     // we create it immediately. The resulting behaviour is transparent to the application,
     // since it's not currently possible to access the state until the object is bound.
     VertexArray *vertexArray = new VertexArray(mRenderer->createVertexArray(), handle, MAX_VERTEX_ATTRIBS);
-    mVertexArrayMap[handle] = vertexArray;
+    mVertexArrayMap.assign(handle, vertexArray);
     return handle;
 }
 
@@ -299,7 +306,7 @@ GLuint Context::createTransformFeedback()
     GLuint handle = mTransformFeedbackAllocator.allocate();
     TransformFeedback *transformFeedback = new TransformFeedback(mRenderer->createTransformFeedback(), handle, mCaps);
     transformFeedback->addRef();
-    mTransformFeedbackMap[handle] = transformFeedback;
+    mTransformFeedbackMap.assign(handle, transformFeedback);
     return handle;
 }
 
@@ -308,7 +315,7 @@ GLuint Context::createFramebuffer()
 {
     GLuint handle = mFramebufferHandleAllocator.allocate();
 
-    mFramebufferMap[handle] = NULL;
+    mFramebufferMap.assign(handle, nullptr);
 
     return handle;
 }
@@ -317,7 +324,7 @@ GLuint Context::createFenceNV()
 {
     GLuint handle = mFenceNVHandleAllocator.allocate();
 
-    mFenceNVMap[handle] = new FenceNV(mRenderer->createFenceNV());
+    mFenceNVMap.assign(handle, new FenceNV(mRenderer->createFenceNV()));
 
     return handle;
 }
@@ -327,7 +334,7 @@ GLuint Context::createQuery()
 {
     GLuint handle = mQueryHandleAllocator.allocate();
 
-    mQueryMap[handle] = NULL;
+    mQueryMap.assign(handle, nullptr);
 
     return handle;
 }
@@ -383,15 +390,14 @@ void Context::deleteFenceSync(GLsync fenceSync)
 
 void Context::deleteVertexArray(GLuint vertexArray)
 {
-    auto vertexArrayObject = mVertexArrayMap.find(vertexArray);
-
-    if (vertexArrayObject != mVertexArrayMap.end())
+    if (mVertexArrayMap.contains(vertexArray))
     {
         detachVertexArray(vertexArray);
 
-        mVertexArrayHandleAllocator.release(vertexArrayObject->first);
-        delete vertexArrayObject->second;
-        mVertexArrayMap.erase(vertexArrayObject);
+        VertexArray *vertexArrayObject = nullptr;
+        mVertexArrayMap.erase(vertexArray, &vertexArrayObject);
+        mVertexArrayHandleAllocator.release(vertexArray);
+        delete vertexArrayObject;
     }
 }
 
@@ -407,53 +413,50 @@ void Context::deleteSampler(GLuint sampler)
 
 void Context::deleteTransformFeedback(GLuint transformFeedback)
 {
-    auto iter = mTransformFeedbackMap.find(transformFeedback);
-    if (iter != mTransformFeedbackMap.end())
+    if (mTransformFeedbackMap.contains(transformFeedback))
     {
         detachTransformFeedback(transformFeedback);
+
+        TransformFeedback *transformFeedbackObject = nullptr;
+        mTransformFeedbackMap.erase(transformFeedback, &transformFeedbackObject);
         mTransformFeedbackAllocator.release(transformFeedback);
-        iter->second->release();
-        mTransformFeedbackMap.erase(iter);
+        transformFeedbackObject->release();
     }
 }
 
 void Context::deleteFramebuffer(GLuint framebuffer)
 {
-    FramebufferMap::iterator framebufferObject = mFramebufferMap.find(framebuffer);
-
-    if (framebufferObject != mFramebufferMap.end())
+    if (mFramebufferMap.contains(framebuffer))
     {
         detachFramebuffer(framebuffer);
 
-        mFramebufferHandleAllocator.release(framebufferObject->first);
-        delete framebufferObject->second;
-        mFramebufferMap.erase(framebufferObject);
+        Framebuffer *framebufferObject = nullptr;
+        mFramebufferMap.erase(framebuffer, &framebufferObject);
+        mFramebufferHandleAllocator.release(framebuffer);
+        delete framebufferObject;
     }
 }
 
 void Context::deleteFenceNV(GLuint fence)
 {
-    FenceNVMap::iterator fenceObject = mFenceNVMap.find(fence);
-
-    if (fenceObject != mFenceNVMap.end())
+    FenceNV *fenceObject = nullptr;
+    if (mFenceNVMap.erase(fence, &fenceObject))
     {
-        mFenceNVHandleAllocator.release(fenceObject->first);
-        delete fenceObject->second;
-        mFenceNVMap.erase(fenceObject);
+        mFenceNVHandleAllocator.release(fence);
+        delete fenceObject;
     }
 }
 
 void Context::deleteQuery(GLuint query)
 {
-    QueryMap::iterator queryObject = mQueryMap.find(query);
-    if (queryObject != mQueryMap.end())
+    Query *queryObject = nullptr;
+    if (mQueryMap.erase(query, &queryObject))
     {
-        mQueryHandleAllocator.release(queryObject->first);
-        if (queryObject->second)
+        mQueryHandleAllocator.release(query);
+        if (queryObject)
         {
-            queryObject->second->release();
+            queryObject->release();
         }
-        mQueryMap.erase(queryObject);
     }
 }
 
@@ -489,16 +492,7 @@ FenceSync *Context::getFenceSync(GLsync handle) const
 
 VertexArray *Context::getVertexArray(GLuint handle) const
 {
-    auto vertexArray = mVertexArrayMap.find(handle);
-
-    if (vertexArray == mVertexArrayMap.end())
-    {
-        return NULL;
-    }
-    else
-    {
-        return vertexArray->second;
-    }
+    return mVertexArrayMap.query(handle);
 }
 
 Sampler *Context::getSampler(GLuint handle) const
@@ -514,8 +508,7 @@ TransformFeedback *Context::getTransformFeedback(GLuint handle) const
     }
     else
     {
-        TransformFeedbackMap::const_iterator iter = mTransformFeedbackMap.find(handle);
-        return (iter != mTransformFeedbackMap.end()) ? iter->second : NULL;
+        return mTransformFeedbackMap.query(handle);
     }
 }
 
@@ -561,7 +554,7 @@ void Context::bindReadFramebuffer(GLuint framebuffer)
 {
     if (!getFramebuffer(framebuffer))
     {
-        mFramebufferMap[framebuffer] = new Framebuffer(mCaps, mRenderer, framebuffer);
+        mFramebufferMap.assign(framebuffer, new Framebuffer(mCaps, mRenderer, framebuffer));
     }
 
     mState.setReadFramebufferBinding(getFramebuffer(framebuffer));
@@ -571,7 +564,7 @@ void Context::bindDrawFramebuffer(GLuint framebuffer)
 {
     if (!getFramebuffer(framebuffer))
     {
-        mFramebufferMap[framebuffer] = new Framebuffer(mCaps, mRenderer, framebuffer);
+        mFramebufferMap.assign(framebuffer, new Framebuffer(mCaps, mRenderer, framebuffer));
     }
 
     mState.setDrawFramebufferBinding(getFramebuffer(framebuffer));
@@ -589,7 +582,7 @@ void Context::bindVertexArray(GLuint vertexArray)
     if (!getVertexArray(vertexArray))
     {
         VertexArray *vertexArrayObject = new VertexArray(mRenderer->createVertexArray(), vertexArray, MAX_VERTEX_ATTRIBS);
-        mVertexArrayMap[vertexArray] = vertexArrayObject;
+        mVertexArrayMap.assign(vertexArray, vertexArrayObject);
     }
 
     mState.setVertexArrayBinding(getVertexArray(vertexArray));
@@ -702,49 +695,29 @@ Error Context::endQuery(GLenum target)
 
 Framebuffer *Context::getFramebuffer(unsigned int handle) const
 {
-    FramebufferMap::const_iterator framebuffer = mFramebufferMap.find(handle);
-
-    if (framebuffer == mFramebufferMap.end())
-    {
-        return NULL;
-    }
-    else
-    {
-        return framebuffer->second;
-    }
+    return mFramebufferMap.query(handle);
 }
 
 FenceNV *Context::getFenceNV(unsigned int handle)
 {
-    FenceNVMap::iterator fence = mFenceNVMap.find(handle);
-
-    if (fence == mFenceNVMap.end())
-    {
-        return NULL;
-    }
-    else
-    {
-        return fence->second;
-    }
+    return mFenceNVMap.query(handle);
 }
 
 Query *Context::getQuery(unsigned int handle, bool create, GLenum type)
 {
-    QueryMap::iterator query = mQueryMap.find(handle);
-
-    if (query == mQueryMap.end())
+    if (!mQueryMap.contains(handle))
     {
         return NULL;
     }
-    else
+
+    Query *query = mQueryMap.query(handle);
+    if (!query && create)
     {
-        if (!query->second && create)
-        {
-            query->second = new Query(mRenderer->createQuery(type), handle);
-            query->second->addRef();
-        }
-        return query->second;
+        query = new Query(mRenderer->createQuery(type), handle);
+        query->addRef();
+        mQueryMap.assign(handle, query);
     }
+    return query;
 }
 
 Texture *Context::getTargetTexture(GLenum target) const
@@ -1219,6 +1192,8 @@ bool Context::getIndexedQueryParameterInfo(GLenum target, GLenum *type, unsigned
 
 Error Context::drawArrays(GLenum mode, GLint first, GLsizei count, GLsizei instances)
 {
+    syncRendererState();
+
     Error error = mRenderer->drawArrays(getData(), mode, first, count, instances);
     if (error.isError())
     {
@@ -1245,9 +1220,17 @@ Error Context::drawElements(GLenum mode, GLsizei count, GLenum type,
                             const GLvoid *indices, GLsizei instances,
                             const RangeUI &indexRange)
 {
+    syncRendererState();
+
     return mRenderer->drawElements(getData(), mode, count, type, indices, instances, indexRange);
 }
 
+void Context::syncRendererState()
+{
+    mRenderer->syncState(mState, mState.getDirtyBits());
+    mState.clearDirtyBits();
+}
+
 Error Context::flush()
 {
     return mRenderer->flush();
@@ -1332,8 +1315,8 @@ EGLenum Context::getClientType() const
 
 EGLenum Context::getRenderBuffer() const
 {
-    ASSERT(mFramebufferMap.count(0) > 0);
-    const Framebuffer *framebuffer = mFramebufferMap.find(0)->second;
+    const Framebuffer *framebuffer = mFramebufferMap.query(0);
+    ASSERT(framebuffer != nullptr);
     const FramebufferAttachment *backAttachment = framebuffer->getAttachment(GL_BACK);
     return backAttachment ? backAttachment->getSurface()->getRenderBuffer() : EGL_NONE;
 }
@@ -1374,9 +1357,9 @@ void Context::detachBuffer(GLuint buffer)
     mState.removeArrayBufferBinding(buffer);
 
     // mark as freed among the vertex array objects
-    for (auto vaoIt = mVertexArrayMap.begin(); vaoIt != mVertexArrayMap.end(); vaoIt++)
+    for (const auto &vertexArray : mVertexArrayMap)
     {
-        vaoIt->second->detachBuffer(buffer);
+        vertexArray.second->detachBuffer(buffer);
     }
 }
 
@@ -1598,8 +1581,15 @@ void Context::initCaps(GLuint clientVersion)
 
         const InternalFormat &formatInfo = GetInternalFormatInfo(format);
 
-        // Update the format caps based on the client version and extensions
+        // Update the format caps based on the client version and extensions. Compressed formats
+        // can't be converted by the front-end, so they also need the renderer to support them:
+        // the ES 3.0 ETC2 and EAC formats are only decoded by some back-ends.
+        bool rendererTexturable = formatCaps.texturable;
         formatCaps.texturable = formatInfo.textureSupport(clientVersion, mExtensions);
+        if (formatInfo.compressed)
+        {
+            formatCaps.texturable = formatCaps.texturable && rendererTexturable;
+        }
         formatCaps.renderable = formatInfo.renderSupport(clientVersion, mExtensions);
         formatCaps.filterable = formatInfo.filterSupport(clientVersion, mExtensions);
 
@@ -25,6 +25,7 @@
 #include "libANGLE/Context.h"
 #include "libANGLE/Surface.h"
 #include "libANGLE/Device.h"
+#include "libANGLE/TraceRecorder.h"
 #include "libANGLE/renderer/DisplayImpl.h"
 #include "third_party/trace_event/trace_event.h"
 
@@ -42,6 +43,10 @@
 #   endif
 #endif
 
+#if defined(ANGLE_ENABLE_NULL)
+#   include "libANGLE/renderer/null/DisplayNull.h"
+#endif
+
 namespace egl
 {
 
@@ -57,16 +62,32 @@ public:
 
 DefaultPlatform *defaultPlatform = nullptr;
 
+// Replaces the default platform when the ANGLE_TRACE_FILE environment variable is set. It lives as
+// long as the process, so that the file holds the events of every display initialized so far.
+angle::TraceRecorder *traceRecorder = nullptr;
+size_t writtenTraceEventCount = 0;
+
 void InitDefaultPlatformImpl()
 {
     if (ANGLEPlatformCurrent() == nullptr)
     {
-        if (defaultPlatform == nullptr)
+        if (defaultPlatform == nullptr && traceRecorder == nullptr)
         {
-            defaultPlatform = new DefaultPlatform();
+            traceRecorder = angle::TraceRecorder::CreateFromEnvironment();
+            if (traceRecorder == nullptr)
+            {
+                defaultPlatform = new DefaultPlatform();
+            }
         }
 
-        ANGLEPlatformInitialize(defaultPlatform);
+        if (traceRecorder != nullptr)
+        {
+            ANGLEPlatformInitialize(traceRecorder);
+        }
+        else
+        {
+            ANGLEPlatformInitialize(defaultPlatform);
+        }
     }
 }
 
@@ -81,6 +102,21 @@ void DeinitDefaultPlatformImpl()
 
         SafeDelete(defaultPlatform);
     }
+
+    if (traceRecorder != nullptr)
+    {
+        if (ANGLEPlatformCurrent() == traceRecorder)
+        {
+            ANGLEPlatformShutdown();
+        }
+
+        // Only rewrite the file when there are events it doesn't have yet
+        size_t eventCount = traceRecorder->getEventCount() + traceRecorder->getDroppedEventCount();
+        if (eventCount > writtenTraceEventCount && traceRecorder->writeTraceFile())
+        {
+            writtenTraceEventCount = eventCount;
+        }
+    }
 }
 
 typedef std::map<EGLNativeWindowType, Surface*> WindowSurfaceMap;
@@ -109,8 +145,10 @@ rx::DisplayImpl *CreateDisplayImpl(const AttributeMap &attribMap)
 #if defined(ANGLE_ENABLE_D3D9) || defined(ANGLE_ENABLE_D3D11)
         // Default to D3D displays
         impl = new rx::DisplayD3D();
-#elif defined(ANGLE_PLATFORM_LINUX)
+#elif defined(ANGLE_ENABLE_OPENGL) && defined(ANGLE_PLATFORM_LINUX)
         impl = new rx::DisplayGLX();
+#elif defined(ANGLE_ENABLE_NULL)
+        impl = new rx::DisplayNull();
 #else
         // No display available
         UNREACHABLE();
@@ -136,6 +174,14 @@ rx::DisplayImpl *CreateDisplayImpl(const AttributeMap &attribMap)
 #else
 #error Unsupported OpenGL platform.
 #endif
+#else
+        UNREACHABLE();
+#endif
+        break;
+
+      case EGL_PLATFORM_ANGLE_TYPE_NULL_ANGLE:
+#if defined(ANGLE_ENABLE_NULL)
+        impl = new rx::DisplayNull();
 #else
         UNREACHABLE();
 #endif
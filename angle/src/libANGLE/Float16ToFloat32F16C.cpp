@@ -0,0 +1,101 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// Float16ToFloat32F16C.cpp: Implements the array conversions between half floats and floats with
+// the F16C instructions. They are only called when gl::supportsF16C returns true.
+
+#include "common/mathutil.h"
+
+#if defined(ANGLE_USE_SSE)
+#include <immintrin.h>
+#endif
+
+// GCC and clang only emit the F16C instructions in functions that target them
+#if defined(ANGLE_USE_SSE) && (defined(__GNUC__) || defined(__clang__))
+#define ANGLE_TARGET_F16C __attribute__((target("f16c")))
+#else
+#define ANGLE_TARGET_F16C
+#endif
+
+namespace gl
+{
+
+ANGLE_TARGET_F16C void float16ToFloat32N_F16C(const unsigned short *input, size_t count, float *output)
+{
+#if defined(ANGLE_USE_SSE)
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i halves = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+
+        // VCVTPH2PS quiets signaling NaNs, while float16ToFloat32 keeps their payload as is
+        __m128i magnitude = _mm_and_si128(halves, _mm_set1_epi16(0x7FFF));
+        if (_mm_movemask_epi8(_mm_cmpgt_epi16(magnitude, _mm_set1_epi16(0x7C00))) != 0)
+        {
+            for (size_t j = i; j < i + 8; j++)
+            {
+                output[j] = float16ToFloat32(input[j]);
+            }
+            continue;
+        }
+
+        _mm_storeu_ps(output + i, _mm_cvtph_ps(halves));
+        _mm_storeu_ps(output + i + 4, _mm_cvtph_ps(_mm_unpackhi_epi64(halves, halves)));
+    }
+
+    for (; i < count; i++)
+    {
+        output[i] = float16ToFloat32(input[i]);
+    }
+#else
+    UNIMPLEMENTED();
+#endif
+}
+
+ANGLE_TARGET_F16C void float32ToFloat16N_F16C(const float *input, size_t count, unsigned short *output)
+{
+#if defined(ANGLE_USE_SSE)
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128 low = _mm_loadu_ps(input + i);
+        __m128 high = _mm_loadu_ps(input + i + 4);
+
+        // float32ToFloat16 keeps the mantissa bits of magnitudes from 2^16 up, where VCVTPS2PH
+        // gives infinity, clamps infinities and NaNs to 0x7FFF, and rounds denormal results
+        // differently than VCVTPS2PH, so those take the scalar conversion
+        __m128i lowMagnitude = _mm_and_si128(_mm_castps_si128(low), _mm_set1_epi32(0x7FFFFFFF));
+        __m128i highMagnitude = _mm_and_si128(_mm_castps_si128(high), _mm_set1_epi32(0x7FFFFFFF));
+        __m128i lowOutOfRange = _mm_or_si128(_mm_cmplt_epi32(lowMagnitude, _mm_set1_epi32(0x38800000)),
+                                             _mm_cmpgt_epi32(lowMagnitude, _mm_set1_epi32(0x477FFFFF)));
+        __m128i highOutOfRange = _mm_or_si128(_mm_cmplt_epi32(highMagnitude, _mm_set1_epi32(0x38800000)),
+                                              _mm_cmpgt_epi32(highMagnitude, _mm_set1_epi32(0x477FFFFF)));
+        lowOutOfRange = _mm_andnot_si128(_mm_cmpeq_epi32(lowMagnitude, _mm_setzero_si128()), lowOutOfRange);
+        highOutOfRange = _mm_andnot_si128(_mm_cmpeq_epi32(highMagnitude, _mm_setzero_si128()), highOutOfRange);
+        if (_mm_movemask_epi8(_mm_or_si128(lowOutOfRange, highOutOfRange)) != 0)
+        {
+            for (size_t j = i; j < i + 8; j++)
+            {
+                output[j] = float32ToFloat16(input[j]);
+            }
+            continue;
+        }
+
+        // Round to nearest even, like float32ToFloat16
+        __m128i halves = _mm_unpacklo_epi64(_mm_cvtps_ph(low, 0), _mm_cvtps_ph(high, 0));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), halves);
+    }
+
+    for (; i < count; i++)
+    {
+        output[i] = float32ToFloat16(input[i]);
+    }
+#else
+    UNIMPLEMENTED();
+#endif
+}
+
+}
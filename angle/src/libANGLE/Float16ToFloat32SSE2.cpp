@@ -0,0 +1,56 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// Float16ToFloat32SSE2.cpp: Implements the array conversions between half floats and floats with
+// SSE2. It's in a separate file for GCC, which can enable SSE usage only per-file.
+
+#include "common/mathutil.h"
+#include "libANGLE/Float16ToFloat32SSE2.h"
+
+namespace gl
+{
+
+void float16ToFloat32N_SSE2(const unsigned short *input, size_t count, float *output)
+{
+#if defined(ANGLE_USE_SSE)
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i halves = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+        _mm_storeu_ps(output + i, Float16ToFloat32SSE2(_mm_unpacklo_epi16(halves, _mm_setzero_si128())));
+        _mm_storeu_ps(output + i + 4, Float16ToFloat32SSE2(_mm_unpackhi_epi16(halves, _mm_setzero_si128())));
+    }
+
+    for (; i < count; i++)
+    {
+        output[i] = float16ToFloat32(input[i]);
+    }
+#else
+    UNIMPLEMENTED();
+#endif
+}
+
+void float32ToFloat16N_SSE2(const float *input, size_t count, unsigned short *output)
+{
+#if defined(ANGLE_USE_SSE)
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i low = Float32ToFloat16SSE2(_mm_loadu_ps(input + i));
+        __m128i high = Float32ToFloat16SSE2(_mm_loadu_ps(input + i + 4));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), PackFloat16SSE2(low, high));
+    }
+
+    for (; i < count; i++)
+    {
+        output[i] = float32ToFloat16(input[i]);
+    }
+#else
+    UNIMPLEMENTED();
+#endif
+}
+
+}
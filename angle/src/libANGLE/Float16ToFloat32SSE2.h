@@ -0,0 +1,82 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// Float16ToFloat32SSE2.h: Defines the SSE2 conversions between half floats and floats, four
+// values at a time. It's only included by the files that are built with SSE2 enabled.
+
+#ifndef LIBANGLE_FLOAT16TOFLOAT32SSE2_H_
+#define LIBANGLE_FLOAT16TOFLOAT32SSE2_H_
+
+#include "common/mathutil.h"
+#include "common/platform.h"
+
+#if defined(ANGLE_USE_SSE)
+
+#include <emmintrin.h>
+
+namespace gl
+{
+
+// Converts the half floats in the low 16 bits of each lane exactly like gl::float16ToFloat32
+inline __m128 Float16ToFloat32SSE2(__m128i halves)
+{
+    __m128i magnitude = _mm_and_si128(halves, _mm_set1_epi32(0x7FFF));
+    __m128i sign = _mm_slli_epi32(_mm_and_si128(halves, _mm_set1_epi32(0x8000)), 16);
+
+    // Normal values only need their exponent rebiased, and infinities and NaNs their exponent
+    // widened. Denormals are their mantissa times 2^-24.
+    __m128i isInfOrNaN = _mm_cmpgt_epi32(magnitude, _mm_set1_epi32(0x7BFF));
+    __m128i exponentBias = _mm_add_epi32(_mm_set1_epi32(112 << 23), _mm_and_si128(isInfOrNaN, _mm_set1_epi32(112 << 23)));
+    __m128i normal = _mm_add_epi32(_mm_slli_epi32(magnitude, 13), exponentBias);
+    __m128i denormal = _mm_castps_si128(_mm_mul_ps(_mm_cvtepi32_ps(magnitude), _mm_set1_ps(1.0f / 16777216.0f)));
+    __m128i isDenormal = _mm_cmplt_epi32(magnitude, _mm_set1_epi32(0x400));
+
+    __m128i bits = _mm_or_si128(_mm_and_si128(isDenormal, denormal), _mm_andnot_si128(isDenormal, normal));
+    return _mm_castsi128_ps(_mm_or_si128(bits, sign));
+}
+
+// Converts to half floats in the low 16 bits of each lane exactly like gl::float32ToFloat16
+inline __m128i Float32ToFloat16SSE2(__m128 values)
+{
+    __m128i bits = _mm_castps_si128(values);
+    __m128i magnitude = _mm_and_si128(bits, _mm_set1_epi32(0x7FFFFFFF));
+    __m128i sign = _mm_srli_epi32(_mm_and_si128(bits, _mm_set1_epi32(0x80000000)), 16);
+
+    __m128i isZero = _mm_cmpeq_epi32(magnitude, _mm_setzero_si128());
+    __m128i outOfRange = _mm_or_si128(_mm_cmplt_epi32(magnitude, _mm_set1_epi32(0x38800000)),
+                                      _mm_cmpgt_epi32(magnitude, _mm_set1_epi32(0x47FFEFFF)));
+    if (_mm_movemask_epi8(_mm_andnot_si128(isZero, outOfRange)) != 0)
+    {
+        // Denormal, infinite and NaN results are rare enough to convert one at a time
+        float floats[4];
+        uint32_t halves[4];
+        _mm_storeu_ps(floats, values);
+        for (size_t i = 0; i < 4; i++)
+        {
+            halves[i] = float32ToFloat16(floats[i]);
+        }
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(halves));
+    }
+
+    // Rebias the exponent and round to nearest even
+    __m128i lowestBit = _mm_and_si128(_mm_srli_epi32(magnitude, 13), _mm_set1_epi32(1));
+    __m128i rounded = _mm_add_epi32(_mm_add_epi32(magnitude, _mm_set1_epi32(0xC8000FFF)), lowestBit);
+    __m128i normal = _mm_andnot_si128(isZero, _mm_srli_epi32(rounded, 13));
+    return _mm_or_si128(normal, sign);
+}
+
+// Packs the half floats in the low 16 bits of the lanes of a and b into the eight words of the
+// result. The signed saturation of the packing is avoided by sign extending them first.
+inline __m128i PackFloat16SSE2(__m128i a, __m128i b)
+{
+    return _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(a, 16), 16), _mm_srai_epi32(_mm_slli_epi32(b, 16), 16));
+}
+
+}
+
+#endif // ANGLE_USE_SSE
+
+#endif // LIBANGLE_FLOAT16TOFLOAT32SSE2_H_
@@ -0,0 +1,157 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// Float16ToFloat32_unittest.cpp: Unit tests that the array conversions between half floats and
+// floats give the same bits as the conversions of single values, for every half float and for
+// floats that hit the rounding, denormal and overflow cases.
+
+#include <iostream>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "common/mathutil.h"
+
+namespace
+{
+
+typedef void (*HalfToFloatFunction)(const unsigned short *, size_t, float *);
+typedef void (*FloatToHalfFunction)(const float *, size_t, unsigned short *);
+
+std::vector<unsigned short> AllHalves()
+{
+    std::vector<unsigned short> halves(0x10000);
+    for (size_t i = 0; i < halves.size(); i++)
+    {
+        halves[i] = static_cast<unsigned short>(i);
+    }
+    return halves;
+}
+
+std::vector<float> InterestingFloats()
+{
+    const unsigned int bits[] =
+    {
+        0x00000000, 0x80000000, 0x3F800000, 0xBF800000, 0x3EAAAAAB,
+        // Largest half float, the rounding boundary above it, and infinities and NaNs
+        0x477FE000, 0x477FEFFF, 0x477FF000, 0x47800000, 0x47801000, 0x47FFEFFF, 0x47FFF000,
+        0x7F7FFFFF, 0x7F800000, 0xFF800000, 0x7FC00000, 0x7F800001, 0xFFC12345,
+        // Smallest normal half float and denormal results
+        0x38800000, 0x387FFFFF, 0x38000000, 0x33800000, 0x33000000, 0x00000001, 0x80400000,
+        // Ties between two half floats, which round to the even one
+        0x3F801000, 0x3F803000, 0xBF801000, 0x3F800FFF, 0x3F801001,
+    };
+
+    std::vector<float> floats;
+    for (size_t i = 0; i < ArraySize(bits); i++)
+    {
+        floats.push_back(gl::bitCast<float>(bits[i]));
+    }
+
+    // Every half float, and the floats halfway between two of them
+    for (unsigned int half = 0; half < 0x10000; half++)
+    {
+        unsigned int floatBits = gl::bitCast<unsigned int>(gl::float16ToFloat32(static_cast<unsigned short>(half)));
+        floats.push_back(gl::bitCast<float>(floatBits));
+        floats.push_back(gl::bitCast<float>(floatBits + 0x1000));
+    }
+
+    return floats;
+}
+
+void CheckHalfToFloat(HalfToFloatFunction convert)
+{
+    std::vector<unsigned short> halves = AllHalves();
+    std::vector<float> floats(halves.size());
+    convert(&halves[0], halves.size(), &floats[0]);
+
+    for (size_t i = 0; i < halves.size(); i++)
+    {
+        EXPECT_EQ(gl::bitCast<unsigned int>(gl::float16ToFloat32(halves[i])), gl::bitCast<unsigned int>(floats[i]))
+            << "half 0x" << std::hex << halves[i];
+    }
+
+    // Every length up to a few vectors, so that the remainders are converted too
+    for (size_t count = 1; count <= 40; count++)
+    {
+        std::vector<float> output(count + 1, 0.0f);
+        convert(&halves[0x3C00], count, &output[0]);
+
+        for (size_t i = 0; i < count; i++)
+        {
+            EXPECT_EQ(gl::float16ToFloat32(halves[0x3C00 + i]), output[i]);
+        }
+        EXPECT_EQ(0.0f, output[count]);
+    }
+}
+
+void CheckFloatToHalf(FloatToHalfFunction convert)
+{
+    std::vector<float> floats = InterestingFloats();
+    std::vector<unsigned short> halves(floats.size());
+    convert(&floats[0], floats.size(), &halves[0]);
+
+    for (size_t i = 0; i < floats.size(); i++)
+    {
+        EXPECT_EQ(gl::float32ToFloat16(floats[i]), halves[i])
+            << "float 0x" << std::hex << gl::bitCast<unsigned int>(floats[i]);
+    }
+
+    for (size_t count = 1; count <= 40; count++)
+    {
+        std::vector<unsigned short> output(count + 1, 0);
+        convert(&floats[0], count, &output[0]);
+
+        for (size_t i = 0; i < count; i++)
+        {
+            EXPECT_EQ(gl::float32ToFloat16(floats[i]), output[i]);
+        }
+        EXPECT_EQ(0u, output[count]);
+    }
+}
+
+TEST(Float16ToFloat32Test, ConvertsSingleValues)
+{
+    EXPECT_EQ(0.0f, gl::float16ToFloat32(0x0000));
+    EXPECT_EQ(1.0f, gl::float16ToFloat32(0x3C00));
+    EXPECT_EQ(-2.0f, gl::float16ToFloat32(0xC000));
+    EXPECT_EQ(65504.0f, gl::float16ToFloat32(0x7BFF));
+    EXPECT_EQ(1.0f / 16777216.0f, gl::float16ToFloat32(0x0001));
+    EXPECT_EQ(0xFF800000u, gl::bitCast<unsigned int>(gl::float16ToFloat32(0xFC00)));
+    EXPECT_EQ(0x7FC02000u, gl::bitCast<unsigned int>(gl::float16ToFloat32(0x7E01)));
+}
+
+TEST(Float16ToFloat32Test, ConvertsArrays)
+{
+    CheckHalfToFloat(gl::float16ToFloat32N);
+    CheckFloatToHalf(gl::float32ToFloat16N);
+}
+
+TEST(Float16ToFloat32Test, ConvertsArraysWithSSE2)
+{
+    if (!gl::supportsSSE2())
+    {
+        std::cout << "Test skipped because SSE2 is not available." << std::endl;
+        return;
+    }
+
+    CheckHalfToFloat(gl::float16ToFloat32N_SSE2);
+    CheckFloatToHalf(gl::float32ToFloat16N_SSE2);
+}
+
+TEST(Float16ToFloat32Test, ConvertsArraysWithF16C)
+{
+    if (!gl::supportsF16C())
+    {
+        std::cout << "Test skipped because F16C is not available." << std::endl;
+        return;
+    }
+
+    CheckHalfToFloat(gl::float16ToFloat32N_F16C);
+    CheckFloatToHalf(gl::float32ToFloat16N_F16C);
+}
+
+}
@@ -0,0 +1,438 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// FrameCapture.cpp: Implements gl::FrameCapture, which records the GLES calls made to a context
+// into a binary trace.
+
+#include "libANGLE/FrameCapture.h"
+
+#include "common/debug.h"
+#include "common/mathutil.h"
+#include "libANGLE/Buffer.h"
+#include "libANGLE/Context.h"
+#include "libANGLE/State.h"
+#include "libANGLE/VertexArray.h"
+#include "libANGLE/VertexAttribute.h"
+#include "libANGLE/formatutils.h"
+#include "libANGLE/validationES.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace gl
+{
+
+namespace
+{
+
+// The trace is written to the file when it grows past this size, so that applications that don't
+// swap often don't keep all of it in memory
+const size_t FlushThreshold = 64 * 1024 * 1024;
+
+size_t ArraySize(GLsizei count, size_t elementSize)
+{
+    return (count > 0) ? static_cast<size_t>(count) * elementSize : 0;
+}
+
+CapturePointer MakePointer(CapturePointerTag tag, const void *data, uint64_t value)
+{
+    CapturePointer pointer;
+    pointer.tag = tag;
+    pointer.data = data;
+    pointer.value = value;
+    return pointer;
+}
+
+// The bytes of an image of uncompressed pixels, from the start of the memory the unpack or pack
+// state describes to its last pixel
+size_t ComputeImageSize(GLenum format, GLenum type, GLsizei width, GLsizei height, GLsizei depth,
+                        GLint alignment, GLint rowLength, GLint imageHeight, GLint skipImages, GLint skipRows,
+                        GLint skipPixels)
+{
+    if (width <= 0 || height <= 0 || depth <= 0)
+    {
+        return 0;
+    }
+
+    const InternalFormat &formatInfo = GetInternalFormatInfo(GetSizedInternalFormat(format, type));
+    size_t rowPitch = formatInfo.computeRowPitch(type, width, alignment, rowLength);
+    size_t depthPitch = rowPitch * ((imageHeight > 0) ? imageHeight : height);
+    size_t skipBytes = skipImages * depthPitch + skipRows * rowPitch + skipPixels * formatInfo.pixelBytes;
+
+    return skipBytes + (depth - 1) * depthPitch + (height - 1) * rowPitch +
+           formatInfo.computeBlockSize(type, width, 1);
+}
+
+}
+
+CapturePointer CaptureNull()
+{
+    return MakePointer(CAPTURE_POINTER_NULL, nullptr, 0);
+}
+
+CapturePointer CaptureMemory(const void *data, GLsizeiptr size)
+{
+    if (data == nullptr)
+    {
+        return CaptureNull();
+    }
+    return MakePointer(CAPTURE_POINTER_MEMORY, data, (size > 0) ? static_cast<uint64_t>(size) : 0);
+}
+
+CapturePointer CaptureArray(const void *data, GLsizei count, size_t elementSize)
+{
+    return CaptureMemory(data, static_cast<GLsizeiptr>(ArraySize(count, elementSize)));
+}
+
+CapturePointer CaptureString(const GLchar *string)
+{
+    return CaptureMemory(string, (string != nullptr) ? static_cast<GLsizeiptr>(strlen(string) + 1) : 0);
+}
+
+CapturePointer CaptureOffset(const void *pointer)
+{
+    if (pointer == nullptr)
+    {
+        return CaptureNull();
+    }
+    return MakePointer(CAPTURE_POINTER_OFFSET, nullptr, reinterpret_cast<uintptr_t>(pointer));
+}
+
+CapturePointer CaptureOutput(GLsizei size)
+{
+    return CaptureOutputArray(size, 1);
+}
+
+CapturePointer CaptureOutputArray(GLsizei count, size_t elementSize)
+{
+    return MakePointer(CAPTURE_POINTER_OUTPUT, nullptr, ArraySize(count, elementSize));
+}
+
+CaptureStringArray CaptureStrings(GLsizei count, const GLchar *const *strings, const GLint *lengths)
+{
+    CaptureStringArray stringArray;
+    stringArray.count = (strings != nullptr) ? std::max(count, 0) : 0;
+    stringArray.strings = strings;
+    stringArray.lengths = lengths;
+    return stringArray;
+}
+
+CapturePointer CapturePixels(const Context *context, GLenum format, GLenum type, GLsizei width, GLsizei height,
+                             GLsizei depth, const GLvoid *pixels)
+{
+    const PixelUnpackState &unpack = context->getState().getUnpackState();
+    if (unpack.pixelBuffer.get() != nullptr)
+    {
+        return CaptureOffset(pixels);
+    }
+
+    size_t size = ComputeImageSize(format, type, width, height, depth, unpack.alignment, unpack.rowLength,
+                                   unpack.imageHeight, unpack.skipImages, unpack.skipRows, unpack.skipPixels);
+    return CaptureMemory(pixels, static_cast<GLsizeiptr>(size));
+}
+
+CapturePointer CaptureCompressedPixels(const Context *context, GLsizei imageSize, const GLvoid *data)
+{
+    if (context->getState().getUnpackState().pixelBuffer.get() != nullptr)
+    {
+        return CaptureOffset(data);
+    }
+    return CaptureMemory(data, imageSize);
+}
+
+CapturePointer CaptureReadPixels(const Context *context, GLenum format, GLenum type, GLsizei width, GLsizei height,
+                                 GLvoid *pixels)
+{
+    const PixelPackState &pack = context->getState().getPackState();
+    if (pack.pixelBuffer.get() != nullptr)
+    {
+        return CaptureOffset(pixels);
+    }
+
+    size_t size = ComputeImageSize(format, type, width, height, 1, pack.alignment, pack.rowLength, 0, 0, 0, 0);
+    return MakePointer(CAPTURE_POINTER_OUTPUT, nullptr, size);
+}
+
+CapturePointer CaptureIndices(const Context *context, GLsizei count, GLenum type, const GLvoid *indices)
+{
+    if (context->getState().getVertexArray()->getElementArrayBuffer() != nullptr)
+    {
+        return CaptureOffset(indices);
+    }
+    return CaptureArray(indices, count, GetTypeInfo(type).bytes);
+}
+
+CaptureWriter::CaptureWriter()
+    : mCallStart(0)
+{
+}
+
+void CaptureWriter::writeHeader(GLint clientVersion)
+{
+    mData.insert(mData.end(), CaptureMagic, CaptureMagic + sizeof(CaptureMagic));
+    writeRaw(CaptureVersion);
+    writeRaw(static_cast<uint32_t>(clientVersion));
+    ASSERT(mData.size() == CaptureHeaderSize);
+}
+
+void CaptureWriter::beginCall(CallID id)
+{
+    mCallStart = mData.size();
+    writeRaw(static_cast<uint16_t>(id));
+    writeRaw(static_cast<uint16_t>(0));
+    writeRaw(static_cast<uint32_t>(0));
+}
+
+void CaptureWriter::endCall()
+{
+    align();
+    uint32_t size = static_cast<uint32_t>(mData.size() - mCallStart - CaptureRecordHeaderSize);
+    memcpy(&mData[mCallStart + 4], &size, sizeof(size));
+}
+
+void CaptureWriter::write(GLsync sync)
+{
+    writeRaw(static_cast<uint32_t>(CAPTURE_POINTER_SYNC));
+    writeRaw(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(sync)));
+}
+
+void CaptureWriter::write(const CapturePointer &pointer)
+{
+    writeRaw(static_cast<uint32_t>(pointer.tag));
+    switch (pointer.tag)
+    {
+      case CAPTURE_POINTER_OFFSET:
+        writeRaw(pointer.value);
+        break;
+
+      case CAPTURE_POINTER_MEMORY:
+        {
+            writeRaw(static_cast<uint32_t>(pointer.value));
+            align();
+            const uint8_t *bytes = reinterpret_cast<const uint8_t *>(pointer.data);
+            mData.insert(mData.end(), bytes, bytes + pointer.value);
+            align();
+        }
+        break;
+
+      case CAPTURE_POINTER_OUTPUT:
+        writeRaw(static_cast<uint32_t>(pointer.value));
+        break;
+
+      default:
+        break;
+    }
+}
+
+void CaptureWriter::write(const CaptureStringArray &strings)
+{
+    writeRaw(static_cast<uint32_t>(CAPTURE_POINTER_STRINGS));
+    writeRaw(static_cast<uint32_t>(strings.count));
+    for (GLsizei stringIndex = 0; stringIndex < strings.count; stringIndex++)
+    {
+        // Strings are always written with a terminator, so the lengths aren't needed to replay them
+        const GLchar *string = strings.strings[stringIndex];
+        size_t length = 0;
+        if (strings.lengths != nullptr && strings.lengths[stringIndex] >= 0)
+        {
+            length = static_cast<size_t>(strings.lengths[stringIndex]);
+        }
+        else if (string != nullptr)
+        {
+            length = strlen(string);
+        }
+
+        writeRaw(static_cast<uint32_t>(length));
+        mData.insert(mData.end(), string, string + length);
+        mData.push_back('\0');
+    }
+}
+
+void CaptureWriter::align()
+{
+    mData.resize(rx::roundUp(mData.size(), CaptureAlignment), 0);
+}
+
+FrameCapture::FrameCapture(const std::string &path)
+    : mPath(path),
+      mFile(nullptr),
+      mFailed(false),
+      mContext(nullptr)
+{
+}
+
+FrameCapture::~FrameCapture()
+{
+    flush();
+    if (mFile != nullptr)
+    {
+        fclose(mFile);
+    }
+}
+
+FrameCapture *FrameCapture::GetDefault()
+{
+#if defined(ANGLE_ENABLE_WINDOWS_STORE)
+    return nullptr;
+#else
+    static const char *path = getenv("ANGLE_CAPTURE_FILE");
+    if (path == nullptr || path[0] == '\0')
+    {
+        return nullptr;
+    }
+
+    static FrameCapture defaultCapture(path);
+    return &defaultCapture;
+#endif
+}
+
+void FrameCapture::captureClientArrays(const Context *context, size_t vertexCount, GLsizei instanceCount)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    const State &state = context->getState();
+    const std::vector<VertexAttribute> &attribs = state.getVertexArray()->getVertexAttributes();
+    GLuint arrayBuffer = state.getArrayBufferId();
+    bool unboundArrayBuffer = false;
+
+    for (size_t attribIndex = 0; attribIndex < attribs.size(); attribIndex++)
+    {
+        const VertexAttribute &attrib = attribs[attribIndex];
+        if (!attrib.enabled || attrib.buffer.get() != nullptr || attrib.pointer == nullptr)
+        {
+            continue;
+        }
+
+        // Instanced attributes advance once per divisor instances. The copy starts at the pointer
+        // rather than the first vertex, so the replay never points before it.
+        size_t count = vertexCount;
+        if (attrib.divisor != 0)
+        {
+            count = (std::max<size_t>(instanceCount, 1) + attrib.divisor - 1) / attrib.divisor;
+        }
+        if (count == 0)
+        {
+            continue;
+        }
+
+        if (arrayBuffer != 0 && !unboundArrayBuffer)
+        {
+            if (!beginCall(CALL_BindBuffer, context))
+            {
+                return;
+            }
+            mWriter.writeParams(static_cast<GLenum>(GL_ARRAY_BUFFER), 0u);
+            endCall();
+            unboundArrayBuffer = true;
+        }
+
+        size_t size = (count - 1) * ComputeVertexAttributeStride(attrib) + ComputeVertexAttributeTypeSize(attrib);
+        CapturePointer memory = CaptureMemory(attrib.pointer, static_cast<GLsizeiptr>(size));
+        GLuint index = static_cast<GLuint>(attribIndex);
+        GLint componentCount = static_cast<GLint>(attrib.size);
+        GLsizei stride = static_cast<GLsizei>(attrib.stride);
+
+        if (!beginCall(attrib.pureInteger ? CALL_VertexAttribIPointer : CALL_VertexAttribPointer, context))
+        {
+            return;
+        }
+        if (attrib.pureInteger)
+        {
+            mWriter.writeParams(index, componentCount, attrib.type, stride, memory);
+        }
+        else
+        {
+            GLboolean normalized = attrib.normalized ? GL_TRUE : GL_FALSE;
+            mWriter.writeParams(index, componentCount, attrib.type, normalized, stride, memory);
+        }
+        endCall();
+    }
+
+    if (unboundArrayBuffer && beginCall(CALL_BindBuffer, context))
+    {
+        mWriter.writeParams(static_cast<GLenum>(GL_ARRAY_BUFFER), arrayBuffer);
+        endCall();
+    }
+}
+
+void FrameCapture::captureMappedBuffer(const Context *context, GLenum target)
+{
+    if (!ValidBufferTarget(context, target))
+    {
+        return;
+    }
+
+    Buffer *buffer = context->getState().getTargetBuffer(target);
+    if (buffer == nullptr || !buffer->isMapped() || (buffer->getAccessFlags() & GL_MAP_WRITE_BIT) == 0)
+    {
+        return;
+    }
+
+    captureCall(CALL_UpdateMappedBuffer, context, target,
+                CaptureMemory(buffer->getMapPointer(), static_cast<GLsizeiptr>(buffer->getMapLength())));
+}
+
+void FrameCapture::captureSwapBuffers(const Context *context, GLint width, GLint height)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (context == nullptr || !beginCall(CALL_SwapBuffers, context))
+    {
+        return;
+    }
+
+    mWriter.writeParams(width, height);
+    mWriter.endCall();
+    flush();
+}
+
+bool FrameCapture::beginCall(CallID id, const Context *context)
+{
+    if (mContext == nullptr)
+    {
+        mContext = context;
+        mWriter.writeHeader(context->getClientVersion());
+    }
+    else if (context != mContext)
+    {
+        return false;
+    }
+
+    mWriter.beginCall(id);
+    return true;
+}
+
+void FrameCapture::endCall()
+{
+    mWriter.endCall();
+    if (mWriter.getData().size() >= FlushThreshold)
+    {
+        flush();
+    }
+}
+
+void FrameCapture::flush()
+{
+    const std::vector<uint8_t> &data = mWriter.getData();
+    if (data.empty() || mFailed)
+    {
+        mWriter.clear();
+        return;
+    }
+
+    if (mFile == nullptr)
+    {
+        mFile = fopen(mPath.c_str(), "wb");
+    }
+
+    if (mFile == nullptr || fwrite(&data[0], 1, data.size(), mFile) != data.size() || fflush(mFile) != 0)
+    {
+        ERR("Failed to write the capture to %s.", mPath.c_str());
+        mFailed = true;
+    }
+    mWriter.clear();
+}
+
+}
@@ -0,0 +1,187 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// FrameCapture.h: Defines gl::FrameCapture, which records the GLES calls made to a context, with
+// the client memory they read, into a binary trace that the capture_replay sample plays back. The
+// capture is enabled by naming its file in the ANGLE_CAPTURE_FILE environment variable.
+
+#ifndef LIBANGLE_FRAMECAPTURE_H_
+#define LIBANGLE_FRAMECAPTURE_H_
+
+#include "common/angleutils.h"
+#include "libANGLE/FrameCaptureFormat.h"
+
+#include <cstdio>
+#include <mutex>
+#include <string>
+
+namespace gl
+{
+class Context;
+
+// A pointer parameter, and how much of the memory behind it the trace keeps
+struct CapturePointer
+{
+    CapturePointerTag tag;
+    const void *data;
+    // The size of the memory or output, or the offset
+    uint64_t value;
+};
+
+struct CaptureStringArray
+{
+    GLsizei count;
+    const GLchar *const *strings;
+    const GLint *lengths;
+};
+
+CapturePointer CaptureNull();
+CapturePointer CaptureMemory(const void *data, GLsizeiptr size);
+CapturePointer CaptureArray(const void *data, GLsizei count, size_t elementSize);
+CapturePointer CaptureString(const GLchar *string);
+CapturePointer CaptureOffset(const void *pointer);
+CapturePointer CaptureOutput(GLsizei size);
+CapturePointer CaptureOutputArray(GLsizei count, size_t elementSize);
+CaptureStringArray CaptureStrings(GLsizei count, const GLchar *const *strings, const GLint *lengths);
+
+// Pixels are read from the pixel unpack buffer when one is bound, or else from client memory laid
+// out by the unpack state.
+CapturePointer CapturePixels(const Context *context, GLenum format, GLenum type, GLsizei width, GLsizei height,
+                             GLsizei depth, const GLvoid *pixels);
+CapturePointer CaptureCompressedPixels(const Context *context, GLsizei imageSize, const GLvoid *data);
+CapturePointer CaptureReadPixels(const Context *context, GLenum format, GLenum type, GLsizei width, GLsizei height,
+                                 GLvoid *pixels);
+CapturePointer CaptureIndices(const Context *context, GLsizei count, GLenum type, const GLvoid *indices);
+
+// Serializes calls into records of the trace format
+class CaptureWriter : angle::NonCopyable
+{
+  public:
+    CaptureWriter();
+
+    void writeHeader(GLint clientVersion);
+
+    void beginCall(CallID id);
+    void endCall();
+
+    void write(unsigned char value) { writeRaw(value); }
+    void write(int value) { writeRaw(value); }
+    void write(unsigned int value) { writeRaw(value); }
+    void write(float value) { writeRaw(value); }
+    void write(long value) { writeRaw(static_cast<int64_t>(value)); }
+    void write(unsigned long value) { writeRaw(static_cast<uint64_t>(value)); }
+    void write(long long value) { writeRaw(static_cast<int64_t>(value)); }
+    void write(unsigned long long value) { writeRaw(static_cast<uint64_t>(value)); }
+    void write(GLsync sync);
+    void write(const CapturePointer &pointer);
+    void write(const CaptureStringArray &strings);
+
+    void writeParams() {}
+
+    template <typename First, typename... Rest>
+    void writeParams(const First &first, const Rest &... rest)
+    {
+        write(first);
+        writeParams(rest...);
+    }
+
+    const std::vector<uint8_t> &getData() const { return mData; }
+    void clear() { mData.clear(); }
+
+  private:
+    template <typename T>
+    void writeRaw(const T &value)
+    {
+        const uint8_t *bytes = reinterpret_cast<const uint8_t *>(&value);
+        mData.insert(mData.end(), bytes, bytes + sizeof(T));
+    }
+
+    void align();
+
+    std::vector<uint8_t> mData;
+    size_t mCallStart;
+};
+
+class FrameCapture : angle::NonCopyable
+{
+  public:
+    explicit FrameCapture(const std::string &path);
+    ~FrameCapture();
+
+    // The capture that writes to the file named by ANGLE_CAPTURE_FILE, or null if it isn't set
+    static FrameCapture *GetDefault();
+
+    // Only the calls to the first context that makes any are recorded
+    template <typename... Params>
+    void captureCall(CallID id, const Context *context, const Params &... params)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (beginCall(id, context))
+        {
+            mWriter.writeParams(params...);
+            endCall();
+        }
+    }
+
+    // Client vertex arrays are only read by draws, so they are recorded before each draw as calls
+    // that point the enabled ones at copies of the vertices it reads.
+    void captureClientArrays(const Context *context, size_t vertexCount, GLsizei instanceCount);
+
+    // Applications write to mapped buffers directly, so their contents are recorded when they are
+    // unmapped.
+    void captureMappedBuffer(const Context *context, GLenum target);
+
+    // Ends a frame, and writes the trace so far to the file
+    void captureSwapBuffers(const Context *context, GLint width, GLint height);
+
+  private:
+    bool beginCall(CallID id, const Context *context);
+    void endCall();
+    void flush();
+
+    std::string mPath;
+    FILE *mFile;
+    bool mFailed;
+    const Context *mContext;
+    CaptureWriter mWriter;
+    std::mutex mMutex;
+};
+
+}
+
+// Records a call to a context when the capture is enabled. The parameters are only evaluated then,
+// so that the entry points don't pay for wrapping client memory otherwise.
+#define ANGLE_CAPTURE(Name, ...) \
+    do \
+    { \
+        gl::FrameCapture *frameCapture = gl::FrameCapture::GetDefault(); \
+        if (frameCapture != nullptr) \
+        { \
+            frameCapture->captureCall(gl::CALL_##Name, __VA_ARGS__); \
+        } \
+    } while (0)
+
+#define ANGLE_CAPTURE_CLIENT_ARRAYS(context, vertexCount, instanceCount) \
+    do \
+    { \
+        gl::FrameCapture *frameCapture = gl::FrameCapture::GetDefault(); \
+        if (frameCapture != nullptr) \
+        { \
+            frameCapture->captureClientArrays(context, vertexCount, instanceCount); \
+        } \
+    } while (0)
+
+#define ANGLE_CAPTURE_MAPPED_BUFFER(context, target) \
+    do \
+    { \
+        gl::FrameCapture *frameCapture = gl::FrameCapture::GetDefault(); \
+        if (frameCapture != nullptr) \
+        { \
+            frameCapture->captureMappedBuffer(context, target); \
+        } \
+    } while (0)
+
+#endif // LIBANGLE_FRAMECAPTURE_H_
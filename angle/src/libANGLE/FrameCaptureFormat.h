@@ -0,0 +1,512 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// FrameCaptureFormat.h: Defines the layout of the binary traces that gl::FrameCapture records, and
+// gl::CaptureReader, which decodes them. The replay tool includes this header on its own, so it
+// only depends on the GL headers.
+//
+// A trace starts with a header of the magic, the version of the format and the client version of
+// the context, and continues with one record per call: its CallID, a reserved word and the size of
+// its parameters, which follow. Integers are written as their own width, except that the ones the
+// size of a pointer are always written as 64 bits, so that traces from 32 bit processes replay in
+// 64 bit ones. Records and the memory in them are aligned to 8 bytes from the start of the trace.
+
+#ifndef LIBANGLE_FRAMECAPTUREFORMAT_H_
+#define LIBANGLE_FRAMECAPTUREFORMAT_H_
+
+#include "angle_gl.h"
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <stdint.h>
+#include <vector>
+
+namespace gl
+{
+
+// The entry points that are captured, in the order of their IDs. Calls are only ever appended, so
+// that older traces stay readable.
+#define ANGLE_CAPTURED_CALLS(OP) \
+    OP(ActiveTexture) \
+    OP(AttachShader) \
+    OP(BindAttribLocation) \
+    OP(BindBuffer) \
+    OP(BindFramebuffer) \
+    OP(BindRenderbuffer) \
+    OP(BindTexture) \
+    OP(BlendColor) \
+    OP(BlendEquationSeparate) \
+    OP(BlendFuncSeparate) \
+    OP(BufferData) \
+    OP(BufferSubData) \
+    OP(CheckFramebufferStatus) \
+    OP(Clear) \
+    OP(ClearColor) \
+    OP(ClearDepthf) \
+    OP(ClearStencil) \
+    OP(ColorMask) \
+    OP(CompileShader) \
+    OP(CompressedTexImage2D) \
+    OP(CompressedTexSubImage2D) \
+    OP(CopyTexImage2D) \
+    OP(CopyTexSubImage2D) \
+    OP(CreateProgram) \
+    OP(CreateShader) \
+    OP(CullFace) \
+    OP(DeleteBuffers) \
+    OP(DeleteFramebuffers) \
+    OP(DeleteProgram) \
+    OP(DeleteRenderbuffers) \
+    OP(DeleteShader) \
+    OP(DeleteTextures) \
+    OP(DepthFunc) \
+    OP(DepthMask) \
+    OP(DepthRangef) \
+    OP(DetachShader) \
+    OP(Disable) \
+    OP(DisableVertexAttribArray) \
+    OP(DrawArrays) \
+    OP(DrawElements) \
+    OP(Enable) \
+    OP(EnableVertexAttribArray) \
+    OP(Finish) \
+    OP(Flush) \
+    OP(FramebufferRenderbuffer) \
+    OP(FramebufferTexture2D) \
+    OP(FrontFace) \
+    OP(GenBuffers) \
+    OP(GenerateMipmap) \
+    OP(GenFramebuffers) \
+    OP(GenRenderbuffers) \
+    OP(GenTextures) \
+    OP(GetActiveAttrib) \
+    OP(GetActiveUniform) \
+    OP(GetAttachedShaders) \
+    OP(GetAttribLocation) \
+    OP(GetBooleanv) \
+    OP(GetBufferParameteriv) \
+    OP(GetError) \
+    OP(GetFloatv) \
+    OP(GetFramebufferAttachmentParameteriv) \
+    OP(GetIntegerv) \
+    OP(GetProgramiv) \
+    OP(GetProgramInfoLog) \
+    OP(GetRenderbufferParameteriv) \
+    OP(GetShaderiv) \
+    OP(GetShaderInfoLog) \
+    OP(GetShaderPrecisionFormat) \
+    OP(GetShaderSource) \
+    OP(GetTexParameterfv) \
+    OP(GetTexParameteriv) \
+    OP(GetUniformfv) \
+    OP(GetUniformiv) \
+    OP(GetUniformLocation) \
+    OP(GetVertexAttribfv) \
+    OP(GetVertexAttribiv) \
+    OP(GetVertexAttribPointerv) \
+    OP(Hint) \
+    OP(IsBuffer) \
+    OP(IsEnabled) \
+    OP(IsFramebuffer) \
+    OP(IsProgram) \
+    OP(IsRenderbuffer) \
+    OP(IsShader) \
+    OP(IsTexture) \
+    OP(LineWidth) \
+    OP(LinkProgram) \
+    OP(PixelStorei) \
+    OP(PolygonOffset) \
+    OP(ReadPixels) \
+    OP(ReleaseShaderCompiler) \
+    OP(RenderbufferStorage) \
+    OP(SampleCoverage) \
+    OP(Scissor) \
+    OP(ShaderBinary) \
+    OP(ShaderSource) \
+    OP(StencilFuncSeparate) \
+    OP(StencilMaskSeparate) \
+    OP(StencilOpSeparate) \
+    OP(TexImage2D) \
+    OP(TexParameterf) \
+    OP(TexParameteri) \
+    OP(TexSubImage2D) \
+    OP(Uniform1fv) \
+    OP(Uniform1iv) \
+    OP(Uniform2fv) \
+    OP(Uniform2iv) \
+    OP(Uniform3fv) \
+    OP(Uniform3iv) \
+    OP(Uniform4fv) \
+    OP(Uniform4iv) \
+    OP(UniformMatrix2fv) \
+    OP(UniformMatrix3fv) \
+    OP(UniformMatrix4fv) \
+    OP(UseProgram) \
+    OP(ValidateProgram) \
+    OP(VertexAttrib1f) \
+    OP(VertexAttrib1fv) \
+    OP(VertexAttrib2f) \
+    OP(VertexAttrib2fv) \
+    OP(VertexAttrib3f) \
+    OP(VertexAttrib3fv) \
+    OP(VertexAttrib4f) \
+    OP(VertexAttrib4fv) \
+    OP(VertexAttribPointer) \
+    OP(Viewport) \
+    OP(ReadBuffer) \
+    OP(DrawRangeElements) \
+    OP(TexImage3D) \
+    OP(TexSubImage3D) \
+    OP(CopyTexSubImage3D) \
+    OP(CompressedTexImage3D) \
+    OP(CompressedTexSubImage3D) \
+    OP(GenQueries) \
+    OP(DeleteQueries) \
+    OP(IsQuery) \
+    OP(BeginQuery) \
+    OP(EndQuery) \
+    OP(GetQueryiv) \
+    OP(GetQueryObjectuiv) \
+    OP(UnmapBuffer) \
+    OP(GetBufferPointerv) \
+    OP(DrawBuffers) \
+    OP(UniformMatrix2x3fv) \
+    OP(UniformMatrix3x2fv) \
+    OP(UniformMatrix2x4fv) \
+    OP(UniformMatrix4x2fv) \
+    OP(UniformMatrix3x4fv) \
+    OP(UniformMatrix4x3fv) \
+    OP(BlitFramebuffer) \
+    OP(RenderbufferStorageMultisample) \
+    OP(FramebufferTextureLayer) \
+    OP(MapBufferRange) \
+    OP(FlushMappedBufferRange) \
+    OP(BindVertexArray) \
+    OP(DeleteVertexArrays) \
+    OP(GenVertexArrays) \
+    OP(IsVertexArray) \
+    OP(GetIntegeri_v) \
+    OP(BeginTransformFeedback) \
+    OP(EndTransformFeedback) \
+    OP(BindBufferRange) \
+    OP(BindBufferBase) \
+    OP(TransformFeedbackVaryings) \
+    OP(GetTransformFeedbackVarying) \
+    OP(VertexAttribIPointer) \
+    OP(GetVertexAttribIiv) \
+    OP(GetVertexAttribIuiv) \
+    OP(VertexAttribI4i) \
+    OP(VertexAttribI4ui) \
+    OP(VertexAttribI4iv) \
+    OP(VertexAttribI4uiv) \
+    OP(GetUniformuiv) \
+    OP(GetFragDataLocation) \
+    OP(Uniform1uiv) \
+    OP(Uniform2uiv) \
+    OP(Uniform3uiv) \
+    OP(Uniform4uiv) \
+    OP(ClearBufferiv) \
+    OP(ClearBufferuiv) \
+    OP(ClearBufferfv) \
+    OP(ClearBufferfi) \
+    OP(GetStringi) \
+    OP(CopyBufferSubData) \
+    OP(GetUniformIndices) \
+    OP(GetActiveUniformsiv) \
+    OP(GetUniformBlockIndex) \
+    OP(GetActiveUniformBlockiv) \
+    OP(GetActiveUniformBlockName) \
+    OP(UniformBlockBinding) \
+    OP(DrawArraysInstanced) \
+    OP(DrawElementsInstanced) \
+    OP(FenceSync) \
+    OP(IsSync) \
+    OP(DeleteSync) \
+    OP(ClientWaitSync) \
+    OP(WaitSync) \
+    OP(GetInteger64v) \
+    OP(GetSynciv) \
+    OP(GetInteger64i_v) \
+    OP(GetBufferParameteri64v) \
+    OP(GenSamplers) \
+    OP(DeleteSamplers) \
+    OP(IsSampler) \
+    OP(BindSampler) \
+    OP(SamplerParameteri) \
+    OP(SamplerParameterf) \
+    OP(GetSamplerParameteriv) \
+    OP(GetSamplerParameterfv) \
+    OP(VertexAttribDivisor) \
+    OP(BindTransformFeedback) \
+    OP(DeleteTransformFeedbacks) \
+    OP(GenTransformFeedbacks) \
+    OP(IsTransformFeedback) \
+    OP(PauseTransformFeedback) \
+    OP(ResumeTransformFeedback) \
+    OP(GetProgramBinary) \
+    OP(ProgramBinary) \
+    OP(ProgramParameteri) \
+    OP(InvalidateFramebuffer) \
+    OP(InvalidateSubFramebuffer) \
+    OP(TexStorage2D) \
+    OP(TexStorage3D) \
+    OP(GetInternalformativ) \
+
+enum CallID : uint16_t
+{
+#define ANGLE_CAPTURED_CALL_ID(Name) CALL_##Name,
+    ANGLE_CAPTURED_CALLS(ANGLE_CAPTURED_CALL_ID)
+#undef ANGLE_CAPTURED_CALL_ID
+
+    // Recorded by the capture rather than an entry point: the end of a frame, with the size of the
+    // surface, and the contents of a buffer mapped for writing, just before it is unmapped.
+    CALL_SwapBuffers,
+    CALL_UpdateMappedBuffer,
+
+    CALL_COUNT
+};
+
+// Each pointer parameter starts with one of these tags
+enum CapturePointerTag : uint32_t
+{
+    CAPTURE_POINTER_NULL,
+    // An offset into the buffer bound for the call, or a pointer that isn't read during the call
+    CAPTURE_POINTER_OFFSET,
+    // Client memory that the call reads, copied into the trace
+    CAPTURE_POINTER_MEMORY,
+    // Memory that the call writes to, which the replay provides. A size of zero stands for the
+    // queries that write at most a few values.
+    CAPTURE_POINTER_OUTPUT,
+    // An array of null terminated strings
+    CAPTURE_POINTER_STRINGS,
+    // A sync object, named by its value in the captured process
+    CAPTURE_POINTER_SYNC,
+};
+
+const char CaptureMagic[8] = { 'A', 'N', 'G', 'L', 'E', 'C', 'A', 'P' };
+const uint32_t CaptureVersion = 1;
+const size_t CaptureHeaderSize = 16;
+const size_t CaptureRecordHeaderSize = 8;
+const size_t CaptureAlignment = 8;
+
+// Decodes a trace held in memory. The pointers it returns for client memory point into the trace,
+// and the ones for outputs stay valid until the next call is read.
+class CaptureReader
+{
+  public:
+    CaptureReader(const uint8_t *data, size_t size)
+        : mData(data),
+          mSize(size),
+          mNextCall(CaptureHeaderSize),
+          mCursor(0),
+          mCallEnd(0),
+          mMemorySize(0),
+          mError(false),
+          mOutput(DefaultOutputSize)
+    {
+    }
+
+    // Returns false if this isn't a trace of a version that can be replayed
+    bool readHeader(GLint *clientVersion)
+    {
+        uint32_t version = 0;
+        uint32_t captureClientVersion = 0;
+        if (mSize < CaptureHeaderSize || memcmp(mData, CaptureMagic, sizeof(CaptureMagic)) != 0)
+        {
+            return false;
+        }
+        memcpy(&version, mData + 8, sizeof(version));
+        memcpy(&captureClientVersion, mData + 12, sizeof(captureClientVersion));
+        *clientVersion = static_cast<GLint>(captureClientVersion);
+        return version == CaptureVersion;
+    }
+
+    // Moves to the next call. Returns false at the end of the trace, or when the rest of it is
+    // truncated.
+    bool nextCall(CallID *id)
+    {
+        mLargeOutputs.clear();
+        mStrings.clear();
+
+        uint16_t callId = 0;
+        uint32_t size = 0;
+        if (mNextCall + CaptureRecordHeaderSize > mSize)
+        {
+            return false;
+        }
+        memcpy(&callId, mData + mNextCall, sizeof(callId));
+        memcpy(&size, mData + mNextCall + 4, sizeof(size));
+
+        mCursor = mNextCall + CaptureRecordHeaderSize;
+        if (size > mSize - mCursor || callId >= CALL_COUNT)
+        {
+            return false;
+        }
+        mCallEnd = mCursor + size;
+        mNextCall = mCallEnd;
+        *id = static_cast<CallID>(callId);
+        return true;
+    }
+
+    // Set once a parameter is read past the end of its call
+    bool hasError() const { return mError; }
+
+    void read(unsigned char *value) { readRaw(value); }
+    void read(int *value) { readRaw(value); }
+    void read(unsigned int *value) { readRaw(value); }
+    void read(float *value) { readRaw(value); }
+    void read(long *value) { readWide<int64_t>(value); }
+    void read(unsigned long *value) { readWide<uint64_t>(value); }
+    void read(long long *value) { readWide<int64_t>(value); }
+    void read(unsigned long long *value) { readWide<uint64_t>(value); }
+
+    template <typename T>
+    void read(T **pointer)
+    {
+        uint32_t tag = CAPTURE_POINTER_NULL;
+        readRaw(&tag);
+
+        uint64_t value = 0;
+        switch (tag)
+        {
+          case CAPTURE_POINTER_OFFSET:
+            readRaw(&value);
+            *pointer = reinterpret_cast<T *>(static_cast<uintptr_t>(value));
+            return;
+
+          case CAPTURE_POINTER_MEMORY:
+            *pointer = reinterpret_cast<T *>(const_cast<uint8_t *>(readMemory()));
+            return;
+
+          case CAPTURE_POINTER_OUTPUT:
+            *pointer = reinterpret_cast<T *>(getOutput());
+            return;
+
+          case CAPTURE_POINTER_STRINGS:
+            *pointer = static_cast<T *>(static_cast<void *>(readStrings()));
+            return;
+
+          case CAPTURE_POINTER_SYNC:
+            readRaw(&value);
+            *pointer = reinterpret_cast<T *>(mSyncs[value]);
+            return;
+
+          default:
+            *pointer = nullptr;
+            return;
+        }
+    }
+
+    // FenceSync is followed by the sync object it returned, which later calls refer to
+    void readSync(uint64_t *capturedSync)
+    {
+        uint32_t tag = CAPTURE_POINTER_NULL;
+        readRaw(&tag);
+        readRaw(capturedSync);
+    }
+
+    void mapSync(uint64_t capturedSync, GLsync sync) { mSyncs[capturedSync] = sync; }
+
+    // The size of the memory the last client memory parameter pointed to
+    size_t getMemorySize() const { return mMemorySize; }
+
+  private:
+    static const size_t DefaultOutputSize = 64 * 1024;
+
+    static size_t Align(size_t offset)
+    {
+        return (offset + CaptureAlignment - 1) & ~(CaptureAlignment - 1);
+    }
+
+    template <typename T>
+    void readRaw(T *value)
+    {
+        if (sizeof(T) > mCallEnd - mCursor)
+        {
+            mError = true;
+            *value = T();
+            return;
+        }
+        memcpy(value, mData + mCursor, sizeof(T));
+        mCursor += sizeof(T);
+    }
+
+    template <typename Wide, typename T>
+    void readWide(T *value)
+    {
+        Wide wide = 0;
+        readRaw(&wide);
+        *value = static_cast<T>(wide);
+    }
+
+    const uint8_t *readMemory()
+    {
+        uint32_t size = 0;
+        readRaw(&size);
+        mCursor = Align(mCursor);
+        if (mCursor > mCallEnd || size > mCallEnd - mCursor)
+        {
+            mError = true;
+            mMemorySize = 0;
+            return nullptr;
+        }
+
+        const uint8_t *memory = mData + mCursor;
+        mMemorySize = size;
+        mCursor = std::min(Align(mCursor + size), mCallEnd);
+        return memory;
+    }
+
+    uint8_t *getOutput()
+    {
+        uint32_t size = 0;
+        readRaw(&size);
+        if (size <= mOutput.size())
+        {
+            return mOutput.data();
+        }
+
+        mLargeOutputs.push_back(std::vector<uint8_t>(size));
+        return mLargeOutputs.back().data();
+    }
+
+    const char **readStrings()
+    {
+        uint32_t count = 0;
+        readRaw(&count);
+        for (uint32_t stringIndex = 0; stringIndex < count && !mError; stringIndex++)
+        {
+            uint32_t length = 0;
+            readRaw(&length);
+            if (length >= mCallEnd - mCursor || mData[mCursor + length] != '\0')
+            {
+                mError = true;
+                break;
+            }
+            mStrings.push_back(reinterpret_cast<const char *>(mData + mCursor));
+            mCursor += length + 1;
+        }
+        return mStrings.empty() ? nullptr : mStrings.data();
+    }
+
+    const uint8_t *mData;
+    size_t mSize;
+    size_t mNextCall;
+    size_t mCursor;
+    size_t mCallEnd;
+    size_t mMemorySize;
+    bool mError;
+
+    std::vector<uint8_t> mOutput;
+    std::vector<std::vector<uint8_t>> mLargeOutputs;
+    std::vector<const char *> mStrings;
+    std::map<uint64_t, GLsync> mSyncs;
+};
+
+}
+
+#endif // LIBANGLE_FRAMECAPTUREFORMAT_H_
@@ -0,0 +1,238 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// FrameCapture_unittest.cpp: Unit tests that the calls written by gl::CaptureWriter are read back
+// by gl::CaptureReader with the same parameters.
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "libANGLE/FrameCapture.h"
+
+using namespace gl;
+
+namespace
+{
+
+// Scalars keep their width, except that the ones the size of a pointer are widened to 64 bits
+TEST(FrameCaptureTest, Scalars)
+{
+    CaptureWriter writer;
+    writer.writeHeader(3);
+    writer.beginCall(CALL_BufferSubData);
+    writer.writeParams(static_cast<GLenum>(GL_ARRAY_BUFFER), static_cast<GLintptr>(-4),
+                       static_cast<GLsizeiptr>(0x123456789ll), static_cast<GLboolean>(GL_TRUE), 2.5f, -7);
+    writer.endCall();
+    writer.beginCall(CALL_Finish);
+    writer.endCall();
+
+    const std::vector<uint8_t> &trace = writer.getData();
+    EXPECT_EQ(0u, trace.size() % CaptureAlignment);
+
+    CaptureReader reader(trace.data(), trace.size());
+    GLint clientVersion = 0;
+    ASSERT_TRUE(reader.readHeader(&clientVersion));
+    EXPECT_EQ(3, clientVersion);
+
+    CallID id;
+    ASSERT_TRUE(reader.nextCall(&id));
+    EXPECT_EQ(CALL_BufferSubData, id);
+
+    GLenum target = 0;
+    GLintptr offset = 0;
+    long long size = 0;
+    GLboolean flag = GL_FALSE;
+    GLfloat value = 0.0f;
+    GLint integer = 0;
+    reader.read(&target);
+    reader.read(&offset);
+    reader.read(&size);
+    reader.read(&flag);
+    reader.read(&value);
+    reader.read(&integer);
+    EXPECT_EQ(static_cast<GLenum>(GL_ARRAY_BUFFER), target);
+    EXPECT_EQ(-4, offset);
+    EXPECT_EQ(0x123456789ll, size);
+    EXPECT_EQ(GL_TRUE, flag);
+    EXPECT_EQ(2.5f, value);
+    EXPECT_EQ(-7, integer);
+    EXPECT_FALSE(reader.hasError());
+
+    ASSERT_TRUE(reader.nextCall(&id));
+    EXPECT_EQ(CALL_Finish, id);
+
+    // Reading past the end of a call is an error rather than a read of the next one
+    reader.read(&integer);
+    EXPECT_TRUE(reader.hasError());
+    EXPECT_FALSE(reader.nextCall(&id));
+}
+
+// Client memory is copied into the trace, aligned so that the replay can read it in place
+TEST(FrameCaptureTest, Pointers)
+{
+    const GLushort indices[] = { 0, 1, 2, 2, 1, 3, 7 };
+    const GLchar *name = "position";
+
+    CaptureWriter writer;
+    writer.writeHeader(2);
+    writer.beginCall(CALL_GetActiveAttrib);
+    writer.writeParams(static_cast<GLboolean>(GL_FALSE), CaptureArray(indices, 7, sizeof(GLushort)),
+                       CaptureString(name), CaptureOffset(reinterpret_cast<const void *>(48)), CaptureNull(),
+                       CaptureOutput(100000), CaptureOutput(0), CaptureMemory(indices, -1));
+    writer.endCall();
+
+    const std::vector<uint8_t> &trace = writer.getData();
+    CaptureReader reader(trace.data(), trace.size());
+    GLint clientVersion = 0;
+    CallID id;
+    ASSERT_TRUE(reader.readHeader(&clientVersion));
+    ASSERT_TRUE(reader.nextCall(&id));
+
+    GLboolean flag = GL_TRUE;
+    const GLushort *readIndices = nullptr;
+    const GLchar *readName = nullptr;
+    const void *offset = nullptr;
+    const void *null = &flag;
+    GLchar *largeOutput = nullptr;
+    GLint *output = nullptr;
+    const void *empty = nullptr;
+    reader.read(&flag);
+
+    reader.read(&readIndices);
+    ASSERT_NE(nullptr, readIndices);
+    EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(readIndices) % CaptureAlignment);
+    EXPECT_EQ(sizeof(indices), reader.getMemorySize());
+    EXPECT_EQ(0, memcmp(indices, readIndices, sizeof(indices)));
+
+    reader.read(&readName);
+    EXPECT_EQ(std::string(name), readName);
+
+    reader.read(&offset);
+    EXPECT_EQ(48u, reinterpret_cast<uintptr_t>(offset));
+
+    reader.read(&null);
+    EXPECT_EQ(nullptr, null);
+
+    // Outputs are writable, however large
+    reader.read(&largeOutput);
+    ASSERT_NE(nullptr, largeOutput);
+    largeOutput[99999] = 'x';
+
+    reader.read(&output);
+    ASSERT_NE(nullptr, output);
+    output[0] = 1;
+
+    reader.read(&empty);
+    EXPECT_NE(nullptr, empty);
+    EXPECT_EQ(0u, reader.getMemorySize());
+
+    EXPECT_FALSE(reader.hasError());
+}
+
+// Strings are written with their terminators, whether they were given by length or not
+TEST(FrameCaptureTest, Strings)
+{
+    const GLchar *strings[] = { "void main()XXXX", " { gl_Position = vec4(0); }", "" };
+    const GLint lengths[] = { 11, -1, 0 };
+
+    CaptureWriter writer;
+    writer.writeHeader(2);
+    writer.beginCall(CALL_ShaderSource);
+    writer.writeParams(5u, 3, CaptureStrings(3, strings, lengths), CaptureNull());
+    writer.endCall();
+
+    const std::vector<uint8_t> &trace = writer.getData();
+    CaptureReader reader(trace.data(), trace.size());
+    GLint clientVersion = 0;
+    CallID id;
+    ASSERT_TRUE(reader.readHeader(&clientVersion));
+    ASSERT_TRUE(reader.nextCall(&id));
+
+    GLuint shader = 0;
+    GLsizei count = 0;
+    const GLchar *const *readStrings = nullptr;
+    const GLint *readLengths = lengths;
+    reader.read(&shader);
+    reader.read(&count);
+    reader.read(&readStrings);
+    reader.read(&readLengths);
+
+    EXPECT_EQ(5u, shader);
+    ASSERT_EQ(3, count);
+    ASSERT_NE(nullptr, readStrings);
+    EXPECT_EQ(std::string("void main()"), readStrings[0]);
+    EXPECT_EQ(std::string(" { gl_Position = vec4(0); }"), readStrings[1]);
+    EXPECT_EQ(std::string(), readStrings[2]);
+    EXPECT_EQ(nullptr, readLengths);
+    EXPECT_FALSE(reader.hasError());
+}
+
+// Sync objects are named by their captured values, which the replay maps to its own
+TEST(FrameCaptureTest, Syncs)
+{
+    GLsync capturedSync = reinterpret_cast<GLsync>(static_cast<uintptr_t>(0x1230));
+    GLsync replayedSync = reinterpret_cast<GLsync>(static_cast<uintptr_t>(0x4560));
+
+    CaptureWriter writer;
+    writer.writeHeader(3);
+    writer.beginCall(CALL_FenceSync);
+    writer.writeParams(static_cast<GLenum>(GL_SYNC_GPU_COMMANDS_COMPLETE), 0u, capturedSync);
+    writer.endCall();
+    writer.beginCall(CALL_DeleteSync);
+    writer.writeParams(capturedSync);
+    writer.endCall();
+
+    const std::vector<uint8_t> &trace = writer.getData();
+    CaptureReader reader(trace.data(), trace.size());
+    GLint clientVersion = 0;
+    CallID id;
+    ASSERT_TRUE(reader.readHeader(&clientVersion));
+
+    GLenum condition = 0;
+    GLbitfield flags = 1;
+    uint64_t sync = 0;
+    ASSERT_TRUE(reader.nextCall(&id));
+    reader.read(&condition);
+    reader.read(&flags);
+    reader.readSync(&sync);
+    reader.mapSync(sync, replayedSync);
+
+    GLsync deletedSync = nullptr;
+    ASSERT_TRUE(reader.nextCall(&id));
+    EXPECT_EQ(CALL_DeleteSync, id);
+    reader.read(&deletedSync);
+    EXPECT_EQ(replayedSync, deletedSync);
+    EXPECT_FALSE(reader.hasError());
+}
+
+// Traces that end in the middle of a call stop before it
+TEST(FrameCaptureTest, Truncated)
+{
+    const GLfloat values[] = { 1.0f, 2.0f, 3.0f, 4.0f };
+
+    CaptureWriter writer;
+    writer.writeHeader(2);
+    writer.beginCall(CALL_Uniform4fv);
+    writer.writeParams(0, 1, CaptureArray(values, 1, sizeof(values)));
+    writer.endCall();
+
+    std::vector<uint8_t> trace = writer.getData();
+    trace.resize(trace.size() - 4);
+
+    CaptureReader reader(trace.data(), trace.size());
+    GLint clientVersion = 0;
+    CallID id;
+    ASSERT_TRUE(reader.readHeader(&clientVersion));
+    EXPECT_FALSE(reader.nextCall(&id));
+
+    CaptureReader notATrace(trace.data() + 1, trace.size() - 1);
+    EXPECT_FALSE(notATrace.readHeader(&clientVersion));
+}
+
+}
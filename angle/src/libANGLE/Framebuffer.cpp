@@ -25,19 +25,6 @@
 namespace gl
 {
 
-namespace
-{
-void DetachMatchingAttachment(FramebufferAttachment *attachment, GLenum matchType, GLuint matchId)
-{
-    if (attachment->isAttached() &&
-        attachment->type() == matchType &&
-        attachment->id() == matchId)
-    {
-        attachment->detach();
-    }
-}
-}
-
 Framebuffer::Data::Data(const Caps &caps)
     : mColorAttachments(caps.maxColorAttachments),
       mDrawBufferStates(caps.maxDrawBuffers, GL_NONE),
@@ -119,7 +106,8 @@ const FramebufferAttachment *Framebuffer::Data::getDepthStencilAttachment() cons
 Framebuffer::Framebuffer(const Caps &caps, rx::ImplFactory *factory, GLuint id)
     : mData(caps),
       mImpl(nullptr),
-      mId(id)
+      mId(id),
+      mCachedStatus(GL_NONE)
 {
     if (mId == 0)
     {
@@ -134,6 +122,13 @@ Framebuffer::Framebuffer(const Caps &caps, rx::ImplFactory *factory, GLuint id)
 
 Framebuffer::~Framebuffer()
 {
+    for (auto &colorAttachment : mData.mColorAttachments)
+    {
+        detachResource(&colorAttachment);
+    }
+    detachResource(&mData.mDepthAttachment);
+    detachResource(&mData.mStencilAttachment);
+
     SafeDelete(mImpl);
 }
 
@@ -151,11 +146,11 @@ void Framebuffer::detachResourceById(GLenum resourceType, GLuint resourceId)
 {
     for (auto &colorAttachment : mData.mColorAttachments)
     {
-        DetachMatchingAttachment(&colorAttachment, resourceType, resourceId);
+        detachMatchingResource(&colorAttachment, resourceType, resourceId);
     }
 
-    DetachMatchingAttachment(&mData.mDepthAttachment, resourceType, resourceId);
-    DetachMatchingAttachment(&mData.mStencilAttachment, resourceType, resourceId);
+    detachMatchingResource(&mData.mDepthAttachment, resourceType, resourceId);
+    detachMatchingResource(&mData.mStencilAttachment, resourceType, resourceId);
 }
 
 const FramebufferAttachment *Framebuffer::getColorbuffer(unsigned int colorAttachment) const
@@ -242,6 +237,7 @@ void Framebuffer::setDrawBuffers(size_t count, const GLenum *buffers)
     std::copy(buffers, buffers + count, drawStates.begin());
     std::fill(drawStates.begin() + count, drawStates.end(), GL_NONE);
     mImpl->setDrawBuffers(count, buffers);
+    mCachedStatus = GL_NONE;
 }
 
 GLenum Framebuffer::getReadBufferState() const
@@ -256,6 +252,7 @@ void Framebuffer::setReadBuffer(GLenum buffer)
             (buffer - GL_COLOR_ATTACHMENT0) < mData.mColorAttachments.size()));
     mData.mReadBufferState = buffer;
     mImpl->setReadBuffer(buffer);
+    mCachedStatus = GL_NONE;
 }
 
 bool Framebuffer::isEnabledColorAttachment(unsigned int colorAttachment) const
@@ -305,6 +302,16 @@ GLenum Framebuffer::checkStatus(const gl::Data &data) const
         return GL_FRAMEBUFFER_COMPLETE;
     }
 
+    if (mCachedStatus == GL_NONE)
+    {
+        mCachedStatus = computeStatus(data);
+    }
+
+    return mCachedStatus;
+}
+
+GLenum Framebuffer::computeStatus(const gl::Data &data) const
+{
     int width = 0;
     int height = 0;
     unsigned int colorbufferSize = 0;
@@ -606,13 +613,13 @@ void Framebuffer::setAttachment(GLenum type,
         const InternalFormat &formatInfo = GetInternalFormatInfo(internalFormat);
         if (resource && formatInfo.depthBits > 0 && formatInfo.stencilBits > 0)
         {
-            mData.mDepthAttachment.attach(type, binding, textureIndex, resource);
-            mData.mStencilAttachment.attach(type, binding, textureIndex, resource);
+            attachResource(&mData.mDepthAttachment, type, binding, textureIndex, resource);
+            attachResource(&mData.mStencilAttachment, type, binding, textureIndex, resource);
         }
         else
         {
-            mData.mDepthAttachment.detach();
-            mData.mStencilAttachment.detach();
+            detachResource(&mData.mDepthAttachment);
+            detachResource(&mData.mStencilAttachment);
         }
         mImpl->onUpdateDepthStencilAttachment();
     }
@@ -622,28 +629,30 @@ void Framebuffer::setAttachment(GLenum type,
         {
           case GL_DEPTH:
           case GL_DEPTH_ATTACHMENT:
-            mData.mDepthAttachment.attach(type, binding, textureIndex, resource);
+            attachResource(&mData.mDepthAttachment, type, binding, textureIndex, resource);
             mImpl->onUpdateDepthAttachment();
             break;
           case GL_STENCIL:
           case GL_STENCIL_ATTACHMENT:
-            mData.mStencilAttachment.attach(type, binding, textureIndex, resource);
+            attachResource(&mData.mStencilAttachment, type, binding, textureIndex, resource);
             mImpl->onUpdateStencilAttachment();
             break;
           case GL_BACK:
-            mData.mColorAttachments[0].attach(type, binding, textureIndex, resource);
+            attachResource(&mData.mColorAttachments[0], type, binding, textureIndex, resource);
             mImpl->onUpdateColorAttachment(0);
             break;
           default:
             {
                 size_t colorIndex = binding - GL_COLOR_ATTACHMENT0;
                 ASSERT(colorIndex < mData.mColorAttachments.size());
-                mData.mColorAttachments[colorIndex].attach(type, binding, textureIndex, resource);
+                attachResource(&mData.mColorAttachments[colorIndex], type, binding, textureIndex, resource);
                 mImpl->onUpdateColorAttachment(colorIndex);
             }
             break;
         }
     }
+
+    mCachedStatus = GL_NONE;
 }
 
 void Framebuffer::resetAttachment(GLenum binding)
@@ -651,4 +660,46 @@ void Framebuffer::resetAttachment(GLenum binding)
     setAttachment(GL_NONE, binding, ImageIndex::MakeInvalid(), nullptr);
 }
 
+void Framebuffer::onSubjectStateChange()
+{
+    // An attached texture or renderbuffer changed storage
+    mCachedStatus = GL_NONE;
+}
+
+void Framebuffer::attachResource(FramebufferAttachment *attachment,
+                                 GLenum type,
+                                 GLenum binding,
+                                 const ImageIndex &textureIndex,
+                                 FramebufferAttachmentObject *resource)
+{
+    // Stop observing the old resource before the attachment releases it
+    detachResource(attachment);
+
+    attachment->attach(type, binding, textureIndex, resource);
+    if (attachment->isAttached() && resource != nullptr)
+    {
+        resource->addObserver(this);
+    }
+}
+
+void Framebuffer::detachResource(FramebufferAttachment *attachment)
+{
+    if (attachment->isAttached() && attachment->getResource() != nullptr)
+    {
+        attachment->getResource()->removeObserver(this);
+    }
+    attachment->detach();
+}
+
+void Framebuffer::detachMatchingResource(FramebufferAttachment *attachment, GLenum matchType, GLuint matchId)
+{
+    if (attachment->isAttached() &&
+        attachment->type() == matchType &&
+        attachment->id() == matchId)
+    {
+        detachResource(attachment);
+        mCachedStatus = GL_NONE;
+    }
+}
+
 }
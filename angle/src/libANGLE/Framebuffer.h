@@ -16,6 +16,7 @@
 #include "libANGLE/Constants.h"
 #include "libANGLE/Error.h"
 #include "libANGLE/FramebufferAttachment.h"
+#include "libANGLE/Observer.h"
 #include "libANGLE/RefCountObject.h"
 
 namespace rx
@@ -43,7 +44,9 @@ struct Extensions;
 struct ImageIndex;
 struct Rectangle;
 
-class Framebuffer
+// The completeness status is cached. Framebuffers observe the textures and renderbuffers
+// attached to them, and drop the cached status when one of them changes storage.
+class Framebuffer : public Observer
 {
   public:
 
@@ -135,12 +138,30 @@ class Framebuffer
     Error blit(const gl::State &state, const gl::Rectangle &sourceArea, const gl::Rectangle &destArea,
                GLbitfield mask, GLenum filter, const gl::Framebuffer *sourceFramebuffer);
 
+    void onSubjectStateChange() override;
+
   protected:
     void detachResourceById(GLenum resourceType, GLuint resourceId);
 
     Data mData;
     rx::FramebufferImpl *mImpl;
     GLuint mId;
+
+  private:
+    GLenum computeStatus(const gl::Data &data) const;
+
+    void attachResource(FramebufferAttachment *attachment,
+                        GLenum type,
+                        GLenum binding,
+                        const ImageIndex &textureIndex,
+                        FramebufferAttachmentObject *resource);
+    void detachResource(FramebufferAttachment *attachment);
+    void detachMatchingResource(FramebufferAttachment *attachment, GLenum matchType, GLuint matchId);
+
+    // Framebuffers are not shared between contexts, so the status only depends on the
+    // attachments and never on the context data passed to checkStatus. GL_NONE until
+    // the status is computed again.
+    mutable GLenum mCachedStatus;
 };
 
 }
@@ -14,6 +14,7 @@
 #include "common/angleutils.h"
 #include "libANGLE/Error.h"
 #include "libANGLE/ImageIndex.h"
+#include "libANGLE/Observer.h"
 #include "libANGLE/RefCountObject.h"
 
 namespace egl
@@ -129,6 +130,7 @@ class FramebufferAttachment final
     GLsizei getSamples() const;
     GLenum type() const { return mType; }
     bool isAttached() const { return mType != GL_NONE; }
+    FramebufferAttachmentObject *getResource() const { return mResource.get(); }
 
     Renderbuffer *getRenderbuffer() const;
     Texture *getTexture() const;
@@ -153,8 +155,9 @@ class FramebufferAttachment final
     BindingPointer<FramebufferAttachmentObject> mResource;
 };
 
-// A base class for objects that FBO Attachments may point to.
-class FramebufferAttachmentObject : public RefCountObject
+// A base class for objects that FBO Attachments may point to. Observers are notified
+// when the size or format of any of the object's images changes.
+class FramebufferAttachmentObject : public RefCountObject, public Subject
 {
   public:
     FramebufferAttachmentObject(GLuint id) : RefCountObject(id) {}
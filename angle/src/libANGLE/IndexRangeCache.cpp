@@ -12,80 +12,250 @@
 #include "common/debug.h"
 #include "libANGLE/formatutils.h"
 
+#include <algorithm>
+
 namespace gl
 {
 
-void IndexRangeCache::addRange(GLenum type, unsigned int offset, GLsizei count, const RangeUI &range)
+// vector::assign takes the fill value by reference, so EmptySlot needs a definition
+const int IndexRangeCache::EmptySlot;
+
+IndexRangeCache::IndexRangeCache()
+    : mEntryCount(0),
+      mClockHand(0),
+      mMaxEntrySize(0),
+      mHitCount(0),
+      mMissCount(0)
 {
-    mIndexRangeCache[IndexRange(type, offset, count)] = range;
 }
 
-void IndexRangeCache::invalidateRange(unsigned int offset, unsigned int size)
+size_t IndexRangeCache::HashKey(GLenum type, unsigned int offset, GLsizei count)
 {
-    unsigned int invalidateStart = offset;
-    unsigned int invalidateEnd = offset + size;
+    unsigned int hash = offset * 0x9E3779B1u;
+    hash ^= static_cast<unsigned int>(count) * 0x85EBCA77u;
+    hash ^= type;
+    hash ^= hash >> 15;
+    return hash & (TableSize - 1);
+}
 
-    IndexRangeMap::iterator i = mIndexRangeCache.begin();
-    while (i != mIndexRangeCache.end())
+size_t IndexRangeCache::findSlot(GLenum type, unsigned int offset, GLsizei count) const
+{
+    // The table is never more than half full, so the probe always reaches an empty slot
+    size_t slot = HashKey(type, offset, count);
+    while (mTable[slot] != EmptySlot)
     {
-        unsigned int rangeStart = i->first.offset;
-        unsigned int rangeEnd = i->first.offset + (GetTypeInfo(i->first.type).bytes * i->first.count);
-
-        if (invalidateEnd < rangeStart || invalidateStart > rangeEnd)
+        const Entry &entry = mEntries[mTable[slot]];
+        if (entry.offset == offset && entry.count == count && entry.type == type)
         {
-            ++i;
-        }
-        else
-        {
-            mIndexRangeCache.erase(i++);
+            break;
         }
+        slot = (slot + 1) & (TableSize - 1);
     }
+    return slot;
 }
 
-bool IndexRangeCache::findRange(GLenum type, unsigned int offset, GLsizei count,
-                                RangeUI *outRange) const
+void IndexRangeCache::addRange(GLenum type, unsigned int offset, GLsizei count, const RangeUI &range)
 {
-    IndexRangeMap::const_iterator i = mIndexRangeCache.find(IndexRange(type, offset, count));
-    if (i != mIndexRangeCache.end())
+    if (mTable.empty())
     {
-        if (outRange)
-        {
-            *outRange = i->second;
-        }
-        return true;
+        mTable.assign(TableSize, EmptySlot);
+        mEntries.reserve(MaxEntries);
+    }
+
+    size_t slot = findSlot(type, offset, count);
+    if (mTable[slot] != EmptySlot)
+    {
+        mEntries[mTable[slot]].range = range;
+        return;
+    }
+
+    size_t entryIndex = 0;
+    if (!mFreeEntries.empty())
+    {
+        entryIndex = mFreeEntries.back();
+        mFreeEntries.pop_back();
+    }
+    else if (mEntries.size() < MaxEntries)
+    {
+        entryIndex = mEntries.size();
+        mEntries.push_back(Entry());
     }
     else
     {
-        if (outRange)
+        entryIndex = evictEntry();
+
+        // Removing the evicted entry may have moved the empty slot the new one belongs in
+        slot = findSlot(type, offset, count);
+    }
+
+    const unsigned int entrySize = GetTypeInfo(type).bytes * static_cast<unsigned int>(count);
+
+    Entry &entry = mEntries[entryIndex];
+    entry.type = type;
+    entry.offset = offset;
+    entry.count = count;
+    entry.end = offset + entrySize;
+    entry.range = range;
+    entry.used = true;
+    entry.referenced = false;
+
+    mTable[slot] = static_cast<int>(entryIndex);
+    mEntryCount++;
+
+    auto position = std::upper_bound(mEntriesByOffset.begin(), mEntriesByOffset.end(), offset,
+                                     [this](unsigned int value, size_t index) { return value < mEntries[index].offset; });
+    mEntriesByOffset.insert(position, entryIndex);
+    mMaxEntrySize = std::max(mMaxEntrySize, entrySize);
+}
+
+bool IndexRangeCache::findRange(GLenum type, unsigned int offset, GLsizei count, RangeUI *outRange)
+{
+    if (mEntryCount > 0)
+    {
+        size_t slot = findSlot(type, offset, count);
+        if (mTable[slot] != EmptySlot)
         {
-            *outRange = RangeUI(0, 0);
+            Entry &entry = mEntries[mTable[slot]];
+            entry.referenced = true;
+            mHitCount++;
+
+            if (outRange)
+            {
+                *outRange = entry.range;
+            }
+            return true;
         }
-        return false;
     }
+
+    mMissCount++;
+    if (outRange)
+    {
+        *outRange = RangeUI(0, 0);
+    }
+    return false;
 }
 
-void IndexRangeCache::clear()
+size_t IndexRangeCache::evictEntry()
 {
-    mIndexRangeCache.clear();
+    ASSERT(mEntryCount == MaxEntries);
+
+    // Every entry is in use when the cache is full
+    for (;;)
+    {
+        size_t entryIndex = mClockHand;
+        mClockHand = (mClockHand + 1) % MaxEntries;
+
+        Entry &entry = mEntries[entryIndex];
+        if (entry.referenced)
+        {
+            entry.referenced = false;
+            continue;
+        }
+
+        removeEntry(entryIndex);
+
+        ASSERT(mFreeEntries.back() == entryIndex);
+        mFreeEntries.pop_back();
+        return entryIndex;
+    }
 }
 
-IndexRangeCache::IndexRange::IndexRange()
-    : IndexRangeCache::IndexRange(GL_NONE, 0, 0)
+void IndexRangeCache::removeEntry(size_t entryIndex)
 {
+    Entry &entry = mEntries[entryIndex];
+    ASSERT(entry.used);
+
+    // Remove the entry from the hash table, moving later entries of the probe sequence back into
+    // the freed slot so that lookups never stop early
+    size_t emptySlot = findSlot(entry.type, entry.offset, entry.count);
+    ASSERT(mTable[emptySlot] == static_cast<int>(entryIndex));
+
+    size_t slot = emptySlot;
+    for (;;)
+    {
+        slot = (slot + 1) & (TableSize - 1);
+        if (mTable[slot] == EmptySlot)
+        {
+            break;
+        }
+
+        const Entry &moved = mEntries[mTable[slot]];
+        size_t home = HashKey(moved.type, moved.offset, moved.count);
+
+        // Leave the entry where it is if its home slot lies cyclically in (emptySlot, slot]
+        bool reachable = (emptySlot <= slot) ? (emptySlot < home && home <= slot)
+                                             : (emptySlot < home || home <= slot);
+        if (!reachable)
+        {
+            mTable[emptySlot] = mTable[slot];
+            emptySlot = slot;
+        }
+    }
+    mTable[emptySlot] = EmptySlot;
+
+    auto position = std::lower_bound(mEntriesByOffset.begin(), mEntriesByOffset.end(), entry.offset,
+                                     [this](size_t index, unsigned int value) { return mEntries[index].offset < value; });
+    while (*position != entryIndex)
+    {
+        ++position;
+    }
+    mEntriesByOffset.erase(position);
+
+    entry.used = false;
+    mFreeEntries.push_back(entryIndex);
+    mEntryCount--;
 }
 
-IndexRangeCache::IndexRange::IndexRange(GLenum typ, intptr_t off, GLsizei c)
-    : type(typ),
-      offset(static_cast<unsigned int>(off)),
-      count(c)
+void IndexRangeCache::invalidateRange(unsigned int offset, unsigned int size)
 {
+    if (mEntryCount == 0)
+    {
+        return;
+    }
+
+    unsigned int invalidateStart = offset;
+    unsigned int invalidateEnd = offset + size;
+
+    // Entries that touch the invalidated range start at most mMaxEntrySize bytes before it
+    unsigned int searchStart = (invalidateStart > mMaxEntrySize) ? (invalidateStart - mMaxEntrySize) : 0;
+    size_t position = std::lower_bound(mEntriesByOffset.begin(), mEntriesByOffset.end(), searchStart,
+                                       [this](size_t index, unsigned int value) { return mEntries[index].offset < value; }) -
+                      mEntriesByOffset.begin();
+
+    while (position < mEntriesByOffset.size())
+    {
+        const Entry &entry = mEntries[mEntriesByOffset[position]];
+        if (entry.offset > invalidateEnd)
+        {
+            break;
+        }
+
+        if (entry.end < invalidateStart)
+        {
+            position++;
+        }
+        else
+        {
+            // Removing the entry shifts the following ones down into this position
+            removeEntry(mEntriesByOffset[position]);
+        }
+    }
 }
 
-bool IndexRangeCache::IndexRange::operator<(const IndexRange& rhs) const
+void IndexRangeCache::clear()
 {
-    if (type != rhs.type) return type < rhs.type;
-    if (offset != rhs.offset) return offset < rhs.offset;
-    return count < rhs.count;
+    if (mEntryCount == 0)
+    {
+        return;
+    }
+
+    mTable.assign(TableSize, EmptySlot);
+    mEntries.clear();
+    mFreeEntries.clear();
+    mEntriesByOffset.clear();
+    mEntryCount = 0;
+    mClockHand = 0;
+    mMaxEntrySize = 0;
 }
 
 }
@@ -15,35 +15,66 @@
 
 #include "angle_gl.h"
 
-#include <map>
+#include <vector>
 
 namespace gl
 {
 
-class IndexRangeCache
+// Holds at most MaxEntries ranges in an open-addressed hash table. When it is full, a clock
+// sweep evicts a range that hasn't been found since the hand last passed it. The entries are
+// also kept sorted by offset so that invalidation only looks at the ones that may overlap.
+class IndexRangeCache final : angle::NonCopyable
 {
   public:
+    static const size_t MaxEntries = 128;
+
+    IndexRangeCache();
+
     void addRange(GLenum type, unsigned int offset, GLsizei count, const RangeUI &range);
-    bool findRange(GLenum type, unsigned int offset, GLsizei count, RangeUI *rangeOut) const;
+    bool findRange(GLenum type, unsigned int offset, GLsizei count, RangeUI *rangeOut);
 
     void invalidateRange(unsigned int offset, unsigned int size);
     void clear();
 
+    size_t size() const { return mEntryCount; }
+    unsigned int getHitCount() const { return mHitCount; }
+    unsigned int getMissCount() const { return mMissCount; }
+
   private:
-    struct IndexRange
+    struct Entry
     {
         GLenum type;
         unsigned int offset;
         GLsizei count;
+        unsigned int end;
+        RangeUI range;
+        bool used;
+        bool referenced;
+    };
 
-        IndexRange();
-        IndexRange(GLenum type, intptr_t offset, GLsizei count);
+    static const size_t TableSize = MaxEntries * 2;
+    static const int EmptySlot = -1;
 
-        bool operator<(const IndexRange& rhs) const;
-    };
+    static size_t HashKey(GLenum type, unsigned int offset, GLsizei count);
+    size_t findSlot(GLenum type, unsigned int offset, GLsizei count) const;
+    size_t evictEntry();
+    void removeEntry(size_t entryIndex);
+
+    std::vector<Entry> mEntries;
+    std::vector<size_t> mFreeEntries;
+    size_t mEntryCount;
+    size_t mClockHand;
+
+    // Indices into mEntries, allocated with the first range
+    std::vector<int> mTable;
+
+    // Entry indices sorted by offset. No entry spans more than mMaxEntrySize bytes, which bounds
+    // how far before an invalidated range the overlapping entries can start.
+    std::vector<size_t> mEntriesByOffset;
+    unsigned int mMaxEntrySize;
 
-    typedef std::map<IndexRange, RangeUI> IndexRangeMap;
-    IndexRangeMap mIndexRangeCache;
+    unsigned int mHitCount;
+    unsigned int mMissCount;
 };
 
 }
@@ -0,0 +1,98 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// IndexRangeCache_unittest.cpp: Unit tests for the bounded cache of buffer index ranges.
+
+#include "gtest/gtest.h"
+
+#include "libANGLE/IndexRangeCache.h"
+
+namespace
+{
+
+TEST(IndexRangeCacheTest, FindsAddedRanges)
+{
+    gl::IndexRangeCache cache;
+    gl::RangeUI range;
+    EXPECT_FALSE(cache.findRange(GL_UNSIGNED_SHORT, 0, 6, &range));
+
+    cache.addRange(GL_UNSIGNED_SHORT, 0, 6, gl::RangeUI(1, 5));
+    cache.addRange(GL_UNSIGNED_INT, 0, 6, gl::RangeUI(2, 7));
+    cache.addRange(GL_UNSIGNED_SHORT, 12, 6, gl::RangeUI(3, 9));
+
+    ASSERT_TRUE(cache.findRange(GL_UNSIGNED_SHORT, 0, 6, &range));
+    EXPECT_EQ(1u, range.start);
+    EXPECT_EQ(5u, range.end);
+    ASSERT_TRUE(cache.findRange(GL_UNSIGNED_INT, 0, 6, &range));
+    EXPECT_EQ(7u, range.end);
+    ASSERT_TRUE(cache.findRange(GL_UNSIGNED_SHORT, 12, 6, &range));
+    EXPECT_EQ(9u, range.end);
+    EXPECT_FALSE(cache.findRange(GL_UNSIGNED_SHORT, 12, 7, nullptr));
+
+    EXPECT_EQ(3u, cache.getHitCount());
+    EXPECT_EQ(2u, cache.getMissCount());
+}
+
+// Only ranges that overlap or touch the invalidated bytes are dropped.
+TEST(IndexRangeCacheTest, InvalidatesOverlappingRanges)
+{
+    gl::IndexRangeCache cache;
+    for (unsigned int i = 0; i < 10; i++)
+    {
+        // Ranges of 50 bytes, 100 bytes apart
+        cache.addRange(GL_UNSIGNED_SHORT, i * 100, 25, gl::RangeUI(i, i));
+    }
+    cache.addRange(GL_UNSIGNED_BYTE, 0, 1000, gl::RangeUI(0, 9));
+
+    cache.invalidateRange(460, 10);
+    EXPECT_EQ(10u, cache.size());
+    EXPECT_FALSE(cache.findRange(GL_UNSIGNED_BYTE, 0, 1000, nullptr));
+
+    cache.invalidateRange(250, 50);
+    EXPECT_EQ(8u, cache.size());
+    EXPECT_TRUE(cache.findRange(GL_UNSIGNED_SHORT, 100, 25, nullptr));
+    EXPECT_FALSE(cache.findRange(GL_UNSIGNED_SHORT, 200, 25, nullptr));
+    EXPECT_FALSE(cache.findRange(GL_UNSIGNED_SHORT, 300, 25, nullptr));
+    EXPECT_TRUE(cache.findRange(GL_UNSIGNED_SHORT, 400, 25, nullptr));
+
+    cache.clear();
+    EXPECT_EQ(0u, cache.size());
+    EXPECT_FALSE(cache.findRange(GL_UNSIGNED_SHORT, 0, 25, nullptr));
+}
+
+// The cache stays bounded and keeps the ranges that are being looked up.
+TEST(IndexRangeCacheTest, EvictsUnreferencedRanges)
+{
+    gl::IndexRangeCache cache;
+    const size_t maxEntries = gl::IndexRangeCache::MaxEntries;
+    const unsigned int rangeCount = static_cast<unsigned int>(maxEntries) * 4;
+
+    cache.addRange(GL_UNSIGNED_SHORT, 0, 3, gl::RangeUI(0, 2));
+    for (unsigned int i = 1; i < rangeCount; i++)
+    {
+        EXPECT_TRUE(cache.findRange(GL_UNSIGNED_SHORT, 0, 3, nullptr));
+        cache.addRange(GL_UNSIGNED_SHORT, i * 6, 3, gl::RangeUI(i, i + 2));
+        EXPECT_LE(cache.size(), maxEntries);
+    }
+
+    EXPECT_TRUE(cache.findRange(GL_UNSIGNED_SHORT, 0, 3, nullptr));
+
+    // Every remaining range is still found with its own value
+    size_t found = 0;
+    for (unsigned int i = 1; i < rangeCount; i++)
+    {
+        gl::RangeUI range;
+        if (cache.findRange(GL_UNSIGNED_SHORT, i * 6, 3, &range))
+        {
+            EXPECT_EQ(i, range.start);
+            found++;
+        }
+    }
+    EXPECT_EQ(maxEntries - 1, found);
+    EXPECT_TRUE(cache.findRange(GL_UNSIGNED_SHORT, (rangeCount - 1) * 6, 3, nullptr));
+}
+
+}
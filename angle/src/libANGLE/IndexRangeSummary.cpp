@@ -0,0 +1,137 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// IndexRangeSummary.cpp: Implements the gl::IndexRangeSummary class, which keeps the index range
+// of every fixed-size block of a buffer so that the range of a long run of indices can be found
+// without reading all of them.
+
+#include "libANGLE/IndexRangeSummary.h"
+
+#include "common/debug.h"
+#include "libANGLE/formatutils.h"
+
+#include <algorithm>
+
+namespace gl
+{
+
+static RangeUI CombineRanges(const RangeUI &a, const RangeUI &b)
+{
+    return RangeUI(std::min(a.start, b.start), std::max(a.end, b.end));
+}
+
+IndexRangeSummary::IndexRangeSummary()
+    : mType(GL_NONE),
+      mIndexDataSize(0),
+      mBlockCount(0),
+      mDirtyBlockCount(0)
+{
+}
+
+void IndexRangeSummary::reset(GLenum type, size_t bufferSize)
+{
+    const size_t indexSize = GetTypeInfo(type).bytes;
+
+    mType = type;
+    mIndexDataSize = bufferSize - (bufferSize % indexSize);
+    mBlockCount = (mIndexDataSize + BlockSize - 1) / BlockSize;
+    mDirtyBlockCount = mBlockCount;
+
+    mTree.assign(mBlockCount * 2, RangeUI(0, 0));
+    mDirtyBlocks.assign(mBlockCount, true);
+}
+
+void IndexRangeSummary::clear()
+{
+    mType = GL_NONE;
+    mIndexDataSize = 0;
+    mBlockCount = 0;
+    mDirtyBlockCount = 0;
+
+    mTree.clear();
+    mDirtyBlocks.clear();
+}
+
+size_t IndexRangeSummary::getBlockStart(size_t block) const
+{
+    ASSERT(block < mBlockCount);
+    return block * BlockSize;
+}
+
+size_t IndexRangeSummary::getBlockEnd(size_t block) const
+{
+    ASSERT(block < mBlockCount);
+    return std::min((block + 1) * BlockSize, mIndexDataSize);
+}
+
+bool IndexRangeSummary::isBlockDirty(size_t block) const
+{
+    ASSERT(block < mBlockCount);
+    return mDirtyBlocks[block];
+}
+
+void IndexRangeSummary::setBlockRange(size_t block, const RangeUI &range)
+{
+    ASSERT(block < mBlockCount);
+    if (mDirtyBlocks[block])
+    {
+        mDirtyBlocks[block] = false;
+        mDirtyBlockCount--;
+    }
+
+    size_t node = block + mBlockCount;
+    mTree[node] = range;
+    for (node /= 2; node > 0; node /= 2)
+    {
+        mTree[node] = CombineRanges(mTree[node * 2], mTree[node * 2 + 1]);
+    }
+}
+
+void IndexRangeSummary::invalidateRange(size_t offset, size_t size)
+{
+    if (size == 0 || offset >= mIndexDataSize)
+    {
+        return;
+    }
+
+    const size_t firstBlock = offset / BlockSize;
+    const size_t lastBlock = std::min((offset + size - 1) / BlockSize, mBlockCount - 1);
+    for (size_t block = firstBlock; block <= lastBlock; block++)
+    {
+        if (!mDirtyBlocks[block])
+        {
+            mDirtyBlocks[block] = true;
+            mDirtyBlockCount++;
+        }
+    }
+}
+
+RangeUI IndexRangeSummary::getRange(size_t firstBlock, size_t lastBlock) const
+{
+    ASSERT(firstBlock < lastBlock && lastBlock <= mBlockCount);
+
+    size_t left = firstBlock + mBlockCount;
+    size_t right = lastBlock + mBlockCount;
+
+    RangeUI range = mTree[left];
+    while (left < right)
+    {
+        if (left & 1)
+        {
+            range = CombineRanges(range, mTree[left++]);
+        }
+        if (right & 1)
+        {
+            range = CombineRanges(range, mTree[--right]);
+        }
+        left /= 2;
+        right /= 2;
+    }
+
+    return range;
+}
+
+}
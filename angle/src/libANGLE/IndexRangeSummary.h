@@ -0,0 +1,69 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// IndexRangeSummary.h: Defines the gl::IndexRangeSummary class, which keeps the index range of
+// every fixed-size block of a buffer so that the range of a long run of indices can be found
+// without reading all of them.
+
+#ifndef LIBANGLE_INDEXRANGESUMMARY_H_
+#define LIBANGLE_INDEXRANGESUMMARY_H_
+
+#include "common/angleutils.h"
+#include "common/mathutil.h"
+
+#include "angle_gl.h"
+
+#include <vector>
+
+namespace gl
+{
+
+// The block ranges are the leaves of a segment tree, so the combined range of any run of blocks
+// takes O(log n) to look up. Blocks whose contents changed are marked dirty until their range is
+// computed again, which only updates the tree along the path to the root.
+class IndexRangeSummary final : angle::NonCopyable
+{
+  public:
+    static const size_t BlockSize = 4096;
+
+    IndexRangeSummary();
+
+    // Sizes the summary for a buffer read as indices of the given type. Every block starts dirty.
+    void reset(GLenum type, size_t bufferSize);
+    void clear();
+
+    bool empty() const { return mBlockCount == 0; }
+    GLenum getType() const { return mType; }
+    size_t getBlockCount() const { return mBlockCount; }
+
+    // The indices of a block are the bytes [getBlockStart(block), getBlockEnd(block)).
+    size_t getBlockStart(size_t block) const;
+    size_t getBlockEnd(size_t block) const;
+
+    bool isBlockDirty(size_t block) const;
+    size_t getDirtyBlockCount() const { return mDirtyBlockCount; }
+    void setBlockRange(size_t block, const RangeUI &range);
+
+    // Marks every block overlapping the bytes [offset, offset + size) as dirty.
+    void invalidateRange(size_t offset, size_t size);
+
+    // Returns the combined range of blocks [firstBlock, lastBlock), none of which may be dirty.
+    RangeUI getRange(size_t firstBlock, size_t lastBlock) const;
+
+  private:
+    GLenum mType;
+    size_t mIndexDataSize;
+    size_t mBlockCount;
+    size_t mDirtyBlockCount;
+
+    // Node i covers nodes 2i and 2i + 1; the leaves are [mBlockCount, 2 * mBlockCount).
+    std::vector<RangeUI> mTree;
+    std::vector<bool> mDirtyBlocks;
+};
+
+}
+
+#endif // LIBANGLE_INDEXRANGESUMMARY_H_
@@ -0,0 +1,185 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// IndexRangeSummary_unittest.cpp: Unit tests for the block summaries used to find the index ranges
+// of buffers.
+
+#include "gtest/gtest.h"
+
+#include "common/utilities.h"
+#include "libANGLE/Buffer.h"
+#include "libANGLE/IndexRangeSummary.h"
+#include "libANGLE/renderer/BufferImpl.h"
+
+#include <cstring>
+#include <vector>
+
+namespace
+{
+
+// Keeps the buffer contents in memory and counts how many indices were read to compute ranges.
+class IndexBufferImpl : public rx::BufferImpl
+{
+  public:
+    IndexBufferImpl() : mIndicesRead(0) {}
+
+    gl::Error setData(const void *data, size_t size, GLenum) override
+    {
+        mData.assign(static_cast<const uint8_t*>(data), static_cast<const uint8_t*>(data) + size);
+        return gl::Error(GL_NO_ERROR);
+    }
+    gl::Error setSubData(const void *data, size_t size, size_t offset) override
+    {
+        memcpy(mData.data() + offset, data, size);
+        return gl::Error(GL_NO_ERROR);
+    }
+    gl::Error copySubData(BufferImpl *, GLintptr, GLintptr, GLsizeiptr) override { return gl::Error(GL_INVALID_OPERATION); }
+    gl::Error map(GLenum, GLvoid **) override { return gl::Error(GL_INVALID_OPERATION); }
+    gl::Error mapRange(size_t, size_t, GLbitfield, GLvoid **) override { return gl::Error(GL_INVALID_OPERATION); }
+    gl::Error unmap(GLboolean *) override { return gl::Error(GL_INVALID_OPERATION); }
+
+    gl::Error getIndexRange(GLenum type, size_t offset, size_t count, gl::RangeUI *outRange) override
+    {
+        mIndicesRead += count;
+        *outRange = gl::ComputeIndexRange(type, mData.data() + offset, static_cast<GLsizei>(count));
+        return gl::Error(GL_NO_ERROR);
+    }
+
+    size_t mIndicesRead;
+
+  private:
+    std::vector<uint8_t> mData;
+};
+
+const size_t BlockIndices = gl::IndexRangeSummary::BlockSize / sizeof(GLushort);
+
+class IndexRangeSummaryBufferTest : public testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        // Ascending indices, so the range of any run is its first and last index
+        mIndices.resize(BlockIndices * 16 + 100);
+        for (size_t i = 0; i < mIndices.size(); i++)
+        {
+            mIndices[i] = static_cast<GLushort>(i % 0xFFFF);
+        }
+
+        mImpl = new IndexBufferImpl;
+        mBuffer = new gl::Buffer(mImpl, 1);
+        mBuffer->addRef();
+        mBuffer->bufferData(mIndices.data(), mIndices.size() * sizeof(GLushort), GL_STATIC_DRAW);
+    }
+
+    void TearDown() override
+    {
+        mBuffer->release();
+    }
+
+    void expectRange(size_t first, size_t count)
+    {
+        gl::RangeUI range;
+        ASSERT_FALSE(mBuffer->getIndexRange(GL_UNSIGNED_SHORT, first * sizeof(GLushort), count, &range).isError());
+        EXPECT_EQ(mIndices[first], range.start) << "first " << first << " count " << count;
+        EXPECT_EQ(mIndices[first + count - 1], range.end) << "first " << first << " count " << count;
+    }
+
+    std::vector<GLushort> mIndices;
+    IndexBufferImpl *mImpl;
+    gl::Buffer *mBuffer;
+};
+
+// Ranges over many blocks only read the blocks once, then just the partial blocks at the ends.
+TEST_F(IndexRangeSummaryBufferTest, ReadsBlocksOnce)
+{
+    expectRange(10, mIndices.size() - 20);
+    EXPECT_EQ(mIndices.size() - 20, mImpl->mIndicesRead);
+
+    mImpl->mIndicesRead = 0;
+    expectRange(30, mIndices.size() - 60);
+    EXPECT_LT(mImpl->mIndicesRead, 2 * BlockIndices);
+
+    // Runs that end with the buffer include its last, partial block
+    mImpl->mIndicesRead = 0;
+    expectRange(BlockIndices * 4, mIndices.size() - BlockIndices * 4);
+    EXPECT_EQ(100u, mImpl->mIndicesRead);
+}
+
+// Updating part of the buffer only reads the touched blocks again.
+TEST_F(IndexRangeSummaryBufferTest, SubDataDirtiesTouchedBlocks)
+{
+    expectRange(0, mIndices.size());
+
+    GLushort update[2] = { 0xFFFF, 0 };
+    mIndices[BlockIndices * 5 + 7] = update[0];
+    mIndices[BlockIndices * 5 + 8] = update[1];
+    mBuffer->bufferSubData(update, sizeof(update), (BlockIndices * 5 + 7) * sizeof(GLushort));
+
+    mImpl->mIndicesRead = 0;
+    gl::RangeUI range;
+    ASSERT_FALSE(mBuffer->getIndexRange(GL_UNSIGNED_SHORT, 2, mIndices.size() - 2, &range).isError());
+    EXPECT_EQ(0u, range.start);
+    EXPECT_EQ(0xFFFFu, range.end);
+    EXPECT_LT(mImpl->mIndicesRead, 2 * BlockIndices + 100);
+}
+
+// Offsets that split indices across blocks and short runs are computed directly, and switching
+// to another index type starts a new summary.
+TEST_F(IndexRangeSummaryBufferTest, UnalignedShortAndRetypedRanges)
+{
+    const uint8_t *bytes = reinterpret_cast<const uint8_t*>(mIndices.data());
+    const GLsizei count = static_cast<GLsizei>(BlockIndices * 10);
+
+    expectRange(BlockIndices - 3, BlockIndices);
+
+    gl::RangeUI range;
+    gl::RangeUI expected = gl::ComputeIndexRange(GL_UNSIGNED_SHORT, bytes + 1, count);
+    ASSERT_FALSE(mBuffer->getIndexRange(GL_UNSIGNED_SHORT, 1, count, &range).isError());
+    EXPECT_EQ(expected.start, range.start);
+    EXPECT_EQ(expected.end, range.end);
+
+    expected = gl::ComputeIndexRange(GL_UNSIGNED_BYTE, bytes + 1, count);
+    ASSERT_FALSE(mBuffer->getIndexRange(GL_UNSIGNED_BYTE, 1, count, &range).isError());
+    EXPECT_EQ(expected.start, range.start);
+    EXPECT_EQ(expected.end, range.end);
+
+    expectRange(5, mIndices.size() - 5);
+}
+
+TEST(IndexRangeSummaryTest, DirtyBlocks)
+{
+    gl::IndexRangeSummary summary;
+    EXPECT_TRUE(summary.empty());
+
+    summary.reset(GL_UNSIGNED_INT, gl::IndexRangeSummary::BlockSize * 3 + 10);
+    EXPECT_EQ(4u, summary.getBlockCount());
+    EXPECT_EQ(4u, summary.getDirtyBlockCount());
+    EXPECT_EQ(gl::IndexRangeSummary::BlockSize * 3 + 8, summary.getBlockEnd(3));
+
+    summary.setBlockRange(0, gl::RangeUI(5, 10));
+    summary.setBlockRange(1, gl::RangeUI(2, 4));
+    summary.setBlockRange(2, gl::RangeUI(7, 30));
+    summary.setBlockRange(3, gl::RangeUI(1, 1));
+    EXPECT_EQ(0u, summary.getDirtyBlockCount());
+
+    EXPECT_EQ(2u, summary.getRange(0, 2).start);
+    EXPECT_EQ(10u, summary.getRange(0, 2).end);
+    EXPECT_EQ(2u, summary.getRange(1, 3).start);
+    EXPECT_EQ(30u, summary.getRange(1, 3).end);
+    EXPECT_EQ(1u, summary.getRange(0, 4).start);
+    EXPECT_EQ(7u, summary.getRange(2, 3).start);
+
+    summary.invalidateRange(gl::IndexRangeSummary::BlockSize - 2, 4);
+    EXPECT_EQ(2u, summary.getDirtyBlockCount());
+    EXPECT_TRUE(summary.isBlockDirty(0));
+    EXPECT_TRUE(summary.isBlockDirty(1));
+    EXPECT_FALSE(summary.isBlockDirty(2));
+
+    summary.setBlockRange(1, gl::RangeUI(50, 60));
+    EXPECT_EQ(60u, summary.getRange(1, 4).end);
+}
+
+}
@@ -0,0 +1,50 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// Observer.cpp: Implements the gl::Subject class.
+
+#include "libANGLE/Observer.h"
+
+#include "common/debug.h"
+
+#include <algorithm>
+
+namespace gl
+{
+
+Subject::Subject()
+{
+}
+
+Subject::~Subject()
+{
+}
+
+void Subject::addObserver(Observer *observer)
+{
+    ASSERT(observer != nullptr);
+    mObservers.push_back(observer);
+}
+
+void Subject::removeObserver(Observer *observer)
+{
+    auto iter = std::find(mObservers.begin(), mObservers.end(), observer);
+    ASSERT(iter != mObservers.end());
+    if (iter != mObservers.end())
+    {
+        mObservers.erase(iter);
+    }
+}
+
+void Subject::notifyStateChange() const
+{
+    for (size_t observerIndex = 0; observerIndex < mObservers.size(); ++observerIndex)
+    {
+        mObservers[observerIndex]->onSubjectStateChange();
+    }
+}
+
+}
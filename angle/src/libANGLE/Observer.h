@@ -0,0 +1,47 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// Observer.h: Defines the gl::Subject and gl::Observer classes, which let an object
+// learn that another object it references has changed in a way that may affect
+// state derived from it, such as the results cached by draw validation.
+
+#ifndef LIBANGLE_OBSERVER_H_
+#define LIBANGLE_OBSERVER_H_
+
+#include <vector>
+
+namespace gl
+{
+
+class Observer
+{
+  public:
+    virtual ~Observer() {}
+
+    virtual void onSubjectStateChange() = 0;
+};
+
+class Subject
+{
+  public:
+    Subject();
+    ~Subject();
+
+    // An observer may be added more than once, for instance by a vertex array that
+    // uses one buffer for several attributes, and must be removed as many times.
+    void addObserver(Observer *observer);
+    void removeObserver(Observer *observer);
+
+  protected:
+    void notifyStateChange() const;
+
+  private:
+    std::vector<Observer *> mObservers;
+};
+
+}
+
+#endif   // LIBANGLE_OBSERVER_H_
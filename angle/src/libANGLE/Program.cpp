@@ -16,11 +16,14 @@
 #include "common/utilities.h"
 #include "common/version.h"
 #include "compiler/translator/blocklayout.h"
+#include "libANGLE/BinaryStream.h"
 #include "libANGLE/Data.h"
+#include "libANGLE/ProgramBinaryCache.h"
 #include "libANGLE/ResourceManager.h"
 #include "libANGLE/features.h"
 #include "libANGLE/renderer/Renderer.h"
 #include "libANGLE/renderer/ProgramImpl.h"
+#include "libANGLE/renderer/ShaderImpl.h"
 
 namespace gl
 {
@@ -29,20 +32,19 @@ const char * const g_fakepath = "C:\\fakepath";
 namespace
 {
 
-unsigned int ParseAndStripArrayIndex(std::string* name)
-{
-    unsigned int subscript = GL_INVALID_INDEX;
-
-    // Strip any trailing array operator and retrieve the subscript
-    size_t open = name->find_last_of('[');
-    size_t close = name->find_last_of(']');
-    if (open != std::string::npos && close == name->length() - 1)
-    {
-        subscript = atoi(name->substr(open + 1).c_str());
-        name->erase(open);
-    }
+// Changes whenever the layout of saved binaries changes, independently of the commit hash, which
+// is not updated by every build
+const int ProgramBinaryLayoutVersion = 2;
 
-    return subscript;
+// Only backends that can load their own binaries use the disk cache
+const ProgramBinaryCache *GetProgramBinaryCache(const Data &data)
+{
+#if ANGLE_PROGRAM_BINARY_LOAD == ANGLE_ENABLED
+    return data.caps->programBinaryFormats.empty() ? nullptr : ProgramBinaryCache::GetDefault();
+#else
+    UNUSED_ASSERTION_VARIABLE(data);
+    return nullptr;
+#endif
 }
 
 }
@@ -131,6 +133,52 @@ VariableLocation::VariableLocation(const std::string &name, unsigned int element
 {
 }
 
+VariableNameIndex::VariableNameIndex()
+{
+}
+
+VariableNameIndex::~VariableNameIndex()
+{
+}
+
+void VariableNameIndex::clear()
+{
+    mValues.clear();
+}
+
+void VariableNameIndex::add(const std::string &name, GLuint value)
+{
+    mValues.insert(std::make_pair(name, value));
+}
+
+void VariableNameIndex::addArrayElement(const std::string &name, unsigned int element, GLuint value)
+{
+    add(name + ArrayString(element), value);
+}
+
+bool VariableNameIndex::find(const std::string &name, GLuint *valueOut) const
+{
+    auto iter = mValues.find(name);
+    if (iter == mValues.end())
+    {
+        size_t subscript = GL_INVALID_INDEX;
+        std::string baseName = ParseUniformName(name, &subscript);
+        if (baseName.length() == name.length())
+        {
+            return false;
+        }
+
+        iter = mValues.find(baseName + ArrayString(static_cast<unsigned int>(subscript)));
+        if (iter == mValues.end())
+        {
+            return false;
+        }
+    }
+
+    *valueOut = iter->second;
+    return true;
+}
+
 LinkedVarying::LinkedVarying()
 {
 }
@@ -277,6 +325,30 @@ Error Program::link(const Data &data)
     }
     ASSERT(mVertexShader->getType() == GL_VERTEX_SHADER);
 
+    const ProgramBinaryCache *binaryCache = GetProgramBinaryCache(data);
+    ProgramBinaryCache::Key binaryCacheKey = { { 0, 0 } };
+    if (binaryCache)
+    {
+        BinaryOutputStream linkInputs;
+        writeLinkInputs(data, &linkInputs);
+        binaryCacheKey = ProgramBinaryCache::ComputeKey(linkInputs.data(), linkInputs.length());
+
+        MappedProgramBinary cachedBinary;
+        if (binaryCache->get(binaryCacheKey, &cachedBinary))
+        {
+            Error error = loadBinary(mProgram->getBinaryFormat(), cachedBinary.data(),
+                                     static_cast<GLsizei>(cachedBinary.size()));
+            if (error.isError() || mLinked)
+            {
+                return error;
+            }
+
+            // Binaries from another build or device are linked again and replaced
+            unlink(false);
+            mInfoLog.reset();
+        }
+    }
+
     if (!linkAttributes(data, mInfoLog, mAttributeBindings, mVertexShader))
     {
         return Error(GL_NO_ERROR);
@@ -318,6 +390,17 @@ Error Program::link(const Data &data)
     }
 
     mLinked = true;
+    indexVariableNames();
+
+    if (binaryCache)
+    {
+        BinaryOutputStream binary;
+        if (!writeBinary(&binary).isError())
+        {
+            binaryCache->put(binaryCacheKey, binary.data(), binary.length());
+        }
+    }
+
     return gl::Error(GL_NO_ERROR);
 }
 
@@ -357,9 +440,37 @@ void Program::unlink(bool destroy)
 
     mProgram->reset();
 
+    mAttributeNames.clear();
+    mOutputVariableNames.clear();
+
     mValidated = false;
 
     mLinked = false;
+
+    notifyStateChange();
+}
+
+// Name lookups after linking go through hashed indices instead of searching the variable lists
+void Program::indexVariableNames()
+{
+    mAttributeNames.clear();
+    for (GLuint location = 0; location < MAX_VERTEX_ATTRIBS; location++)
+    {
+        if (!mLinkedAttribute[location].name.empty())
+        {
+            mAttributeNames.add(mLinkedAttribute[location].name, location);
+        }
+    }
+
+    mOutputVariableNames.clear();
+    for (const auto &outputVariable : mOutputVariables)
+    {
+        const VariableLocation &variable = outputVariable.second;
+        mOutputVariableNames.add(variable.name, static_cast<GLuint>(outputVariable.first));
+        mOutputVariableNames.addArrayElement(variable.name, variable.element, static_cast<GLuint>(outputVariable.first));
+    }
+
+    mProgram->indexVariableNames();
 }
 
 bool Program::isLinked()
@@ -401,6 +512,13 @@ Error Program::loadBinary(GLenum binaryFormat, const void *binary, GLsizei lengt
         return Error(GL_NO_ERROR);
     }
 
+    int layoutVersion = stream.readInt<int>();
+    if (layoutVersion != ProgramBinaryLayoutVersion)
+    {
+        mInfoLog << "Invalid program binary version.";
+        return Error(GL_NO_ERROR);
+    }
+
     // TODO(jmadill): replace MAX_VERTEX_ATTRIBS
     for (int i = 0; i < MAX_VERTEX_ATTRIBS; ++i)
     {
@@ -427,6 +545,7 @@ Error Program::loadBinary(GLenum binaryFormat, const void *binary, GLsizei lengt
     }
 
     mLinked = true;
+    indexVariableNames();
     return Error(GL_NO_ERROR);
 #endif // #if ANGLE_PROGRAM_BINARY_LOAD == ANGLE_ENABLED
 }
@@ -439,32 +558,7 @@ Error Program::saveBinary(GLenum *binaryFormat, void *binary, GLsizei bufSize, G
     }
 
     BinaryOutputStream stream;
-
-    stream.writeInt(mProgram->getBinaryFormat());
-    stream.writeInt(ANGLE_MAJOR_VERSION);
-    stream.writeInt(ANGLE_MINOR_VERSION);
-    stream.writeBytes(reinterpret_cast<const unsigned char*>(ANGLE_COMMIT_HASH), ANGLE_COMMIT_HASH_SIZE);
-
-    // TODO(jmadill): replace MAX_VERTEX_ATTRIBS
-    for (unsigned int i = 0; i < MAX_VERTEX_ATTRIBS; ++i)
-    {
-        stream.writeInt(mLinkedAttribute[i].type);
-        stream.writeString(mLinkedAttribute[i].name);
-        stream.writeInt(mProgram->getSemanticIndexes()[i]);
-    }
-
-    const auto &shaderAttributes = mProgram->getShaderAttributes();
-    stream.writeInt(shaderAttributes.size());
-    for (const auto &attrib : shaderAttributes)
-    {
-        stream.writeInt(attrib.type);
-        stream.writeInt(attrib.precision);
-        stream.writeString(attrib.name);
-        stream.writeInt(attrib.arraySize);
-        stream.writeInt(attrib.location);
-    }
-
-    gl::Error error = mProgram->save(&stream);
+    Error error = writeBinary(&stream);
     if (error.isError())
     {
         return error;
@@ -504,6 +598,58 @@ Error Program::saveBinary(GLenum *binaryFormat, void *binary, GLsizei bufSize, G
     return Error(GL_NO_ERROR);
 }
 
+Error Program::writeBinary(BinaryOutputStream *stream) const
+{
+    stream->writeInt(mProgram->getBinaryFormat());
+    stream->writeInt(ANGLE_MAJOR_VERSION);
+    stream->writeInt(ANGLE_MINOR_VERSION);
+    stream->writeBytes(reinterpret_cast<const unsigned char*>(ANGLE_COMMIT_HASH), ANGLE_COMMIT_HASH_SIZE);
+    stream->writeInt(ProgramBinaryLayoutVersion);
+
+    // TODO(jmadill): replace MAX_VERTEX_ATTRIBS
+    for (unsigned int i = 0; i < MAX_VERTEX_ATTRIBS; ++i)
+    {
+        stream->writeInt(mLinkedAttribute[i].type);
+        stream->writeString(mLinkedAttribute[i].name);
+        stream->writeInt(mProgram->getSemanticIndexes()[i]);
+    }
+
+    const auto &shaderAttributes = mProgram->getShaderAttributes();
+    stream->writeInt(shaderAttributes.size());
+    for (const auto &attrib : shaderAttributes)
+    {
+        stream->writeInt(attrib.type);
+        stream->writeInt(attrib.precision);
+        stream->writeString(attrib.name);
+        stream->writeInt(attrib.arraySize);
+        stream->writeInt(attrib.location);
+    }
+
+    return mProgram->save(stream);
+}
+
+// Everything the result of link depends on, for finding the program in the binary cache
+void Program::writeLinkInputs(const Data &data, BinaryOutputStream *stream) const
+{
+    stream->writeInt(mProgram->getBinaryFormat());
+    stream->writeInt(data.clientVersion);
+    stream->writeString(mVertexShader->getImplementation()->getTranslatedSource());
+    stream->writeString(mFragmentShader->getImplementation()->getTranslatedSource());
+
+    for (const sh::Attribute &attribute : mVertexShader->getActiveAttributes())
+    {
+        stream->writeString(attribute.name);
+        stream->writeInt(mAttributeBindings.getAttributeBinding(attribute.name));
+    }
+
+    stream->writeInt(mTransformFeedbackBufferMode);
+    stream->writeInt(mTransformFeedbackVaryings.size());
+    for (const std::string &varying : mTransformFeedbackVaryings)
+    {
+        stream->writeString(varying);
+    }
+}
+
 GLint Program::getBinaryLength() const
 {
     GLint length;
@@ -578,15 +724,9 @@ void Program::getAttachedShaders(GLsizei maxCount, GLsizei *count, GLuint *shade
 
 GLuint Program::getAttributeLocation(const std::string &name)
 {
-    for (int index = 0; index < MAX_VERTEX_ATTRIBS; index++)
-    {
-        if (mLinkedAttribute[index].name == name)
-        {
-            return index;
-        }
-    }
-
-    return static_cast<GLuint>(-1);
+    GLuint location = static_cast<GLuint>(-1);
+    mAttributeNames.find(name, &location);
+    return location;
 }
 
 const int *Program::getSemanticIndexes() const
@@ -716,17 +856,8 @@ GLenum Program::getSamplerTextureType(SamplerType type, unsigned int samplerInde
 
 GLint Program::getFragDataLocation(const std::string &name) const
 {
-    std::string baseName(name);
-    unsigned int arrayIndex = ParseAndStripArrayIndex(&baseName);
-    for (auto locationIt = mOutputVariables.begin(); locationIt != mOutputVariables.end(); locationIt++)
-    {
-        const VariableLocation &outputVariable = locationIt->second;
-        if (outputVariable.name == baseName && (arrayIndex == GL_INVALID_INDEX || arrayIndex == outputVariable.element))
-        {
-            return static_cast<GLint>(locationIt->first);
-        }
-    }
-    return -1;
+    GLuint location = 0;
+    return mOutputVariableNames.find(name, &location) ? static_cast<GLint>(location) : -1;
 }
 
 void Program::getActiveUniform(GLuint index, GLsizei bufsize, GLsizei *length, GLint *size, GLenum *type, GLchar *name)
@@ -878,6 +1009,12 @@ void Program::setUniform4fv(GLint location, GLsizei count, const GLfloat *v)
 void Program::setUniform1iv(GLint location, GLsizei count, const GLint *v)
 {
     mProgram->setUniform1iv(location, count, v);
+
+    const LinkedUniform *uniform = getUniformByLocation(location);
+    if (uniform != nullptr && uniform->isSampler())
+    {
+        notifyStateChange();
+    }
 }
 
 void Program::setUniform2iv(GLint location, GLsizei count, const GLint *v)
@@ -1130,6 +1267,7 @@ const UniformBlock *Program::getUniformBlockByIndex(GLuint index) const
 void Program::bindUniformBlock(GLuint uniformBlockIndex, GLuint uniformBlockBinding)
 {
     mUniformBlockBindings[uniformBlockIndex] = uniformBlockBinding;
+    notifyStateChange();
 }
 
 GLuint Program::getUniformBlockBinding(GLuint uniformBlockIndex) const
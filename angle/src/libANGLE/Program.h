@@ -13,6 +13,7 @@
 #include "libANGLE/angletypes.h"
 #include "libANGLE/Constants.h"
 #include "libANGLE/Error.h"
+#include "libANGLE/Observer.h"
 #include "libANGLE/RefCountObject.h"
 
 #include "common/angleutils.h"
@@ -24,6 +25,7 @@
 #include <sstream>
 #include <string>
 #include <set>
+#include <unordered_map>
 
 namespace rx
 {
@@ -35,6 +37,7 @@ class ProgramImpl;
 
 namespace gl
 {
+class BinaryOutputStream;
 struct Caps;
 struct Data;
 class ResourceManager;
@@ -142,6 +145,28 @@ struct VariableLocation
     unsigned int index;
 };
 
+// Maps the names of a linked program's variables to their locations or indices. Array elements
+// are added as "name[n]". Other spellings of a subscript, like "name[01]", are parsed and looked
+// up in that form.
+class VariableNameIndex : angle::NonCopyable
+{
+  public:
+    VariableNameIndex();
+    ~VariableNameIndex();
+
+    void clear();
+
+    // A name that is already in the index keeps its first value, so adding variables in the
+    // order their list used to be searched in gives the same results as the search.
+    void add(const std::string &name, GLuint value);
+    void addArrayElement(const std::string &name, unsigned int element, GLuint value);
+
+    bool find(const std::string &name, GLuint *valueOut) const;
+
+  private:
+    std::unordered_map<std::string, GLuint> mValues;
+};
+
 struct LinkedVarying
 {
     LinkedVarying();
@@ -160,7 +185,9 @@ struct LinkedVarying
     unsigned int semanticIndexCount;
 };
 
-class Program : angle::NonCopyable
+// Observers are notified when the program is relinked or when a change to its sampler
+// uniforms or uniform block bindings may affect draw validation.
+class Program : angle::NonCopyable, public Subject
 {
   public:
     Program(rx::ProgramImpl *impl, ResourceManager *manager, GLuint handle);
@@ -278,6 +305,10 @@ class Program : angle::NonCopyable
   private:
     void unlink(bool destroy = false);
     void resetUniformBlockBindings();
+    void indexVariableNames();
+
+    Error writeBinary(BinaryOutputStream *stream) const;
+    void writeLinkInputs(const Data &data, BinaryOutputStream *stream) const;
 
     bool linkAttributes(const Data &data,
                         InfoLog &infoLog,
@@ -308,6 +339,9 @@ class Program : angle::NonCopyable
 
     std::map<int, VariableLocation> mOutputVariables;
 
+    VariableNameIndex mAttributeNames;
+    VariableNameIndex mOutputVariableNames;
+
     bool mValidated;
 
     Shader *mFragmentShader;
@@ -0,0 +1,245 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// ProgramBinaryCache.cpp: Implements the gl::ProgramBinaryCache class.
+
+#include "libANGLE/ProgramBinaryCache.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+
+#include "common/debug.h"
+#include "third_party/murmurhash/MurmurHash3.h"
+
+#if defined(ANGLE_PLATFORM_POSIX)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace gl
+{
+
+namespace
+{
+
+const uint32_t KeySeed = 0xABCDEF98;
+
+// Numbers the temporary files of a process, so that threads storing the same binary at the same
+// time each write their own.
+std::atomic<unsigned int> TempFileCounter(0);
+
+unsigned long GetProcessIdentifier()
+{
+#if defined(ANGLE_PLATFORM_WINDOWS)
+    return GetCurrentProcessId();
+#else
+    return static_cast<unsigned long>(getpid());
+#endif
+}
+
+bool MoveFileOverExisting(const std::string &fromPath, const std::string &toPath)
+{
+#if defined(ANGLE_PLATFORM_WINDOWS)
+    return MoveFileExA(fromPath.c_str(), toPath.c_str(), MOVEFILE_REPLACE_EXISTING) != FALSE;
+#else
+    return rename(fromPath.c_str(), toPath.c_str()) == 0;
+#endif
+}
+
+}
+
+MappedProgramBinary::MappedProgramBinary()
+    : mData(nullptr),
+      mSize(0)
+#if defined(ANGLE_PLATFORM_WINDOWS)
+      , mFile(INVALID_HANDLE_VALUE),
+      mMapping(nullptr)
+#endif
+{
+}
+
+MappedProgramBinary::~MappedProgramBinary()
+{
+    unmap();
+}
+
+bool MappedProgramBinary::map(const std::string &path)
+{
+    unmap();
+
+#if defined(ANGLE_ENABLE_WINDOWS_STORE)
+    UNUSED_ASSERTION_VARIABLE(path);
+    return false;
+#elif defined(ANGLE_PLATFORM_WINDOWS)
+    mFile = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING,
+                        FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (mFile == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(mFile, &fileSize) || fileSize.QuadPart == 0 ||
+        static_cast<unsigned long long>(fileSize.QuadPart) > static_cast<size_t>(-1))
+    {
+        unmap();
+        return false;
+    }
+
+    mMapping = CreateFileMappingA(mFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mMapping == nullptr)
+    {
+        unmap();
+        return false;
+    }
+
+    mData = reinterpret_cast<const uint8_t*>(MapViewOfFile(mMapping, FILE_MAP_READ, 0, 0, 0));
+    if (mData == nullptr)
+    {
+        unmap();
+        return false;
+    }
+
+    mSize = static_cast<size_t>(fileSize.QuadPart);
+    return true;
+#else
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size <= 0)
+    {
+        close(fd);
+        return false;
+    }
+
+    size_t size = static_cast<size_t>(fileStat.st_size);
+    void *mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    // The mapping keeps the file alive
+    close(fd);
+
+    if (mapped == MAP_FAILED)
+    {
+        return false;
+    }
+
+    mData = reinterpret_cast<const uint8_t*>(mapped);
+    mSize = size;
+    return true;
+#endif
+}
+
+void MappedProgramBinary::unmap()
+{
+#if defined(ANGLE_PLATFORM_WINDOWS)
+    if (mData != nullptr)
+    {
+        UnmapViewOfFile(mData);
+    }
+    if (mMapping != nullptr)
+    {
+        CloseHandle(mMapping);
+        mMapping = nullptr;
+    }
+    if (mFile != INVALID_HANDLE_VALUE)
+    {
+        CloseHandle(mFile);
+        mFile = INVALID_HANDLE_VALUE;
+    }
+#else
+    if (mData != nullptr)
+    {
+        munmap(const_cast<uint8_t*>(mData), mSize);
+    }
+#endif
+
+    mData = nullptr;
+    mSize = 0;
+}
+
+std::string ProgramBinaryCache::Key::toString() const
+{
+    return FormatString("%016llx%016llx", static_cast<unsigned long long>(hash[0]),
+                        static_cast<unsigned long long>(hash[1]));
+}
+
+ProgramBinaryCache::ProgramBinaryCache(const std::string &directory)
+    : mDirectory(directory)
+{
+    if (!mDirectory.empty() && mDirectory.back() != '/' && mDirectory.back() != '\\')
+    {
+        mDirectory += '/';
+    }
+}
+
+ProgramBinaryCache::Key ProgramBinaryCache::ComputeKey(const void *data, size_t size)
+{
+    ASSERT(size <= static_cast<size_t>(std::numeric_limits<int>::max()));
+
+    Key key;
+    MurmurHash3_x64_128(data, static_cast<int>(size), KeySeed, key.hash);
+    return key;
+}
+
+bool ProgramBinaryCache::get(const Key &key, MappedProgramBinary *binaryOut) const
+{
+    return binaryOut->map(getPath(key));
+}
+
+bool ProgramBinaryCache::put(const Key &key, const void *binary, size_t size) const
+{
+    const std::string path = getPath(key);
+
+    const std::string tempPath = path + FormatString(".%lu.%u.tmp", GetProcessIdentifier(), TempFileCounter++);
+
+    FILE *file = fopen(tempPath.c_str(), "wb");
+    if (file == nullptr)
+    {
+        return false;
+    }
+
+    bool written = (fwrite(binary, 1, size, file) == size);
+    written = (fclose(file) == 0) && written;
+
+    if (!written || !MoveFileOverExisting(tempPath, path))
+    {
+        remove(tempPath.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+const ProgramBinaryCache *ProgramBinaryCache::GetDefault()
+{
+#if defined(ANGLE_ENABLE_WINDOWS_STORE)
+    return nullptr;
+#else
+    static const char *directory = getenv("ANGLE_PROGRAM_BINARY_CACHE_DIR");
+    if (directory == nullptr || directory[0] == '\0')
+    {
+        return nullptr;
+    }
+
+    static const ProgramBinaryCache defaultCache(directory);
+    return &defaultCache;
+#endif
+}
+
+std::string ProgramBinaryCache::getPath(const Key &key) const
+{
+    return mDirectory + key.toString() + ".bin";
+}
+
+}
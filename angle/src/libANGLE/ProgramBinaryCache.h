@@ -0,0 +1,80 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// ProgramBinaryCache.h: Defines the gl::ProgramBinaryCache class, which keeps linked program
+// binaries on disk so that later runs can load them instead of compiling their shaders again.
+
+#ifndef LIBANGLE_PROGRAMBINARYCACHE_H_
+#define LIBANGLE_PROGRAMBINARYCACHE_H_
+
+#include "common/angleutils.h"
+#include "common/platform.h"
+
+#include <cstddef>
+#include <string>
+#include <stdint.h>
+
+namespace gl
+{
+
+// A read-only view of a cached binary, mapped from its file rather than read into memory.
+class MappedProgramBinary : angle::NonCopyable
+{
+  public:
+    MappedProgramBinary();
+    ~MappedProgramBinary();
+
+    bool map(const std::string &path);
+    void unmap();
+
+    const uint8_t *data() const { return mData; }
+    size_t size() const { return mSize; }
+
+  private:
+    const uint8_t *mData;
+    size_t mSize;
+
+#if defined(ANGLE_PLATFORM_WINDOWS)
+    HANDLE mFile;
+    HANDLE mMapping;
+#endif
+};
+
+class ProgramBinaryCache : angle::NonCopyable
+{
+  public:
+    // A hash of everything that goes into linking a program
+    struct Key
+    {
+        uint64_t hash[2];
+
+        std::string toString() const;
+    };
+
+    explicit ProgramBinaryCache(const std::string &directory);
+
+    static Key ComputeKey(const void *data, size_t size);
+
+    // Returns false if there is no binary for the key.
+    bool get(const Key &key, MappedProgramBinary *binaryOut) const;
+
+    // Stores the binary for the key. The file is written under another name and then renamed, so
+    // other processes sharing the directory never map a partly written binary.
+    bool put(const Key &key, const void *binary, size_t size) const;
+
+    // The cache in the directory named by the ANGLE_PROGRAM_BINARY_CACHE_DIR environment
+    // variable, or null if it isn't set.
+    static const ProgramBinaryCache *GetDefault();
+
+  private:
+    std::string getPath(const Key &key) const;
+
+    std::string mDirectory;
+};
+
+}
+
+#endif // LIBANGLE_PROGRAMBINARYCACHE_H_
@@ -0,0 +1,143 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// ProgramBinaryCache_unittest.cpp: Unit tests for the program binary cache and the binary stream
+// arrays that let cached binaries be read in place.
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "libANGLE/BinaryStream.h"
+#include "libANGLE/ProgramBinaryCache.h"
+
+namespace
+{
+
+struct TestRecord
+{
+    uint32_t first;
+    uint16_t second;
+    uint16_t third;
+};
+
+TEST(BinaryStreamTest, ArrayRoundTrip)
+{
+    const TestRecord records[] = { { 1, 2, 3 }, { 4, 5, 6 }, { 0xFFFFFFFF, 7, 8 } };
+    const uint32_t values[] = { 10, 20, 30, 40, 50 };
+
+    gl::BinaryOutputStream outStream;
+    outStream.writeInt(7);
+    outStream.writeArray(records, 3);
+    outStream.writeString("separator");
+    outStream.writeArray(values, 5);
+    outStream.writeArray(values, 0);
+    outStream.writeInt(9);
+
+    gl::BinaryInputStream inStream(outStream.data(), outStream.length());
+    EXPECT_EQ(7, inStream.readInt<int>());
+
+    std::vector<TestRecord> readRecords;
+    inStream.readArray(&readRecords);
+    ASSERT_EQ(3u, readRecords.size());
+    EXPECT_EQ(0, memcmp(records, &readRecords[0], sizeof(records)));
+
+    EXPECT_EQ("separator", inStream.readString());
+
+    size_t count = 0;
+    const uint32_t *readValues = inStream.readArrayInPlace<uint32_t>(&count);
+    ASSERT_EQ(5u, count);
+
+    // Arrays are aligned relative to the start of the stream
+    EXPECT_EQ(0u, (reinterpret_cast<const uint8_t*>(readValues) -
+                   reinterpret_cast<const uint8_t*>(outStream.data())) % gl::BinaryArrayAlignment);
+    EXPECT_EQ(0, memcmp(values, readValues, sizeof(values)));
+
+    std::vector<uint32_t> emptyValues;
+    inStream.readArray(&emptyValues);
+    EXPECT_TRUE(emptyValues.empty());
+
+    EXPECT_EQ(9, inStream.readInt<int>());
+    EXPECT_FALSE(inStream.error());
+    EXPECT_TRUE(inStream.endOfStream());
+}
+
+// An array count past the end of the stream is an error rather than an overread.
+TEST(BinaryStreamTest, TruncatedArray)
+{
+    const uint32_t values[] = { 1, 2, 3, 4 };
+
+    gl::BinaryOutputStream outStream;
+    outStream.writeArray(values, 4);
+
+    gl::BinaryInputStream inStream(outStream.data(), outStream.length() - 1);
+    std::vector<uint32_t> readValues;
+    inStream.readArray(&readValues);
+    EXPECT_TRUE(inStream.error());
+    EXPECT_TRUE(readValues.empty());
+}
+
+TEST(ProgramBinaryCacheTest, KeysDependOnAllInputs)
+{
+    const char inputs[] = "attribute vec4 position; void main() { gl_Position = position; }";
+    char otherInputs[sizeof(inputs)];
+    memcpy(otherInputs, inputs, sizeof(inputs));
+    otherInputs[sizeof(inputs) - 2] = ' ';
+
+    gl::ProgramBinaryCache::Key key = gl::ProgramBinaryCache::ComputeKey(inputs, sizeof(inputs));
+    gl::ProgramBinaryCache::Key sameKey = gl::ProgramBinaryCache::ComputeKey(inputs, sizeof(inputs));
+    gl::ProgramBinaryCache::Key otherKey = gl::ProgramBinaryCache::ComputeKey(otherInputs, sizeof(otherInputs));
+    gl::ProgramBinaryCache::Key shorterKey = gl::ProgramBinaryCache::ComputeKey(inputs, sizeof(inputs) - 1);
+
+    EXPECT_EQ(key.toString(), sameKey.toString());
+    EXPECT_NE(key.toString(), otherKey.toString());
+    EXPECT_NE(key.toString(), shorterKey.toString());
+    EXPECT_EQ(32u, key.toString().length());
+}
+
+TEST(ProgramBinaryCacheTest, StoreAndMap)
+{
+    // Use the working directory, which tests are allowed to write to
+    gl::ProgramBinaryCache cache("");
+
+    const char inputs[] = "ProgramBinaryCacheTest.StoreAndMap";
+    gl::ProgramBinaryCache::Key key = gl::ProgramBinaryCache::ComputeKey(inputs, sizeof(inputs));
+    const std::string path = key.toString() + ".bin";
+    remove(path.c_str());
+
+    gl::MappedProgramBinary binary;
+    EXPECT_FALSE(cache.get(key, &binary));
+    EXPECT_EQ(nullptr, binary.data());
+
+    std::vector<uint8_t> contents(1000);
+    for (size_t i = 0; i < contents.size(); i++)
+    {
+        contents[i] = static_cast<uint8_t>(i * 7);
+    }
+    ASSERT_TRUE(cache.put(key, &contents[0], contents.size()));
+
+    ASSERT_TRUE(cache.get(key, &binary));
+    ASSERT_EQ(contents.size(), binary.size());
+    EXPECT_EQ(0, memcmp(&contents[0], binary.data(), contents.size()));
+
+    // Storing again replaces the binary. Windows can't replace a file that is mapped.
+    binary.unmap();
+    EXPECT_EQ(0u, binary.size());
+    contents.resize(10);
+    ASSERT_TRUE(cache.put(key, &contents[0], contents.size()));
+
+    gl::MappedProgramBinary newBinary;
+    ASSERT_TRUE(cache.get(key, &newBinary));
+    EXPECT_EQ(10u, newBinary.size());
+    EXPECT_EQ(0, memcmp(&contents[0], newBinary.data(), contents.size()));
+
+    newBinary.unmap();
+    EXPECT_EQ(0, remove(path.c_str()));
+}
+
+}
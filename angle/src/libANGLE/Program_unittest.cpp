@@ -40,4 +40,38 @@ TEST(InfoLogTest, AppendingNewline)
     EXPECT_EQ(expected, infoLog.str());
 }
 
+// Tests that array elements are found by any spelling of their subscript, and that the first
+// value added for a name is kept.
+TEST(VariableNameIndexTest, ArrayElements)
+{
+    VariableNameIndex index;
+    index.add("array", 4);
+    index.addArrayElement("array", 0, 4);
+    index.addArrayElement("array", 1, 5);
+    index.add("s[1].f", 7);
+    index.add("array", 9);
+
+    GLuint value = 0;
+    EXPECT_TRUE(index.find("array", &value));
+    EXPECT_EQ(4u, value);
+    EXPECT_TRUE(index.find("array[1]", &value));
+    EXPECT_EQ(5u, value);
+    EXPECT_TRUE(index.find("array[01]", &value));
+    EXPECT_EQ(5u, value);
+    EXPECT_TRUE(index.find("s[1].f", &value));
+    EXPECT_EQ(7u, value);
+
+    // A negative subscript names the whole array
+    EXPECT_TRUE(index.find("array[-1]", &value));
+    EXPECT_EQ(4u, value);
+
+    EXPECT_FALSE(index.find("array[2]", &value));
+    EXPECT_FALSE(index.find("s[1].f[0]", &value));
+    EXPECT_FALSE(index.find("s[1]", &value));
+    EXPECT_FALSE(index.find("", &value));
+
+    index.clear();
+    EXPECT_FALSE(index.find("array", &value));
+}
+
 } // namespace
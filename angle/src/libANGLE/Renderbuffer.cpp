@@ -46,6 +46,7 @@ Error Renderbuffer::setStorage(GLenum internalformat, size_t width, size_t heigh
     mHeight = height;
     mInternalFormat = internalformat;
     mSamples = 0;
+    notifyStateChange();
 
     return Error(GL_NO_ERROR);
 }
@@ -62,6 +63,7 @@ Error Renderbuffer::setStorageMultisample(size_t samples, GLenum internalformat,
     mHeight = height;
     mInternalFormat = internalformat;
     mSamples = samples;
+    notifyStateChange();
 
     return Error(GL_NO_ERROR);
 }
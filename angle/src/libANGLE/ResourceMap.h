@@ -0,0 +1,223 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// ResourceMap.h: Defines the gl::ResourceMap class, which maps GL handles to the objects
+// they name.
+
+#ifndef LIBANGLE_RESOURCEMAP_H_
+#define LIBANGLE_RESOURCEMAP_H_
+
+#include "common/angleutils.h"
+#include "common/debug.h"
+
+#include "angle_gl.h"
+
+#include <algorithm>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace gl
+{
+
+// HandleAllocator hands out small, mostly consecutive handles, so handles below FlatResourcesLimit
+// index a flat array that grows as needed. Larger names, which only come from applications
+// choosing their own, go to a hash map. A handle can be in the map with a null object, which is
+// how names that were generated but not yet bound are recorded.
+template <typename ResourceType>
+class ResourceMap final : angle::NonCopyable
+{
+  public:
+    typedef std::pair<GLuint, ResourceType *> value_type;
+
+    static const GLuint FlatResourcesLimit = 0x4000;
+
+    ResourceMap() : mSize(0) {}
+
+    // Returns the object, or null if the handle isn't in the map or has no object yet.
+    ResourceType *query(GLuint handle) const
+    {
+        if (handle < FlatResourcesLimit)
+        {
+            if (handle >= mFlatResources.size() || mFlatResources[handle] == InvalidPointer())
+            {
+                return nullptr;
+            }
+            return mFlatResources[handle];
+        }
+
+        auto iter = mHashedResources.find(handle);
+        return (iter != mHashedResources.end()) ? iter->second : nullptr;
+    }
+
+    bool contains(GLuint handle) const
+    {
+        if (handle < FlatResourcesLimit)
+        {
+            return (handle < mFlatResources.size() && mFlatResources[handle] != InvalidPointer());
+        }
+        return (mHashedResources.find(handle) != mHashedResources.end());
+    }
+
+    // Adds the handle to the map, or replaces the object of a handle already in it.
+    void assign(GLuint handle, ResourceType *resource)
+    {
+        if (handle < FlatResourcesLimit)
+        {
+            if (handle >= mFlatResources.size())
+            {
+                size_t newSize = std::max<size_t>(handle + 1, mFlatResources.size() * 2);
+                mFlatResources.resize(std::min<size_t>(newSize, FlatResourcesLimit), InvalidPointer());
+            }
+
+            if (mFlatResources[handle] == InvalidPointer())
+            {
+                mSize++;
+            }
+            mFlatResources[handle] = resource;
+        }
+        else
+        {
+            auto result = mHashedResources.insert(std::make_pair(handle, resource));
+            if (result.second)
+            {
+                mSize++;
+            }
+            else
+            {
+                result.first->second = resource;
+            }
+        }
+    }
+
+    // Removes the handle from the map. Returns false if it wasn't in it, otherwise returns its
+    // object, which may be null, through resourceOut.
+    bool erase(GLuint handle, ResourceType **resourceOut)
+    {
+        if (handle < FlatResourcesLimit)
+        {
+            if (handle >= mFlatResources.size() || mFlatResources[handle] == InvalidPointer())
+            {
+                return false;
+            }
+            *resourceOut = mFlatResources[handle];
+            mFlatResources[handle] = InvalidPointer();
+        }
+        else
+        {
+            auto iter = mHashedResources.find(handle);
+            if (iter == mHashedResources.end())
+            {
+                return false;
+            }
+            *resourceOut = iter->second;
+            mHashedResources.erase(iter);
+        }
+
+        mSize--;
+        return true;
+    }
+
+    bool empty() const { return mSize == 0; }
+    size_t size() const { return mSize; }
+
+    // Visits the flat handles in ascending order, then the hashed ones in no particular order.
+    class Iterator final
+    {
+      public:
+        bool operator==(const Iterator &other) const
+        {
+            return mFlatIndex == other.mFlatIndex && mHashIter == other.mHashIter;
+        }
+        bool operator!=(const Iterator &other) const { return !(*this == other); }
+
+        Iterator &operator++()
+        {
+            if (mFlatIndex < mOrigin->mFlatResources.size())
+            {
+                mFlatIndex = mOrigin->nextFlatIndex(mFlatIndex + 1);
+            }
+            else
+            {
+                ++mHashIter;
+            }
+            updateValue();
+            return *this;
+        }
+
+        const value_type &operator*() const { return mValue; }
+        const value_type *operator->() const { return &mValue; }
+
+      private:
+        friend class ResourceMap;
+
+        typedef typename std::unordered_map<GLuint, ResourceType *>::const_iterator HashIterator;
+
+        Iterator(const ResourceMap *origin, size_t flatIndex, HashIterator hashIter)
+            : mOrigin(origin),
+              mFlatIndex(flatIndex),
+              mHashIter(hashIter)
+        {
+            updateValue();
+        }
+
+        void updateValue()
+        {
+            if (mFlatIndex < mOrigin->mFlatResources.size())
+            {
+                mValue = value_type(static_cast<GLuint>(mFlatIndex), mOrigin->mFlatResources[mFlatIndex]);
+            }
+            else if (mHashIter != mOrigin->mHashedResources.end())
+            {
+                mValue = *mHashIter;
+            }
+        }
+
+        const ResourceMap *mOrigin;
+        size_t mFlatIndex;
+        HashIterator mHashIter;
+        value_type mValue;
+    };
+
+    Iterator begin() const { return Iterator(this, nextFlatIndex(0), mHashedResources.begin()); }
+    Iterator end() const { return Iterator(this, mFlatResources.size(), mHashedResources.end()); }
+
+    // Returns every handle in the map, in iteration order. Loops that erase handles as they go use
+    // this snapshot rather than restarting from begin(), which rescans the empty flat slots.
+    std::vector<GLuint> getHandles() const
+    {
+        std::vector<GLuint> handles;
+        handles.reserve(mSize);
+        for (const auto &resource : *this)
+        {
+            handles.push_back(resource.first);
+        }
+        return handles;
+    }
+
+  private:
+    static ResourceType *InvalidPointer() { return reinterpret_cast<ResourceType *>(-1); }
+
+    size_t nextFlatIndex(size_t index) const
+    {
+        while (index < mFlatResources.size() && mFlatResources[index] == InvalidPointer())
+        {
+            index++;
+        }
+        return index;
+    }
+
+    std::vector<ResourceType *> mFlatResources;
+    std::unordered_map<GLuint, ResourceType *> mHashedResources;
+    size_t mSize;
+};
+
+template <typename ResourceType>
+const GLuint ResourceMap<ResourceType>::FlatResourcesLimit;
+
+}
+
+#endif // LIBANGLE_RESOURCEMAP_H_
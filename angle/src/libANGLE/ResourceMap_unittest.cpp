@@ -0,0 +1,153 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// ResourceMap_unittest.cpp: Unit tests for the map from GL handles to objects.
+
+#include <set>
+
+#include "gtest/gtest.h"
+
+#include "libANGLE/ResourceMap.h"
+
+namespace
+{
+
+typedef gl::ResourceMap<int> IntResourceMap;
+
+TEST(ResourceMapTest, AssignQueryAndErase)
+{
+    IntResourceMap map;
+    int objects[3] = {};
+
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(nullptr, map.query(1));
+    EXPECT_FALSE(map.contains(1));
+
+    map.assign(1, &objects[0]);
+    map.assign(5, &objects[1]);
+    EXPECT_EQ(2u, map.size());
+    EXPECT_EQ(&objects[0], map.query(1));
+    EXPECT_EQ(&objects[1], map.query(5));
+    EXPECT_FALSE(map.contains(2));
+
+    // Replacing the object doesn't add another handle
+    map.assign(5, &objects[2]);
+    EXPECT_EQ(2u, map.size());
+    EXPECT_EQ(&objects[2], map.query(5));
+
+    int *erased = nullptr;
+    EXPECT_TRUE(map.erase(1, &erased));
+    EXPECT_EQ(&objects[0], erased);
+    EXPECT_FALSE(map.erase(1, &erased));
+    EXPECT_FALSE(map.contains(1));
+    EXPECT_EQ(1u, map.size());
+}
+
+// Handles that were generated but have no object yet are in the map.
+TEST(ResourceMapTest, NullObjects)
+{
+    IntResourceMap map;
+    map.assign(3, nullptr);
+
+    EXPECT_TRUE(map.contains(3));
+    EXPECT_EQ(nullptr, map.query(3));
+    EXPECT_EQ(1u, map.size());
+
+    int *erased = reinterpret_cast<int *>(1);
+    EXPECT_TRUE(map.erase(3, &erased));
+    EXPECT_EQ(nullptr, erased);
+    EXPECT_TRUE(map.empty());
+}
+
+// Names past the flat range, which applications can choose themselves, work the same way.
+TEST(ResourceMapTest, LargeHandles)
+{
+    IntResourceMap map;
+    int objects[2] = {};
+    const GLuint largeHandle = IntResourceMap::FlatResourcesLimit + 100;
+
+    map.assign(largeHandle, &objects[0]);
+    map.assign(0xFFFFFFFFu, &objects[1]);
+    EXPECT_EQ(&objects[0], map.query(largeHandle));
+    EXPECT_EQ(&objects[1], map.query(0xFFFFFFFFu));
+    EXPECT_FALSE(map.contains(largeHandle + 1));
+    EXPECT_EQ(2u, map.size());
+
+    int *erased = nullptr;
+    EXPECT_TRUE(map.erase(largeHandle, &erased));
+    EXPECT_EQ(&objects[0], erased);
+    EXPECT_FALSE(map.contains(largeHandle));
+    EXPECT_EQ(1u, map.size());
+}
+
+// Iteration visits every handle once, with the flat handles in ascending order.
+TEST(ResourceMapTest, Iteration)
+{
+    IntResourceMap map;
+    EXPECT_TRUE(map.begin() == map.end());
+
+    int objects[4] = {};
+    const GLuint largeHandle = IntResourceMap::FlatResourcesLimit;
+    map.assign(9, &objects[0]);
+    map.assign(2, &objects[1]);
+    map.assign(largeHandle, &objects[2]);
+    map.assign(4, nullptr);
+    map.assign(7, &objects[3]);
+
+    int *erased = nullptr;
+    map.erase(7, &erased);
+
+    std::vector<GLuint> flatHandles;
+    std::set<GLuint> largeHandles;
+    for (const auto &resource : map)
+    {
+        EXPECT_EQ(map.query(resource.first), resource.second);
+        if (resource.first < IntResourceMap::FlatResourcesLimit)
+        {
+            flatHandles.push_back(resource.first);
+        }
+        else
+        {
+            largeHandles.insert(resource.first);
+        }
+    }
+
+    ASSERT_EQ(3u, flatHandles.size());
+    EXPECT_EQ(2u, flatHandles[0]);
+    EXPECT_EQ(4u, flatHandles[1]);
+    EXPECT_EQ(9u, flatHandles[2]);
+    EXPECT_EQ(1u, largeHandles.size());
+    EXPECT_EQ(1u, largeHandles.count(largeHandle));
+}
+
+// The handle snapshot lists the same handles as iteration and stays valid while they are erased.
+TEST(ResourceMapTest, GetHandles)
+{
+    IntResourceMap map;
+    EXPECT_TRUE(map.getHandles().empty());
+
+    int objects[3] = {};
+    const GLuint largeHandle = IntResourceMap::FlatResourcesLimit + 5;
+    map.assign(3, &objects[0]);
+    map.assign(largeHandle, &objects[1]);
+    map.assign(1, &objects[2]);
+
+    std::vector<GLuint> handles = map.getHandles();
+    ASSERT_EQ(3u, handles.size());
+    EXPECT_EQ(1u, handles[0]);
+    EXPECT_EQ(3u, handles[1]);
+    EXPECT_EQ(largeHandle, handles[2]);
+
+    for (GLuint handle : handles)
+    {
+        int *erased = nullptr;
+        EXPECT_TRUE(map.erase(handle, &erased));
+        EXPECT_EQ(nullptr, map.query(handle));
+    }
+    EXPECT_TRUE(map.empty());
+}
+
+}
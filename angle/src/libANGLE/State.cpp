@@ -23,6 +23,11 @@ State::State()
 {
     mMaxDrawBuffers = 0;
     mMaxCombinedTextureImageUnits = 0;
+    mVertexArray = NULL;
+    mProgram = NULL;
+    mDrawStateValidated = false;
+    mMaxValidatedVertex = 0;
+    mMaxValidatedPrimcount = 0;
 }
 
 State::~State()
@@ -137,6 +142,9 @@ void State::initialize(const Caps &caps, GLuint clientVersion)
     mDrawFramebuffer = NULL;
 
     mPrimitiveRestart = false;
+
+    setAllDirtyBits();
+    invalidateDrawState();
 }
 
 void State::reset()
@@ -157,8 +165,15 @@ void State::reset()
     mArrayBuffer.set(NULL);
     mRenderbuffer.set(NULL);
 
+    if (mVertexArray)
+    {
+        mVertexArray->removeObserver(this);
+    }
+    mVertexArray = NULL;
+
     if (mProgram)
     {
+        mProgram->removeObserver(this);
         mProgram->release();
     }
     mProgram = NULL;
@@ -173,6 +188,10 @@ void State::reset()
     mGenericUniformBuffer.set(NULL);
     for (BufferVector::iterator bufItr = mUniformBuffers.begin(); bufItr != mUniformBuffers.end(); ++bufItr)
     {
+        if (bufItr->get())
+        {
+            bufItr->get()->removeObserver(this);
+        }
         bufItr->set(NULL);
     }
 
@@ -183,6 +202,8 @@ void State::reset()
     mUnpack.pixelBuffer.set(NULL);
 
     mProgram = NULL;
+
+    invalidateDrawState();
 }
 
 const RasterizerState &State::getRasterizerState() const
@@ -206,16 +227,19 @@ void State::setColorClearValue(float red, float green, float blue, float alpha)
     mColorClearValue.green = green;
     mColorClearValue.blue = blue;
     mColorClearValue.alpha = alpha;
+    mDirtyBits.set(DIRTY_BIT_CLEAR_COLOR);
 }
 
 void State::setDepthClearValue(float depth)
 {
     mDepthClearValue = depth;
+    mDirtyBits.set(DIRTY_BIT_CLEAR_DEPTH);
 }
 
 void State::setStencilClearValue(int stencil)
 {
     mStencilClearValue = stencil;
+    mDirtyBits.set(DIRTY_BIT_CLEAR_STENCIL);
 }
 
 void State::setColorMask(bool red, bool green, bool blue, bool alpha)
@@ -224,11 +248,13 @@ void State::setColorMask(bool red, bool green, bool blue, bool alpha)
     mBlend.colorMaskGreen = green;
     mBlend.colorMaskBlue = blue;
     mBlend.colorMaskAlpha = alpha;
+    mDirtyBits.set(DIRTY_BIT_COLOR_MASK);
 }
 
 void State::setDepthMask(bool mask)
 {
     mDepthStencil.depthMask = mask;
+    mDirtyBits.set(DIRTY_BIT_DEPTH_MASK);
 }
 
 bool State::isRasterizerDiscardEnabled() const
@@ -239,6 +265,7 @@ bool State::isRasterizerDiscardEnabled() const
 void State::setRasterizerDiscard(bool enabled)
 {
     mRasterizer.rasterizerDiscard = enabled;
+    mDirtyBits.set(DIRTY_BIT_RASTERIZER_DISCARD_ENABLED);
 }
 
 bool State::isCullFaceEnabled() const
@@ -249,16 +276,19 @@ bool State::isCullFaceEnabled() const
 void State::setCullFace(bool enabled)
 {
     mRasterizer.cullFace = enabled;
+    mDirtyBits.set(DIRTY_BIT_CULL_FACE_ENABLED);
 }
 
 void State::setCullMode(GLenum mode)
 {
     mRasterizer.cullMode = mode;
+    mDirtyBits.set(DIRTY_BIT_CULL_FACE);
 }
 
 void State::setFrontFace(GLenum front)
 {
     mRasterizer.frontFace = front;
+    mDirtyBits.set(DIRTY_BIT_FRONT_FACE);
 }
 
 bool State::isDepthTestEnabled() const
@@ -269,17 +299,20 @@ bool State::isDepthTestEnabled() const
 void State::setDepthTest(bool enabled)
 {
     mDepthStencil.depthTest = enabled;
+    mDirtyBits.set(DIRTY_BIT_DEPTH_TEST_ENABLED);
 }
 
 void State::setDepthFunc(GLenum depthFunc)
 {
      mDepthStencil.depthFunc = depthFunc;
+    mDirtyBits.set(DIRTY_BIT_DEPTH_FUNC);
 }
 
 void State::setDepthRange(float zNear, float zFar)
 {
     mNearZ = zNear;
     mFarZ = zFar;
+    mDirtyBits.set(DIRTY_BIT_DEPTH_RANGE);
 }
 
 float State::getNearPlane() const
@@ -300,6 +333,7 @@ bool State::isBlendEnabled() const
 void State::setBlend(bool enabled)
 {
     mBlend.blend = enabled;
+    mDirtyBits.set(DIRTY_BIT_BLEND_ENABLED);
 }
 
 void State::setBlendFactors(GLenum sourceRGB, GLenum destRGB, GLenum sourceAlpha, GLenum destAlpha)
@@ -308,6 +342,7 @@ void State::setBlendFactors(GLenum sourceRGB, GLenum destRGB, GLenum sourceAlpha
     mBlend.destBlendRGB = destRGB;
     mBlend.sourceBlendAlpha = sourceAlpha;
     mBlend.destBlendAlpha = destAlpha;
+    mDirtyBits.set(DIRTY_BIT_BLEND_FUNCS);
 }
 
 void State::setBlendColor(float red, float green, float blue, float alpha)
@@ -316,12 +351,14 @@ void State::setBlendColor(float red, float green, float blue, float alpha)
     mBlendColor.green = green;
     mBlendColor.blue = blue;
     mBlendColor.alpha = alpha;
+    mDirtyBits.set(DIRTY_BIT_BLEND_COLOR);
 }
 
 void State::setBlendEquation(GLenum rgbEquation, GLenum alphaEquation)
 {
     mBlend.blendEquationRGB = rgbEquation;
     mBlend.blendEquationAlpha = alphaEquation;
+    mDirtyBits.set(DIRTY_BIT_BLEND_EQUATIONS);
 }
 
 const ColorF &State::getBlendColor() const
@@ -337,6 +374,7 @@ bool State::isStencilTestEnabled() const
 void State::setStencilTest(bool enabled)
 {
     mDepthStencil.stencilTest = enabled;
+    mDirtyBits.set(DIRTY_BIT_STENCIL_TEST_ENABLED);
 }
 
 void State::setStencilParams(GLenum stencilFunc, GLint stencilRef, GLuint stencilMask)
@@ -344,6 +382,8 @@ void State::setStencilParams(GLenum stencilFunc, GLint stencilRef, GLuint stenci
     mDepthStencil.stencilFunc = stencilFunc;
     mStencilRef = (stencilRef > 0) ? stencilRef : 0;
     mDepthStencil.stencilMask = stencilMask;
+    mDirtyBits.set(DIRTY_BIT_STENCIL_FUNCS_FRONT);
+    invalidateDrawState();
 }
 
 void State::setStencilBackParams(GLenum stencilBackFunc, GLint stencilBackRef, GLuint stencilBackMask)
@@ -351,16 +391,22 @@ void State::setStencilBackParams(GLenum stencilBackFunc, GLint stencilBackRef, G
     mDepthStencil.stencilBackFunc = stencilBackFunc;
     mStencilBackRef = (stencilBackRef > 0) ? stencilBackRef : 0;
     mDepthStencil.stencilBackMask = stencilBackMask;
+    mDirtyBits.set(DIRTY_BIT_STENCIL_FUNCS_BACK);
+    invalidateDrawState();
 }
 
 void State::setStencilWritemask(GLuint stencilWritemask)
 {
     mDepthStencil.stencilWritemask = stencilWritemask;
+    mDirtyBits.set(DIRTY_BIT_STENCIL_WRITEMASK_FRONT);
+    invalidateDrawState();
 }
 
 void State::setStencilBackWritemask(GLuint stencilBackWritemask)
 {
     mDepthStencil.stencilBackWritemask = stencilBackWritemask;
+    mDirtyBits.set(DIRTY_BIT_STENCIL_WRITEMASK_BACK);
+    invalidateDrawState();
 }
 
 void State::setStencilOperations(GLenum stencilFail, GLenum stencilPassDepthFail, GLenum stencilPassDepthPass)
@@ -368,6 +414,7 @@ void State::setStencilOperations(GLenum stencilFail, GLenum stencilPassDepthFail
     mDepthStencil.stencilFail = stencilFail;
     mDepthStencil.stencilPassDepthFail = stencilPassDepthFail;
     mDepthStencil.stencilPassDepthPass = stencilPassDepthPass;
+    mDirtyBits.set(DIRTY_BIT_STENCIL_OPS_FRONT);
 }
 
 void State::setStencilBackOperations(GLenum stencilBackFail, GLenum stencilBackPassDepthFail, GLenum stencilBackPassDepthPass)
@@ -375,6 +422,7 @@ void State::setStencilBackOperations(GLenum stencilBackFail, GLenum stencilBackP
     mDepthStencil.stencilBackFail = stencilBackFail;
     mDepthStencil.stencilBackPassDepthFail = stencilBackPassDepthFail;
     mDepthStencil.stencilBackPassDepthPass = stencilBackPassDepthPass;
+    mDirtyBits.set(DIRTY_BIT_STENCIL_OPS_BACK);
 }
 
 GLint State::getStencilRef() const
@@ -395,6 +443,7 @@ bool State::isPolygonOffsetFillEnabled() const
 void State::setPolygonOffsetFill(bool enabled)
 {
      mRasterizer.polygonOffsetFill = enabled;
+    mDirtyBits.set(DIRTY_BIT_POLYGON_OFFSET_FILL_ENABLED);
 }
 
 void State::setPolygonOffsetParams(GLfloat factor, GLfloat units)
@@ -402,6 +451,7 @@ void State::setPolygonOffsetParams(GLfloat factor, GLfloat units)
     // An application can pass NaN values here, so handle this gracefully
     mRasterizer.polygonOffsetFactor = factor != factor ? 0.0f : factor;
     mRasterizer.polygonOffsetUnits = units != units ? 0.0f : units;
+    mDirtyBits.set(DIRTY_BIT_POLYGON_OFFSET);
 }
 
 bool State::isSampleAlphaToCoverageEnabled() const
@@ -412,6 +462,7 @@ bool State::isSampleAlphaToCoverageEnabled() const
 void State::setSampleAlphaToCoverage(bool enabled)
 {
     mBlend.sampleAlphaToCoverage = enabled;
+    mDirtyBits.set(DIRTY_BIT_SAMPLE_ALPHA_TO_COVERAGE_ENABLED);
 }
 
 bool State::isSampleCoverageEnabled() const
@@ -422,12 +473,14 @@ bool State::isSampleCoverageEnabled() const
 void State::setSampleCoverage(bool enabled)
 {
     mSampleCoverage = enabled;
+    mDirtyBits.set(DIRTY_BIT_SAMPLE_COVERAGE_ENABLED);
 }
 
 void State::setSampleCoverageParams(GLclampf value, bool invert)
 {
     mSampleCoverageValue = value;
     mSampleCoverageInvert = invert;
+    mDirtyBits.set(DIRTY_BIT_SAMPLE_COVERAGE);
 }
 
 GLclampf State::getSampleCoverageValue() const
@@ -448,6 +501,7 @@ bool State::isScissorTestEnabled() const
 void State::setScissorTest(bool enabled)
 {
     mScissorTest = enabled;
+    mDirtyBits.set(DIRTY_BIT_SCISSOR_TEST_ENABLED);
 }
 
 void State::setScissorParams(GLint x, GLint y, GLsizei width, GLsizei height)
@@ -456,6 +510,7 @@ void State::setScissorParams(GLint x, GLint y, GLsizei width, GLsizei height)
     mScissor.y = y;
     mScissor.width = width;
     mScissor.height = height;
+    mDirtyBits.set(DIRTY_BIT_SCISSOR);
 }
 
 const Rectangle &State::getScissor() const
@@ -471,6 +526,7 @@ bool State::isDitherEnabled() const
 void State::setDither(bool enabled)
 {
     mBlend.dither = enabled;
+    mDirtyBits.set(DIRTY_BIT_DITHER_ENABLED);
 }
 
 bool State::isPrimitiveRestartEnabled() const
@@ -481,6 +537,7 @@ bool State::isPrimitiveRestartEnabled() const
 void State::setPrimitiveRestart(bool enabled)
 {
     mPrimitiveRestart = enabled;
+    mDirtyBits.set(DIRTY_BIT_PRIMITIVE_RESTART_ENABLED);
 }
 
 void State::setEnableFeature(GLenum feature, bool enabled)
@@ -524,6 +581,7 @@ bool State::getEnableFeature(GLenum feature)
 void State::setLineWidth(GLfloat width)
 {
     mLineWidth = width;
+    mDirtyBits.set(DIRTY_BIT_LINE_WIDTH);
 }
 
 float State::getLineWidth() const
@@ -534,11 +592,13 @@ float State::getLineWidth() const
 void State::setGenerateMipmapHint(GLenum hint)
 {
     mGenerateMipmapHint = hint;
+    mDirtyBits.set(DIRTY_BIT_GENERATE_MIPMAP_HINT);
 }
 
 void State::setFragmentShaderDerivativeHint(GLenum hint)
 {
     mFragmentShaderDerivativeHint = hint;
+    mDirtyBits.set(DIRTY_BIT_SHADER_DERIVATIVE_HINT);
     // TODO: Propagate the hint to shader translator so we can write
     // ddx, ddx_coarse, or ddx_fine depending on the hint.
     // Ignore for now. It is valid for implementations to ignore hint.
@@ -550,6 +610,7 @@ void State::setViewportParams(GLint x, GLint y, GLsizei width, GLsizei height)
     mViewport.y = y;
     mViewport.width = width;
     mViewport.height = height;
+    mDirtyBits.set(DIRTY_BIT_VIEWPORT);
 }
 
 const Rectangle &State::getViewport() const
@@ -570,6 +631,7 @@ unsigned int State::getActiveSampler() const
 void State::setSamplerTexture(GLenum type, Texture *texture)
 {
     mSamplerTextures[type][mActiveSampler].set(texture);
+    mDirtyBits.set(DIRTY_BIT_TEXTURE_BINDINGS);
 }
 
 Texture *State::getSamplerTexture(unsigned int sampler, GLenum type) const
@@ -610,6 +672,7 @@ void State::detachTexture(const TextureMap &zeroTextures, GLuint texture)
                 ASSERT(it != zeroTextures.end());
                 // Zero textures are the "default" textures instead of NULL
                 binding.set(it->second.get());
+                mDirtyBits.set(DIRTY_BIT_TEXTURE_BINDINGS);
             }
         }
     }
@@ -641,11 +704,13 @@ void State::initializeZeroTextures(const TextureMap &zeroTextures)
             samplerTextureArray[textureUnit].set(zeroTexture.second.get());
         }
     }
+    mDirtyBits.set(DIRTY_BIT_TEXTURE_BINDINGS);
 }
 
 void State::setSamplerBinding(GLuint textureUnit, Sampler *sampler)
 {
     mSamplers[textureUnit].set(sampler);
+    mDirtyBits.set(DIRTY_BIT_SAMPLER_BINDINGS);
 }
 
 GLuint State::getSamplerId(GLuint textureUnit) const
@@ -673,11 +738,13 @@ void State::detachSampler(GLuint sampler)
             samplerBinding.set(NULL);
         }
     }
+    mDirtyBits.set(DIRTY_BIT_SAMPLER_BINDINGS);
 }
 
 void State::setRenderbufferBinding(Renderbuffer *renderbuffer)
 {
     mRenderbuffer.set(renderbuffer);
+    mDirtyBits.set(DIRTY_BIT_RENDERBUFFER_BINDING);
 }
 
 GLuint State::getRenderbufferId() const
@@ -699,6 +766,7 @@ void State::detachRenderbuffer(GLuint renderbuffer)
     if (mRenderbuffer.id() == renderbuffer)
     {
         mRenderbuffer.set(NULL);
+        mDirtyBits.set(DIRTY_BIT_RENDERBUFFER_BINDING);
     }
 
     // [OpenGL ES 2.0.24] section 4.4 page 111:
@@ -724,11 +792,13 @@ void State::detachRenderbuffer(GLuint renderbuffer)
 void State::setReadFramebufferBinding(Framebuffer *framebuffer)
 {
     mReadFramebuffer = framebuffer;
+    mDirtyBits.set(DIRTY_BIT_READ_FRAMEBUFFER_BINDING);
 }
 
 void State::setDrawFramebufferBinding(Framebuffer *framebuffer)
 {
     mDrawFramebuffer = framebuffer;
+    mDirtyBits.set(DIRTY_BIT_DRAW_FRAMEBUFFER_BINDING);
 }
 
 Framebuffer *State::getTargetFramebuffer(GLenum target) const
@@ -768,6 +838,7 @@ bool State::removeReadFramebufferBinding(GLuint framebuffer)
         mReadFramebuffer->id() == framebuffer)
     {
         mReadFramebuffer = NULL;
+        mDirtyBits.set(DIRTY_BIT_READ_FRAMEBUFFER_BINDING);
         return true;
     }
 
@@ -780,6 +851,7 @@ bool State::removeDrawFramebufferBinding(GLuint framebuffer)
         mDrawFramebuffer->id() == framebuffer)
     {
         mDrawFramebuffer = NULL;
+        mDirtyBits.set(DIRTY_BIT_DRAW_FRAMEBUFFER_BINDING);
         return true;
     }
 
@@ -788,7 +860,24 @@ bool State::removeDrawFramebufferBinding(GLuint framebuffer)
 
 void State::setVertexArrayBinding(VertexArray *vertexArray)
 {
-    mVertexArray = vertexArray;
+    if (mVertexArray != vertexArray)
+    {
+        if (mVertexArray)
+        {
+            mVertexArray->removeObserver(this);
+        }
+
+        mVertexArray = vertexArray;
+
+        if (mVertexArray)
+        {
+            mVertexArray->addObserver(this);
+        }
+
+        invalidateDrawState();
+    }
+
+    mDirtyBits.set(DIRTY_BIT_VERTEX_ARRAY_BINDING);
 }
 
 GLuint State::getVertexArrayId() const
@@ -805,9 +894,12 @@ VertexArray *State::getVertexArray() const
 
 bool State::removeVertexArrayBinding(GLuint vertexArray)
 {
-    if (mVertexArray->id() == vertexArray)
+    if (mVertexArray && mVertexArray->id() == vertexArray)
     {
+        mVertexArray->removeObserver(this);
         mVertexArray = NULL;
+        mDirtyBits.set(DIRTY_BIT_VERTEX_ARRAY_BINDING);
+        invalidateDrawState();
         return true;
     }
 
@@ -820,6 +912,7 @@ void State::setProgram(Program *newProgram)
     {
         if (mProgram)
         {
+            mProgram->removeObserver(this);
             mProgram->release();
         }
 
@@ -828,7 +921,11 @@ void State::setProgram(Program *newProgram)
         if (mProgram)
         {
             newProgram->addRef();
+            newProgram->addObserver(this);
         }
+
+        mDirtyBits.set(DIRTY_BIT_PROGRAM_BINDING);
+        invalidateDrawState();
     }
 }
 
@@ -924,7 +1021,21 @@ void State::setGenericUniformBufferBinding(Buffer *buffer)
 
 void State::setIndexedUniformBufferBinding(GLuint index, Buffer *buffer, GLintptr offset, GLsizeiptr size)
 {
-    mUniformBuffers[index].set(buffer, offset, size);
+    OffsetBindingPointer<Buffer> &binding = mUniformBuffers[index];
+    if (binding.get() != buffer)
+    {
+        if (binding.get())
+        {
+            binding->removeObserver(this);
+        }
+        if (buffer)
+        {
+            buffer->addObserver(this);
+        }
+    }
+
+    binding.set(buffer, offset, size);
+    invalidateDrawState();
 }
 
 GLuint State::getIndexedUniformBufferId(GLuint index) const
@@ -994,30 +1105,35 @@ Buffer *State::getTargetBuffer(GLenum target) const
 void State::setEnableVertexAttribArray(unsigned int attribNum, bool enabled)
 {
     getVertexArray()->enableAttribute(attribNum, enabled);
+    mDirtyBits.set(DIRTY_BIT_VERTEX_ATTRIB_STATE);
 }
 
 void State::setVertexAttribf(GLuint index, const GLfloat values[4])
 {
     ASSERT(static_cast<size_t>(index) < mVertexAttribCurrentValues.size());
     mVertexAttribCurrentValues[index].setFloatValues(values);
+    mDirtyBits.set(DIRTY_BIT_CURRENT_VALUES);
 }
 
 void State::setVertexAttribu(GLuint index, const GLuint values[4])
 {
     ASSERT(static_cast<size_t>(index) < mVertexAttribCurrentValues.size());
     mVertexAttribCurrentValues[index].setUnsignedIntValues(values);
+    mDirtyBits.set(DIRTY_BIT_CURRENT_VALUES);
 }
 
 void State::setVertexAttribi(GLuint index, const GLint values[4])
 {
     ASSERT(static_cast<size_t>(index) < mVertexAttribCurrentValues.size());
     mVertexAttribCurrentValues[index].setIntValues(values);
+    mDirtyBits.set(DIRTY_BIT_CURRENT_VALUES);
 }
 
 void State::setVertexAttribState(unsigned int attribNum, Buffer *boundBuffer, GLint size, GLenum type, bool normalized,
     bool pureInteger, GLsizei stride, const void *pointer)
 {
     getVertexArray()->setAttributeState(attribNum, boundBuffer, size, type, normalized, pureInteger, stride, pointer);
+    mDirtyBits.set(DIRTY_BIT_VERTEX_ATTRIB_STATE);
 }
 
 const VertexAttribCurrentValueData &State::getVertexAttribCurrentValue(unsigned int attribNum) const
@@ -1034,6 +1150,7 @@ const void *State::getVertexAttribPointer(unsigned int attribNum) const
 void State::setPackAlignment(GLint alignment)
 {
     mPack.alignment = alignment;
+    mDirtyBits.set(DIRTY_BIT_PACK_ALIGNMENT);
 }
 
 GLint State::getPackAlignment() const
@@ -1044,6 +1161,7 @@ GLint State::getPackAlignment() const
 void State::setPackReverseRowOrder(bool reverseRowOrder)
 {
     mPack.reverseRowOrder = reverseRowOrder;
+    mDirtyBits.set(DIRTY_BIT_PACK_REVERSE_ROW_ORDER);
 }
 
 bool State::getPackReverseRowOrder() const
@@ -1064,6 +1182,7 @@ PixelPackState &State::getPackState()
 void State::setUnpackAlignment(GLint alignment)
 {
     mUnpack.alignment = alignment;
+    mDirtyBits.set(DIRTY_BIT_UNPACK_ALIGNMENT);
 }
 
 GLint State::getUnpackAlignment() const
@@ -1074,6 +1193,7 @@ GLint State::getUnpackAlignment() const
 void State::setUnpackRowLength(GLint rowLength)
 {
     mUnpack.rowLength = rowLength;
+    mDirtyBits.set(DIRTY_BIT_UNPACK_ROW_LENGTH);
 }
 
 GLint State::getUnpackRowLength() const
@@ -1407,6 +1527,18 @@ bool State::getIndexedInteger64v(GLenum target, GLuint index, GLint64 *data)
     return true;
 }
 
+void State::setDrawStateValidated(GLint64 maxVertex, GLint64 maxPrimcount)
+{
+    mDrawStateValidated = true;
+    mMaxValidatedVertex = maxVertex;
+    mMaxValidatedPrimcount = maxPrimcount;
+}
+
+void State::onSubjectStateChange()
+{
+    invalidateDrawState();
+}
+
 bool State::hasMappedBuffer(GLenum target) const
 {
     if (target == GL_ARRAY_BUFFER)
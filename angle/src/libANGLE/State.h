@@ -12,6 +12,7 @@
 #include "common/angleutils.h"
 #include "libANGLE/RefCountObject.h"
 #include "libANGLE/angletypes.h"
+#include "libANGLE/Observer.h"
 #include "libANGLE/VertexAttribute.h"
 #include "libANGLE/Renderbuffer.h"
 #include "libANGLE/Texture.h"
@@ -19,6 +20,8 @@
 #include "libANGLE/Program.h"
 #include "libANGLE/Sampler.h"
 
+#include <bitset>
+
 namespace gl
 {
 class Query;
@@ -29,7 +32,9 @@ struct Data;
 
 typedef std::map< GLenum, BindingPointer<Texture> > TextureMap;
 
-class State : angle::NonCopyable
+// State observes the bound program, vertex array and indexed uniform buffers so that it
+// can drop the cached draw validation result when any of them change.
+class State : angle::NonCopyable, public Observer
 {
   public:
     State();
@@ -252,7 +257,81 @@ class State : angle::NonCopyable
 
     bool hasMappedBuffer(GLenum target) const;
 
+    // Groups of state touched since the renderer last synced. Every setter
+    // marks its group so backends only need to re-apply what changed.
+    enum DirtyBitType
+    {
+        DIRTY_BIT_SCISSOR_TEST_ENABLED,
+        DIRTY_BIT_SCISSOR,
+        DIRTY_BIT_VIEWPORT,
+        DIRTY_BIT_DEPTH_RANGE,
+        DIRTY_BIT_BLEND_ENABLED,
+        DIRTY_BIT_BLEND_COLOR,
+        DIRTY_BIT_BLEND_FUNCS,
+        DIRTY_BIT_BLEND_EQUATIONS,
+        DIRTY_BIT_COLOR_MASK,
+        DIRTY_BIT_SAMPLE_ALPHA_TO_COVERAGE_ENABLED,
+        DIRTY_BIT_SAMPLE_COVERAGE_ENABLED,
+        DIRTY_BIT_SAMPLE_COVERAGE,
+        DIRTY_BIT_DEPTH_TEST_ENABLED,
+        DIRTY_BIT_DEPTH_FUNC,
+        DIRTY_BIT_DEPTH_MASK,
+        DIRTY_BIT_STENCIL_TEST_ENABLED,
+        DIRTY_BIT_STENCIL_FUNCS_FRONT,
+        DIRTY_BIT_STENCIL_FUNCS_BACK,
+        DIRTY_BIT_STENCIL_OPS_FRONT,
+        DIRTY_BIT_STENCIL_OPS_BACK,
+        DIRTY_BIT_STENCIL_WRITEMASK_FRONT,
+        DIRTY_BIT_STENCIL_WRITEMASK_BACK,
+        DIRTY_BIT_CULL_FACE_ENABLED,
+        DIRTY_BIT_CULL_FACE,
+        DIRTY_BIT_FRONT_FACE,
+        DIRTY_BIT_POLYGON_OFFSET_FILL_ENABLED,
+        DIRTY_BIT_POLYGON_OFFSET,
+        DIRTY_BIT_RASTERIZER_DISCARD_ENABLED,
+        DIRTY_BIT_LINE_WIDTH,
+        DIRTY_BIT_PRIMITIVE_RESTART_ENABLED,
+        DIRTY_BIT_CLEAR_COLOR,
+        DIRTY_BIT_CLEAR_DEPTH,
+        DIRTY_BIT_CLEAR_STENCIL,
+        DIRTY_BIT_UNPACK_ALIGNMENT,
+        DIRTY_BIT_UNPACK_ROW_LENGTH,
+        DIRTY_BIT_PACK_ALIGNMENT,
+        DIRTY_BIT_PACK_REVERSE_ROW_ORDER,
+        DIRTY_BIT_DITHER_ENABLED,
+        DIRTY_BIT_GENERATE_MIPMAP_HINT,
+        DIRTY_BIT_SHADER_DERIVATIVE_HINT,
+        DIRTY_BIT_READ_FRAMEBUFFER_BINDING,
+        DIRTY_BIT_DRAW_FRAMEBUFFER_BINDING,
+        DIRTY_BIT_RENDERBUFFER_BINDING,
+        DIRTY_BIT_VERTEX_ARRAY_BINDING,
+        DIRTY_BIT_VERTEX_ATTRIB_STATE,
+        DIRTY_BIT_CURRENT_VALUES,
+        DIRTY_BIT_PROGRAM_BINDING,
+        DIRTY_BIT_TEXTURE_BINDINGS,
+        DIRTY_BIT_SAMPLER_BINDINGS,
+        DIRTY_BIT_INVALID,
+        DIRTY_BIT_MAX = DIRTY_BIT_INVALID,
+    };
+
+    typedef std::bitset<DIRTY_BIT_MAX> DirtyBits;
+    const DirtyBits &getDirtyBits() const { return mDirtyBits; }
+    void clearDirtyBits() { mDirtyBits.reset(); }
+    void setAllDirtyBits() { mDirtyBits.set(); }
+
+    // Draw validation cache. Holds the outcome of the draw checks that only depend on
+    // bound state, as the largest vertex and instance counts the bound vertex buffers
+    // can serve, until a binding or an observed object those checks read changes.
+    bool isDrawStateValidated() const { return mDrawStateValidated; }
+    GLint64 getMaxValidatedVertex() const { return mMaxValidatedVertex; }
+    GLint64 getMaxValidatedPrimcount() const { return mMaxValidatedPrimcount; }
+    void setDrawStateValidated(GLint64 maxVertex, GLint64 maxPrimcount);
+
+    void onSubjectStateChange() override;
+
   private:
+    void invalidateDrawState() { mDrawStateValidated = false; }
+
     // Cached values from Context's caps
     GLuint mMaxDrawBuffers;
     GLuint mMaxCombinedTextureImageUnits;
@@ -320,6 +399,12 @@ class State : angle::NonCopyable
     PixelPackState mPack;
 
     bool mPrimitiveRestart;
+
+    DirtyBits mDirtyBits;
+
+    bool mDrawStateValidated;
+    GLint64 mMaxValidatedVertex;
+    GLint64 mMaxValidatedPrimcount;
 };
 
 }
@@ -0,0 +1,198 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Unit tests for the dirty bits set by the State setters, and for the notifications
+// that drop the cached draw validation result.
+//
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "libANGLE/Buffer.h"
+#include "libANGLE/Caps.h"
+#include "libANGLE/State.h"
+#include "libANGLE/VertexArray.h"
+#include "libANGLE/renderer/BufferImpl_mock.h"
+#include "libANGLE/renderer/VertexArrayImpl.h"
+
+using ::testing::_;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+namespace
+{
+
+class StateDirtyBitsTest : public testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        gl::Caps caps;
+        caps.maxDrawBuffers = 4;
+        caps.maxVertexAttributes = 16;
+        caps.maxCombinedUniformBlocks = 24;
+        caps.maxCombinedTextureImageUnits = 16;
+        mState.initialize(caps, 3);
+    }
+
+    gl::State mState;
+};
+
+// A freshly initialized state needs a full sync.
+TEST_F(StateDirtyBitsTest, InitializeSetsAllBits)
+{
+    EXPECT_TRUE(mState.getDirtyBits().all());
+
+    mState.clearDirtyBits();
+    EXPECT_TRUE(mState.getDirtyBits().none());
+}
+
+// Setters only mark the groups they touch.
+TEST_F(StateDirtyBitsTest, SettersMarkTheirGroup)
+{
+    mState.clearDirtyBits();
+
+    mState.setBlend(true);
+    mState.setScissorParams(1, 2, 3, 4);
+    mState.setStencilBackOperations(GL_ZERO, GL_KEEP, GL_INCR);
+
+    gl::State::DirtyBits expected;
+    expected.set(gl::State::DIRTY_BIT_BLEND_ENABLED);
+    expected.set(gl::State::DIRTY_BIT_SCISSOR);
+    expected.set(gl::State::DIRTY_BIT_STENCIL_OPS_BACK);
+    EXPECT_EQ(expected, mState.getDirtyBits());
+}
+
+// Generic enables go through the same setters as the specific ones.
+TEST_F(StateDirtyBitsTest, EnableFeature)
+{
+    mState.clearDirtyBits();
+
+    mState.setEnableFeature(GL_DEPTH_TEST, true);
+    mState.setEnableFeature(GL_RASTERIZER_DISCARD, true);
+
+    EXPECT_EQ(2u, mState.getDirtyBits().count());
+    EXPECT_TRUE(mState.getDirtyBits().test(gl::State::DIRTY_BIT_DEPTH_TEST_ENABLED));
+    EXPECT_TRUE(mState.getDirtyBits().test(gl::State::DIRTY_BIT_RASTERIZER_DISCARD_ENABLED));
+}
+
+// Rebinding the current program is not a change.
+TEST_F(StateDirtyBitsTest, SameProgramIsNotDirty)
+{
+    mState.clearDirtyBits();
+
+    mState.setProgram(nullptr);
+    EXPECT_TRUE(mState.getDirtyBits().none());
+}
+
+class NullVertexArrayImpl : public rx::VertexArrayImpl
+{
+  public:
+    void setElementArrayBuffer(const gl::Buffer *buffer) override {}
+    void setAttribute(size_t idx, const gl::VertexAttribute &attr) override {}
+    void setAttributeDivisor(size_t idx, GLuint divisor) override {}
+    void enableAttribute(size_t idx, bool enabledState) override {}
+};
+
+class StateDrawValidationTest : public StateDirtyBitsTest
+{
+  protected:
+    void SetUp() override
+    {
+        StateDirtyBitsTest::SetUp();
+
+        mBufferImpl = new NiceMock<rx::MockBufferImpl>;
+        ON_CALL(*mBufferImpl, setData(_, _, _)).WillByDefault(Return(gl::Error(GL_NO_ERROR)));
+        mBuffer = new gl::Buffer(mBufferImpl, 1);
+        mBuffer->addRef();
+
+        mVertexArray = new gl::VertexArray(new NullVertexArrayImpl, 1, gl::MAX_VERTEX_ATTRIBS);
+        mState.setVertexArrayBinding(mVertexArray);
+        mState.setDrawStateValidated(0, 0);
+    }
+
+    void TearDown() override
+    {
+        mState.reset();
+        delete mVertexArray;
+        mBuffer->release();
+    }
+
+    rx::MockBufferImpl *mBufferImpl;
+    gl::Buffer *mBuffer;
+    gl::VertexArray *mVertexArray;
+};
+
+// State the checks read directly drops the cached result.
+TEST_F(StateDrawValidationTest, SettersInvalidate)
+{
+    mState.setStencilWritemask(0x0F);
+    EXPECT_FALSE(mState.isDrawStateValidated());
+
+    mState.setDrawStateValidated(0, 0);
+    mState.setVertexArrayBinding(nullptr);
+    EXPECT_FALSE(mState.isDrawStateValidated());
+
+    // Unrelated state keeps it
+    mState.setDrawStateValidated(0, 0);
+    mState.setBlend(true);
+    mState.setViewportParams(0, 0, 16, 16);
+    EXPECT_TRUE(mState.isDrawStateValidated());
+}
+
+// Edits to the bound vertex array, and to the buffers it uses, reach the state.
+TEST_F(StateDrawValidationTest, VertexArrayNotifies)
+{
+    mState.setVertexAttribState(0, mBuffer, 4, GL_FLOAT, false, false, 0, nullptr);
+    EXPECT_FALSE(mState.isDrawStateValidated());
+
+    mState.setDrawStateValidated(0, 0);
+    mState.setEnableVertexAttribArray(0, true);
+    EXPECT_FALSE(mState.isDrawStateValidated());
+
+    mState.setDrawStateValidated(0, 0);
+    mBuffer->bufferData(nullptr, 64, GL_STATIC_DRAW);
+    EXPECT_FALSE(mState.isDrawStateValidated());
+
+    // Same size, so nothing the checks read has changed
+    mState.setDrawStateValidated(0, 0);
+    mBuffer->bufferData(nullptr, 64, GL_DYNAMIC_DRAW);
+    EXPECT_TRUE(mState.isDrawStateValidated());
+
+    // Once detached, the buffer no longer reaches the state
+    mVertexArray->detachBuffer(mBuffer->id());
+    mState.setDrawStateValidated(0, 0);
+    mBuffer->bufferData(nullptr, 128, GL_STATIC_DRAW);
+    EXPECT_TRUE(mState.isDrawStateValidated());
+}
+
+// A buffer used by several attributes keeps notifying until every use is gone.
+TEST_F(StateDrawValidationTest, BufferSharedByAttributes)
+{
+    mState.setVertexAttribState(0, mBuffer, 4, GL_FLOAT, false, false, 0, nullptr);
+    mState.setVertexAttribState(1, mBuffer, 4, GL_FLOAT, false, false, 0, nullptr);
+    mState.setVertexAttribState(0, nullptr, 4, GL_FLOAT, false, false, 0, nullptr);
+
+    mState.setDrawStateValidated(0, 0);
+    mBuffer->bufferData(nullptr, 32, GL_STATIC_DRAW);
+    EXPECT_FALSE(mState.isDrawStateValidated());
+
+    mState.setVertexAttribState(1, nullptr, 4, GL_FLOAT, false, false, 0, nullptr);
+    mState.setDrawStateValidated(0, 0);
+    mBuffer->bufferData(nullptr, 16, GL_STATIC_DRAW);
+    EXPECT_TRUE(mState.isDrawStateValidated());
+}
+
+// Uniform buffers bound to indexed binding points are observed too.
+TEST_F(StateDrawValidationTest, UniformBufferNotifies)
+{
+    mState.setIndexedUniformBufferBinding(2, mBuffer, 0, 0);
+    EXPECT_FALSE(mState.isDrawStateValidated());
+
+    mState.setDrawStateValidated(0, 0);
+    mBuffer->bufferData(nullptr, 256, GL_STATIC_DRAW);
+    EXPECT_FALSE(mState.isDrawStateValidated());
+}
+
+} // namespace
@@ -335,6 +335,7 @@ void Texture::setImageDesc(GLenum target, size_t level, const ImageDesc &desc)
     ASSERT(descIndex < mImageDescs.size());
     mImageDescs[descIndex] = desc;
     mCompletenessCache.cacheValid = false;
+    notifyStateChange();
 }
 
 void Texture::clearImageDesc(GLenum target, size_t level)
@@ -349,6 +350,7 @@ void Texture::clearImageDescs()
         mImageDescs[descIndex] = ImageDesc();
     }
     mCompletenessCache.cacheValid = false;
+    notifyStateChange();
 }
 
 void Texture::bindTexImage(egl::Surface *surface)
@@ -0,0 +1,543 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// TraceRecorder.cpp: Implements the angle::TraceRecorder class.
+
+#include "libANGLE/TraceRecorder.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <limits>
+
+#include "common/debug.h"
+
+#if defined(ANGLE_PLATFORM_POSIX)
+#include <time.h>
+#include <unistd.h>
+#endif
+
+namespace angle
+{
+
+namespace
+{
+
+// About 20MB of events for each thread
+const size_t DefaultMaxEventsPerThread = 1 << 18;
+
+// The TRACE_VALUE_TYPE_* and TRACE_EVENT_FLAG_* values of trace_event.h
+const unsigned char TraceValueTypeBool = 1;
+const unsigned char TraceValueTypeUInt = 2;
+const unsigned char TraceValueTypeInt = 3;
+const unsigned char TraceValueTypeDouble = 4;
+const unsigned char TraceValueTypePointer = 5;
+const unsigned char TraceValueTypeString = 6;
+const unsigned char TraceValueTypeCopyString = 7;
+
+const unsigned char TraceEventFlagCopy = 1 << 0;
+const unsigned char TraceEventFlagHasId = 1 << 1;
+
+const size_t MaxCategories = 64;
+
+// The names come from the trace macros, which only pass string literals
+unsigned char CategoryEnabled[MaxCategories];
+const char *CategoryNames[MaxCategories];
+size_t CategoryCount = 0;
+std::mutex CategoryMutex;
+
+double GetMonotonicSeconds()
+{
+#if defined(ANGLE_PLATFORM_WINDOWS)
+    LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return static_cast<double>(counter.QuadPart) / static_cast<double>(frequency.QuadPart);
+#else
+    timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return static_cast<double>(time.tv_sec) + static_cast<double>(time.tv_nsec) * 1e-9;
+#endif
+}
+
+unsigned int GetProcessIdentifier()
+{
+#if defined(ANGLE_PLATFORM_WINDOWS)
+    return static_cast<unsigned int>(GetCurrentProcessId());
+#else
+    return static_cast<unsigned int>(getpid());
+#endif
+}
+
+void WriteJSONString(std::ostream &out, const char *string)
+{
+    out << '"';
+    for (const char *c = string; *c != '\0'; c++)
+    {
+        switch (*c)
+        {
+          case '"':  out << "\\\""; break;
+          case '\\': out << "\\\\"; break;
+          case '\n': out << "\\n"; break;
+          case '\t': out << "\\t"; break;
+          default:
+            if (static_cast<unsigned char>(*c) < 0x20)
+            {
+                const char hexDigits[] = "0123456789abcdef";
+                out << "\\u00" << hexDigits[(*c >> 4) & 0xF] << hexDigits[*c & 0xF];
+            }
+            else
+            {
+                out << *c;
+            }
+            break;
+        }
+    }
+    out << '"';
+}
+
+void WriteJSONHex(std::ostream &out, unsigned long long value)
+{
+    out << "\"0x" << std::hex << value << std::dec << "\"";
+}
+
+void WriteJSONValue(std::ostream &out, unsigned char type, unsigned long long value)
+{
+    switch (type)
+    {
+      case TraceValueTypeBool:
+        out << (value != 0 ? "true" : "false");
+        break;
+      case TraceValueTypeUInt:
+        out << value;
+        break;
+      case TraceValueTypeInt:
+        out << static_cast<long long>(value);
+        break;
+      case TraceValueTypeDouble:
+        {
+            double number = 0.0;
+            memcpy(&number, &value, sizeof(number));
+            if (number == number && std::abs(number) <= std::numeric_limits<double>::max())
+            {
+                out << number;
+            }
+            else
+            {
+                // JSON has no infinities or NaNs
+                out << "null";
+            }
+        }
+        break;
+      case TraceValueTypePointer:
+        WriteJSONHex(out, value);
+        break;
+      case TraceValueTypeString:
+      case TraceValueTypeCopyString:
+        WriteJSONString(out, reinterpret_cast<const char *>(static_cast<uintptr_t>(value)));
+        break;
+      default:
+        out << "null";
+        break;
+    }
+}
+
+// The same bucket ranges as Chromium's exponential histograms, so that the samples of ANGLE line
+// up with those reported through a browser's platform.
+void BuildExponentialRanges(int min, int max, int bucketCount, std::vector<int> *ranges)
+{
+    min = std::max(min, 1);
+    ranges->resize(bucketCount + 1);
+    (*ranges)[0] = 0;
+    (*ranges)[1] = min;
+    (*ranges)[bucketCount] = std::numeric_limits<int>::max();
+
+    double logMax = log(static_cast<double>(max));
+    int current = min;
+    for (int bucket = 2; bucket < bucketCount; bucket++)
+    {
+        double logCurrent = log(static_cast<double>(current));
+        double logNext = logCurrent + (logMax - logCurrent) / (bucketCount - bucket);
+        int next = static_cast<int>(floor(exp(logNext) + 0.5));
+        current = (next > current) ? next : current + 1;
+        (*ranges)[bucket] = current;
+    }
+}
+
+}
+
+TraceRecorder::Chunk::Chunk()
+    : count(0),
+      next(nullptr)
+{
+}
+
+TraceRecorder::ThreadBuffer::ThreadBuffer(unsigned int threadId)
+    : threadId(threadId),
+      first(new Chunk()),
+      current(first),
+      eventCount(0),
+      droppedCount(0)
+{
+}
+
+TraceRecorder::ThreadBuffer::~ThreadBuffer()
+{
+    Chunk *chunk = first;
+    while (chunk != nullptr)
+    {
+        Chunk *next = chunk->next.load();
+        delete chunk;
+        chunk = next;
+    }
+}
+
+void TraceRecorder::Histogram::add(int sample)
+{
+    sampleCount++;
+    sum += sample;
+
+    if (ranges.empty())
+    {
+        buckets[sample]++;
+    }
+    else
+    {
+        sample = std::max(sample, 0);
+        buckets[*(std::upper_bound(ranges.begin(), ranges.end(), sample) - 1)]++;
+    }
+}
+
+TraceRecorder::TraceRecorder(size_t maxEventsPerThread)
+    : mMaxEventsPerThread(maxEventsPerThread),
+      mStartTime(GetMonotonicSeconds()),
+      mProcessId(GetProcessIdentifier()),
+      mThreadBufferIndex(CreateTLSIndex())
+{
+    ASSERT(mMaxEventsPerThread > 0);
+}
+
+TraceRecorder::~TraceRecorder()
+{
+    for (size_t i = 0; i < mThreadBuffers.size(); i++)
+    {
+        SafeDelete(mThreadBuffers[i]);
+    }
+    DestroyTLSIndex(mThreadBufferIndex);
+}
+
+TraceRecorder *TraceRecorder::CreateFromEnvironment()
+{
+#if defined(ANGLE_ENABLE_WINDOWS_STORE)
+    return nullptr;
+#else
+    const char *traceFile = getenv("ANGLE_TRACE_FILE");
+    if (traceFile == nullptr || traceFile[0] == '\0')
+    {
+        return nullptr;
+    }
+
+    TraceRecorder *recorder = new TraceRecorder(DefaultMaxEventsPerThread);
+    recorder->mTraceFile = traceFile;
+    return recorder;
+#endif
+}
+
+double TraceRecorder::currentTime()
+{
+    return std::chrono::duration<double>(std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+double TraceRecorder::monotonicallyIncreasingTime()
+{
+    return GetMonotonicSeconds();
+}
+
+const unsigned char *TraceRecorder::getTraceCategoryEnabledFlag(const char *categoryName)
+{
+    // The trace macros keep the flag of each call site, so this is only called once for each
+    std::lock_guard<std::mutex> lock(CategoryMutex);
+
+    for (size_t i = 0; i < CategoryCount; i++)
+    {
+        if (strcmp(CategoryNames[i], categoryName) == 0)
+        {
+            return &CategoryEnabled[i];
+        }
+    }
+
+    // The last category collects the events of the ones that don't fit
+    size_t category = CategoryCount;
+    if (CategoryCount == MaxCategories - 1)
+    {
+        categoryName = "__overflow";
+    }
+    else
+    {
+        CategoryCount++;
+    }
+
+    CategoryNames[category] = categoryName;
+    CategoryEnabled[category] = 1;
+    return &CategoryEnabled[category];
+}
+
+Platform::TraceEventHandle TraceRecorder::addTraceEvent(char phase,
+                                                        const unsigned char *categoryEnabledFlag,
+                                                        const char *name,
+                                                        unsigned long long id,
+                                                        double timestamp,
+                                                        int numArgs,
+                                                        const char **argNames,
+                                                        const unsigned char *argTypes,
+                                                        const unsigned long long *argValues,
+                                                        unsigned char flags)
+{
+    ThreadBuffer *buffer = getThreadBuffer();
+    if (buffer->eventCount >= mMaxEventsPerThread)
+    {
+        buffer->droppedCount.fetch_add(1, std::memory_order_relaxed);
+        return static_cast<TraceEventHandle>(buffer->eventCount);
+    }
+
+    Chunk *chunk = buffer->current;
+    size_t index = chunk->count.load(std::memory_order_relaxed);
+    if (index == EventsPerChunk)
+    {
+        Chunk *next = new Chunk();
+        chunk->next.store(next, std::memory_order_release);
+        buffer->current = next;
+        chunk = next;
+        index = 0;
+    }
+
+    Event &event = chunk->events[index];
+    event.phase = phase;
+    event.flags = flags;
+    // Call sites that kept the flag of another platform are recorded in the overflow category
+    bool knownCategory = categoryEnabledFlag >= CategoryEnabled && categoryEnabledFlag < CategoryEnabled + MaxCategories;
+    event.category = static_cast<unsigned char>(knownCategory ? categoryEnabledFlag - CategoryEnabled : MaxCategories - 1);
+    event.name = (flags & TraceEventFlagCopy) != 0 ? copyString(name) : name;
+    event.id = id;
+    event.timestamp = timestamp;
+    event.numArgs = static_cast<unsigned char>(std::min(static_cast<size_t>(std::max(numArgs, 0)), MaxArgs));
+    for (size_t arg = 0; arg < event.numArgs; arg++)
+    {
+        event.argNames[arg] = argNames[arg];
+        event.argTypes[arg] = argTypes[arg];
+        event.argValues[arg] = argValues[arg];
+
+        if (argTypes[arg] == TraceValueTypeCopyString)
+        {
+            const char *copy = copyString(reinterpret_cast<const char *>(static_cast<uintptr_t>(argValues[arg])));
+            event.argValues[arg] = static_cast<unsigned long long>(reinterpret_cast<uintptr_t>(copy));
+        }
+    }
+
+    // Publish the event to the threads writing the trace
+    chunk->count.store(index + 1, std::memory_order_release);
+    buffer->eventCount++;
+
+    return static_cast<TraceEventHandle>(buffer->eventCount);
+}
+
+void TraceRecorder::histogramCustomCounts(const char *name, int sample, int min, int max, int bucketCount)
+{
+    std::lock_guard<std::mutex> lock(mHistogramMutex);
+    Histogram *histogram = getHistogram(name);
+    if (histogram->sampleCount == 0 && bucketCount >= 3 && min < max)
+    {
+        BuildExponentialRanges(min, max, bucketCount, &histogram->ranges);
+    }
+    histogram->add(sample);
+}
+
+void TraceRecorder::histogramEnumeration(const char *name, int sample, int boundaryValue)
+{
+    // Values past the boundary share its overflow bucket
+    std::lock_guard<std::mutex> lock(mHistogramMutex);
+    getHistogram(name)->add(std::min(sample, boundaryValue));
+}
+
+void TraceRecorder::histogramSparse(const char *name, int sample)
+{
+    std::lock_guard<std::mutex> lock(mHistogramMutex);
+    getHistogram(name)->add(sample);
+}
+
+void TraceRecorder::histogramBoolean(const char *name, bool sample)
+{
+    std::lock_guard<std::mutex> lock(mHistogramMutex);
+    getHistogram(name)->add(sample ? 1 : 0);
+}
+
+void TraceRecorder::writeTrace(std::ostream &out) const
+{
+    std::vector<const char *> categoryNames;
+    {
+        std::lock_guard<std::mutex> lock(CategoryMutex);
+        categoryNames.assign(CategoryNames, CategoryNames + MaxCategories);
+    }
+
+    out << "{\"traceEvents\":[";
+
+    bool firstEvent = true;
+    size_t droppedCount = 0;
+    std::lock_guard<std::mutex> lock(mThreadBuffersMutex);
+    for (size_t bufferIndex = 0; bufferIndex < mThreadBuffers.size(); bufferIndex++)
+    {
+        const ThreadBuffer *buffer = mThreadBuffers[bufferIndex];
+        droppedCount += buffer->droppedCount.load(std::memory_order_relaxed);
+        for (const Chunk *chunk = buffer->first; chunk != nullptr; chunk = chunk->next.load(std::memory_order_acquire))
+        {
+            size_t count = chunk->count.load(std::memory_order_acquire);
+            for (size_t eventIndex = 0; eventIndex < count; eventIndex++)
+            {
+                const Event &event = chunk->events[eventIndex];
+
+                out << (firstEvent ? "\n" : ",\n");
+                firstEvent = false;
+
+                out << "{\"name\":";
+                WriteJSONString(out, event.name);
+                out << ",\"cat\":";
+                WriteJSONString(out, categoryNames[event.category] != nullptr ? categoryNames[event.category] : "__overflow");
+                out << ",\"ph\":\"" << event.phase << "\"";
+                out << ",\"ts\":" << (event.timestamp - mStartTime) * 1000000.0;
+                out << ",\"pid\":" << mProcessId << ",\"tid\":" << buffer->threadId;
+                if ((event.flags & TraceEventFlagHasId) != 0)
+                {
+                    out << ",\"id\":";
+                    WriteJSONHex(out, event.id);
+                }
+
+                out << ",\"args\":{";
+                for (size_t arg = 0; arg < event.numArgs; arg++)
+                {
+                    out << (arg == 0 ? "" : ",");
+                    WriteJSONString(out, event.argNames[arg]);
+                    out << ":";
+                    WriteJSONValue(out, event.argTypes[arg], event.argValues[arg]);
+                }
+                out << "}}";
+            }
+        }
+    }
+
+    out << "\n],\"displayTimeUnit\":\"ms\",\"metadata\":{\"dropped-events\":" << droppedCount;
+
+    out << ",\"histograms\":{";
+    {
+        std::lock_guard<std::mutex> histogramLock(mHistogramMutex);
+        for (auto histogram = mHistograms.begin(); histogram != mHistograms.end(); histogram++)
+        {
+            out << (histogram == mHistograms.begin() ? "" : ",");
+            WriteJSONString(out, histogram->first.c_str());
+            out << ":{\"count\":" << histogram->second.sampleCount << ",\"sum\":" << histogram->second.sum
+                << ",\"buckets\":{";
+            const auto &buckets = histogram->second.buckets;
+            for (auto bucket = buckets.begin(); bucket != buckets.end(); bucket++)
+            {
+                out << (bucket == buckets.begin() ? "" : ",") << "\"" << bucket->first << "\":" << bucket->second;
+            }
+            out << "}}";
+        }
+    }
+    out << "}}}\n";
+}
+
+bool TraceRecorder::writeTraceFile() const
+{
+    if (mTraceFile.empty())
+    {
+        return false;
+    }
+
+    std::ofstream file(mTraceFile.c_str(), std::ios::out | std::ios::trunc);
+    if (!file)
+    {
+        ERR("Failed to open the trace file %s.", mTraceFile.c_str());
+        return false;
+    }
+
+    writeTrace(file);
+    return !file.fail();
+}
+
+void TraceRecorder::dumpHistograms(std::ostream &out) const
+{
+    std::lock_guard<std::mutex> lock(mHistogramMutex);
+    for (auto histogram = mHistograms.begin(); histogram != mHistograms.end(); histogram++)
+    {
+        const Histogram &value = histogram->second;
+        out << "Histogram: " << histogram->first << " recorded " << value.sampleCount << " samples, mean = "
+            << (value.sampleCount > 0 ? static_cast<double>(value.sum) / value.sampleCount : 0.0) << "\n";
+        for (auto bucket = value.buckets.begin(); bucket != value.buckets.end(); bucket++)
+        {
+            out << "  " << bucket->first << ": " << bucket->second << "\n";
+        }
+    }
+}
+
+size_t TraceRecorder::getEventCount() const
+{
+    size_t eventCount = 0;
+
+    std::lock_guard<std::mutex> lock(mThreadBuffersMutex);
+    for (size_t i = 0; i < mThreadBuffers.size(); i++)
+    {
+        for (const Chunk *chunk = mThreadBuffers[i]->first; chunk != nullptr; chunk = chunk->next.load(std::memory_order_acquire))
+        {
+            eventCount += chunk->count.load(std::memory_order_acquire);
+        }
+    }
+
+    return eventCount;
+}
+
+size_t TraceRecorder::getDroppedEventCount() const
+{
+    size_t droppedCount = 0;
+
+    std::lock_guard<std::mutex> lock(mThreadBuffersMutex);
+    for (size_t i = 0; i < mThreadBuffers.size(); i++)
+    {
+        droppedCount += mThreadBuffers[i]->droppedCount.load(std::memory_order_relaxed);
+    }
+
+    return droppedCount;
+}
+
+TraceRecorder::ThreadBuffer *TraceRecorder::getThreadBuffer()
+{
+    ThreadBuffer *buffer = static_cast<ThreadBuffer *>(GetTLSValue(mThreadBufferIndex));
+    if (buffer == nullptr)
+    {
+        // Only the first event of each thread takes the lock
+        std::lock_guard<std::mutex> lock(mThreadBuffersMutex);
+        buffer = new ThreadBuffer(static_cast<unsigned int>(mThreadBuffers.size() + 1));
+        mThreadBuffers.push_back(buffer);
+        SetTLSValue(mThreadBufferIndex, buffer);
+    }
+    return buffer;
+}
+
+const char *TraceRecorder::copyString(const char *string)
+{
+    std::lock_guard<std::mutex> lock(mCopiedStringsMutex);
+    return mCopiedStrings.insert(std::string(string)).first->c_str();
+}
+
+TraceRecorder::Histogram *TraceRecorder::getHistogram(const char *name)
+{
+    return &mHistograms[name];
+}
+
+}
@@ -0,0 +1,155 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// TraceRecorder.h: Defines angle::TraceRecorder, a built-in angle::Platform that records the
+// trace events of libANGLE in memory and aggregates its histograms, so that ANGLE can be profiled
+// without an embedder supplying a tracing platform. The events are written as Chrome trace JSON,
+// which chrome://tracing loads.
+
+#ifndef LIBANGLE_TRACERECORDER_H_
+#define LIBANGLE_TRACERECORDER_H_
+
+#include "common/angleutils.h"
+#include "common/tls.h"
+#include "platform/Platform.h"
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace angle
+{
+
+class TraceRecorder : public Platform
+{
+  public:
+    // Each thread keeps at most maxEventsPerThread events, and drops the later ones.
+    explicit TraceRecorder(size_t maxEventsPerThread);
+    ~TraceRecorder() override;
+
+    // A recorder that writes to the file named by the ANGLE_TRACE_FILE environment variable, or
+    // null if it isn't set.
+    static TraceRecorder *CreateFromEnvironment();
+
+    double currentTime() override;
+    double monotonicallyIncreasingTime() override;
+
+    // Every category is enabled. The flags are shared by all the recorders, because the trace
+    // macros keep them at their call sites.
+    const unsigned char *getTraceCategoryEnabledFlag(const char *categoryName) override;
+
+    // Events are appended to a buffer owned by the calling thread, without locking
+    TraceEventHandle addTraceEvent(char phase,
+                                   const unsigned char *categoryEnabledFlag,
+                                   const char *name,
+                                   unsigned long long id,
+                                   double timestamp,
+                                   int numArgs,
+                                   const char **argNames,
+                                   const unsigned char *argTypes,
+                                   const unsigned long long *argValues,
+                                   unsigned char flags) override;
+
+    void histogramCustomCounts(const char *name, int sample, int min, int max, int bucketCount) override;
+    void histogramEnumeration(const char *name, int sample, int boundaryValue) override;
+    void histogramSparse(const char *name, int sample) override;
+    void histogramBoolean(const char *name, bool sample) override;
+
+    // Writes the events recorded so far as Chrome trace JSON, with the histograms in its metadata.
+    // Threads may keep adding events while they are written.
+    void writeTrace(std::ostream &out) const;
+    bool writeTraceFile() const;
+
+    // Writes a readable summary of the histograms, one line per bucket
+    void dumpHistograms(std::ostream &out) const;
+
+    size_t getEventCount() const;
+    size_t getDroppedEventCount() const;
+
+  private:
+    static const size_t EventsPerChunk = 1024;
+    static const size_t MaxArgs = 2;
+
+    struct Event
+    {
+        char phase;
+        unsigned char flags;
+        unsigned char category;
+        unsigned char numArgs;
+        const char *name;
+        unsigned long long id;
+        double timestamp;
+        const char *argNames[MaxArgs];
+        unsigned char argTypes[MaxArgs];
+        unsigned long long argValues[MaxArgs];
+    };
+
+    // Only the owning thread writes to a chunk. It publishes each event by incrementing the count,
+    // and each full chunk by linking the next one, so readers never see a partly written event.
+    struct Chunk
+    {
+        Chunk();
+
+        Event events[EventsPerChunk];
+        std::atomic<size_t> count;
+        std::atomic<Chunk *> next;
+    };
+
+    struct ThreadBuffer
+    {
+        explicit ThreadBuffer(unsigned int threadId);
+        ~ThreadBuffer();
+
+        unsigned int threadId;
+        Chunk *first;
+        Chunk *current;
+        size_t eventCount;
+        std::atomic<size_t> droppedCount;
+    };
+
+    // Chromium's layout of histogram buckets: samples are counted in the bucket with the largest
+    // lower bound that isn't above them.
+    struct Histogram
+    {
+        Histogram() : sampleCount(0), sum(0) {}
+
+        void add(int sample);
+
+        std::vector<int> ranges;
+        std::map<int, size_t> buckets;
+        size_t sampleCount;
+        long long sum;
+    };
+
+    ThreadBuffer *getThreadBuffer();
+    const char *copyString(const char *string);
+    Histogram *getHistogram(const char *name);
+
+    size_t mMaxEventsPerThread;
+    std::string mTraceFile;
+    double mStartTime;
+    unsigned int mProcessId;
+
+    TLSIndex mThreadBufferIndex;
+    std::vector<ThreadBuffer *> mThreadBuffers;
+    mutable std::mutex mThreadBuffersMutex;
+
+    // Strings of the events that copy them, which nothing in libANGLE records often enough to
+    // make this lock matter
+    std::set<std::string> mCopiedStrings;
+    std::mutex mCopiedStringsMutex;
+
+    std::map<std::string, Histogram> mHistograms;
+    mutable std::mutex mHistogramMutex;
+};
+
+}
+
+#endif // LIBANGLE_TRACERECORDER_H_
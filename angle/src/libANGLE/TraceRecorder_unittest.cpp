@@ -0,0 +1,204 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// TraceRecorder_unittest.cpp: Unit tests that the built-in trace recorder writes the events of
+// several threads as Chrome trace JSON, and aggregates the histograms of libANGLE.
+
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "libANGLE/TraceRecorder.h"
+#include "libANGLE/histogram_macros.h"
+#include "third_party/trace_event/trace_event.h"
+
+namespace
+{
+
+size_t CountOccurrences(const std::string &text, const std::string &pattern)
+{
+    size_t count = 0;
+    for (size_t position = text.find(pattern); position != std::string::npos; position = text.find(pattern, position + 1))
+    {
+        count++;
+    }
+    return count;
+}
+
+void AddInstantEvent(angle::TraceRecorder *recorder, const unsigned char *category, const char *name)
+{
+    recorder->addTraceEvent(TRACE_EVENT_PHASE_INSTANT, category, name, 0, recorder->monotonicallyIncreasingTime(),
+                            0, nullptr, nullptr, nullptr, TRACE_EVENT_FLAG_NONE);
+}
+
+std::string WriteTrace(const angle::TraceRecorder &recorder)
+{
+    std::ostringstream trace;
+    recorder.writeTrace(trace);
+    return trace.str();
+}
+
+// The trace and histogram macros of libANGLE reach the recorder once it is the current platform
+TEST(TraceRecorderTest, RecordsTraceMacros)
+{
+    angle::TraceRecorder recorder(1000);
+    angle::Platform *previousPlatform = ANGLEPlatformCurrent();
+    ANGLEPlatformInitialize(&recorder);
+
+    {
+        TRACE_EVENT0("gpu.angle", "TraceRecorderTest::scope");
+        TRACE_COUNTER2("gpu.angle", "TraceRecorderTest::counter", "InUse", 5, "Free", 7);
+    }
+    ANGLE_HISTOGRAM_BOOLEAN("GPU.ANGLE.TraceRecorderTest", true);
+
+    if (previousPlatform != nullptr)
+    {
+        ANGLEPlatformInitialize(previousPlatform);
+    }
+    else
+    {
+        ANGLEPlatformShutdown();
+    }
+
+    EXPECT_EQ(3u, recorder.getEventCount());
+
+    std::string trace = WriteTrace(recorder);
+    EXPECT_EQ(0u, trace.find("{\"traceEvents\":["));
+    EXPECT_NE(std::string::npos, trace.find("{\"name\":\"TraceRecorderTest::scope\",\"cat\":\"gpu.angle\",\"ph\":\"B\""));
+    EXPECT_NE(std::string::npos, trace.find("{\"name\":\"TraceRecorderTest::scope\",\"cat\":\"gpu.angle\",\"ph\":\"E\""));
+    EXPECT_NE(std::string::npos, trace.find("\"ph\":\"C\""));
+    EXPECT_NE(std::string::npos, trace.find("\"args\":{\"InUse\":5,\"Free\":7}"));
+    EXPECT_NE(std::string::npos, trace.find("\"GPU.ANGLE.TraceRecorderTest\":{\"count\":1,\"sum\":1,\"buckets\":{\"1\":1}}"));
+}
+
+TEST(TraceRecorderTest, CategoriesShareFlags)
+{
+    angle::TraceRecorder recorder(1000);
+    const unsigned char *flag = recorder.getTraceCategoryEnabledFlag("TraceRecorderTest.first");
+    ASSERT_NE(nullptr, flag);
+    EXPECT_NE(0, *flag);
+    EXPECT_EQ(flag, recorder.getTraceCategoryEnabledFlag("TraceRecorderTest.first"));
+    EXPECT_NE(flag, recorder.getTraceCategoryEnabledFlag("TraceRecorderTest.second"));
+
+    // The call sites keep the flags after their recorder is gone
+    angle::TraceRecorder otherRecorder(1000);
+    EXPECT_EQ(flag, otherRecorder.getTraceCategoryEnabledFlag("TraceRecorderTest.first"));
+}
+
+// Threads append events without waiting for each other, while the trace is written
+TEST(TraceRecorderTest, RecordsManyThreads)
+{
+    const size_t threadCount = 4;
+    const size_t eventsPerThread = 5000;
+
+    angle::TraceRecorder recorder(eventsPerThread);
+    const unsigned char *category = recorder.getTraceCategoryEnabledFlag("TraceRecorderTest");
+
+    std::vector<std::thread> threads;
+    for (size_t thread = 0; thread < threadCount; thread++)
+    {
+        threads.push_back(std::thread([&recorder, category]()
+        {
+            for (size_t event = 0; event < eventsPerThread; event++)
+            {
+                AddInstantEvent(&recorder, category, "TraceRecorderTest::thread");
+            }
+        }));
+    }
+
+    std::string partialTrace = WriteTrace(recorder);
+    for (size_t thread = 0; thread < threadCount; thread++)
+    {
+        threads[thread].join();
+    }
+
+    EXPECT_GE(threadCount * eventsPerThread, CountOccurrences(partialTrace, "\"ph\":\"I\""));
+    EXPECT_EQ(threadCount * eventsPerThread, recorder.getEventCount());
+    EXPECT_EQ(0u, recorder.getDroppedEventCount());
+
+    std::string trace = WriteTrace(recorder);
+    EXPECT_EQ(threadCount * eventsPerThread, CountOccurrences(trace, "\"ph\":\"I\""));
+    for (size_t thread = 1; thread <= threadCount; thread++)
+    {
+        std::ostringstream threadId;
+        threadId << "\"tid\":" << thread << ",";
+        EXPECT_EQ(eventsPerThread, CountOccurrences(trace, threadId.str()));
+    }
+}
+
+TEST(TraceRecorderTest, DropsEventsOverLimit)
+{
+    angle::TraceRecorder recorder(10);
+    const unsigned char *category = recorder.getTraceCategoryEnabledFlag("TraceRecorderTest");
+    for (size_t event = 0; event < 15; event++)
+    {
+        AddInstantEvent(&recorder, category, "TraceRecorderTest::dropped");
+    }
+
+    EXPECT_EQ(10u, recorder.getEventCount());
+    EXPECT_EQ(5u, recorder.getDroppedEventCount());
+    EXPECT_NE(std::string::npos, WriteTrace(recorder).find("\"dropped-events\":5"));
+}
+
+// Names and arguments flagged as copies outlive the strings they came from
+TEST(TraceRecorderTest, CopiesStrings)
+{
+    angle::TraceRecorder recorder(10);
+    const unsigned char *category = recorder.getTraceCategoryEnabledFlag("TraceRecorderTest");
+
+    std::string name = "Copied \"name\"";
+    std::string value = "copied\nvalue";
+    const char *argNames[] = { "value" };
+    const unsigned char argTypes[] = { TRACE_VALUE_TYPE_COPY_STRING };
+    const unsigned long long argValues[] = { reinterpret_cast<unsigned long long>(value.c_str()) };
+    recorder.addTraceEvent(TRACE_EVENT_PHASE_INSTANT, category, name.c_str(), 0, recorder.monotonicallyIncreasingTime(),
+                           1, argNames, argTypes, argValues, TRACE_EVENT_FLAG_COPY);
+    name.assign(name.size(), 'x');
+    value.assign(value.size(), 'x');
+
+    std::string trace = WriteTrace(recorder);
+    EXPECT_NE(std::string::npos, trace.find("\"name\":\"Copied \\\"name\\\"\""));
+    EXPECT_NE(std::string::npos, trace.find("\"args\":{\"value\":\"copied\\nvalue\"}"));
+}
+
+TEST(TraceRecorderTest, AggregatesHistograms)
+{
+    angle::TraceRecorder recorder(10);
+
+    // Chromium's exponential buckets for 1 to 100 in 10 buckets start at 0, 1, 2, 3, 5, 9, 16, 29,
+    // 54 and 100, and the last one holds everything above the maximum.
+    recorder.histogramCustomCounts("Counts", 0, 1, 100, 10);
+    recorder.histogramCustomCounts("Counts", 5, 1, 100, 10);
+    recorder.histogramCustomCounts("Counts", 6, 1, 100, 10);
+    recorder.histogramCustomCounts("Counts", 9, 1, 100, 10);
+    recorder.histogramCustomCounts("Counts", 1000, 1, 100, 10);
+    recorder.histogramEnumeration("Enumeration", 2, 4);
+    recorder.histogramEnumeration("Enumeration", 7, 4);
+    recorder.histogramSparse("Sparse", -3);
+    recorder.histogramBoolean("Boolean", false);
+
+    std::ostringstream dump;
+    recorder.dumpHistograms(dump);
+    const std::string expected =
+        "Histogram: Boolean recorded 1 samples, mean = 0\n"
+        "  0: 1\n"
+        "Histogram: Counts recorded 5 samples, mean = 204\n"
+        "  0: 1\n"
+        "  5: 2\n"
+        "  9: 1\n"
+        "  100: 1\n"
+        "Histogram: Enumeration recorded 2 samples, mean = 3\n"
+        "  2: 1\n"
+        "  4: 1\n"
+        "Histogram: Sparse recorded 1 samples, mean = -3\n"
+        "  -3: 1\n";
+    EXPECT_EQ(expected, dump.str());
+}
+
+}
@@ -28,7 +28,7 @@ VertexArray::~VertexArray()
 
     for (size_t i = 0; i < getMaxAttribs(); i++)
     {
-        mVertexAttributes[i].buffer.set(NULL);
+        setAttributeBuffer(i, NULL);
     }
     mElementArrayBuffer.set(NULL);
 }
@@ -44,7 +44,8 @@ void VertexArray::detachBuffer(GLuint bufferName)
     {
         if (mVertexAttributes[attribute].buffer.id() == bufferName)
         {
-            mVertexAttributes[attribute].buffer.set(NULL);
+            setAttributeBuffer(attribute, NULL);
+            notifyStateChange();
         }
     }
 
@@ -70,6 +71,7 @@ void VertexArray::setVertexAttribDivisor(GLuint index, GLuint divisor)
     ASSERT(index < getMaxAttribs());
     mVertexAttributes[index].divisor = divisor;
     mVertexArray->setAttributeDivisor(index, divisor);
+    notifyStateChange();
 }
 
 void VertexArray::enableAttribute(unsigned int attributeIndex, bool enabledState)
@@ -90,13 +92,15 @@ void VertexArray::enableAttribute(unsigned int attributeIndex, bool enabledState
             --mMaxEnabledAttribute;
         }
     }
+
+    notifyStateChange();
 }
 
 void VertexArray::setAttributeState(unsigned int attributeIndex, gl::Buffer *boundBuffer, GLint size, GLenum type,
                                     bool normalized, bool pureInteger, GLsizei stride, const void *pointer)
 {
     ASSERT(attributeIndex < getMaxAttribs());
-    mVertexAttributes[attributeIndex].buffer.set(boundBuffer);
+    setAttributeBuffer(attributeIndex, boundBuffer);
     mVertexAttributes[attributeIndex].size = size;
     mVertexAttributes[attributeIndex].type = type;
     mVertexAttributes[attributeIndex].normalized = normalized;
@@ -104,6 +108,7 @@ void VertexArray::setAttributeState(unsigned int attributeIndex, gl::Buffer *bou
     mVertexAttributes[attributeIndex].stride = stride;
     mVertexAttributes[attributeIndex].pointer = pointer;
     mVertexArray->setAttribute(attributeIndex, mVertexAttributes[attributeIndex]);
+    notifyStateChange();
 }
 
 void VertexArray::setElementArrayBuffer(Buffer *buffer)
@@ -112,4 +117,29 @@ void VertexArray::setElementArrayBuffer(Buffer *buffer)
     mVertexArray->setElementArrayBuffer(buffer);
 }
 
+void VertexArray::onSubjectStateChange()
+{
+    // One of the attribute buffers was resized or mapped
+    notifyStateChange();
+}
+
+void VertexArray::setAttributeBuffer(size_t attributeIndex, Buffer *buffer)
+{
+    BindingPointer<Buffer> &binding = mVertexAttributes[attributeIndex].buffer;
+    if (binding.get() == buffer)
+    {
+        return;
+    }
+
+    if (binding.get() != NULL)
+    {
+        binding->removeObserver(this);
+    }
+    if (buffer != NULL)
+    {
+        buffer->addObserver(this);
+    }
+    binding.set(buffer);
+}
+
 }
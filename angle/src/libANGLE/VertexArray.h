@@ -15,6 +15,7 @@
 
 #include "libANGLE/RefCountObject.h"
 #include "libANGLE/Constants.h"
+#include "libANGLE/Observer.h"
 #include "libANGLE/VertexAttribute.h"
 
 #include <vector>
@@ -28,7 +29,9 @@ namespace gl
 {
 class Buffer;
 
-class VertexArray
+// A vertex array observes the buffers bound to its attributes and notifies its own
+// observers when an attribute changes or one of those buffers is resized or mapped.
+class VertexArray : public Subject, public Observer
 {
   public:
     VertexArray(rx::VertexArrayImpl *impl, GLuint id, size_t maxAttribs);
@@ -55,7 +58,11 @@ class VertexArray
 
     unsigned int getMaxEnabledAttribute() const { return mMaxEnabledAttribute; }
 
+    void onSubjectStateChange() override;
+
   private:
+    void setAttributeBuffer(size_t attributeIndex, Buffer *buffer);
+
     GLuint mId;
 
     rx::VertexArrayImpl *mVertexArray;
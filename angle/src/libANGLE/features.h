@@ -42,4 +42,9 @@
 #define ANGLE_MULTITHREADED_D3D_SHADER_COMPILE ANGLE_DISABLED
 #endif
 
+// Should large texture uploads be converted on several threads at once?
+#if !defined(ANGLE_MULTITHREADED_TEXTURE_LOAD)
+#define ANGLE_MULTITHREADED_TEXTURE_LOAD ANGLE_ENABLED
+#endif
+
 #endif // LIBANGLE_FEATURES_H_
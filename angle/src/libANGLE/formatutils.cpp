@@ -12,9 +12,97 @@
 #include "libANGLE/Framebuffer.h"
 #include "libANGLE/renderer/Renderer.h"
 
+#include <vector>
+
 namespace gl
 {
 
+namespace
+{
+
+// Maps each key of a fixed set to its position in the set with one multiply, one shift and one
+// compare. The multiplier is searched for when the table is built, so that no two keys share a
+// slot.
+class PerfectHashIndex final : angle::NonCopyable
+{
+  public:
+    explicit PerfectHashIndex(const std::vector<GLuint> &keys);
+
+    size_t find(GLuint key) const
+    {
+        const Slot &slot = mSlots[(key * mMultiplier) >> mShift];
+        return (slot.key == key && slot.index != EmptyIndex) ? slot.index : InvalidInternalFormatIndex;
+    }
+
+  private:
+    struct Slot
+    {
+        GLuint key;
+        GLuint index;
+    };
+
+    // Empty slots can't be told apart by their key alone, since any value is a valid lookup
+    static const GLuint EmptyKey = 0xFFFFFFFFu;
+    static const GLuint EmptyIndex = 0xFFFFFFFFu;
+
+    bool tryMultiplier(const std::vector<GLuint> &keys, GLuint multiplier, unsigned int bits);
+
+    GLuint mMultiplier;
+    unsigned int mShift;
+    std::vector<Slot> mSlots;
+};
+
+PerfectHashIndex::PerfectHashIndex(const std::vector<GLuint> &keys)
+    : mMultiplier(0),
+      mShift(0)
+{
+    // Start with a table about four times larger than the key set, which usually finds a
+    // multiplier within a few hundred tries, and grow it if none is found
+    unsigned int bits = 1;
+    while ((1u << bits) < keys.size() * 4)
+    {
+        bits++;
+    }
+
+    for (; bits < 32; bits++)
+    {
+        GLuint multiplier = 0x9E3779B1u;
+        for (unsigned int attempt = 0; attempt < 4096; attempt++)
+        {
+            if (tryMultiplier(keys, multiplier, bits))
+            {
+                return;
+            }
+            multiplier = multiplier * 1664525u + 1013904223u;
+        }
+    }
+
+    UNREACHABLE();
+}
+
+bool PerfectHashIndex::tryMultiplier(const std::vector<GLuint> &keys, GLuint multiplier, unsigned int bits)
+{
+    Slot emptySlot = { EmptyKey, EmptyIndex };
+    mSlots.assign(static_cast<size_t>(1) << bits, emptySlot);
+    mMultiplier = multiplier | 1;
+    mShift = 32 - bits;
+
+    for (size_t keyIndex = 0; keyIndex < keys.size(); keyIndex++)
+    {
+        Slot &slot = mSlots[(keys[keyIndex] * mMultiplier) >> mShift];
+        if (slot.index != EmptyIndex)
+        {
+            return false;
+        }
+        slot.key = keys[keyIndex];
+        slot.index = static_cast<GLuint>(keyIndex);
+    }
+
+    return true;
+}
+
+}
+
 // ES2 requires that format is equal to internal format at all glTex*Image2D entry points and the implementation
 // can decide the true, sized, internal format. The ES2FormatMap determines the internal format for all valid
 // format and type combinations.
@@ -23,6 +111,13 @@ typedef std::pair<GLenum, GLenum> FormatTypePair;
 typedef std::pair<FormatTypePair, GLenum> FormatPair;
 typedef std::map<FormatTypePair, GLenum> FormatMap;
 
+// Format and type enums both fit in 16 bits, so a pair packs into one perfect hash key
+static GLuint PackFormatType(GLenum format, GLenum type)
+{
+    ASSERT(format <= 0xFFFF && type <= 0xFFFF);
+    return (type << 16) | format;
+}
+
 // A helper function to insert data into the format map with fewer characters.
 static inline void InsertFormatMapping(FormatMap *map, GLenum format, GLenum type, GLenum internalFormat)
 {
@@ -451,16 +546,16 @@ static InternalFormatInfoMap BuildInternalFormatInfoMap()
 
     // Compressed formats, From ES 3.0.1 spec, table 3.16
     //                               | Internal format                             |                |W |H | BS |CC| Format                                      | Type            | SRGB | Supported          | Renderable           | Filterable         |
-    map.insert(InternalFormatInfoPair(GL_COMPRESSED_R11_EAC,                        CompressedFormat(4, 4,  64, 1, GL_COMPRESSED_R11_EAC,                        GL_UNSIGNED_BYTE, false, UnimplementedSupport, UnimplementedSupport, UnimplementedSupport)));
-    map.insert(InternalFormatInfoPair(GL_COMPRESSED_SIGNED_R11_EAC,                 CompressedFormat(4, 4,  64, 1, GL_COMPRESSED_SIGNED_R11_EAC,                 GL_UNSIGNED_BYTE, false, UnimplementedSupport, UnimplementedSupport, UnimplementedSupport)));
-    map.insert(InternalFormatInfoPair(GL_COMPRESSED_RG11_EAC,                       CompressedFormat(4, 4, 128, 2, GL_COMPRESSED_RG11_EAC,                       GL_UNSIGNED_BYTE, false, UnimplementedSupport, UnimplementedSupport, UnimplementedSupport)));
-    map.insert(InternalFormatInfoPair(GL_COMPRESSED_SIGNED_RG11_EAC,                CompressedFormat(4, 4, 128, 2, GL_COMPRESSED_SIGNED_RG11_EAC,                GL_UNSIGNED_BYTE, false, UnimplementedSupport, UnimplementedSupport, UnimplementedSupport)));
-    map.insert(InternalFormatInfoPair(GL_COMPRESSED_RGB8_ETC2,                      CompressedFormat(4, 4,  64, 3, GL_COMPRESSED_RGB8_ETC2,                      GL_UNSIGNED_BYTE, false, UnimplementedSupport, UnimplementedSupport, UnimplementedSupport)));
-    map.insert(InternalFormatInfoPair(GL_COMPRESSED_SRGB8_ETC2,                     CompressedFormat(4, 4,  64, 3, GL_COMPRESSED_SRGB8_ETC2,                     GL_UNSIGNED_BYTE, true,  UnimplementedSupport, UnimplementedSupport, UnimplementedSupport)));
-    map.insert(InternalFormatInfoPair(GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2,  CompressedFormat(4, 4,  64, 3, GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2,  GL_UNSIGNED_BYTE, false, UnimplementedSupport, UnimplementedSupport, UnimplementedSupport)));
-    map.insert(InternalFormatInfoPair(GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2, CompressedFormat(4, 4,  64, 3, GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2, GL_UNSIGNED_BYTE, true,  UnimplementedSupport, UnimplementedSupport, UnimplementedSupport)));
-    map.insert(InternalFormatInfoPair(GL_COMPRESSED_RGBA8_ETC2_EAC,                 CompressedFormat(4, 4, 128, 4, GL_COMPRESSED_RGBA8_ETC2_EAC,                 GL_UNSIGNED_BYTE, false, UnimplementedSupport, UnimplementedSupport, UnimplementedSupport)));
-    map.insert(InternalFormatInfoPair(GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC,          CompressedFormat(4, 4, 128, 4, GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC,          GL_UNSIGNED_BYTE, true,  UnimplementedSupport, UnimplementedSupport, UnimplementedSupport)));
+    map.insert(InternalFormatInfoPair(GL_COMPRESSED_R11_EAC,                        CompressedFormat(4, 4,  64, 1, GL_COMPRESSED_R11_EAC,                        GL_UNSIGNED_BYTE, false, RequireES<3>,       NeverSupported,       AlwaysSupported   )));
+    map.insert(InternalFormatInfoPair(GL_COMPRESSED_SIGNED_R11_EAC,                 CompressedFormat(4, 4,  64, 1, GL_COMPRESSED_SIGNED_R11_EAC,                 GL_UNSIGNED_BYTE, false, RequireES<3>,       NeverSupported,       AlwaysSupported   )));
+    map.insert(InternalFormatInfoPair(GL_COMPRESSED_RG11_EAC,                       CompressedFormat(4, 4, 128, 2, GL_COMPRESSED_RG11_EAC,                       GL_UNSIGNED_BYTE, false, RequireES<3>,       NeverSupported,       AlwaysSupported   )));
+    map.insert(InternalFormatInfoPair(GL_COMPRESSED_SIGNED_RG11_EAC,                CompressedFormat(4, 4, 128, 2, GL_COMPRESSED_SIGNED_RG11_EAC,                GL_UNSIGNED_BYTE, false, RequireES<3>,       NeverSupported,       AlwaysSupported   )));
+    map.insert(InternalFormatInfoPair(GL_COMPRESSED_RGB8_ETC2,                      CompressedFormat(4, 4,  64, 3, GL_COMPRESSED_RGB8_ETC2,                      GL_UNSIGNED_BYTE, false, RequireES<3>,       NeverSupported,       AlwaysSupported   )));
+    map.insert(InternalFormatInfoPair(GL_COMPRESSED_SRGB8_ETC2,                     CompressedFormat(4, 4,  64, 3, GL_COMPRESSED_SRGB8_ETC2,                     GL_UNSIGNED_BYTE, true,  RequireES<3>,       NeverSupported,       AlwaysSupported   )));
+    map.insert(InternalFormatInfoPair(GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2,  CompressedFormat(4, 4,  64, 3, GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2,  GL_UNSIGNED_BYTE, false, RequireES<3>,       NeverSupported,       AlwaysSupported   )));
+    map.insert(InternalFormatInfoPair(GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2, CompressedFormat(4, 4,  64, 3, GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2, GL_UNSIGNED_BYTE, true,  RequireES<3>,       NeverSupported,       AlwaysSupported   )));
+    map.insert(InternalFormatInfoPair(GL_COMPRESSED_RGBA8_ETC2_EAC,                 CompressedFormat(4, 4, 128, 4, GL_COMPRESSED_RGBA8_ETC2_EAC,                 GL_UNSIGNED_BYTE, false, RequireES<3>,       NeverSupported,       AlwaysSupported   )));
+    map.insert(InternalFormatInfoPair(GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC,          CompressedFormat(4, 4, 128, 4, GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC,          GL_UNSIGNED_BYTE, true,  RequireES<3>,       NeverSupported,       AlwaysSupported   )));
 
     // From GL_EXT_texture_compression_dxt1
     //                               | Internal format                   |                |W |H | BS |CC| Format                            | Type            | SRGB | Supported                                      | Renderable    | Filterable    |
@@ -489,6 +584,46 @@ static const InternalFormatInfoMap &GetInternalFormatMap()
     return formatMap;
 }
 
+// The internal formats in the order of their indices, and the perfect hash from format to index
+class InternalFormatTable final : angle::NonCopyable
+{
+  public:
+    explicit InternalFormatTable(const InternalFormatInfoMap &formatMap)
+        : mFormats(GetMapKeys(formatMap)),
+          mIndex(mFormats)
+    {
+        for (InternalFormatInfoMap::const_iterator i = formatMap.begin(); i != formatMap.end(); i++)
+        {
+            mInfos.push_back(i->second);
+        }
+    }
+
+    size_t getIndex(GLenum internalFormat) const { return mIndex.find(internalFormat); }
+    size_t size() const { return mFormats.size(); }
+    const InternalFormat &getInfo(size_t formatIndex) const { return mInfos[formatIndex]; }
+
+  private:
+    static std::vector<GLuint> GetMapKeys(const InternalFormatInfoMap &formatMap)
+    {
+        std::vector<GLuint> keys;
+        for (InternalFormatInfoMap::const_iterator i = formatMap.begin(); i != formatMap.end(); i++)
+        {
+            keys.push_back(i->first);
+        }
+        return keys;
+    }
+
+    std::vector<GLuint> mFormats;
+    PerfectHashIndex mIndex;
+    std::vector<InternalFormat> mInfos;
+};
+
+static const InternalFormatTable &GetInternalFormatTable()
+{
+    static const InternalFormatTable table(GetInternalFormatMap());
+    return table;
+}
+
 static FormatSet BuildAllSizedInternalFormatSet()
 {
     FormatSet result;
@@ -563,11 +698,11 @@ const Type &GetTypeInfo(GLenum type)
 
 const InternalFormat &GetInternalFormatInfo(GLenum internalFormat)
 {
-    const InternalFormatInfoMap &formatMap = GetInternalFormatMap();
-    InternalFormatInfoMap::const_iterator iter = formatMap.find(internalFormat);
-    if (iter != formatMap.end())
+    const InternalFormatTable &table = GetInternalFormatTable();
+    size_t formatIndex = table.getIndex(internalFormat);
+    if (formatIndex != InvalidInternalFormatIndex)
     {
-        return iter->second;
+        return table.getInfo(formatIndex);
     }
     else
     {
@@ -576,6 +711,16 @@ const InternalFormat &GetInternalFormatInfo(GLenum internalFormat)
     }
 }
 
+size_t GetInternalFormatIndex(GLenum internalFormat)
+{
+    return GetInternalFormatTable().getIndex(internalFormat);
+}
+
+size_t GetInternalFormatCount()
+{
+    return GetInternalFormatTable().size();
+}
+
 GLuint InternalFormat::computeRowPitch(GLenum formatType, GLsizei width, GLint alignment, GLint rowLength) const
 {
     ASSERT(alignment > 0 && isPow2(alignment));
@@ -619,6 +764,46 @@ GLuint InternalFormat::computeBlockSize(GLenum formatType, GLsizei width, GLsize
     }
 }
 
+// The sized internal formats for each unsized format and type, found through a perfect hash of
+// the format and type pair
+class SizedFormatTable final : angle::NonCopyable
+{
+  public:
+    explicit SizedFormatTable(const FormatMap &formatMap)
+        : mIndex(GetMapKeys(formatMap))
+    {
+        for (FormatMap::const_iterator i = formatMap.begin(); i != formatMap.end(); i++)
+        {
+            mSizedFormats.push_back(i->second);
+        }
+    }
+
+    GLenum get(GLenum format, GLenum type) const
+    {
+        if (format > 0xFFFF || type > 0xFFFF)
+        {
+            return GL_NONE;
+        }
+
+        size_t pairIndex = mIndex.find(PackFormatType(format, type));
+        return (pairIndex != InvalidInternalFormatIndex) ? mSizedFormats[pairIndex] : GL_NONE;
+    }
+
+  private:
+    static std::vector<GLuint> GetMapKeys(const FormatMap &formatMap)
+    {
+        std::vector<GLuint> keys;
+        for (FormatMap::const_iterator i = formatMap.begin(); i != formatMap.end(); i++)
+        {
+            keys.push_back(PackFormatType(i->first.first, i->first.second));
+        }
+        return keys;
+    }
+
+    PerfectHashIndex mIndex;
+    std::vector<GLenum> mSizedFormats;
+};
+
 GLenum GetSizedInternalFormat(GLenum internalFormat, GLenum type)
 {
     const InternalFormat& formatInfo = GetInternalFormatInfo(internalFormat);
@@ -628,16 +813,8 @@ GLenum GetSizedInternalFormat(GLenum internalFormat, GLenum type)
     }
     else
     {
-        static const FormatMap formatMap = BuildFormatMap();
-        FormatMap::const_iterator iter = formatMap.find(FormatTypePair(internalFormat, type));
-        if (iter != formatMap.end())
-        {
-            return iter->second;
-        }
-        else
-        {
-            return GL_NONE;
-        }
+        static const SizedFormatTable sizedFormats(BuildFormatMap());
+        return sizedFormats.get(internalFormat, type);
     }
 }
 
@@ -71,6 +71,12 @@ struct InternalFormat
 };
 const InternalFormat &GetInternalFormatInfo(GLenum internalFormat);
 
+// Every format known to GetInternalFormatInfo has a dense index below GetInternalFormatCount(), so
+// that per-format data can be kept in arrays. Other enums return InvalidInternalFormatIndex.
+const size_t InvalidInternalFormatIndex = static_cast<size_t>(-1);
+size_t GetInternalFormatIndex(GLenum internalFormat);
+size_t GetInternalFormatCount();
+
 GLenum GetSizedInternalFormat(GLenum internalFormat, GLenum type);
 
 typedef std::set<GLenum> FormatSet;
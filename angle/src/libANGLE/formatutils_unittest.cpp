@@ -0,0 +1,137 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// formatutils_unittest.cpp: Unit tests for the internal format tables.
+
+#include <chrono>
+#include <iterator>
+#include <map>
+#include <set>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "libANGLE/formatutils.h"
+
+namespace
+{
+
+// Enums that are not internal formats
+const GLenum NonFormats[] = { GL_TEXTURE_2D, GL_UNSIGNED_BYTE, 0x1234, 0xFFFF, 0x10000, 0xFFFFFFFF };
+
+TEST(FormatUtilsTest, InternalFormatIndices)
+{
+    const size_t formatCount = gl::GetInternalFormatCount();
+    std::set<size_t> indices;
+
+    for (GLenum format : gl::GetAllSizedInternalFormats())
+    {
+        size_t formatIndex = gl::GetInternalFormatIndex(format);
+        ASSERT_LT(formatIndex, formatCount);
+        EXPECT_TRUE(indices.insert(formatIndex).second);
+        EXPECT_NE(0u, gl::GetInternalFormatInfo(format).pixelBytes);
+    }
+
+    EXPECT_NE(gl::InvalidInternalFormatIndex, gl::GetInternalFormatIndex(GL_NONE));
+    EXPECT_NE(gl::InvalidInternalFormatIndex, gl::GetInternalFormatIndex(GL_RGBA));
+
+    for (GLenum nonFormat : NonFormats)
+    {
+        EXPECT_EQ(gl::InvalidInternalFormatIndex, gl::GetInternalFormatIndex(nonFormat));
+        EXPECT_EQ(0u, gl::GetInternalFormatInfo(nonFormat).pixelBytes);
+    }
+}
+
+TEST(FormatUtilsTest, SizedInternalFormats)
+{
+    EXPECT_EQ(static_cast<GLenum>(GL_RGBA8), gl::GetSizedInternalFormat(GL_RGBA, GL_UNSIGNED_BYTE));
+    EXPECT_EQ(static_cast<GLenum>(GL_RGB565), gl::GetSizedInternalFormat(GL_RGB, GL_UNSIGNED_SHORT_5_6_5));
+    EXPECT_EQ(static_cast<GLenum>(GL_R16F), gl::GetSizedInternalFormat(GL_RED, GL_HALF_FLOAT_OES));
+    EXPECT_EQ(static_cast<GLenum>(GL_DEPTH24_STENCIL8), gl::GetSizedInternalFormat(GL_DEPTH_STENCIL, GL_UNSIGNED_INT_24_8));
+    EXPECT_EQ(static_cast<GLenum>(GL_STENCIL_INDEX8), gl::GetSizedInternalFormat(GL_STENCIL, GL_UNSIGNED_BYTE));
+
+    // Sized formats are returned as they are, whatever the type
+    EXPECT_EQ(static_cast<GLenum>(GL_RGBA8), gl::GetSizedInternalFormat(GL_RGBA8, GL_FLOAT));
+
+    EXPECT_EQ(static_cast<GLenum>(GL_NONE), gl::GetSizedInternalFormat(GL_RGBA, GL_UNSIGNED_SHORT_5_6_5));
+    EXPECT_EQ(static_cast<GLenum>(GL_NONE), gl::GetSizedInternalFormat(GL_RGBA, 0x10000 | GL_UNSIGNED_BYTE));
+    EXPECT_EQ(static_cast<GLenum>(GL_NONE), gl::GetSizedInternalFormat(0xFFFFFFFF, GL_UNSIGNED_BYTE));
+}
+
+TEST(FormatUtilsTest, TextureCapsMap)
+{
+    gl::TextureCapsMap capsMap;
+
+    gl::TextureCaps renderableCaps;
+    renderableCaps.texturable = true;
+    renderableCaps.renderable = true;
+    capsMap.insert(GL_RGBA8, renderableCaps);
+
+    // An enum outside the format table still gets stored
+    gl::TextureCaps filterableCaps;
+    filterableCaps.filterable = true;
+    capsMap.insert(0x1234, filterableCaps);
+
+    EXPECT_EQ(2u, capsMap.size());
+    EXPECT_TRUE(capsMap.get(GL_RGBA8).renderable);
+    EXPECT_TRUE(capsMap.get(0x1234).filterable);
+    EXPECT_FALSE(capsMap.get(GL_RGB8).texturable);
+
+    // Inserting a format twice keeps the first caps
+    capsMap.insert(GL_RGBA8, filterableCaps);
+    EXPECT_TRUE(capsMap.get(GL_RGBA8).renderable);
+
+    capsMap.remove(GL_RGBA8);
+    EXPECT_FALSE(capsMap.get(GL_RGBA8).texturable);
+    EXPECT_EQ(1u, capsMap.size());
+}
+
+// Times format lookups against the std::map they replaced. The timings are reported as test
+// properties rather than checked, since they depend on the machine.
+TEST(FormatUtilsTest, LookupBenchmark)
+{
+    std::vector<GLenum> formats(gl::GetAllSizedInternalFormats().begin(), gl::GetAllSizedInternalFormats().end());
+    formats.insert(formats.end(), std::begin(NonFormats), std::end(NonFormats));
+
+    std::map<GLenum, gl::InternalFormat> formatMap;
+    for (GLenum format : formats)
+    {
+        formatMap[format] = gl::GetInternalFormatInfo(format);
+    }
+
+    const size_t iterations = 2000;
+    const size_t lookups = iterations * formats.size();
+
+    GLuint tableBytes = 0;
+    auto tableStart = std::chrono::steady_clock::now();
+    for (size_t iteration = 0; iteration < iterations; iteration++)
+    {
+        for (GLenum format : formats)
+        {
+            tableBytes += gl::GetInternalFormatInfo(format).pixelBytes;
+        }
+    }
+    auto tableTime = std::chrono::steady_clock::now() - tableStart;
+
+    GLuint mapBytes = 0;
+    auto mapStart = std::chrono::steady_clock::now();
+    for (size_t iteration = 0; iteration < iterations; iteration++)
+    {
+        for (GLenum format : formats)
+        {
+            mapBytes += formatMap.find(format)->second.pixelBytes;
+        }
+    }
+    auto mapTime = std::chrono::steady_clock::now() - mapStart;
+
+    EXPECT_EQ(mapBytes, tableBytes);
+
+    typedef std::chrono::duration<double, std::nano> Nanoseconds;
+    RecordProperty("table_ps_per_lookup", static_cast<int>(Nanoseconds(tableTime).count() * 1000 / lookups));
+    RecordProperty("map_ps_per_lookup", static_cast<int>(Nanoseconds(mapTime).count() * 1000 / lookups));
+}
+
+}
@@ -0,0 +1,46 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// CompilerTranslator.h: Defines rx::CompilerTranslator, a CompilerImpl for the back-ends that
+// translate shaders with the ANGLE shader translator and only differ in its output.
+
+#ifndef LIBANGLE_RENDERER_COMPILERTRANSLATOR_H_
+#define LIBANGLE_RENDERER_COMPILERTRANSLATOR_H_
+
+#include "libANGLE/renderer/CompilerImpl.h"
+
+#include "GLSLANG/ShaderLang.h"
+
+namespace gl
+{
+struct Data;
+}
+
+namespace rx
+{
+
+class CompilerTranslator : public CompilerImpl
+{
+  public:
+    CompilerTranslator(const gl::Data &data, ShShaderOutput outputType);
+    ~CompilerTranslator() override;
+
+    gl::Error release() override;
+
+    ShHandle getCompilerHandle(GLenum type);
+
+  private:
+    ShShaderSpec mSpec;
+    ShShaderOutput mOutputType;
+    ShBuiltInResources mResources;
+
+    ShHandle mFragmentCompiler;
+    ShHandle mVertexCompiler;
+};
+
+}
+
+#endif // LIBANGLE_RENDERER_COMPILERTRANSLATOR_H_
@@ -52,6 +52,12 @@ gl::UniformBlock *ProgramImpl::getUniformBlockByIndex(GLuint blockIndex) const
 
 GLint ProgramImpl::getUniformLocation(const std::string &name) const
 {
+    if (mVariableNamesIndexed)
+    {
+        GLuint location = 0;
+        return mUniformLocationNames.find(name, &location) ? static_cast<GLint>(location) : -1;
+    }
+
     size_t subscript = GL_INVALID_INDEX;
     std::string baseName = gl::ParseUniformName(name, &subscript);
 
@@ -76,6 +82,13 @@ GLint ProgramImpl::getUniformLocation(const std::string &name) const
 
 GLuint ProgramImpl::getUniformIndex(const std::string &name) const
 {
+    if (mVariableNamesIndexed)
+    {
+        GLuint index = GL_INVALID_INDEX;
+        mUniformIndexNames.find(name, &index);
+        return index;
+    }
+
     size_t subscript = GL_INVALID_INDEX;
     std::string baseName = gl::ParseUniformName(name, &subscript);
 
@@ -102,6 +115,13 @@ GLuint ProgramImpl::getUniformIndex(const std::string &name) const
 
 GLuint ProgramImpl::getUniformBlockIndex(const std::string &name) const
 {
+    if (mVariableNamesIndexed)
+    {
+        GLuint blockIndex = GL_INVALID_INDEX;
+        mUniformBlockNames.find(name, &blockIndex);
+        return blockIndex;
+    }
+
     size_t subscript = GL_INVALID_INDEX;
     std::string baseName = gl::ParseUniformName(name, &subscript);
 
@@ -122,6 +142,50 @@ GLuint ProgramImpl::getUniformBlockIndex(const std::string &name) const
     return GL_INVALID_INDEX;
 }
 
+void ProgramImpl::indexVariableNames()
+{
+    mUniformLocationNames.clear();
+    for (size_t location = 0; location < mUniformIndex.size(); location++)
+    {
+        const gl::VariableLocation &variable = mUniformIndex[location];
+        mUniformLocationNames.add(variable.name, static_cast<GLuint>(location));
+        if (mUniforms[variable.index]->isArray())
+        {
+            mUniformLocationNames.addArrayElement(variable.name, variable.element, static_cast<GLuint>(location));
+        }
+    }
+
+    // Arrays of basic types can only be named by their first element
+    mUniformIndexNames.clear();
+    for (size_t index = 0; index < mUniforms.size(); index++)
+    {
+        const gl::LinkedUniform &uniform = *mUniforms[index];
+        mUniformIndexNames.add(uniform.name, static_cast<GLuint>(index));
+        if (uniform.isArray())
+        {
+            mUniformIndexNames.addArrayElement(uniform.name, 0, static_cast<GLuint>(index));
+        }
+    }
+
+    // The plain name of an array of blocks is its first element
+    mUniformBlockNames.clear();
+    for (size_t blockIndex = 0; blockIndex < mUniformBlocks.size(); blockIndex++)
+    {
+        const gl::UniformBlock &uniformBlock = *mUniformBlocks[blockIndex];
+        if (uniformBlock.elementIndex == GL_INVALID_INDEX || uniformBlock.elementIndex == 0)
+        {
+            mUniformBlockNames.add(uniformBlock.name, static_cast<GLuint>(blockIndex));
+        }
+        if (uniformBlock.elementIndex != GL_INVALID_INDEX)
+        {
+            mUniformBlockNames.addArrayElement(uniformBlock.name, uniformBlock.elementIndex,
+                                               static_cast<GLuint>(blockIndex));
+        }
+    }
+
+    mVariableNamesIndexed = true;
+}
+
 void ProgramImpl::reset()
 {
     std::fill(mSemanticIndex, mSemanticIndex + ArraySize(mSemanticIndex), -1);
@@ -129,6 +193,11 @@ void ProgramImpl::reset()
     mUniformIndex.clear();
     SafeDeleteContainer(mUniformBlocks);
     mTransformFeedbackLinkedVaryings.clear();
+
+    mUniformLocationNames.clear();
+    mUniformIndexNames.clear();
+    mUniformBlockNames.clear();
+    mVariableNamesIndexed = false;
 }
 
 void ProgramImpl::setShaderAttribute(size_t index, const sh::Attribute &attrib)
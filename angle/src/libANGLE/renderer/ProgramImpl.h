@@ -33,7 +33,7 @@ class ProgramImpl : angle::NonCopyable
   public:
     typedef int SemanticIndexArray[gl::MAX_VERTEX_ATTRIBS];
 
-    ProgramImpl() { }
+    ProgramImpl() : mVariableNamesIndexed(false) { }
     virtual ~ProgramImpl();
 
     virtual bool usesPointSize() const = 0;
@@ -121,6 +121,10 @@ class ProgramImpl : angle::NonCopyable
     GLuint getUniformIndex(const std::string &name) const;
     GLuint getUniformBlockIndex(const std::string &name) const;
 
+    // Indexes the uniform and uniform block names once a program has been linked or loaded.
+    // Lookups before that, which happen while linking, search the lists instead.
+    void indexVariableNames();
+
     void setShaderAttribute(size_t index, const sh::Attribute &attrib);
     void setShaderAttribute(size_t index, GLenum type, GLenum precision, const std::string &name, GLint size, int location);
 
@@ -136,6 +140,11 @@ class ProgramImpl : angle::NonCopyable
 
   private:
     std::vector<sh::Attribute> mShaderAttributes;
+
+    gl::VariableNameIndex mUniformLocationNames;
+    gl::VariableNameIndex mUniformIndexNames;
+    gl::VariableNameIndex mUniformBlockNames;
+    bool mVariableNamesIndexed;
 };
 
 }
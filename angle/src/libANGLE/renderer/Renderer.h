@@ -13,6 +13,7 @@
 #include "libANGLE/Caps.h"
 #include "libANGLE/Error.h"
 #include "libANGLE/Framebuffer.h"
+#include "libANGLE/State.h"
 #include "libANGLE/Uniform.h"
 #include "libANGLE/angletypes.h"
 #include "libANGLE/renderer/ImplFactory.h"
@@ -57,6 +58,10 @@ class Renderer : public ImplFactory
                                    const GLvoid *indices, GLsizei instances,
                                    const gl::RangeUI &indexRange) = 0;
 
+    // Applies the state groups changed since the last sync. Called before
+    // every draw with the current context's dirty bits.
+    virtual void syncState(const gl::State &state, const gl::State::DirtyBits &dirtyBits) = 0;
+
     // lost device
     //TODO(jmadill): investigate if this stuff is necessary in GL
     virtual void notifyDeviceLost() = 0;
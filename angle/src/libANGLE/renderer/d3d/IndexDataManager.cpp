@@ -10,49 +10,24 @@
 #include "libANGLE/renderer/d3d/IndexDataManager.h"
 #include "libANGLE/renderer/d3d/BufferD3D.h"
 #include "libANGLE/renderer/d3d/IndexBuffer.h"
+#include "libANGLE/renderer/d3d/indexconversion.h"
 #include "libANGLE/Buffer.h"
 #include "libANGLE/formatutils.h"
 
 namespace rx
 {
 
-static void ConvertIndices(GLenum sourceType, GLenum destinationType, const void *input, GLsizei count, void *output)
+// Converts with SSE2 when the CPU supports it
+static void ConvertIndexData(GLenum sourceType, GLenum destinationType, const void *input, size_t count, void *output)
 {
-    if (sourceType == GL_UNSIGNED_BYTE)
+    if (gl::supportsSSE2())
     {
-        ASSERT(destinationType == GL_UNSIGNED_SHORT);
-        const GLubyte *in = static_cast<const GLubyte*>(input);
-        GLushort *out = static_cast<GLushort*>(output);
-
-        for (GLsizei i = 0; i < count; i++)
-        {
-            out[i] = in[i];
-        }
+        ConvertIndices_SSE2(sourceType, destinationType, input, count, output, false, NULL);
     }
-    else if (sourceType == GL_UNSIGNED_INT)
-    {
-        ASSERT(destinationType == GL_UNSIGNED_INT);
-        memcpy(output, input, count * sizeof(GLuint));
-    }
-    else if (sourceType == GL_UNSIGNED_SHORT)
+    else
     {
-        if (destinationType == GL_UNSIGNED_SHORT)
-        {
-            memcpy(output, input, count * sizeof(GLushort));
-        }
-        else if (destinationType == GL_UNSIGNED_INT)
-        {
-            const GLushort *in = static_cast<const GLushort*>(input);
-            GLuint *out = static_cast<GLuint*>(output);
-
-            for (GLsizei i = 0; i < count; i++)
-            {
-                out[i] = in[i];
-            }
-        }
-        else UNREACHABLE();
+        ConvertIndices(sourceType, destinationType, input, count, output, false, NULL);
     }
-    else UNREACHABLE();
 }
 
 IndexDataManager::IndexDataManager(BufferFactoryD3D *factory, RendererClass rendererClass)
@@ -200,7 +175,7 @@ gl::Error IndexDataManager::prepareIndexData(GLenum type, GLsizei count, gl::Buf
                 return error;
             }
         }
-        ConvertIndices(type, destinationIndexType, dataPointer, convertCount, output);
+        ConvertIndexData(type, destinationIndexType, dataPointer, convertCount, output);
 
         error = indexBuffer->unmapBuffer();
         if (error.isError())
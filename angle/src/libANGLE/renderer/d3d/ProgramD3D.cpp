@@ -34,6 +34,30 @@ namespace rx
 namespace
 {
 
+// The fixed-size fields of a uniform, saved as one array in program binaries. The names follow as
+// strings.
+struct UniformBinaryRecord
+{
+    GLenum type;
+    GLenum precision;
+    unsigned int arraySize;
+    int blockIndex;
+    int blockOffset;
+    int blockArrayStride;
+    int blockMatrixStride;
+    unsigned int blockIsRowMajorMatrix;
+    unsigned int psRegisterIndex;
+    unsigned int vsRegisterIndex;
+    unsigned int registerCount;
+    unsigned int registerElement;
+};
+
+struct UniformIndexBinaryRecord
+{
+    unsigned int element;
+    unsigned int index;
+};
+
 GLenum GetTextureType(GLenum samplerType)
 {
     switch (samplerType)
@@ -299,42 +323,39 @@ void ProgramD3D::updateSamplerMapping()
     {
         gl::LinkedUniform *targetUniform = mUniforms[uniformIndex];
 
-        if (targetUniform->dirty)
+        if (gl::IsSamplerType(targetUniform->type))
         {
-            if (gl::IsSamplerType(targetUniform->type))
+            int count = targetUniform->elementCount();
+            GLint (*v)[4] = reinterpret_cast<GLint(*)[4]>(targetUniform->data);
+
+            if (targetUniform->isReferencedByFragmentShader())
             {
-                int count = targetUniform->elementCount();
-                GLint (*v)[4] = reinterpret_cast<GLint(*)[4]>(targetUniform->data);
+                unsigned int firstIndex = targetUniform->psRegisterIndex;
 
-                if (targetUniform->isReferencedByFragmentShader())
+                for (int i = 0; i < count; i++)
                 {
-                    unsigned int firstIndex = targetUniform->psRegisterIndex;
+                    unsigned int samplerIndex = firstIndex + i;
 
-                    for (int i = 0; i < count; i++)
+                    if (samplerIndex < mSamplersPS.size())
                     {
-                        unsigned int samplerIndex = firstIndex + i;
-
-                        if (samplerIndex < mSamplersPS.size())
-                        {
-                            ASSERT(mSamplersPS[samplerIndex].active);
-                            mSamplersPS[samplerIndex].logicalTextureUnit = v[i][0];
-                        }
+                        ASSERT(mSamplersPS[samplerIndex].active);
+                        mSamplersPS[samplerIndex].logicalTextureUnit = v[i][0];
                     }
                 }
+            }
 
-                if (targetUniform->isReferencedByVertexShader())
+            if (targetUniform->isReferencedByVertexShader())
+            {
+                unsigned int firstIndex = targetUniform->vsRegisterIndex;
+
+                for (int i = 0; i < count; i++)
                 {
-                    unsigned int firstIndex = targetUniform->vsRegisterIndex;
+                    unsigned int samplerIndex = firstIndex + i;
 
-                    for (int i = 0; i < count; i++)
+                    if (samplerIndex < mSamplersVS.size())
                     {
-                        unsigned int samplerIndex = firstIndex + i;
-
-                        if (samplerIndex < mSamplersVS.size())
-                        {
-                            ASSERT(mSamplersVS[samplerIndex].active);
-                            mSamplersVS[samplerIndex].logicalTextureUnit = v[i][0];
-                        }
+                        ASSERT(mSamplersVS[samplerIndex].active);
+                        mSamplersVS[samplerIndex].logicalTextureUnit = v[i][0];
                     }
                 }
             }
@@ -454,7 +475,7 @@ LinkResult ProgramD3D::load(gl::InfoLog &infoLog, gl::BinaryInputStream *stream)
     stream->readInt(&mShaderVersion);
 
     const unsigned int psSamplerCount = stream->readInt<unsigned int>();
-    for (unsigned int i = 0; i < psSamplerCount; ++i)
+    for (unsigned int i = 0; i < psSamplerCount && !stream->error(); ++i)
     {
         Sampler sampler;
         stream->readBool(&sampler.active);
@@ -463,7 +484,7 @@ LinkResult ProgramD3D::load(gl::InfoLog &infoLog, gl::BinaryInputStream *stream)
         mSamplersPS.push_back(sampler);
     }
     const unsigned int vsSamplerCount = stream->readInt<unsigned int>();
-    for (unsigned int i = 0; i < vsSamplerCount; ++i)
+    for (unsigned int i = 0; i < vsSamplerCount && !stream->error(); ++i)
     {
         Sampler sampler;
         stream->readBool(&sampler.active);
@@ -475,52 +496,47 @@ LinkResult ProgramD3D::load(gl::InfoLog &infoLog, gl::BinaryInputStream *stream)
     stream->readInt(&mUsedVertexSamplerRange);
     stream->readInt(&mUsedPixelSamplerRange);
 
-    const unsigned int uniformCount = stream->readInt<unsigned int>();
+    std::vector<UniformBinaryRecord> uniformRecords;
+    stream->readArray(&uniformRecords);
     if (stream->error())
     {
         infoLog << "Invalid program binary.";
         return LinkResult(false, gl::Error(GL_NO_ERROR));
     }
 
-    mUniforms.resize(uniformCount);
-    for (unsigned int uniformIndex = 0; uniformIndex < uniformCount; uniformIndex++)
+    mUniforms.resize(uniformRecords.size());
+    for (size_t uniformIndex = 0; uniformIndex < uniformRecords.size(); uniformIndex++)
     {
-        GLenum type = stream->readInt<GLenum>();
-        GLenum precision = stream->readInt<GLenum>();
+        const UniformBinaryRecord &record = uniformRecords[uniformIndex];
         std::string name = stream->readString();
-        unsigned int arraySize = stream->readInt<unsigned int>();
-        int blockIndex = stream->readInt<int>();
 
-        int offset = stream->readInt<int>();
-        int arrayStride = stream->readInt<int>();
-        int matrixStride = stream->readInt<int>();
-        bool isRowMajorMatrix = stream->readBool();
+        const sh::BlockMemberInfo blockInfo(record.blockOffset, record.blockArrayStride, record.blockMatrixStride,
+                                            record.blockIsRowMajorMatrix != 0);
 
-        const sh::BlockMemberInfo blockInfo(offset, arrayStride, matrixStride, isRowMajorMatrix);
-
-        gl::LinkedUniform *uniform = new gl::LinkedUniform(type, precision, name, arraySize, blockIndex, blockInfo);
-
-        stream->readInt(&uniform->psRegisterIndex);
-        stream->readInt(&uniform->vsRegisterIndex);
-        stream->readInt(&uniform->registerCount);
-        stream->readInt(&uniform->registerElement);
+        gl::LinkedUniform *uniform = new gl::LinkedUniform(record.type, record.precision, name, record.arraySize,
+                                                           record.blockIndex, blockInfo);
+        uniform->psRegisterIndex = record.psRegisterIndex;
+        uniform->vsRegisterIndex = record.vsRegisterIndex;
+        uniform->registerCount = record.registerCount;
+        uniform->registerElement = record.registerElement;
 
         mUniforms[uniformIndex] = uniform;
     }
 
-    const unsigned int uniformIndexCount = stream->readInt<unsigned int>();
+    std::vector<UniformIndexBinaryRecord> uniformIndexRecords;
+    stream->readArray(&uniformIndexRecords);
     if (stream->error())
     {
         infoLog << "Invalid program binary.";
         return LinkResult(false, gl::Error(GL_NO_ERROR));
     }
 
-    mUniformIndex.resize(uniformIndexCount);
-    for (unsigned int uniformIndexIndex = 0; uniformIndexIndex < uniformIndexCount; uniformIndexIndex++)
+    mUniformIndex.resize(uniformIndexRecords.size());
+    for (size_t uniformIndexIndex = 0; uniformIndexIndex < uniformIndexRecords.size(); uniformIndexIndex++)
     {
         stream->readString(&mUniformIndex[uniformIndexIndex].name);
-        stream->readInt(&mUniformIndex[uniformIndexIndex].element);
-        stream->readInt(&mUniformIndex[uniformIndexIndex].index);
+        mUniformIndex[uniformIndexIndex].element = uniformIndexRecords[uniformIndexIndex].element;
+        mUniformIndex[uniformIndexIndex].index = uniformIndexRecords[uniformIndexIndex].index;
     }
 
     unsigned int uniformBlockCount = stream->readInt<unsigned int>();
@@ -541,13 +557,7 @@ LinkResult ProgramD3D::load(gl::InfoLog &infoLog, gl::BinaryInputStream *stream)
 
         stream->readInt(&uniformBlock->psRegisterIndex);
         stream->readInt(&uniformBlock->vsRegisterIndex);
-
-        unsigned int numMembers = stream->readInt<unsigned int>();
-        uniformBlock->memberUniformIndexes.resize(numMembers);
-        for (unsigned int blockMemberIndex = 0; blockMemberIndex < numMembers; blockMemberIndex++)
-        {
-            stream->readInt(&uniformBlock->memberUniformIndexes[blockMemberIndex]);
-        }
+        stream->readArray(&uniformBlock->memberUniformIndexes);
 
         mUniformBlocks[uniformBlockIndex] = uniformBlock;
     }
@@ -584,8 +594,6 @@ LinkResult ProgramD3D::load(gl::InfoLog &infoLog, gl::BinaryInputStream *stream)
         stream->readInt(&mPixelShaderKey[pixelShaderKeyIndex].outputIndex);
     }
 
-    const unsigned char* binary = reinterpret_cast<const unsigned char*>(stream->data());
-
     const unsigned int vertexShaderCount = stream->readInt<unsigned int>();
     for (unsigned int vertexShaderIndex = 0; vertexShaderIndex < vertexShaderCount; vertexShaderIndex++)
     {
@@ -601,7 +609,12 @@ LinkResult ProgramD3D::load(gl::InfoLog &infoLog, gl::BinaryInputStream *stream)
         }
 
         unsigned int vertexShaderSize = stream->readInt<unsigned int>();
-        const unsigned char *vertexShaderFunction = binary + stream->offset();
+        const unsigned char *vertexShaderFunction = stream->readBytesInPlace(vertexShaderSize);
+        if (stream->error())
+        {
+            infoLog << "Invalid program binary.";
+            return LinkResult(false, gl::Error(GL_NO_ERROR));
+        }
 
         ShaderExecutableD3D *shaderExecutable = NULL;
         gl::Error error = mRenderer->loadExecutable(vertexShaderFunction, vertexShaderSize,
@@ -626,8 +639,6 @@ LinkResult ProgramD3D::load(gl::InfoLog &infoLog, gl::BinaryInputStream *stream)
 
         // add new binary
         mVertexExecutables.push_back(new VertexExecutable(inputLayout, signature, shaderExecutable));
-
-        stream->skip(vertexShaderSize);
     }
 
     const size_t pixelShaderCount = stream->readInt<unsigned int>();
@@ -641,7 +652,13 @@ LinkResult ProgramD3D::load(gl::InfoLog &infoLog, gl::BinaryInputStream *stream)
         }
 
         const size_t pixelShaderSize = stream->readInt<unsigned int>();
-        const unsigned char *pixelShaderFunction = binary + stream->offset();
+        const unsigned char *pixelShaderFunction = stream->readBytesInPlace(pixelShaderSize);
+        if (stream->error())
+        {
+            infoLog << "Invalid program binary.";
+            return LinkResult(false, gl::Error(GL_NO_ERROR));
+        }
+
         ShaderExecutableD3D *shaderExecutable = NULL;
         gl::Error error = mRenderer->loadExecutable(pixelShaderFunction, pixelShaderSize, SHADER_PIXEL,
                                                     mTransformFeedbackLinkedVaryings,
@@ -660,15 +677,19 @@ LinkResult ProgramD3D::load(gl::InfoLog &infoLog, gl::BinaryInputStream *stream)
 
         // add new binary
         mPixelExecutables.push_back(new PixelExecutable(outputs, shaderExecutable));
-
-        stream->skip(pixelShaderSize);
     }
 
     unsigned int geometryShaderSize = stream->readInt<unsigned int>();
 
     if (geometryShaderSize > 0)
     {
-        const unsigned char *geometryShaderFunction = binary + stream->offset();
+        const unsigned char *geometryShaderFunction = stream->readBytesInPlace(geometryShaderSize);
+        if (stream->error())
+        {
+            infoLog << "Invalid program binary.";
+            return LinkResult(false, gl::Error(GL_NO_ERROR));
+        }
+
         gl::Error error = mRenderer->loadExecutable(geometryShaderFunction, geometryShaderSize, SHADER_GEOMETRY,
                                                     mTransformFeedbackLinkedVaryings,
                                                     (mTransformFeedbackBufferMode == GL_SEPARATE_ATTRIBS),
@@ -683,7 +704,6 @@ LinkResult ProgramD3D::load(gl::InfoLog &infoLog, gl::BinaryInputStream *stream)
             infoLog << "Could not create geometry shader.";
             return LinkResult(false, gl::Error(GL_NO_ERROR));
         }
-        stream->skip(geometryShaderSize);
     }
 
     GUID binaryIdentifier = {0};
@@ -727,34 +747,41 @@ gl::Error ProgramD3D::save(gl::BinaryOutputStream *stream)
     stream->writeInt(mUsedVertexSamplerRange);
     stream->writeInt(mUsedPixelSamplerRange);
 
-    stream->writeInt(mUniforms.size());
+    std::vector<UniformBinaryRecord> uniformRecords(mUniforms.size());
     for (size_t uniformIndex = 0; uniformIndex < mUniforms.size(); ++uniformIndex)
     {
         const gl::LinkedUniform &uniform = *mUniforms[uniformIndex];
-
-        stream->writeInt(uniform.type);
-        stream->writeInt(uniform.precision);
-        stream->writeString(uniform.name);
-        stream->writeInt(uniform.arraySize);
-        stream->writeInt(uniform.blockIndex);
-
-        stream->writeInt(uniform.blockInfo.offset);
-        stream->writeInt(uniform.blockInfo.arrayStride);
-        stream->writeInt(uniform.blockInfo.matrixStride);
-        stream->writeInt(uniform.blockInfo.isRowMajorMatrix);
-
-        stream->writeInt(uniform.psRegisterIndex);
-        stream->writeInt(uniform.vsRegisterIndex);
-        stream->writeInt(uniform.registerCount);
-        stream->writeInt(uniform.registerElement);
+        UniformBinaryRecord &record = uniformRecords[uniformIndex];
+
+        record.type = uniform.type;
+        record.precision = uniform.precision;
+        record.arraySize = uniform.arraySize;
+        record.blockIndex = uniform.blockIndex;
+        record.blockOffset = uniform.blockInfo.offset;
+        record.blockArrayStride = uniform.blockInfo.arrayStride;
+        record.blockMatrixStride = uniform.blockInfo.matrixStride;
+        record.blockIsRowMajorMatrix = uniform.blockInfo.isRowMajorMatrix;
+        record.psRegisterIndex = uniform.psRegisterIndex;
+        record.vsRegisterIndex = uniform.vsRegisterIndex;
+        record.registerCount = uniform.registerCount;
+        record.registerElement = uniform.registerElement;
+    }
+    stream->writeArray(uniformRecords.data(), uniformRecords.size());
+    for (size_t uniformIndex = 0; uniformIndex < mUniforms.size(); ++uniformIndex)
+    {
+        stream->writeString(mUniforms[uniformIndex]->name);
     }
 
-    stream->writeInt(mUniformIndex.size());
+    std::vector<UniformIndexBinaryRecord> uniformIndexRecords(mUniformIndex.size());
+    for (size_t i = 0; i < mUniformIndex.size(); ++i)
+    {
+        uniformIndexRecords[i].element = mUniformIndex[i].element;
+        uniformIndexRecords[i].index = mUniformIndex[i].index;
+    }
+    stream->writeArray(uniformIndexRecords.data(), uniformIndexRecords.size());
     for (size_t i = 0; i < mUniformIndex.size(); ++i)
     {
         stream->writeString(mUniformIndex[i].name);
-        stream->writeInt(mUniformIndex[i].element);
-        stream->writeInt(mUniformIndex[i].index);
     }
 
     stream->writeInt(mUniformBlocks.size());
@@ -766,14 +793,9 @@ gl::Error ProgramD3D::save(gl::BinaryOutputStream *stream)
         stream->writeInt(uniformBlock.elementIndex);
         stream->writeInt(uniformBlock.dataSize);
 
-        stream->writeInt(uniformBlock.memberUniformIndexes.size());
-        for (unsigned int blockMemberIndex = 0; blockMemberIndex < uniformBlock.memberUniformIndexes.size(); blockMemberIndex++)
-        {
-            stream->writeInt(uniformBlock.memberUniformIndexes[blockMemberIndex]);
-        }
-
         stream->writeInt(uniformBlock.psRegisterIndex);
         stream->writeInt(uniformBlock.vsRegisterIndex);
+        stream->writeArray(uniformBlock.memberUniformIndexes.data(), uniformBlock.memberUniformIndexes.size());
     }
 
     stream->writeInt(mTransformFeedbackBufferMode);
@@ -1182,22 +1204,21 @@ void ProgramD3D::initializeUniformStorage()
 
     mVertexUniformStorage = mRenderer->createUniformStorage(vertexRegisters * 16u);
     mFragmentUniformStorage = mRenderer->createUniformStorage(fragmentRegisters * 16u);
+    dirtyAllUniforms();
 }
 
 gl::Error ProgramD3D::applyUniforms()
 {
     updateSamplerMapping();
 
-    gl::Error error = mRenderer->applyUniforms(*this, mUniforms);
+    gl::Error error = mRenderer->applyUniforms(*this);
     if (error.isError())
     {
         return error;
     }
 
-    for (size_t uniformIndex = 0; uniformIndex < mUniforms.size(); uniformIndex++)
-    {
-        mUniforms[uniformIndex]->dirty = false;
-    }
+    mVertexUniformStorage->markClean();
+    mFragmentUniformStorage->markClean();
 
     return gl::Error(GL_NO_ERROR);
 }
@@ -1281,10 +1302,24 @@ bool ProgramD3D::assignUniformBlockRegister(gl::InfoLog &infoLog, gl::UniformBlo
 
 void ProgramD3D::dirtyAllUniforms()
 {
+    // Only the registers of the uniforms are marked, since shader model 3 keeps the driver uniforms
+    // in the registers below them.
     unsigned int numUniforms = mUniforms.size();
     for (unsigned int index = 0; index < numUniforms; index++)
     {
-        mUniforms[index]->dirty = true;
+        const gl::LinkedUniform &uniform = *mUniforms[index];
+
+        if (!uniform.isSampler())
+        {
+            if (uniform.isReferencedByVertexShader())
+            {
+                mVertexUniformStorage->markDirty(uniform.vsRegisterIndex * 16u, uniform.registerCount * 16u);
+            }
+            if (uniform.isReferencedByFragmentShader())
+            {
+                mFragmentUniformStorage->markDirty(uniform.psRegisterIndex * 16u, uniform.registerCount * 16u);
+            }
+        }
     }
 }
 
@@ -1562,16 +1597,6 @@ void ProgramD3D::defineUniform(const ShaderD3D *shader, const sh::ShaderVariable
     }
 }
 
-template <typename T>
-static inline void SetIfDirty(T *dest, const T& source, bool *dirtyFlag)
-{
-    ASSERT(dest != NULL);
-    ASSERT(dirtyFlag != NULL);
-
-    *dirtyFlag = *dirtyFlag || (memcmp(dest, &source, sizeof(T)) != 0);
-    *dest = source;
-}
-
 template <typename T>
 void ProgramD3D::setUniform(GLint location, GLsizei count, const T* v, GLenum targetUniformType)
 {
@@ -1579,14 +1604,16 @@ void ProgramD3D::setUniform(GLint location, GLsizei count, const T* v, GLenum ta
     const GLenum targetBoolType = gl::VariableBoolVectorType(targetUniformType);
 
     gl::LinkedUniform *targetUniform = getUniformByLocation(location);
+    unsigned int element = mUniformIndex[location].element;
 
     int elementCount = targetUniform->elementCount();
 
-    count = std::min(elementCount - (int)mUniformIndex[location].element, count);
+    count = std::min(elementCount - (int)element, count);
+    mUniformStaging.resize(count * 4 * sizeof(T));
 
     if (targetUniform->type == targetUniformType)
     {
-        T *target = reinterpret_cast<T*>(targetUniform->data) + mUniformIndex[location].element * 4;
+        T *target = reinterpret_cast<T*>(mUniformStaging.data());
 
         for (int i = 0; i < count; i++)
         {
@@ -1595,17 +1622,17 @@ void ProgramD3D::setUniform(GLint location, GLsizei count, const T* v, GLenum ta
 
             for (int c = 0; c < components; c++)
             {
-                SetIfDirty(dest + c, source[c], &targetUniform->dirty);
+                dest[c] = source[c];
             }
             for (int c = components; c < 4; c++)
             {
-                SetIfDirty(dest + c, T(0), &targetUniform->dirty);
+                dest[c] = T(0);
             }
         }
     }
     else if (targetUniform->type == targetBoolType)
     {
-        GLint *boolParams = reinterpret_cast<GLint*>(targetUniform->data) + mUniformIndex[location].element * 4;
+        GLint *boolParams = reinterpret_cast<GLint*>(mUniformStaging.data());
 
         for (int i = 0; i < count; i++)
         {
@@ -1614,11 +1641,11 @@ void ProgramD3D::setUniform(GLint location, GLsizei count, const T* v, GLenum ta
 
             for (int c = 0; c < components; c++)
             {
-                SetIfDirty(dest + c, (source[c] == static_cast<T>(0)) ? GL_FALSE : GL_TRUE, &targetUniform->dirty);
+                dest[c] = (source[c] == static_cast<T>(0)) ? GL_FALSE : GL_TRUE;
             }
             for (int c = components; c < 4; c++)
             {
-                SetIfDirty(dest + c, GL_FALSE, &targetUniform->dirty);
+                dest[c] = GL_FALSE;
             }
         }
     }
@@ -1626,33 +1653,80 @@ void ProgramD3D::setUniform(GLint location, GLsizei count, const T* v, GLenum ta
     {
         ASSERT(targetUniformType == GL_INT);
 
-        GLint *target = reinterpret_cast<GLint*>(targetUniform->data) + mUniformIndex[location].element * 4;
-
-        bool wasDirty = targetUniform->dirty;
+        GLint *target = reinterpret_cast<GLint*>(mUniformStaging.data());
 
         for (int i = 0; i < count; i++)
         {
             GLint *dest = target + (i * 4);
             const GLint *source = reinterpret_cast<const GLint*>(v) + (i * components);
 
-            SetIfDirty(dest + 0, source[0], &targetUniform->dirty);
-            SetIfDirty(dest + 1, 0, &targetUniform->dirty);
-            SetIfDirty(dest + 2, 0, &targetUniform->dirty);
-            SetIfDirty(dest + 3, 0, &targetUniform->dirty);
+            dest[0] = source[0];
+            dest[1] = 0;
+            dest[2] = 0;
+            dest[3] = 0;
         }
+    }
+    else UNREACHABLE();
 
-        if (!wasDirty && targetUniform->dirty)
+    setUniformData(targetUniform, element, count);
+}
+
+void ProgramD3D::setUniformData(gl::LinkedUniform *targetUniform, unsigned int element, GLsizei count)
+{
+    const size_t elementSize = gl::VariableRowCount(targetUniform->type) * 4 * sizeof(GLfloat);
+    const size_t size = count * elementSize;
+    unsigned char *dest = targetUniform->data + element * elementSize;
+
+    // Most calls set the values the uniform already has
+    if (size == 0 || memcmp(dest, mUniformStaging.data(), size) == 0)
+    {
+        return;
+    }
+
+    memcpy(dest, mUniformStaging.data(), size);
+
+    if (targetUniform->isSampler())
+    {
+        mDirtySamplerMapping = true;
+        return;
+    }
+
+    // Shader model 3 registers only hold floats
+    if (mRenderer->getMajorShaderModel() < 4 && gl::VariableComponentType(targetUniform->type) != GL_FLOAT)
+    {
+        const GLint *intParams = reinterpret_cast<const GLint*>(dest);
+        GLfloat *floatParams = reinterpret_cast<GLfloat*>(mUniformStaging.data());
+
+        for (size_t i = 0; i < size / sizeof(GLint); i++)
         {
-            mDirtySamplerMapping = true;
+            floatParams[i] = static_cast<GLfloat>(intParams[i]);
         }
     }
-    else UNREACHABLE();
+
+    // Struct members can share their registers with the members packed around them, so only the
+    // components the uniform owns are written
+    ASSERT(targetUniform->registerElement == 0 ||
+           (!targetUniform->isArray() && !gl::IsMatrixType(targetUniform->type)));
+    const size_t registerOffset = element * elementSize + targetUniform->registerElement * sizeof(GLfloat);
+    const size_t registerCount = count * gl::VariableRowCount(targetUniform->type);
+    const size_t componentCount = gl::VariableColumnCount(targetUniform->type);
+
+    if (targetUniform->isReferencedByVertexShader())
+    {
+        mVertexUniformStorage->setRegisters(targetUniform->vsRegisterIndex * 16u + registerOffset,
+                                            mUniformStaging.data(), registerCount, componentCount);
+    }
+
+    if (targetUniform->isReferencedByFragmentShader())
+    {
+        mFragmentUniformStorage->setRegisters(targetUniform->psRegisterIndex * 16u + registerOffset,
+                                              mUniformStaging.data(), registerCount, componentCount);
+    }
 }
 
 template<typename T>
-bool transposeMatrix(T *target, const GLfloat *value, int targetWidth, int targetHeight, int srcWidth, int srcHeight)
+void transposeMatrix(T *target, const GLfloat *value, int targetWidth, int targetHeight, int srcWidth, int srcHeight)
 {
-    bool dirty = false;
     int copyWidth = std::min(targetHeight, srcWidth);
     int copyHeight = std::min(targetWidth, srcHeight);
 
@@ -1660,7 +1734,7 @@ bool transposeMatrix(T *target, const GLfloat *value, int targetWidth, int targe
     {
         for (int y = 0; y < copyHeight; y++)
         {
-            SetIfDirty(target + (x * targetWidth + y), static_cast<T>(value[y * srcWidth + x]), &dirty);
+            target[x * targetWidth + y] = static_cast<T>(value[y * srcWidth + x]);
         }
     }
     // clear unfilled right side
@@ -1668,7 +1742,7 @@ bool transposeMatrix(T *target, const GLfloat *value, int targetWidth, int targe
     {
         for (int x = copyHeight; x < targetWidth; x++)
         {
-            SetIfDirty(target + (y * targetWidth + x), static_cast<T>(0), &dirty);
+            target[y * targetWidth + x] = static_cast<T>(0);
         }
     }
     // clear unfilled bottom.
@@ -1676,17 +1750,14 @@ bool transposeMatrix(T *target, const GLfloat *value, int targetWidth, int targe
     {
         for (int x = 0; x < targetWidth; x++)
         {
-            SetIfDirty(target + (y * targetWidth + x), static_cast<T>(0), &dirty);
+            target[y * targetWidth + x] = static_cast<T>(0);
         }
     }
-
-    return dirty;
 }
 
 template<typename T>
-bool expandMatrix(T *target, const GLfloat *value, int targetWidth, int targetHeight, int srcWidth, int srcHeight)
+void expandMatrix(T *target, const GLfloat *value, int targetWidth, int targetHeight, int srcWidth, int srcHeight)
 {
-    bool dirty = false;
     int copyWidth = std::min(targetWidth, srcWidth);
     int copyHeight = std::min(targetHeight, srcHeight);
 
@@ -1694,7 +1765,7 @@ bool expandMatrix(T *target, const GLfloat *value, int targetWidth, int targetHe
     {
         for (int x = 0; x < copyWidth; x++)
         {
-            SetIfDirty(target + (y * targetWidth + x), static_cast<T>(value[y * srcWidth + x]), &dirty);
+            target[y * targetWidth + x] = static_cast<T>(value[y * srcWidth + x]);
         }
     }
     // clear unfilled right side
@@ -1702,7 +1773,7 @@ bool expandMatrix(T *target, const GLfloat *value, int targetWidth, int targetHe
     {
         for (int x = copyWidth; x < targetWidth; x++)
         {
-            SetIfDirty(target + (y * targetWidth + x), static_cast<T>(0), &dirty);
+            target[y * targetWidth + x] = static_cast<T>(0);
         }
     }
     // clear unfilled bottom.
@@ -1710,38 +1781,40 @@ bool expandMatrix(T *target, const GLfloat *value, int targetWidth, int targetHe
     {
         for (int x = 0; x < targetWidth; x++)
         {
-            SetIfDirty(target + (y * targetWidth + x), static_cast<T>(0), &dirty);
+            target[y * targetWidth + x] = static_cast<T>(0);
         }
     }
-
-    return dirty;
 }
 
 template <int cols, int rows>
 void ProgramD3D::setUniformMatrixfv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value, GLenum targetUniformType)
 {
     gl::LinkedUniform *targetUniform = getUniformByLocation(location);
+    unsigned int element = mUniformIndex[location].element;
 
     int elementCount = targetUniform->elementCount();
 
-    count = std::min(elementCount - (int)mUniformIndex[location].element, count);
+    count = std::min(elementCount - (int)element, count);
     const unsigned int targetMatrixStride = (4 * rows);
-    GLfloat *target = (GLfloat*)(targetUniform->data + mUniformIndex[location].element * sizeof(GLfloat) * targetMatrixStride);
+    mUniformStaging.resize(count * targetMatrixStride * sizeof(GLfloat));
+    GLfloat *target = reinterpret_cast<GLfloat*>(mUniformStaging.data());
 
     for (int i = 0; i < count; i++)
     {
         // Internally store matrices as transposed versions to accomodate HLSL matrix indexing
         if (transpose == GL_FALSE)
         {
-            targetUniform->dirty = transposeMatrix<GLfloat>(target, value, 4, rows, rows, cols) || targetUniform->dirty;
+            transposeMatrix<GLfloat>(target, value, 4, rows, rows, cols);
         }
         else
         {
-            targetUniform->dirty = expandMatrix<GLfloat>(target, value, 4, rows, cols, rows) || targetUniform->dirty;
+            expandMatrix<GLfloat>(target, value, 4, rows, cols, rows);
         }
         target += targetMatrixStride;
         value += cols * rows;
     }
+
+    setUniformData(targetUniform, element, count);
 }
 
 template <typename T>
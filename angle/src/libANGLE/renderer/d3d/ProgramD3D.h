@@ -186,6 +186,7 @@ class ProgramD3D : public ProgramImpl
 
     template <typename T>
     void setUniform(GLint location, GLsizei count, const T* v, GLenum targetUniformType);
+    void setUniformData(gl::LinkedUniform *targetUniform, unsigned int element, GLsizei count);
 
     template <int cols, int rows>
     void setUniformMatrixfv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value, GLenum targetUniformType);
@@ -218,6 +219,9 @@ class ProgramD3D : public ProgramImpl
     UniformStorageD3D *mVertexUniformStorage;
     UniformStorageD3D *mFragmentUniformStorage;
 
+    // The values of a glUniform* call, converted to the layout of the uniform's registers
+    std::vector<uint8_t> mUniformStaging;
+
     GLenum mTransformFeedbackBufferMode;
 
     std::vector<Sampler> mSamplersPS;
@@ -221,6 +221,13 @@ gl::Error RendererD3D::drawArrays(const gl::Data &data,
     return gl::Error(GL_NO_ERROR);
 }
 
+void RendererD3D::syncState(const gl::State &state, const gl::State::DirtyBits &dirtyBits)
+{
+    // The D3D renderers still derive their state blocks from the full GL state in
+    // applyState, where the blend, depth-stencil and rasterizer state caches make
+    // unchanged state cheap to re-apply.
+}
+
 gl::Error RendererD3D::generateSwizzles(const gl::Data &data, gl::SamplerType type)
 {
     gl::Program *program = data.state->getProgram();
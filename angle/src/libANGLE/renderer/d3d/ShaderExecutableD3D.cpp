@@ -10,6 +10,10 @@
 #include "libANGLE/renderer/d3d/ShaderExecutableD3D.h"
 
 #include "common/angleutils.h"
+#include "common/mathutil.h"
+
+#include <algorithm>
+#include <cstring>
 
 namespace rx
 {
@@ -45,7 +49,10 @@ void ShaderExecutableD3D::appendDebugInfo(const std::string &info)
 }
 
 
-UniformStorageD3D::UniformStorageD3D(size_t initialSize) : mSize(initialSize)
+UniformStorageD3D::UniformStorageD3D(size_t initialSize)
+    : mShadowData(initialSize, 0),
+      mDirtyBegin(0),
+      mDirtyEnd(0)
 {
 }
 
@@ -55,7 +62,90 @@ UniformStorageD3D::~UniformStorageD3D()
 
 size_t UniformStorageD3D::size() const
 {
-    return mSize;
+    return mShadowData.size();
+}
+
+const uint8_t *UniformStorageD3D::getShadowData() const
+{
+    return mShadowData.data();
+}
+
+bool UniformStorageD3D::setData(size_t offset, const void *data, size_t dataSize)
+{
+    ASSERT(offset + dataSize <= mShadowData.size());
+
+    uint8_t *dest = mShadowData.data() + offset;
+    const uint8_t *source = static_cast<const uint8_t*>(data);
+    if (dataSize == 0 || memcmp(dest, source, dataSize) == 0)
+    {
+        return false;
+    }
+
+    // Only the bytes between the first and the last that differ are marked, so that setting a
+    // whole array to change one of its elements dirties only that element's registers.
+    size_t first = 0;
+    while (dest[first] == source[first])
+    {
+        first++;
+    }
+
+    size_t last = dataSize - 1;
+    while (dest[last] == source[last])
+    {
+        last--;
+    }
+
+    memcpy(dest + first, source + first, last + 1 - first);
+    markDirty(offset + first, last + 1 - first);
+    return true;
+}
+
+bool UniformStorageD3D::setRegisters(size_t offset, const void *data, size_t registerCount, size_t componentCount)
+{
+    const size_t registerSize = 4 * sizeof(float);
+    ASSERT(componentCount > 0 && componentCount <= 4);
+
+    if (componentCount == 4)
+    {
+        return setData(offset, data, registerCount * registerSize);
+    }
+
+    const uint8_t *source = static_cast<const uint8_t*>(data);
+    bool changed = false;
+    for (size_t registerIndex = 0; registerIndex < registerCount; registerIndex++)
+    {
+        changed |= setData(offset + registerIndex * registerSize, source + registerIndex * registerSize,
+                           componentCount * sizeof(float));
+    }
+    return changed;
+}
+
+void UniformStorageD3D::markDirty(size_t offset, size_t dataSize)
+{
+    const size_t registerSize = 4 * sizeof(float);
+    size_t begin = offset - (offset % registerSize);
+    size_t end = std::min(roundUp(offset + dataSize, registerSize), mShadowData.size());
+    if (begin >= end)
+    {
+        return;
+    }
+
+    if (isDirty())
+    {
+        mDirtyBegin = std::min(mDirtyBegin, begin);
+        mDirtyEnd = std::max(mDirtyEnd, end);
+    }
+    else
+    {
+        mDirtyBegin = begin;
+        mDirtyEnd = end;
+    }
+}
+
+void UniformStorageD3D::markClean()
+{
+    mDirtyBegin = 0;
+    mDirtyEnd = 0;
 }
 
 }
@@ -37,6 +37,8 @@ class ShaderExecutableD3D : angle::NonCopyable
     std::string mDebugInfo;
 };
 
+// Shadows the default uniform block of one shader stage, packed into registers the way the shader
+// reads them, along with the range of registers that changed since it was last uploaded.
 class UniformStorageD3D : angle::NonCopyable
 {
   public:
@@ -45,8 +47,25 @@ class UniformStorageD3D : angle::NonCopyable
 
     size_t size() const;
 
+    const uint8_t *getShadowData() const;
+
+    // Returns false, leaving the storage clean, if the registers already hold the data
+    bool setData(size_t offset, const void *data, size_t dataSize);
+    // Sets only the first componentCount components of each register, since the components after
+    // them can belong to the uniforms packed into the same register.
+    bool setRegisters(size_t offset, const void *data, size_t registerCount, size_t componentCount);
+    void markDirty(size_t offset, size_t dataSize);
+    void markClean();
+
+    // The dirty range covers whole registers
+    bool isDirty() const { return mDirtyBegin < mDirtyEnd; }
+    size_t getDirtyBegin() const { return mDirtyBegin; }
+    size_t getDirtyEnd() const { return mDirtyEnd; }
+
   private:
-    size_t mSize;
+    std::vector<uint8_t> mShadowData;
+    size_t mDirtyBegin;
+    size_t mDirtyEnd;
 };
 
 }
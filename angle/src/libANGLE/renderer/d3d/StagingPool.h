@@ -0,0 +1,181 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// StagingPool.h: Defines rx::StagingPool, a pool of the staging resources that hold the system
+// memory copies of texture images. Images hand their staging resources back to the pool when they
+// are redefined or their data moves to a texture storage, and take a recycled resource of the same
+// description before creating a new one.
+
+#ifndef LIBANGLE_RENDERER_D3D_STAGINGPOOL_H_
+#define LIBANGLE_RENDERER_D3D_STAGINGPOOL_H_
+
+#include "angle_gl.h"
+#include "common/angleutils.h"
+#include "common/debug.h"
+
+#include <vector>
+
+namespace rx
+{
+
+// Resources are only recycled for the exact same description. The copies between the staging
+// resources and the storages don't all accept partial subresources, so rounding the sizes up to
+// coarser classes would not work for every format.
+struct StagingDesc
+{
+    StagingDesc()
+        : target(GL_NONE),
+          format(0),
+          width(0),
+          height(0),
+          depth(0),
+          levels(0),
+          bytes(0)
+    {
+    }
+
+    // GL_TEXTURE_2D or GL_TEXTURE_3D, for the dimension of the resource
+    GLenum target;
+    // Format of the renderer, such as a DXGI_FORMAT
+    unsigned int format;
+    GLsizei width;
+    GLsizei height;
+    GLsizei depth;
+    GLsizei levels;
+    // Memory held by the resource, which counts towards the resident bytes of the pool
+    size_t bytes;
+};
+
+inline bool operator==(const StagingDesc &a, const StagingDesc &b)
+{
+    return a.target == b.target && a.format == b.format && a.width == b.width &&
+           a.height == b.height && a.depth == b.depth && a.levels == b.levels;
+}
+
+template <typename ResourceT>
+class StagingPool : angle::NonCopyable
+{
+  public:
+    // Free resources are released, oldest first, when they add up to more than maxFreeBytes.
+    explicit StagingPool(size_t maxFreeBytes);
+    ~StagingPool();
+
+    // Takes a free resource of the description out of the pool. Returns NULL when there is none,
+    // in which case the caller creates the resource and accounts for it with addResource.
+    ResourceT *acquire(const StagingDesc &desc);
+    void addResource(const StagingDesc &desc);
+
+    // Gives back a resource that was acquired or added. The pool takes over its reference.
+    void recycle(const StagingDesc &desc, ResourceT *resource);
+
+    // Releases all the free resources, for example when the application runs low on memory.
+    void trim();
+
+    // Bytes of the staging resources held by images, and of those waiting to be recycled. Both
+    // together are the staging memory resident for the renderer.
+    size_t getInUseBytes() const { return mInUseBytes; }
+    size_t getFreeBytes() const { return mFreeBytes; }
+    size_t getResidentBytes() const { return mInUseBytes + mFreeBytes; }
+
+  private:
+    void releaseOldest();
+
+    struct FreeResource
+    {
+        StagingDesc desc;
+        ResourceT *resource;
+    };
+
+    // Ordered from the least to the most recently recycled
+    std::vector<FreeResource> mFreeResources;
+
+    size_t mMaxFreeBytes;
+    size_t mInUseBytes;
+    size_t mFreeBytes;
+};
+
+template <typename ResourceT>
+StagingPool<ResourceT>::StagingPool(size_t maxFreeBytes)
+    : mMaxFreeBytes(maxFreeBytes),
+      mInUseBytes(0),
+      mFreeBytes(0)
+{
+}
+
+template <typename ResourceT>
+StagingPool<ResourceT>::~StagingPool()
+{
+    trim();
+}
+
+template <typename ResourceT>
+ResourceT *StagingPool<ResourceT>::acquire(const StagingDesc &desc)
+{
+    // Search from the most recently recycled resources, which are the most likely to match
+    for (size_t i = mFreeResources.size(); i > 0; i--)
+    {
+        const FreeResource &freeResource = mFreeResources[i - 1];
+        if (freeResource.desc == desc)
+        {
+            ResourceT *resource = freeResource.resource;
+            mFreeBytes -= freeResource.desc.bytes;
+            mInUseBytes += freeResource.desc.bytes;
+            mFreeResources.erase(mFreeResources.begin() + (i - 1));
+            return resource;
+        }
+    }
+
+    return NULL;
+}
+
+template <typename ResourceT>
+void StagingPool<ResourceT>::addResource(const StagingDesc &desc)
+{
+    mInUseBytes += desc.bytes;
+}
+
+template <typename ResourceT>
+void StagingPool<ResourceT>::recycle(const StagingDesc &desc, ResourceT *resource)
+{
+    ASSERT(resource);
+    ASSERT(mInUseBytes >= desc.bytes);
+    mInUseBytes -= desc.bytes;
+
+    FreeResource freeResource;
+    freeResource.desc = desc;
+    freeResource.resource = resource;
+    mFreeResources.push_back(freeResource);
+    mFreeBytes += desc.bytes;
+
+    while (mFreeBytes > mMaxFreeBytes)
+    {
+        releaseOldest();
+    }
+}
+
+template <typename ResourceT>
+void StagingPool<ResourceT>::trim()
+{
+    while (!mFreeResources.empty())
+    {
+        releaseOldest();
+    }
+}
+
+template <typename ResourceT>
+void StagingPool<ResourceT>::releaseOldest()
+{
+    ASSERT(!mFreeResources.empty());
+
+    FreeResource &oldest = mFreeResources.front();
+    mFreeBytes -= oldest.desc.bytes;
+    SafeRelease(oldest.resource);
+    mFreeResources.erase(mFreeResources.begin());
+}
+
+}
+
+#endif // LIBANGLE_RENDERER_D3D_STAGINGPOOL_H_
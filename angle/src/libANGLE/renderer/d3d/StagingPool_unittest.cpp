@@ -0,0 +1,126 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// StagingPool_unittest.cpp: Unit tests that the staging pool recycles resources by description,
+// accounts for the resident bytes, and releases the oldest free resources over its budget.
+
+#include "gtest/gtest.h"
+
+#include "libANGLE/renderer/d3d/StagingPool.h"
+
+using namespace rx;
+
+namespace
+{
+
+// Counts its references like a COM object
+struct MockResource
+{
+    MockResource() : references(1) {}
+    void Release() { references--; }
+
+    int references;
+};
+
+StagingDesc MakeDesc(GLenum target, GLsizei width, GLsizei height, GLsizei depth, size_t pixelBytes)
+{
+    StagingDesc desc;
+    desc.target = target;
+    desc.format = 28;
+    desc.width = width;
+    desc.height = height;
+    desc.depth = depth;
+    desc.levels = 1;
+    desc.bytes = width * height * depth * pixelBytes;
+    return desc;
+}
+
+TEST(StagingPoolTest, RecyclesMatchingResources)
+{
+    StagingPool<MockResource> pool(1024 * 1024);
+    StagingDesc desc2D = MakeDesc(GL_TEXTURE_2D, 64, 64, 1, 4);
+    StagingDesc desc3D = MakeDesc(GL_TEXTURE_3D, 16, 16, 16, 4);
+
+    EXPECT_EQ(nullptr, pool.acquire(desc2D));
+
+    MockResource resource;
+    pool.addResource(desc2D);
+    EXPECT_EQ(desc2D.bytes, pool.getInUseBytes());
+    EXPECT_EQ(0u, pool.getFreeBytes());
+
+    pool.recycle(desc2D, &resource);
+    EXPECT_EQ(0u, pool.getInUseBytes());
+    EXPECT_EQ(desc2D.bytes, pool.getFreeBytes());
+    EXPECT_EQ(1, resource.references);
+
+    // Only a resource of the same description is handed out again
+    EXPECT_EQ(nullptr, pool.acquire(desc3D));
+    EXPECT_EQ(nullptr, pool.acquire(MakeDesc(GL_TEXTURE_2D, 64, 32, 1, 4)));
+    EXPECT_EQ(&resource, pool.acquire(desc2D));
+    EXPECT_EQ(desc2D.bytes, pool.getInUseBytes());
+    EXPECT_EQ(0u, pool.getFreeBytes());
+    EXPECT_EQ(nullptr, pool.acquire(desc2D));
+
+    pool.recycle(desc2D, &resource);
+    pool.trim();
+    EXPECT_EQ(0, resource.references);
+    EXPECT_EQ(0u, pool.getResidentBytes());
+}
+
+TEST(StagingPoolTest, ReleasesOldestOverBudget)
+{
+    StagingDesc desc = MakeDesc(GL_TEXTURE_2D, 32, 32, 1, 4);
+    StagingPool<MockResource> pool(desc.bytes * 2);
+
+    MockResource resources[3];
+    for (size_t i = 0; i < 3; i++)
+    {
+        pool.addResource(desc);
+    }
+    EXPECT_EQ(desc.bytes * 3, pool.getResidentBytes());
+
+    for (size_t i = 0; i < 3; i++)
+    {
+        pool.recycle(desc, &resources[i]);
+    }
+
+    // The first one recycled no longer fits in the budget
+    EXPECT_EQ(0, resources[0].references);
+    EXPECT_EQ(1, resources[1].references);
+    EXPECT_EQ(1, resources[2].references);
+    EXPECT_EQ(desc.bytes * 2, pool.getResidentBytes());
+
+    // The most recently recycled is handed out first
+    EXPECT_EQ(&resources[2], pool.acquire(desc));
+    EXPECT_EQ(&resources[1], pool.acquire(desc));
+}
+
+// A resource larger than the whole budget isn't kept
+TEST(StagingPoolTest, LargeResourcesAreReleased)
+{
+    StagingDesc desc = MakeDesc(GL_TEXTURE_3D, 64, 64, 64, 4);
+    StagingPool<MockResource> pool(desc.bytes - 1);
+
+    MockResource resource;
+    pool.addResource(desc);
+    pool.recycle(desc, &resource);
+    EXPECT_EQ(0, resource.references);
+    EXPECT_EQ(0u, pool.getResidentBytes());
+}
+
+TEST(StagingPoolTest, DestructorReleasesFreeResources)
+{
+    StagingDesc desc = MakeDesc(GL_TEXTURE_2D, 8, 8, 1, 4);
+    MockResource resource;
+    {
+        StagingPool<MockResource> pool(1024);
+        pool.addResource(desc);
+        pool.recycle(desc, &resource);
+    }
+    EXPECT_EQ(0, resource.references);
+}
+
+}
@@ -0,0 +1,147 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// UniformStorageD3D_unittest.cpp: Unit tests that the shadow registers of a shader stage only mark
+// the registers whose values change, rounded out to whole registers.
+
+#include <cstring>
+
+#include "gtest/gtest.h"
+
+#include "libANGLE/renderer/d3d/ShaderExecutableD3D.h"
+
+using namespace rx;
+
+namespace
+{
+
+const size_t RegisterSize = 16;
+
+TEST(UniformStorageD3DTest, StartsClean)
+{
+    UniformStorageD3D storage(8 * RegisterSize);
+    EXPECT_EQ(8 * RegisterSize, storage.size());
+    EXPECT_FALSE(storage.isDirty());
+
+    for (size_t byte = 0; byte < storage.size(); byte++)
+    {
+        EXPECT_EQ(0u, storage.getShadowData()[byte]);
+    }
+}
+
+TEST(UniformStorageD3DTest, MarksWholeRegisters)
+{
+    UniformStorageD3D storage(8 * RegisterSize);
+
+    const float value = 2.0f;
+    EXPECT_TRUE(storage.setData(3 * RegisterSize + 2 * sizeof(float), &value, sizeof(value)));
+    EXPECT_TRUE(storage.isDirty());
+    EXPECT_EQ(3 * RegisterSize, storage.getDirtyBegin());
+    EXPECT_EQ(4 * RegisterSize, storage.getDirtyEnd());
+    EXPECT_EQ(0, memcmp(storage.getShadowData() + 3 * RegisterSize + 2 * sizeof(float), &value, sizeof(value)));
+
+    // Later changes widen the range to cover both
+    const float values[] = { 1.0f, 0.0f, 0.0f, 0.0f, 5.0f, 0.0f, 0.0f, 0.0f };
+    EXPECT_TRUE(storage.setData(5 * RegisterSize, values, sizeof(values)));
+    EXPECT_EQ(3 * RegisterSize, storage.getDirtyBegin());
+    EXPECT_EQ(7 * RegisterSize, storage.getDirtyEnd());
+
+    storage.markClean();
+    EXPECT_FALSE(storage.isDirty());
+}
+
+// Setting the values the registers already hold leaves them clean
+TEST(UniformStorageD3DTest, SkipsUnchangedValues)
+{
+    UniformStorageD3D storage(4 * RegisterSize);
+
+    const float values[] = { 1.0f, 2.0f, 3.0f, 4.0f };
+    EXPECT_TRUE(storage.setData(RegisterSize, values, sizeof(values)));
+    storage.markClean();
+
+    EXPECT_FALSE(storage.setData(RegisterSize, values, sizeof(values)));
+    EXPECT_FALSE(storage.isDirty());
+
+    const float zeros[4] = {};
+    EXPECT_FALSE(storage.setData(2 * RegisterSize, zeros, sizeof(zeros)));
+    EXPECT_FALSE(storage.setData(0, values, 0));
+    EXPECT_FALSE(storage.isDirty());
+}
+
+// Setting a whole array to change one element only marks the registers of that element
+TEST(UniformStorageD3DTest, MarksOnlyChangedElements)
+{
+    const size_t elementCount = 16;
+    UniformStorageD3D storage(elementCount * RegisterSize);
+
+    float values[elementCount][4];
+    for (size_t element = 0; element < elementCount; element++)
+    {
+        values[element][0] = static_cast<float>(element);
+        values[element][1] = 1.0f;
+        values[element][2] = 0.0f;
+        values[element][3] = 0.0f;
+    }
+    EXPECT_TRUE(storage.setData(0, values, sizeof(values)));
+    EXPECT_EQ(0u, storage.getDirtyBegin());
+    EXPECT_EQ(elementCount * RegisterSize, storage.getDirtyEnd());
+    storage.markClean();
+
+    values[9][2] = 7.0f;
+    values[10][0] = -1.0f;
+    EXPECT_TRUE(storage.setData(0, values, sizeof(values)));
+    EXPECT_EQ(9 * RegisterSize, storage.getDirtyBegin());
+    EXPECT_EQ(11 * RegisterSize, storage.getDirtyEnd());
+    EXPECT_EQ(0, memcmp(storage.getShadowData(), values, sizeof(values)));
+}
+
+// Setting a struct member leaves alone the members packed into the rest of its registers, as in
+// struct { float a; vec2 b; } where b is in the y and z components of a's register
+TEST(UniformStorageD3DTest, KeepsPackedMembers)
+{
+    UniformStorageD3D storage(4 * RegisterSize);
+
+    const float b[] = { 3.0f, 4.0f, 0.0f, 0.0f };
+    EXPECT_TRUE(storage.setRegisters(RegisterSize + sizeof(float), b, 1, 2));
+
+    const float a[] = { 1.0f, 0.0f, 0.0f, 0.0f };
+    EXPECT_TRUE(storage.setRegisters(RegisterSize, a, 1, 1));
+
+    const float packed[] = { 1.0f, 3.0f, 4.0f, 0.0f };
+    EXPECT_EQ(0, memcmp(storage.getShadowData() + RegisterSize, packed, sizeof(packed)));
+    storage.markClean();
+
+    EXPECT_FALSE(storage.setRegisters(RegisterSize, a, 1, 1));
+    EXPECT_FALSE(storage.isDirty());
+
+    // Each register of an array or matrix keeps the components after the ones it uses
+    const float rows[] = { 5.0f, 6.0f, 0.0f, 0.0f, 7.0f, 8.0f, 0.0f, 0.0f };
+    const float z = 9.0f;
+    EXPECT_TRUE(storage.setData(2 * RegisterSize + 2 * sizeof(float), &z, sizeof(z)));
+    EXPECT_TRUE(storage.setRegisters(2 * RegisterSize, rows, 2, 2));
+    EXPECT_EQ(z, reinterpret_cast<const float*>(storage.getShadowData() + 2 * RegisterSize)[2]);
+    EXPECT_EQ(8.0f, reinterpret_cast<const float*>(storage.getShadowData() + 3 * RegisterSize)[1]);
+    EXPECT_EQ(2 * RegisterSize, storage.getDirtyBegin());
+    EXPECT_EQ(4 * RegisterSize, storage.getDirtyEnd());
+}
+
+TEST(UniformStorageD3DTest, MarkDirtyStaysInStorage)
+{
+    UniformStorageD3D storage(4 * RegisterSize);
+    storage.markDirty(2 * RegisterSize + 4, 3 * RegisterSize);
+    EXPECT_EQ(2 * RegisterSize, storage.getDirtyBegin());
+    EXPECT_EQ(4 * RegisterSize, storage.getDirtyEnd());
+
+    storage.markDirty(RegisterSize, 0);
+    EXPECT_EQ(2 * RegisterSize, storage.getDirtyBegin());
+
+    // Stages without uniforms have nothing to upload
+    UniformStorageD3D emptyStorage(0);
+    emptyStorage.markDirty(0, RegisterSize);
+    EXPECT_FALSE(emptyStorage.isDirty());
+}
+
+}
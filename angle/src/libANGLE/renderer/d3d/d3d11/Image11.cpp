@@ -23,6 +23,30 @@
 namespace rx
 {
 
+namespace
+{
+
+size_t ComputeStagingTextureBytes(const StagingDesc &desc)
+{
+    const d3d11::DXGIFormat &dxgiFormatInfo = d3d11::GetDXGIFormatInfo(static_cast<DXGI_FORMAT>(desc.format));
+
+    size_t bytes = 0;
+    for (GLsizei level = 0; level < desc.levels; level++)
+    {
+        size_t levelWidth = std::max(desc.width >> level, 1);
+        size_t levelHeight = std::max(desc.height >> level, 1);
+        size_t levelDepth = std::max(desc.depth >> level, 1);
+
+        size_t blocksWide = (levelWidth + dxgiFormatInfo.blockWidth - 1) / dxgiFormatInfo.blockWidth;
+        size_t blocksHigh = (levelHeight + dxgiFormatInfo.blockHeight - 1) / dxgiFormatInfo.blockHeight;
+        bytes += blocksWide * blocksHigh * levelDepth * dxgiFormatInfo.pixelBytes;
+    }
+
+    return bytes;
+}
+
+}
+
 Image11::Image11(Renderer11 *renderer)
     : mRenderer(renderer),
       mDXGIFormat(DXGI_FORMAT_UNKNOWN),
@@ -177,16 +201,31 @@ gl::Error Image11::copyToStorage(TextureStorage *storage, const gl::ImageIndex &
     // Once the image data has been copied into the Storage, we can release it locally.
     if (attemptToReleaseStagingTexture)
     {
-        storage11->associateImage(this, index);
-        releaseStagingTexture();
-        mRecoverFromStorage = true;
-        mAssociatedStorage = storage11;
-        mAssociatedImageIndex = index;
+        releaseStagingTextureToStorage(storage11, index);
     }
 
     return gl::Error(GL_NO_ERROR);
 }
 
+void Image11::releaseStagingTextureToStorage(TextureStorage11 *storage11, const gl::ImageIndex &index)
+{
+    // Already recovering its data from the storage
+    if (mRecoverFromStorage)
+    {
+        ASSERT(mAssociatedStorage == storage11);
+        return;
+    }
+
+    storage11->associateImage(this, index);
+    releaseStagingTexture();
+    mRecoverFromStorage = true;
+    mAssociatedStorage = storage11;
+    mAssociatedImageIndex = index;
+
+    // The storage holds all the data of the image now
+    mDirty = false;
+}
+
 bool Image11::isAssociatedStorageValid(TextureStorage11* textureStorage) const
 {
     return (mAssociatedStorage == textureStorage);
@@ -360,9 +399,9 @@ gl::Error Image11::loadData(const gl::Box &area, const gl::PixelUnpackState &unp
     }
 
     uint8_t *offsetMappedData = (reinterpret_cast<uint8_t*>(mappedImage.pData) + (area.y * mappedImage.RowPitch + area.x * outputPixelSize + area.z * mappedImage.DepthPitch));
-    loadFunction(area.width, area.height, area.depth,
-                 reinterpret_cast<const uint8_t*>(input), inputRowPitch, inputDepthPitch,
-                 offsetMappedData, mappedImage.RowPitch, mappedImage.DepthPitch);
+    LoadImageParallel(loadFunction, 1, 1, area.width, area.height, area.depth,
+                      reinterpret_cast<const uint8_t*>(input), inputRowPitch, inputDepthPitch,
+                      offsetMappedData, mappedImage.RowPitch, mappedImage.DepthPitch);
 
     unmap();
 
@@ -397,9 +436,11 @@ gl::Error Image11::loadCompressedData(const gl::Box &area, const void *input)
                                                                            (area.x / outputBlockWidth) * outputPixelSize +
                                                                            area.z * mappedImage.DepthPitch);
 
-    loadFunction(area.width, area.height, area.depth,
-                 reinterpret_cast<const uint8_t*>(input), inputRowPitch, inputDepthPitch,
-                 offsetMappedData, mappedImage.RowPitch, mappedImage.DepthPitch);
+    // Formats without native support are decoded, into one output row per pixel row
+    LoadImageParallel(loadFunction, formatInfo.compressedBlockHeight, outputBlockHeight,
+                      area.width, area.height, area.depth,
+                      reinterpret_cast<const uint8_t*>(input), inputRowPitch, inputDepthPitch,
+                      offsetMappedData, mappedImage.RowPitch, mappedImage.DepthPitch);
 
     unmap();
 
@@ -598,7 +639,13 @@ gl::Error Image11::getStagingTexture(ID3D11Resource **outStagingTexture, unsigne
 
 void Image11::releaseStagingTexture()
 {
-    SafeRelease(mStagingTexture);
+    if (mStagingTexture)
+    {
+        // Keep the texture for the next image of the same description, instead of creating one
+        mRenderer->getStagingTexturePool()->recycle(mStagingDesc, mStagingTexture);
+        mStagingTexture = NULL;
+        mRenderer->traceStagingTextureBytes();
+    }
 }
 
 gl::Error Image11::createStagingTexture()
@@ -622,6 +669,34 @@ gl::Error Image11::createStagingTexture()
     // adjust size if needed for compressed textures
     d3d11::MakeValidSize(false, dxgiFormat, &width, &height, &lodOffset);
 
+    StagingDesc stagingDesc;
+    stagingDesc.target = (mTarget == GL_TEXTURE_3D ? GL_TEXTURE_3D : GL_TEXTURE_2D);
+    stagingDesc.format = dxgiFormat;
+    stagingDesc.width = width;
+    stagingDesc.height = height;
+    stagingDesc.depth = (mTarget == GL_TEXTURE_3D ? mDepth : 1);
+    stagingDesc.levels = lodOffset + 1;
+    stagingDesc.bytes = ComputeStagingTextureBytes(stagingDesc);
+
+    StagingPool<ID3D11Resource> *stagingPool = mRenderer->getStagingTexturePool();
+    ID3D11Resource *recycledTexture = stagingPool->acquire(stagingDesc);
+    if (recycledTexture)
+    {
+        mStagingTexture = recycledTexture;
+        mStagingSubresource = D3D11CalcSubresource(lodOffset, 0, lodOffset + 1);
+        mStagingDesc = stagingDesc;
+        mRenderer->traceStagingTextureBytes();
+
+        gl::Error error = clearRecycledStagingTexture();
+        if (error.isError())
+        {
+            return error;
+        }
+
+        mDirty = false;
+        return gl::Error(GL_NO_ERROR);
+    }
+
     if (mTarget == GL_TEXTURE_3D)
     {
         ID3D11Texture3D *newTexture = NULL;
@@ -705,10 +780,55 @@ gl::Error Image11::createStagingTexture()
         UNREACHABLE();
     }
 
+    mStagingDesc = stagingDesc;
+    stagingPool->addResource(stagingDesc);
+    mRenderer->traceStagingTextureBytes();
+
     mDirty = false;
     return gl::Error(GL_NO_ERROR);
 }
 
+gl::Error Image11::clearRecycledStagingTexture()
+{
+    ASSERT(mStagingTexture);
+
+    ID3D11DeviceContext *deviceContext = mRenderer->getDeviceContext();
+
+    D3D11_MAPPED_SUBRESOURCE mappedImage;
+    HRESULT result = deviceContext->Map(mStagingTexture, mStagingSubresource, D3D11_MAP_WRITE, 0, &mappedImage);
+    if (FAILED(result))
+    {
+        if (d3d11::isDeviceLostError(result))
+        {
+            mRenderer->notifyDeviceLost();
+        }
+        return gl::Error(GL_OUT_OF_MEMORY, "Failed to map staging texture, result: 0x%X.", result);
+    }
+
+    // The texture still holds the data of the image that used it before, so it is given the same
+    // contents as a newly created texture
+    uint8_t *data = reinterpret_cast<uint8_t*>(mappedImage.pData);
+    const d3d11::TextureFormat &formatInfo = d3d11::GetTextureFormatInfo(mInternalFormat, mRenderer->getRenderer11DeviceCaps(), false);
+    if (formatInfo.dataInitializerFunction != NULL)
+    {
+        formatInfo.dataInitializerFunction(mWidth, mHeight, mDepth, data, mappedImage.RowPitch, mappedImage.DepthPitch);
+    }
+    else
+    {
+        const d3d11::DXGIFormat &dxgiFormatInfo = d3d11::GetDXGIFormatInfo(mDXGIFormat);
+        size_t blockRows = (mHeight + dxgiFormatInfo.blockHeight - 1) / dxgiFormatInfo.blockHeight;
+        size_t rowBytes = ((mWidth + dxgiFormatInfo.blockWidth - 1) / dxgiFormatInfo.blockWidth) * dxgiFormatInfo.pixelBytes;
+        for (GLsizei z = 0; z < mDepth; z++)
+        {
+            memset(data + z * mappedImage.DepthPitch, 0, (blockRows - 1) * mappedImage.RowPitch + rowBytes);
+        }
+    }
+
+    deviceContext->Unmap(mStagingTexture, mStagingSubresource);
+
+    return gl::Error(GL_NO_ERROR);
+}
+
 gl::Error Image11::map(D3D11_MAP mapType, D3D11_MAPPED_SUBRESOURCE *map)
 {
     // We must recover from the TextureStorage if necessary, even for D3D11_MAP_WRITE.
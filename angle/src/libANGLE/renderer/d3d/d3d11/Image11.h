@@ -12,6 +12,7 @@
 
 #include "libANGLE/renderer/d3d/ImageD3D.h"
 #include "libANGLE/ImageIndex.h"
+#include "libANGLE/renderer/d3d/StagingPool.h"
 #include "libANGLE/renderer/d3d/formatutilsD3D.h"
 #include "common/debug.h"
 
@@ -52,6 +53,10 @@ class Image11 : public ImageD3D
     bool isAssociatedStorageValid(TextureStorage11* textureStorage) const;
     void disassociateStorage();
 
+    // Called after the storage was written directly with data for this image. The staging texture
+    // is given back, and the data is recovered from the storage if it is ever needed again.
+    void releaseStagingTextureToStorage(TextureStorage11 *storage11, const gl::ImageIndex &index);
+
   protected:
     gl::Error map(D3D11_MAP mapType, D3D11_MAPPED_SUBRESOURCE *map);
     void unmap();
@@ -69,6 +74,7 @@ class Image11 : public ImageD3D
 
     gl::Error getStagingTexture(ID3D11Resource **outStagingTexture, unsigned int *outSubresourceIndex);
     gl::Error createStagingTexture();
+    gl::Error clearRecycledStagingTexture();
     void releaseStagingTexture();
 
     Renderer11 *mRenderer;
@@ -76,6 +82,7 @@ class Image11 : public ImageD3D
     DXGI_FORMAT mDXGIFormat;
     ID3D11Resource *mStagingTexture;
     unsigned int mStagingSubresource;
+    StagingDesc mStagingDesc;
 
     bool mRecoverFromStorage;
     TextureStorage11 *mAssociatedStorage;
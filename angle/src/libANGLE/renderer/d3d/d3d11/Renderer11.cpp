@@ -94,6 +94,9 @@ enum
     MAX_TEXTURE_IMAGE_UNITS_VTF_SM4 = 16
 };
 
+// Staging textures that no image holds are kept up to this size, to be recycled
+static const size_t MaxFreeStagingTextureBytes = 8 * 1024 * 1024;
+
 bool ImageIndexConflictsWithSRV(const gl::ImageIndex &index, D3D11_SHADER_RESOURCE_VIEW_DESC desc)
 {
     unsigned mipLevel = index.mipIndex;
@@ -209,6 +212,7 @@ ANGLEFeatureLevel GetANGLEFeatureLevel(D3D_FEATURE_LEVEL d3dFeatureLevel)
 Renderer11::Renderer11(egl::Display *display)
     : RendererD3D(display),
       mStateCache(this),
+      mStagingTexturePool(MaxFreeStagingTextureBytes),
       mDebug(nullptr)
 {
     // Initialize global annotator
@@ -2053,31 +2057,8 @@ gl::Error Renderer11::applyShaders(gl::Program *program, const gl::VertexFormat
     return gl::Error(GL_NO_ERROR);
 }
 
-gl::Error Renderer11::applyUniforms(const ProgramImpl &program, const std::vector<gl::LinkedUniform*> &uniformArray)
+gl::Error Renderer11::applyUniforms(const ProgramImpl &program)
 {
-    unsigned int totalRegisterCountVS = 0;
-    unsigned int totalRegisterCountPS = 0;
-
-    bool vertexUniformsDirty = false;
-    bool pixelUniformsDirty = false;
-
-    for (size_t uniformIndex = 0; uniformIndex < uniformArray.size(); uniformIndex++)
-    {
-        const gl::LinkedUniform &uniform = *uniformArray[uniformIndex];
-
-        if (uniform.isReferencedByVertexShader() && !uniform.isSampler())
-        {
-            totalRegisterCountVS += uniform.registerCount;
-            vertexUniformsDirty = (vertexUniformsDirty || uniform.dirty);
-        }
-
-        if (uniform.isReferencedByFragmentShader() && !uniform.isSampler())
-        {
-            totalRegisterCountPS += uniform.registerCount;
-            pixelUniformsDirty = (pixelUniformsDirty || uniform.dirty);
-        }
-    }
-
     const ProgramD3D *programD3D = GetAs<ProgramD3D>(&program);
     const UniformStorage11 *vertexUniformStorage = GetAs<UniformStorage11>(&programD3D->getVertexUniformStorage());
     const UniformStorage11 *fragmentUniformStorage = GetAs<UniformStorage11>(&programD3D->getFragmentUniformStorage());
@@ -2087,57 +2068,25 @@ gl::Error Renderer11::applyUniforms(const ProgramImpl &program, const std::vecto
     ID3D11Buffer *vertexConstantBuffer = vertexUniformStorage->getConstantBuffer();
     ID3D11Buffer *pixelConstantBuffer = fragmentUniformStorage->getConstantBuffer();
 
-    float (*mapVS)[4] = NULL;
-    float (*mapPS)[4] = NULL;
-
-    if (totalRegisterCountVS > 0 && vertexUniformsDirty)
+    // Mapping with WRITE_DISCARD drops the previous contents, so the whole shadow copy of the
+    // registers is written even when only a few of them changed.
+    if (vertexUniformStorage->isDirty())
     {
         D3D11_MAPPED_SUBRESOURCE map = {0};
         HRESULT result = mDeviceContext->Map(vertexConstantBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &map);
         UNUSED_ASSERTION_VARIABLE(result);
         ASSERT(SUCCEEDED(result));
-        mapVS = (float(*)[4])map.pData;
+        memcpy(map.pData, vertexUniformStorage->getShadowData(), vertexUniformStorage->size());
+        mDeviceContext->Unmap(vertexConstantBuffer, 0);
     }
 
-    if (totalRegisterCountPS > 0 && pixelUniformsDirty)
+    if (fragmentUniformStorage->isDirty())
     {
         D3D11_MAPPED_SUBRESOURCE map = {0};
         HRESULT result = mDeviceContext->Map(pixelConstantBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &map);
         UNUSED_ASSERTION_VARIABLE(result);
         ASSERT(SUCCEEDED(result));
-        mapPS = (float(*)[4])map.pData;
-    }
-
-    for (size_t uniformIndex = 0; uniformIndex < uniformArray.size(); uniformIndex++)
-    {
-        gl::LinkedUniform *uniform = uniformArray[uniformIndex];
-
-        if (!uniform->isSampler())
-        {
-            unsigned int componentCount = (4 - uniform->registerElement);
-
-            // we assume that uniforms from structs are arranged in struct order in our uniforms list. otherwise we would
-            // overwrite previously written regions of memory.
-
-            if (uniform->isReferencedByVertexShader() && mapVS)
-            {
-                memcpy(&mapVS[uniform->vsRegisterIndex][uniform->registerElement], uniform->data, uniform->registerCount * sizeof(float) * componentCount);
-            }
-
-            if (uniform->isReferencedByFragmentShader() && mapPS)
-            {
-                memcpy(&mapPS[uniform->psRegisterIndex][uniform->registerElement], uniform->data, uniform->registerCount * sizeof(float) * componentCount);
-            }
-        }
-    }
-
-    if (mapVS)
-    {
-        mDeviceContext->Unmap(vertexConstantBuffer, 0);
-    }
-
-    if (mapPS)
-    {
+        memcpy(map.pData, fragmentUniformStorage->getShadowData(), fragmentUniformStorage->size());
         mDeviceContext->Unmap(pixelConstantBuffer, 0);
     }
 
@@ -2308,6 +2257,7 @@ void Renderer11::releaseDeviceResources()
 {
     mStateCache.clear();
     mInputLayoutCache.clear();
+    trimStagingTextures();
 
     SafeDelete(mVertexDataManager);
     SafeDelete(mIndexDataManager);
@@ -2323,6 +2273,19 @@ void Renderer11::releaseDeviceResources()
     SafeRelease(mSyncQuery);
 }
 
+void Renderer11::traceStagingTextureBytes() const
+{
+    TRACE_COUNTER2("gpu.angle", "Renderer11::StagingTextureBytes",
+                   "InUse", mStagingTexturePool.getInUseBytes(),
+                   "Free", mStagingTexturePool.getFreeBytes());
+}
+
+void Renderer11::trimStagingTextures()
+{
+    mStagingTexturePool.trim();
+    traceStagingTextureBytes();
+}
+
 // set notify to true to broadcast a message to all contexts of the device loss
 bool Renderer11::testDeviceLost()
 {
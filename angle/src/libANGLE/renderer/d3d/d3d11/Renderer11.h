@@ -16,6 +16,7 @@
 #include "libANGLE/renderer/d3d/HLSLCompiler.h"
 #include "libANGLE/renderer/d3d/RendererD3D.h"
 #include "libANGLE/renderer/d3d/RenderTargetD3D.h"
+#include "libANGLE/renderer/d3d/StagingPool.h"
 #include "libANGLE/renderer/d3d/d3d11/DebugAnnotator11.h"
 #include "libANGLE/renderer/d3d/d3d11/InputLayoutCache.h"
 #include "libANGLE/renderer/d3d/d3d11/RenderStateCache.h"
@@ -133,7 +134,7 @@ class Renderer11 : public RendererD3D
     virtual gl::Error applyShaders(gl::Program *program, const gl::VertexFormat inputLayout[], const gl::Framebuffer *framebuffer,
                                    bool rasterizerDiscard, bool transformFeedbackActive);
 
-    virtual gl::Error applyUniforms(const ProgramImpl &program, const std::vector<gl::LinkedUniform*> &uniformArray);
+    virtual gl::Error applyUniforms(const ProgramImpl &program);
     virtual gl::Error applyVertexBuffer(const gl::State &state, GLenum mode, GLint first, GLsizei count, GLsizei instances);
     virtual gl::Error applyIndexBuffer(const GLvoid *indices, gl::Buffer *elementArrayBuffer, GLsizei count, GLenum mode, GLenum type, TranslatedIndexData *indexInfo);
     void applyTransformFeedbackBuffers(const gl::State &state) override;
@@ -240,6 +241,12 @@ class Renderer11 : public RendererD3D
     Blit11 *getBlitter() { return mBlit; }
     Clear11 *getClearer() { return mClear; }
 
+    // Staging textures of the images, recycled between them. The bytes held by images and
+    // waiting in the pool are recorded as a trace counter whenever they change.
+    StagingPool<ID3D11Resource> *getStagingTexturePool() { return &mStagingTexturePool; }
+    void traceStagingTextureBytes() const;
+    void trimStagingTextures();
+
     // Buffer-to-texture and Texture-to-buffer copies
     virtual bool supportsFastCopyBufferToTexture(GLenum internalFormat) const;
     virtual gl::Error fastCopyBufferToTexture(const gl::PixelUnpackState &unpack, unsigned int offset, RenderTargetD3D *destRenderTarget,
@@ -416,6 +423,8 @@ class Renderer11 : public RendererD3D
     // Perform trim for D3D resources
     Trim11 *mTrim;
 
+    StagingPool<ID3D11Resource> mStagingTexturePool;
+
     // Sync query
     ID3D11Query *mSyncQuery;
 
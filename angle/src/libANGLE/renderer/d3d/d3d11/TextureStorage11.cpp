@@ -23,6 +23,7 @@
 #include "libANGLE/renderer/d3d/d3d11/SwapChain11.h"
 #include "libANGLE/renderer/d3d/d3d11/formatutils11.h"
 #include "libANGLE/renderer/d3d/d3d11/renderer11_utils.h"
+#include "libANGLE/renderer/d3d/loadimage.h"
 
 namespace rx
 {
@@ -593,10 +594,32 @@ gl::Error TextureStorage11::copyToStorage(TextureStorage *destStorage)
 gl::Error TextureStorage11::setData(const gl::ImageIndex &index, ImageD3D *image, const gl::Box *destBox, GLenum type,
                                     const gl::PixelUnpackState &unpack, const uint8_t *pixelData)
 {
-    ASSERT(!image->isDirty());
+    Image11 *image11 = GetAs<Image11>(image);
+
+    gl::Box levelBox(0, 0, 0, getLevelWidth(index.mipIndex), getLevelHeight(index.mipIndex), getLevelDepth(index.mipIndex));
+    bool fullUpdate = (destBox == NULL || *destBox == levelBox);
+
+    // The staging texture of the image is dropped below, so data it holds that the storage doesn't
+    // have yet must be copied first, unless all of it is about to be overwritten
+    gl::Error error(GL_NO_ERROR);
+    if (image11->isDirty() && !fullUpdate)
+    {
+        error = image11->copyToStorage(this, index, levelBox);
+        if (error.isError())
+        {
+            return error;
+        }
+    }
+
+    // If another image relies on this storage for its data, it must recover it before it is overwritten
+    error = releaseAssociatedImage(index, image11);
+    if (error.isError())
+    {
+        return error;
+    }
 
     ID3D11Resource *resource = NULL;
-    gl::Error error = getResource(&resource);
+    error = getResource(&resource);
     if (error.isError())
     {
         return error;
@@ -607,8 +630,6 @@ gl::Error TextureStorage11::setData(const gl::ImageIndex &index, ImageD3D *image
 
     const gl::InternalFormat &internalFormatInfo = gl::GetInternalFormatInfo(image->getInternalFormat());
 
-    gl::Box levelBox(0, 0, 0, getLevelWidth(index.mipIndex), getLevelHeight(index.mipIndex), getLevelDepth(index.mipIndex));
-    bool fullUpdate = (destBox == NULL || *destBox == levelBox);
     ASSERT(internalFormatInfo.depthBits == 0 || fullUpdate);
 
     // TODO(jmadill): Handle compressed formats
@@ -642,9 +663,9 @@ gl::Error TextureStorage11::setData(const gl::ImageIndex &index, ImageD3D *image
 
     // TODO: fast path
     LoadImageFunction loadFunction = d3d11Format.loadFunctions.at(type);
-    loadFunction(width, height, depth,
-                 pixelData, srcRowPitch, srcDepthPitch,
-                 conversionBuffer->data(), bufferRowPitch, bufferDepthPitch);
+    LoadImageParallel(loadFunction, 1, 1, width, height, depth,
+                      pixelData, srcRowPitch, srcDepthPitch,
+                      conversionBuffer->data(), bufferRowPitch, bufferDepthPitch);
 
     ID3D11DeviceContext *immediateContext = mRenderer->getDeviceContext();
 
@@ -671,6 +692,10 @@ gl::Error TextureStorage11::setData(const gl::ImageIndex &index, ImageD3D *image
                                             bufferRowPitch, bufferDepthPitch);
     }
 
+    // The data was uploaded without going through the staging texture of the image, which would
+    // now be out of date. It doesn't need to stay resident, since the storage holds all the data.
+    image11->releaseStagingTextureToStorage(this, index);
+
     return gl::Error(GL_NO_ERROR);
 }
 
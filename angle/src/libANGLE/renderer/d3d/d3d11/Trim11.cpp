@@ -39,6 +39,9 @@ void Trim11::trim()
         return;
     }
 
+    // The recycled staging textures are only kept to speed up the next uploads
+    mRenderer->trimStagingTextures();
+
 #if defined (ANGLE_ENABLE_WINDOWS_STORE)
     ID3D11Device* device = mRenderer->getDevice();
     // IDXGIDevice3 is only supported on Windows 8.1 and Windows Phone 8.1 and above.
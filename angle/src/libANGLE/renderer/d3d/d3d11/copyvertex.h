@@ -10,6 +10,7 @@
 #define LIBANGLE_RENDERER_D3D_D3D11_COPYVERTEX_H_
 
 #include "common/mathutil.h"
+#include "libANGLE/renderer/d3d/formatutilsD3D.h"
 
 namespace rx
 {
@@ -33,6 +34,29 @@ inline void CopyTo32FVertexData(const uint8_t *input, size_t stride, size_t coun
 template <bool isSigned, bool normalized, bool toFloat>
 inline void CopyXYZ10W2ToXYZW32FVertexData(const uint8_t *input, size_t stride, size_t count, uint8_t *output);
 
+// Calls the preferred copy function when the predicate holds, for example when the CPU supports the
+// instructions it uses, and the fallback otherwise.
+template <FallbackPredicateFunction pred, VertexCopyFunction prefered, VertexCopyFunction fallback>
+inline void FallbackVertexCopy(const uint8_t *input, size_t stride, size_t count, uint8_t *output);
+
+// The SSE2 functions convert the four components at the start of a vertex at once, and give the
+// same results as the templates above. The last vertices, whose four components could run past
+// the end of the input or output, are copied by the templates.
+
+// Same as CopyNativeVertexData<T, 3, 4, alphaDefaultValueBits>
+template <typename T, uint32_t alphaDefaultValueBits>
+void CopyXYZToXYZWVertexData_SSE2(const uint8_t *input, size_t stride, size_t count, uint8_t *output);
+
+template <size_t inputComponentCount, size_t outputComponentCount>
+void Copy8SnormTo16SnormVertexData_SSE2(const uint8_t *input, size_t stride, size_t count, uint8_t *output);
+
+template <size_t inputComponentCount, size_t outputComponentCount>
+void Copy32FixedTo32FVertexData_SSE2(const uint8_t *input, size_t stride, size_t count, uint8_t *output);
+
+// T is GLushort or GLint.
+template <typename T, size_t inputComponentCount, size_t outputComponentCount, bool normalized>
+void CopyTo32FVertexData_SSE2(const uint8_t *input, size_t stride, size_t count, uint8_t *output);
+
 }
 
 #include "copyvertex.inl"
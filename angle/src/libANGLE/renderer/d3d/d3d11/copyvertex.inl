@@ -374,4 +374,17 @@ inline void CopyXYZ10W2ToXYZW32FVertexData(const uint8_t *input, size_t stride,
     }
 }
 
+template <FallbackPredicateFunction pred, VertexCopyFunction prefered, VertexCopyFunction fallback>
+inline void FallbackVertexCopy(const uint8_t *input, size_t stride, size_t count, uint8_t *output)
+{
+    if (pred())
+    {
+        prefered(input, stride, count, output);
+    }
+    else
+    {
+        fallback(input, stride, count, output);
+    }
+}
+
 }
@@ -0,0 +1,325 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// copyvertexSSE2.cpp: Defines vertex copy and conversion functions that use SSE2. It's
+// in a separated file for GCC, which can enable SSE usage only per-file,
+// not for code blocks that use SSE2 explicitly.
+
+#include "libANGLE/renderer/d3d/d3d11/copyvertex.h"
+
+#include "common/platform.h"
+
+#ifdef ANGLE_USE_SSE
+#include <emmintrin.h>
+#endif
+
+namespace rx
+{
+
+#if defined(ANGLE_USE_SSE)
+namespace
+{
+
+// Returns the number of vertices, from the first one, whose first four components can be read
+// from the input and written to the output without running past the end of either.
+template <typename T, size_t inputComponentCount, size_t outputComponentSize, size_t outputComponentCount>
+inline size_t CountWholeVectorVertices(size_t stride, size_t count)
+{
+    const size_t inputEnd = (count > 0) ? (count - 1) * stride + inputComponentCount * sizeof(T) : 0;
+    const size_t outputEnd = count * outputComponentCount * outputComponentSize;
+    const size_t vectorInputSize = 4 * sizeof(T);
+    const size_t vectorOutputSize = 4 * outputComponentSize;
+
+    if (inputEnd < vectorInputSize || outputEnd < vectorOutputSize)
+    {
+        return 0;
+    }
+
+    size_t vertices = (outputEnd - vectorOutputSize) / (outputComponentCount * outputComponentSize) + 1;
+    if (stride > 0)
+    {
+        vertices = std::min(vertices, (inputEnd - vectorInputSize) / stride + 1);
+    }
+    return std::min(vertices, count);
+}
+
+// Loads the four components at input into 32 bit lanes.
+template <typename T>
+inline __m128i LoadComponents(const uint8_t *input);
+
+template <>
+inline __m128i LoadComponents<GLushort>(const uint8_t *input)
+{
+    __m128i components = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(input));
+    return _mm_unpacklo_epi16(components, _mm_setzero_si128());
+}
+
+template <>
+inline __m128i LoadComponents<GLint>(const uint8_t *input)
+{
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(input));
+}
+
+// Mask of the lanes of the components that are read from the input
+template <size_t inputComponentCount>
+inline __m128i InputComponentMask()
+{
+    return _mm_set_epi32(inputComponentCount > 3 ? -1 : 0, inputComponentCount > 2 ? -1 : 0,
+                         inputComponentCount > 1 ? -1 : 0, -1);
+}
+
+// Converts the components the same way as CopyTo32FVertexData
+template <typename T, bool normalized>
+struct ConvertTo32F
+{
+    static __m128 convert(__m128i components)
+    {
+        typedef std::numeric_limits<T> NL;
+
+        __m128 values = _mm_cvtepi32_ps(components);
+        if (normalized)
+        {
+            if (NL::is_signed)
+            {
+                const float divisor = 1.0f / (2 * static_cast<float>(NL::max()) + 1);
+                values = _mm_add_ps(_mm_add_ps(values, values), _mm_set1_ps(1.0f));
+                return _mm_mul_ps(values, _mm_set1_ps(divisor));
+            }
+            else
+            {
+                return _mm_div_ps(values, _mm_set1_ps(static_cast<float>(NL::max())));
+            }
+        }
+        return values;
+    }
+};
+
+// Converts the components the same way as Copy32FixedTo32FVertexData
+struct ConvertFixedTo32F
+{
+    static __m128 convert(__m128i components)
+    {
+        return _mm_mul_ps(_mm_cvtepi32_ps(components), _mm_set1_ps(1.0f / (1 << 16)));
+    }
+};
+
+// Converts the vertices to floats four components at a time. Tightly packed vertices that are
+// copied whole are converted as one array of components, and others one vertex at a time, writing
+// past the end of the vertex into the next one when it has less than four components. Returns
+// the number of vertices that are left for the scalar function.
+template <typename T, size_t inputComponentCount, size_t outputComponentCount, typename Converter>
+size_t ConvertVerticesTo32F(const uint8_t *input, size_t stride, size_t count, uint8_t *output)
+{
+    float *floatOutput = reinterpret_cast<float*>(output);
+
+    if (stride == inputComponentCount * sizeof(T) && inputComponentCount == outputComponentCount)
+    {
+        const size_t componentCount = count * inputComponentCount;
+        size_t component = 0;
+        for (; component + 4 <= componentCount; component += 4)
+        {
+            __m128 values = Converter::convert(LoadComponents<T>(input + component * sizeof(T)));
+            _mm_storeu_ps(floatOutput + component, values);
+        }
+
+        // Start the rest at the vertex of the first component that is left
+        return count - component / inputComponentCount;
+    }
+
+    const size_t vectorVertices = CountWholeVectorVertices<T, inputComponentCount, sizeof(float),
+                                                           outputComponentCount>(stride, count);
+    const __m128 inputMask = _mm_castsi128_ps(InputComponentMask<inputComponentCount>());
+
+    for (size_t i = 0; i < vectorVertices; i++)
+    {
+        __m128 values = Converter::convert(LoadComponents<T>(input + i * stride));
+
+        // The remaining components are padded with zeros
+        values = _mm_and_ps(values, inputMask);
+        _mm_storeu_ps(floatOutput + i * outputComponentCount, values);
+    }
+
+    return count - vectorVertices;
+}
+
+// Loads the four components of each vertex that fits in a vector. The vertices must have at least
+// three components, so that none of them is read past the end of the next vertex.
+template <size_t componentSize>
+inline __m128i LoadVertices(const uint8_t *input, size_t stride);
+
+template <>
+inline __m128i LoadVertices<1>(const uint8_t *input, size_t stride)
+{
+    int vertices[4];
+    for (size_t i = 0; i < 4; i++)
+    {
+        memcpy(&vertices[i], input + i * stride, sizeof(int));
+    }
+    return _mm_set_epi32(vertices[3], vertices[2], vertices[1], vertices[0]);
+}
+
+template <>
+inline __m128i LoadVertices<2>(const uint8_t *input, size_t stride)
+{
+    return _mm_unpacklo_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(input)),
+                              _mm_loadl_epi64(reinterpret_cast<const __m128i*>(input + stride)));
+}
+
+template <>
+inline __m128i LoadVertices<4>(const uint8_t *input, size_t stride)
+{
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(input));
+}
+
+}
+#endif // ANGLE_USE_SSE
+
+template <typename T, uint32_t alphaDefaultValueBits>
+void CopyXYZToXYZWVertexData_SSE2(const uint8_t *input, size_t stride, size_t count, uint8_t *output)
+{
+#if defined(ANGLE_USE_SSE)
+    const size_t verticesPerVector = 16 / (4 * sizeof(T));
+
+    // Clears the alpha component of each vertex and replaces it with the default value
+    const T defaultAlphaValue = gl::bitCast<T>(alphaDefaultValueBits);
+    uint8_t alphaMask[16];
+    uint8_t alpha[16];
+    for (size_t byte = 0; byte < 16; byte++)
+    {
+        bool isAlpha = ((byte / sizeof(T)) % 4 == 3);
+        alphaMask[byte] = isAlpha ? 0 : 0xFF;
+        alpha[byte] = isAlpha ? reinterpret_cast<const uint8_t*>(&defaultAlphaValue)[byte % sizeof(T)] : 0;
+    }
+    const __m128i alphaMaskVector = _mm_loadu_si128(reinterpret_cast<const __m128i*>(alphaMask));
+    const __m128i alphaVector = _mm_loadu_si128(reinterpret_cast<const __m128i*>(alpha));
+
+    // Reading the fourth component of a vertex runs into the next vertex, so the last vertex is
+    // never loaded as a vector.
+    size_t i = 0;
+    if (stride >= sizeof(T))
+    {
+        for (; i + verticesPerVector < count; i += verticesPerVector)
+        {
+            __m128i vertices = LoadVertices<sizeof(T)>(input + i * stride, stride);
+            vertices = _mm_or_si128(_mm_and_si128(vertices, alphaMaskVector), alphaVector);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i * 4 * sizeof(T)), vertices);
+        }
+    }
+
+    CopyNativeVertexData<T, 3, 4, alphaDefaultValueBits>(input + i * stride, stride, count - i,
+                                                         output + i * 4 * sizeof(T));
+#else
+    UNIMPLEMENTED();
+#endif
+}
+
+template <size_t inputComponentCount, size_t outputComponentCount>
+void Copy8SnormTo16SnormVertexData_SSE2(const uint8_t *input, size_t stride, size_t count, uint8_t *output)
+{
+#if defined(ANGLE_USE_SSE)
+    static_assert(outputComponentCount == 2 || outputComponentCount == 4,
+                  "Normalized bytes are only copied to two or four shorts.");
+
+    const size_t vectorVertices = CountWholeVectorVertices<GLbyte, inputComponentCount, sizeof(GLshort),
+                                                           outputComponentCount>(stride, count);
+
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i inputMask = _mm_packs_epi32(InputComponentMask<inputComponentCount>(), zero);
+    const __m128i alpha = (inputComponentCount < outputComponentCount && outputComponentCount == 4) ?
+                          _mm_set_epi16(0, 0, 0, 0, INT16_MAX, 0, 0, 0) : zero;
+
+    for (size_t i = 0; i < vectorVertices; i++)
+    {
+        int bytes;
+        memcpy(&bytes, input + i * stride, sizeof(bytes));
+        __m128i components = _mm_cvtsi32_si128(bytes);
+        components = _mm_srai_epi16(_mm_unpacklo_epi8(components, components), 8);
+
+        // Positive values repeat their bits to reach INT16_MAX, the others are only shifted.
+        __m128i shifted = _mm_slli_epi16(components, 8);
+        __m128i repeated = _mm_or_si128(_mm_slli_epi16(components, 1),
+                                        _mm_srli_epi16(_mm_and_si128(components, _mm_set1_epi16(0x40)), 6));
+        __m128i positive = _mm_cmpgt_epi16(components, zero);
+        components = _mm_or_si128(shifted, _mm_and_si128(repeated, positive));
+
+        components = _mm_or_si128(_mm_and_si128(components, inputMask), alpha);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(output + i * outputComponentCount * sizeof(GLshort)),
+                         components);
+    }
+
+    Copy8SnormTo16SnormVertexData<inputComponentCount, outputComponentCount>(
+        input + vectorVertices * stride, stride, count - vectorVertices,
+        output + vectorVertices * outputComponentCount * sizeof(GLshort));
+#else
+    UNIMPLEMENTED();
+#endif
+}
+
+template <size_t inputComponentCount, size_t outputComponentCount>
+void Copy32FixedTo32FVertexData_SSE2(const uint8_t *input, size_t stride, size_t count, uint8_t *output)
+{
+#if defined(ANGLE_USE_SSE)
+    size_t remaining = ConvertVerticesTo32F<GLint, inputComponentCount, outputComponentCount,
+                                            ConvertFixedTo32F>(input, stride, count, output);
+    size_t first = count - remaining;
+    Copy32FixedTo32FVertexData<inputComponentCount, outputComponentCount>(
+        input + first * stride, stride, remaining, output + first * outputComponentCount * sizeof(float));
+#else
+    UNIMPLEMENTED();
+#endif
+}
+
+template <typename T, size_t inputComponentCount, size_t outputComponentCount, bool normalized>
+void CopyTo32FVertexData_SSE2(const uint8_t *input, size_t stride, size_t count, uint8_t *output)
+{
+#if defined(ANGLE_USE_SSE)
+    size_t remaining = ConvertVerticesTo32F<T, inputComponentCount, outputComponentCount,
+                                            ConvertTo32F<T, normalized>>(input, stride, count, output);
+    size_t first = count - remaining;
+    CopyTo32FVertexData<T, inputComponentCount, outputComponentCount, normalized>(
+        input + first * stride, stride, remaining, output + first * outputComponentCount * sizeof(float));
+#else
+    UNIMPLEMENTED();
+#endif
+}
+
+// The formats of the vertex format tables
+template void CopyXYZToXYZWVertexData_SSE2<GLbyte, 1>(const uint8_t *, size_t, size_t, uint8_t *);
+template void CopyXYZToXYZWVertexData_SSE2<GLbyte, INT8_MAX>(const uint8_t *, size_t, size_t, uint8_t *);
+template void CopyXYZToXYZWVertexData_SSE2<GLubyte, 1>(const uint8_t *, size_t, size_t, uint8_t *);
+template void CopyXYZToXYZWVertexData_SSE2<GLubyte, UINT8_MAX>(const uint8_t *, size_t, size_t, uint8_t *);
+template void CopyXYZToXYZWVertexData_SSE2<GLshort, 1>(const uint8_t *, size_t, size_t, uint8_t *);
+template void CopyXYZToXYZWVertexData_SSE2<GLshort, INT16_MAX>(const uint8_t *, size_t, size_t, uint8_t *);
+template void CopyXYZToXYZWVertexData_SSE2<GLushort, 1>(const uint8_t *, size_t, size_t, uint8_t *);
+template void CopyXYZToXYZWVertexData_SSE2<GLushort, UINT16_MAX>(const uint8_t *, size_t, size_t, uint8_t *);
+template void CopyXYZToXYZWVertexData_SSE2<GLhalf, gl::Float16One>(const uint8_t *, size_t, size_t, uint8_t *);
+template void CopyXYZToXYZWVertexData_SSE2<GLfloat, gl::Float32One>(const uint8_t *, size_t, size_t, uint8_t *);
+
+template void Copy8SnormTo16SnormVertexData_SSE2<1, 2>(const uint8_t *, size_t, size_t, uint8_t *);
+template void Copy8SnormTo16SnormVertexData_SSE2<2, 2>(const uint8_t *, size_t, size_t, uint8_t *);
+template void Copy8SnormTo16SnormVertexData_SSE2<3, 4>(const uint8_t *, size_t, size_t, uint8_t *);
+template void Copy8SnormTo16SnormVertexData_SSE2<4, 4>(const uint8_t *, size_t, size_t, uint8_t *);
+
+template void Copy32FixedTo32FVertexData_SSE2<1, 1>(const uint8_t *, size_t, size_t, uint8_t *);
+template void Copy32FixedTo32FVertexData_SSE2<1, 2>(const uint8_t *, size_t, size_t, uint8_t *);
+template void Copy32FixedTo32FVertexData_SSE2<2, 2>(const uint8_t *, size_t, size_t, uint8_t *);
+template void Copy32FixedTo32FVertexData_SSE2<3, 3>(const uint8_t *, size_t, size_t, uint8_t *);
+template void Copy32FixedTo32FVertexData_SSE2<4, 4>(const uint8_t *, size_t, size_t, uint8_t *);
+
+template void CopyTo32FVertexData_SSE2<GLushort, 1, 2, false>(const uint8_t *, size_t, size_t, uint8_t *);
+template void CopyTo32FVertexData_SSE2<GLushort, 2, 2, false>(const uint8_t *, size_t, size_t, uint8_t *);
+template void CopyTo32FVertexData_SSE2<GLushort, 3, 3, false>(const uint8_t *, size_t, size_t, uint8_t *);
+template void CopyTo32FVertexData_SSE2<GLushort, 4, 4, false>(const uint8_t *, size_t, size_t, uint8_t *);
+template void CopyTo32FVertexData_SSE2<GLushort, 1, 2, true>(const uint8_t *, size_t, size_t, uint8_t *);
+template void CopyTo32FVertexData_SSE2<GLushort, 2, 2, true>(const uint8_t *, size_t, size_t, uint8_t *);
+template void CopyTo32FVertexData_SSE2<GLushort, 3, 3, true>(const uint8_t *, size_t, size_t, uint8_t *);
+template void CopyTo32FVertexData_SSE2<GLushort, 4, 4, true>(const uint8_t *, size_t, size_t, uint8_t *);
+template void CopyTo32FVertexData_SSE2<GLint, 1, 1, true>(const uint8_t *, size_t, size_t, uint8_t *);
+template void CopyTo32FVertexData_SSE2<GLint, 2, 2, true>(const uint8_t *, size_t, size_t, uint8_t *);
+template void CopyTo32FVertexData_SSE2<GLint, 3, 3, true>(const uint8_t *, size_t, size_t, uint8_t *);
+template void CopyTo32FVertexData_SSE2<GLint, 4, 4, true>(const uint8_t *, size_t, size_t, uint8_t *);
+
+}
@@ -0,0 +1,170 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// copyvertex_unittest.cpp: Unit tests that the vectorized vertex copy functions produce the same
+// vertices as the templates.
+
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "common/platform.h"
+#include "libANGLE/renderer/d3d/d3d11/copyvertex.h"
+
+using namespace rx;
+
+namespace
+{
+
+#if defined(ANGLE_USE_SSE)
+
+unsigned int NextRandom(unsigned int *seed)
+{
+    *seed = *seed * 1664525u + 1013904223u;
+    return *seed >> 8;
+}
+
+void FillBytes(std::vector<uint8_t> *data)
+{
+    unsigned int seed = 0x12345678u;
+    for (size_t i = 0; i < data->size(); i++)
+    {
+        (*data)[i] = static_cast<uint8_t>(NextRandom(&seed));
+    }
+}
+
+// Floats without NaNs, which the templates could quiet when they copy them through the FPU
+void FillFloats(std::vector<uint8_t> *data)
+{
+    unsigned int seed = 0x9ABCDEF0u;
+    for (size_t i = 0; i + sizeof(float) <= data->size(); i += sizeof(float))
+    {
+        float value = static_cast<float>(NextRandom(&seed) % 20000) / 1000.0f - 10.0f;
+        memcpy(&(*data)[i], &value, sizeof(float));
+    }
+}
+
+std::vector<uint8_t> CopyVertices(VertexCopyFunction copyFunction, const std::vector<uint8_t> &input,
+                                  size_t stride, size_t count, size_t outputVertexSize)
+{
+    // The bytes past the last vertex catch functions that write too much
+    std::vector<uint8_t> output(count * outputVertexSize + 16, 0xCD);
+    copyFunction(&input[0], stride, count, &output[0]);
+    return output;
+}
+
+// Compares the vertices copied by two functions from tightly packed and interleaved vertices, and
+// from a single vertex repeated with a zero stride. The input ends with the last vertex, so that
+// functions which read past it can be caught by memory checkers.
+void CheckVertexCopy(VertexCopyFunction sse2Function, VertexCopyFunction scalarFunction,
+                     size_t inputVertexSize, size_t outputVertexSize,
+                     void (*fill)(std::vector<uint8_t> *) = FillBytes)
+{
+    if (!gl::supportsSSE2())
+    {
+        std::cout << "Test skipped because SSE2 is not available." << std::endl;
+        return;
+    }
+
+    const size_t paddings[] = { 0, 4, 12 };
+
+    for (size_t count = 1; count <= 33; count++)
+    {
+        for (size_t padding : paddings)
+        {
+            size_t stride = inputVertexSize + padding;
+            std::vector<uint8_t> input((count - 1) * stride + inputVertexSize);
+            fill(&input);
+
+            EXPECT_EQ(CopyVertices(scalarFunction, input, stride, count, outputVertexSize),
+                      CopyVertices(sse2Function, input, stride, count, outputVertexSize))
+                << count << " vertices with stride " << stride;
+        }
+
+        std::vector<uint8_t> input(inputVertexSize);
+        fill(&input);
+        EXPECT_EQ(CopyVertices(scalarFunction, input, 0, count, outputVertexSize),
+                  CopyVertices(sse2Function, input, 0, count, outputVertexSize))
+            << count << " vertices with stride 0";
+    }
+}
+
+// Converts every value of the component type as a single component vertex.
+void CheckAllValues(VertexCopyFunction sse2Function, VertexCopyFunction scalarFunction,
+                    size_t componentSize, size_t outputVertexSize)
+{
+    if (!gl::supportsSSE2())
+    {
+        std::cout << "Test skipped because SSE2 is not available." << std::endl;
+        return;
+    }
+
+    const size_t count = static_cast<size_t>(1) << (componentSize * 8);
+    std::vector<uint8_t> input(count * componentSize);
+    for (size_t i = 0; i < count; i++)
+    {
+        memcpy(&input[i * componentSize], &i, componentSize);
+    }
+
+    EXPECT_EQ(CopyVertices(scalarFunction, input, componentSize, count, outputVertexSize),
+              CopyVertices(sse2Function, input, componentSize, count, outputVertexSize));
+}
+
+TEST(CopyVertexTest, XYZToXYZWSSE2)
+{
+    CheckVertexCopy(CopyXYZToXYZWVertexData_SSE2<GLbyte, INT8_MAX>,
+                    CopyNativeVertexData<GLbyte, 3, 4, INT8_MAX>, 3, 4);
+    CheckVertexCopy(CopyXYZToXYZWVertexData_SSE2<GLubyte, 1>,
+                    CopyNativeVertexData<GLubyte, 3, 4, 1>, 3, 4);
+    CheckVertexCopy(CopyXYZToXYZWVertexData_SSE2<GLshort, INT16_MAX>,
+                    CopyNativeVertexData<GLshort, 3, 4, INT16_MAX>, 6, 8);
+    CheckVertexCopy(CopyXYZToXYZWVertexData_SSE2<GLhalf, gl::Float16One>,
+                    CopyNativeVertexData<GLhalf, 3, 4, gl::Float16One>, 6, 8);
+    CheckVertexCopy(CopyXYZToXYZWVertexData_SSE2<GLfloat, gl::Float32One>,
+                    CopyNativeVertexData<GLfloat, 3, 4, gl::Float32One>, 12, 16, FillFloats);
+}
+
+TEST(CopyVertexTest, Snorm8To16SSE2)
+{
+    CheckVertexCopy(Copy8SnormTo16SnormVertexData_SSE2<1, 2>, Copy8SnormTo16SnormVertexData<1, 2>, 1, 4);
+    CheckVertexCopy(Copy8SnormTo16SnormVertexData_SSE2<2, 2>, Copy8SnormTo16SnormVertexData<2, 2>, 2, 4);
+    CheckVertexCopy(Copy8SnormTo16SnormVertexData_SSE2<3, 4>, Copy8SnormTo16SnormVertexData<3, 4>, 3, 8);
+    CheckVertexCopy(Copy8SnormTo16SnormVertexData_SSE2<4, 4>, Copy8SnormTo16SnormVertexData<4, 4>, 4, 8);
+    CheckAllValues(Copy8SnormTo16SnormVertexData_SSE2<1, 2>, Copy8SnormTo16SnormVertexData<1, 2>, 1, 4);
+}
+
+TEST(CopyVertexTest, FixedTo32FSSE2)
+{
+    CheckVertexCopy(Copy32FixedTo32FVertexData_SSE2<1, 1>, Copy32FixedTo32FVertexData<1, 1>, 4, 4);
+    CheckVertexCopy(Copy32FixedTo32FVertexData_SSE2<1, 2>, Copy32FixedTo32FVertexData<1, 2>, 4, 8);
+    CheckVertexCopy(Copy32FixedTo32FVertexData_SSE2<2, 2>, Copy32FixedTo32FVertexData<2, 2>, 8, 8);
+    CheckVertexCopy(Copy32FixedTo32FVertexData_SSE2<3, 3>, Copy32FixedTo32FVertexData<3, 3>, 12, 12);
+    CheckVertexCopy(Copy32FixedTo32FVertexData_SSE2<4, 4>, Copy32FixedTo32FVertexData<4, 4>, 16, 16);
+}
+
+TEST(CopyVertexTest, UnsignedShortTo32FSSE2)
+{
+    CheckVertexCopy(CopyTo32FVertexData_SSE2<GLushort, 1, 2, false>, CopyTo32FVertexData<GLushort, 1, 2, false>, 2, 8);
+    CheckVertexCopy(CopyTo32FVertexData_SSE2<GLushort, 3, 3, false>, CopyTo32FVertexData<GLushort, 3, 3, false>, 6, 12);
+    CheckVertexCopy(CopyTo32FVertexData_SSE2<GLushort, 1, 2, true>, CopyTo32FVertexData<GLushort, 1, 2, true>, 2, 8);
+    CheckVertexCopy(CopyTo32FVertexData_SSE2<GLushort, 2, 2, true>, CopyTo32FVertexData<GLushort, 2, 2, true>, 4, 8);
+    CheckVertexCopy(CopyTo32FVertexData_SSE2<GLushort, 3, 3, true>, CopyTo32FVertexData<GLushort, 3, 3, true>, 6, 12);
+    CheckVertexCopy(CopyTo32FVertexData_SSE2<GLushort, 4, 4, true>, CopyTo32FVertexData<GLushort, 4, 4, true>, 8, 16);
+    CheckAllValues(CopyTo32FVertexData_SSE2<GLushort, 1, 2, true>, CopyTo32FVertexData<GLushort, 1, 2, true>, 2, 8);
+}
+
+TEST(CopyVertexTest, NormalizedIntTo32FSSE2)
+{
+    CheckVertexCopy(CopyTo32FVertexData_SSE2<GLint, 1, 1, true>, CopyTo32FVertexData<GLint, 1, 1, true>, 4, 4);
+    CheckVertexCopy(CopyTo32FVertexData_SSE2<GLint, 3, 3, true>, CopyTo32FVertexData<GLint, 3, 3, true>, 12, 12);
+    CheckVertexCopy(CopyTo32FVertexData_SSE2<GLint, 4, 4, true>, CopyTo32FVertexData<GLint, 4, 4, true>, 16, 16);
+}
+
+#endif // ANGLE_USE_SSE
+
+}
@@ -13,6 +13,7 @@
 #include "libANGLE/renderer/d3d/d3d9/Renderer9.h"
 #include "libANGLE/renderer/d3d/d3d9/RenderTarget9.h"
 #include "libANGLE/renderer/d3d/d3d9/TextureStorage9.h"
+#include "libANGLE/renderer/d3d/loadimage.h"
 #include "libANGLE/formatutils.h"
 #include "libANGLE/Framebuffer.h"
 #include "libANGLE/FramebufferAttachment.h"
@@ -496,9 +497,9 @@ gl::Error Image9::loadData(const gl::Box &area, const gl::PixelUnpackState &unpa
         return error;
     }
 
-    d3dFormatInfo.loadFunction(area.width, area.height, area.depth,
-                               reinterpret_cast<const uint8_t*>(input), inputRowPitch, 0,
-                               reinterpret_cast<uint8_t*>(locked.pBits), locked.Pitch, 0);
+    LoadImageParallel(d3dFormatInfo.loadFunction, 1, 1, area.width, area.height, area.depth,
+                      reinterpret_cast<const uint8_t*>(input), inputRowPitch, 0,
+                      reinterpret_cast<uint8_t*>(locked.pBits), locked.Pitch, 0);
 
     unlock();
 
@@ -534,9 +535,10 @@ gl::Error Image9::loadCompressedData(const gl::Box &area, const void *input)
         return error;
     }
 
-    d3d9FormatInfo.loadFunction(area.width, area.height, area.depth,
-                                reinterpret_cast<const uint8_t*>(input), inputRowPitch, inputDepthPitch,
-                                reinterpret_cast<uint8_t*>(locked.pBits), locked.Pitch, 0);
+    LoadImageParallel(d3d9FormatInfo.loadFunction, formatInfo.compressedBlockHeight, formatInfo.compressedBlockHeight,
+                      area.width, area.height, area.depth,
+                      reinterpret_cast<const uint8_t*>(input), inputRowPitch, inputDepthPitch,
+                      reinterpret_cast<uint8_t*>(locked.pBits), locked.Pitch, 0);
 
     unlock();
 
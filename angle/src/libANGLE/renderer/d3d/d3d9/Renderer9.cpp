@@ -1879,47 +1879,26 @@ gl::Error Renderer9::applyShaders(gl::Program *program, const gl::VertexFormat i
     return gl::Error(GL_NO_ERROR);
 }
 
-gl::Error Renderer9::applyUniforms(const ProgramImpl &program, const std::vector<gl::LinkedUniform*> &uniformArray)
+gl::Error Renderer9::applyUniforms(const ProgramImpl &program)
 {
-    for (size_t uniformIndex = 0; uniformIndex < uniformArray.size(); uniformIndex++)
-    {
-        gl::LinkedUniform *targetUniform = uniformArray[uniformIndex];
+    const ProgramD3D *programD3D = GetAs<ProgramD3D>(&program);
+    const UniformStorageD3D &vertexUniformStorage = programD3D->getVertexUniformStorage();
+    const UniformStorageD3D &fragmentUniformStorage = programD3D->getFragmentUniformStorage();
 
-        if (targetUniform->dirty)
-        {
-            GLfloat *f = (GLfloat*)targetUniform->data;
-            GLint *i = (GLint*)targetUniform->data;
+    // The shadow registers already hold integers and booleans as floats, so the registers that
+    // changed are set with a single call for each shader.
+    if (vertexUniformStorage.isDirty())
+    {
+        size_t dirtyBegin = vertexUniformStorage.getDirtyBegin();
+        const float *registers = reinterpret_cast<const float*>(vertexUniformStorage.getShadowData() + dirtyBegin);
+        mDevice->SetVertexShaderConstantF(dirtyBegin / 16, registers, (vertexUniformStorage.getDirtyEnd() - dirtyBegin) / 16);
+    }
 
-            switch (targetUniform->type)
-            {
-              case GL_SAMPLER_2D:
-              case GL_SAMPLER_CUBE:
-                break;
-              case GL_BOOL:
-              case GL_BOOL_VEC2:
-              case GL_BOOL_VEC3:
-              case GL_BOOL_VEC4:
-                applyUniformnbv(targetUniform, i);
-                break;
-              case GL_FLOAT:
-              case GL_FLOAT_VEC2:
-              case GL_FLOAT_VEC3:
-              case GL_FLOAT_VEC4:
-              case GL_FLOAT_MAT2:
-              case GL_FLOAT_MAT3:
-              case GL_FLOAT_MAT4:
-                applyUniformnfv(targetUniform, f);
-                break;
-              case GL_INT:
-              case GL_INT_VEC2:
-              case GL_INT_VEC3:
-              case GL_INT_VEC4:
-                applyUniformniv(targetUniform, i);
-                break;
-              default:
-                UNREACHABLE();
-            }
-        }
+    if (fragmentUniformStorage.isDirty())
+    {
+        size_t dirtyBegin = fragmentUniformStorage.getDirtyBegin();
+        const float *registers = reinterpret_cast<const float*>(fragmentUniformStorage.getShadowData() + dirtyBegin);
+        mDevice->SetPixelShaderConstantF(dirtyBegin / 16, registers, (fragmentUniformStorage.getDirtyEnd() - dirtyBegin) / 16);
     }
 
     // Driver uniforms
@@ -1933,51 +1912,6 @@ gl::Error Renderer9::applyUniforms(const ProgramImpl &program, const std::vector
     return gl::Error(GL_NO_ERROR);
 }
 
-void Renderer9::applyUniformnfv(gl::LinkedUniform *targetUniform, const GLfloat *v)
-{
-    if (targetUniform->isReferencedByFragmentShader())
-    {
-        mDevice->SetPixelShaderConstantF(targetUniform->psRegisterIndex, v, targetUniform->registerCount);
-    }
-
-    if (targetUniform->isReferencedByVertexShader())
-    {
-        mDevice->SetVertexShaderConstantF(targetUniform->vsRegisterIndex, v, targetUniform->registerCount);
-    }
-}
-
-void Renderer9::applyUniformniv(gl::LinkedUniform *targetUniform, const GLint *v)
-{
-    ASSERT(targetUniform->registerCount <= MAX_VERTEX_CONSTANT_VECTORS_D3D9);
-    GLfloat vector[MAX_VERTEX_CONSTANT_VECTORS_D3D9][4];
-
-    for (unsigned int i = 0; i < targetUniform->registerCount; i++)
-    {
-        vector[i][0] = (GLfloat)v[4 * i + 0];
-        vector[i][1] = (GLfloat)v[4 * i + 1];
-        vector[i][2] = (GLfloat)v[4 * i + 2];
-        vector[i][3] = (GLfloat)v[4 * i + 3];
-    }
-
-    applyUniformnfv(targetUniform, (GLfloat*)vector);
-}
-
-void Renderer9::applyUniformnbv(gl::LinkedUniform *targetUniform, const GLint *v)
-{
-    ASSERT(targetUniform->registerCount <= MAX_VERTEX_CONSTANT_VECTORS_D3D9);
-    GLfloat vector[MAX_VERTEX_CONSTANT_VECTORS_D3D9][4];
-
-    for (unsigned int i = 0; i < targetUniform->registerCount; i++)
-    {
-        vector[i][0] = (v[4 * i + 0] == GL_FALSE) ? 0.0f : 1.0f;
-        vector[i][1] = (v[4 * i + 1] == GL_FALSE) ? 0.0f : 1.0f;
-        vector[i][2] = (v[4 * i + 2] == GL_FALSE) ? 0.0f : 1.0f;
-        vector[i][3] = (v[4 * i + 3] == GL_FALSE) ? 0.0f : 1.0f;
-    }
-
-    applyUniformnfv(targetUniform, (GLfloat*)vector);
-}
-
 gl::Error Renderer9::clear(const ClearParameters &clearParams,
                            const gl::FramebufferAttachment *colorBuffer,
                            const gl::FramebufferAttachment *depthStencilBuffer)
@@ -0,0 +1,188 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// generatemip.cpp: Defines the mip generation functions that average texels at float precision
+// instead of in the format of the texture.
+
+#include "libANGLE/renderer/d3d/generatemip.h"
+
+#include "common/mathutil.h"
+
+namespace rx
+{
+
+namespace
+{
+
+template <size_t componentCount>
+struct HalfFloatTexel
+{
+    enum { ComponentCount = componentCount, Size = componentCount * sizeof(uint16_t) };
+
+    static void read(const uint8_t *source, float *values)
+    {
+        const uint16_t *halves = reinterpret_cast<const uint16_t*>(source);
+        for (size_t i = 0; i < componentCount; i++)
+        {
+            values[i] = gl::float16ToFloat32(halves[i]);
+        }
+    }
+
+    static void write(const float *values, uint8_t *dest)
+    {
+        uint16_t *halves = reinterpret_cast<uint16_t*>(dest);
+        for (size_t i = 0; i < componentCount; i++)
+        {
+            halves[i] = gl::float32ToFloat16(values[i]);
+        }
+    }
+};
+
+struct R8G8B8A8SRGBTexel
+{
+    enum { ComponentCount = 4, Size = 4 };
+
+    static void read(const uint8_t *source, float *values)
+    {
+        values[0] = SRGB8ToLinear(source[0]);
+        values[1] = SRGB8ToLinear(source[1]);
+        values[2] = SRGB8ToLinear(source[2]);
+        values[3] = source[3];
+    }
+
+    static void write(const float *values, uint8_t *dest)
+    {
+        dest[0] = LinearToSRGB8(values[0]);
+        dest[1] = LinearToSRGB8(values[1]);
+        dest[2] = LinearToSRGB8(values[2]);
+        dest[3] = static_cast<uint8_t>(values[3] + 0.5f);
+    }
+};
+
+template <typename Texel>
+inline void AverageValues(const float *a, const float *b, float *result)
+{
+    for (size_t i = 0; i < Texel::ComponentCount; i++)
+    {
+        result[i] = gl::average(a[i], b[i]);
+    }
+}
+
+// Averages the texels of a column of the block, first along z and then along y. The steps are
+// zero for dimensions that aren't halved, since averaging a value with itself gives it back.
+template <typename Texel, bool filterDepth>
+inline void ReadColumn(const uint8_t *source, size_t yStep, size_t zStep, float *result)
+{
+    float front[Texel::ComponentCount];
+    float back[Texel::ComponentCount];
+
+    Texel::read(source, front);
+    Texel::read(source + yStep, back);
+    if (filterDepth)
+    {
+        float frontDepth[Texel::ComponentCount];
+        float backDepth[Texel::ComponentCount];
+        Texel::read(source + zStep, frontDepth);
+        Texel::read(source + yStep + zStep, backDepth);
+        AverageValues<Texel>(front, frontDepth, front);
+        AverageValues<Texel>(back, backDepth, back);
+    }
+
+    AverageValues<Texel>(front, back, result);
+}
+
+// Averages the texels of each block in the same order as GenerateMip: first along z, then along y
+// and last along x.
+template <typename Texel, bool filterDepth>
+void GenerateMipAtFloatPrecision(size_t sourceWidth, size_t sourceHeight, size_t sourceDepth,
+                                 const uint8_t *sourceData, size_t sourceRowPitch, size_t sourceDepthPitch,
+                                 uint8_t *destData, size_t destRowPitch, size_t destDepthPitch)
+{
+    size_t mipWidth = std::max<size_t>(1, sourceWidth >> 1);
+    size_t mipHeight = std::max<size_t>(1, sourceHeight >> 1);
+    size_t mipDepth = std::max<size_t>(1, sourceDepth >> 1);
+
+    size_t xStep = (sourceWidth > 1) ? Texel::Size : 0;
+    size_t yStep = (sourceHeight > 1) ? sourceRowPitch : 0;
+    size_t zStep = (sourceDepth > 1) ? sourceDepthPitch : 0;
+
+    for (size_t z = 0; z < mipDepth; z++)
+    {
+        for (size_t y = 0; y < mipHeight; y++)
+        {
+            const uint8_t *source = sourceData + y * 2 * yStep + z * 2 * zStep;
+            uint8_t *dest = destData + y * destRowPitch + z * destDepthPitch;
+
+            for (size_t x = 0; x < mipWidth; x++)
+            {
+                float left[Texel::ComponentCount];
+                float right[Texel::ComponentCount];
+                ReadColumn<Texel, filterDepth>(source + x * 2 * xStep, yStep, zStep, left);
+                ReadColumn<Texel, filterDepth>(source + x * 2 * xStep + xStep, yStep, zStep, right);
+
+                AverageValues<Texel>(left, right, left);
+                Texel::write(left, dest + x * Texel::Size);
+            }
+        }
+    }
+}
+
+template <typename Texel>
+void GenerateMipAtFloatPrecision(size_t sourceWidth, size_t sourceHeight, size_t sourceDepth,
+                                 const uint8_t *sourceData, size_t sourceRowPitch, size_t sourceDepthPitch,
+                                 uint8_t *destData, size_t destRowPitch, size_t destDepthPitch)
+{
+    if (sourceDepth > 1)
+    {
+        GenerateMipAtFloatPrecision<Texel, true>(sourceWidth, sourceHeight, sourceDepth, sourceData, sourceRowPitch,
+                                                 sourceDepthPitch, destData, destRowPitch, destDepthPitch);
+    }
+    else
+    {
+        GenerateMipAtFloatPrecision<Texel, false>(sourceWidth, sourceHeight, sourceDepth, sourceData, sourceRowPitch,
+                                                  sourceDepthPitch, destData, destRowPitch, destDepthPitch);
+    }
+}
+
+}
+
+void GenerateMipR16F(size_t sourceWidth, size_t sourceHeight, size_t sourceDepth,
+                     const uint8_t *sourceData, size_t sourceRowPitch, size_t sourceDepthPitch,
+                     uint8_t *destData, size_t destRowPitch, size_t destDepthPitch)
+{
+    GenerateMipAtFloatPrecision<HalfFloatTexel<1>>(sourceWidth, sourceHeight, sourceDepth, sourceData,
+                                                   sourceRowPitch, sourceDepthPitch, destData,
+                                                   destRowPitch, destDepthPitch);
+}
+
+void GenerateMipR16G16F(size_t sourceWidth, size_t sourceHeight, size_t sourceDepth,
+                        const uint8_t *sourceData, size_t sourceRowPitch, size_t sourceDepthPitch,
+                        uint8_t *destData, size_t destRowPitch, size_t destDepthPitch)
+{
+    GenerateMipAtFloatPrecision<HalfFloatTexel<2>>(sourceWidth, sourceHeight, sourceDepth, sourceData,
+                                                   sourceRowPitch, sourceDepthPitch, destData,
+                                                   destRowPitch, destDepthPitch);
+}
+
+void GenerateMipR16G16B16A16F(size_t sourceWidth, size_t sourceHeight, size_t sourceDepth,
+                              const uint8_t *sourceData, size_t sourceRowPitch, size_t sourceDepthPitch,
+                              uint8_t *destData, size_t destRowPitch, size_t destDepthPitch)
+{
+    GenerateMipAtFloatPrecision<HalfFloatTexel<4>>(sourceWidth, sourceHeight, sourceDepth, sourceData,
+                                                   sourceRowPitch, sourceDepthPitch, destData,
+                                                   destRowPitch, destDepthPitch);
+}
+
+void GenerateMipR8G8B8A8SRGB(size_t sourceWidth, size_t sourceHeight, size_t sourceDepth,
+                             const uint8_t *sourceData, size_t sourceRowPitch, size_t sourceDepthPitch,
+                             uint8_t *destData, size_t destRowPitch, size_t destDepthPitch)
+{
+    GenerateMipAtFloatPrecision<R8G8B8A8SRGBTexel>(sourceWidth, sourceHeight, sourceDepth, sourceData,
+                                                   sourceRowPitch, sourceDepthPitch, destData,
+                                                   destRowPitch, destDepthPitch);
+}
+
+}
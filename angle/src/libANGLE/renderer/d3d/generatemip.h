@@ -10,6 +10,7 @@
 #ifndef LIBANGLE_RENDERER_D3D_GENERATEMIP_H_
 #define LIBANGLE_RENDERER_D3D_GENERATEMIP_H_
 
+#include "libANGLE/renderer/d3d/formatutilsD3D.h"
 #include "libANGLE/renderer/d3d/imageformats.h"
 #include "libANGLE/angletypes.h"
 
@@ -21,6 +22,72 @@ inline void GenerateMip(size_t sourceWidth, size_t sourceHeight, size_t sourceDe
                         const uint8_t *sourceData, size_t sourceRowPitch, size_t sourceDepthPitch,
                         uint8_t *destData, size_t destRowPitch, size_t destDepthPitch);
 
+// Calls the preferred mip generation function when the predicate holds, for example when the CPU
+// supports the instructions it uses, and the fallback otherwise.
+template <FallbackPredicateFunction pred, MipGenerationFunction prefered, MipGenerationFunction fallback>
+inline void FallbackMip(size_t sourceWidth, size_t sourceHeight, size_t sourceDepth,
+                        const uint8_t *sourceData, size_t sourceRowPitch, size_t sourceDepthPitch,
+                        uint8_t *destData, size_t destRowPitch, size_t destDepthPitch);
+
+// Half float levels are averaged at full float precision and rounded once, rather than after
+// every pair of texels like GenerateMip does.
+void GenerateMipR16F(size_t sourceWidth, size_t sourceHeight, size_t sourceDepth,
+                     const uint8_t *sourceData, size_t sourceRowPitch, size_t sourceDepthPitch,
+                     uint8_t *destData, size_t destRowPitch, size_t destDepthPitch);
+
+void GenerateMipR16G16F(size_t sourceWidth, size_t sourceHeight, size_t sourceDepth,
+                        const uint8_t *sourceData, size_t sourceRowPitch, size_t sourceDepthPitch,
+                        uint8_t *destData, size_t destRowPitch, size_t destDepthPitch);
+
+void GenerateMipR16G16B16A16F(size_t sourceWidth, size_t sourceHeight, size_t sourceDepth,
+                              const uint8_t *sourceData, size_t sourceRowPitch, size_t sourceDepthPitch,
+                              uint8_t *destData, size_t destRowPitch, size_t destDepthPitch);
+
+// Averages the color channels of sRGB levels in linear space.
+void GenerateMipR8G8B8A8SRGB(size_t sourceWidth, size_t sourceHeight, size_t sourceDepth,
+                             const uint8_t *sourceData, size_t sourceRowPitch, size_t sourceDepthPitch,
+                             uint8_t *destData, size_t destRowPitch, size_t destDepthPitch);
+
+// The SSE2 functions filter each 2x2 or 2x2x2 block of texels in one pass, and use the scalar
+// functions for levels that are only one texel wide or high. They give the same results as
+// GenerateMip, or as the functions above for half float formats. The 8 bit functions work for any
+// channel order.
+void GenerateMipR8G8B8A8_SSE2(size_t sourceWidth, size_t sourceHeight, size_t sourceDepth,
+                              const uint8_t *sourceData, size_t sourceRowPitch, size_t sourceDepthPitch,
+                              uint8_t *destData, size_t destRowPitch, size_t destDepthPitch);
+
+void GenerateMipB8G8R8X8_SSE2(size_t sourceWidth, size_t sourceHeight, size_t sourceDepth,
+                              const uint8_t *sourceData, size_t sourceRowPitch, size_t sourceDepthPitch,
+                              uint8_t *destData, size_t destRowPitch, size_t destDepthPitch);
+
+void GenerateMipR16F_SSE2(size_t sourceWidth, size_t sourceHeight, size_t sourceDepth,
+                          const uint8_t *sourceData, size_t sourceRowPitch, size_t sourceDepthPitch,
+                          uint8_t *destData, size_t destRowPitch, size_t destDepthPitch);
+
+void GenerateMipR16G16F_SSE2(size_t sourceWidth, size_t sourceHeight, size_t sourceDepth,
+                             const uint8_t *sourceData, size_t sourceRowPitch, size_t sourceDepthPitch,
+                             uint8_t *destData, size_t destRowPitch, size_t destDepthPitch);
+
+void GenerateMipR16G16B16A16F_SSE2(size_t sourceWidth, size_t sourceHeight, size_t sourceDepth,
+                                   const uint8_t *sourceData, size_t sourceRowPitch, size_t sourceDepthPitch,
+                                   uint8_t *destData, size_t destRowPitch, size_t destDepthPitch);
+
+void GenerateMipR32F_SSE2(size_t sourceWidth, size_t sourceHeight, size_t sourceDepth,
+                          const uint8_t *sourceData, size_t sourceRowPitch, size_t sourceDepthPitch,
+                          uint8_t *destData, size_t destRowPitch, size_t destDepthPitch);
+
+void GenerateMipR32G32F_SSE2(size_t sourceWidth, size_t sourceHeight, size_t sourceDepth,
+                             const uint8_t *sourceData, size_t sourceRowPitch, size_t sourceDepthPitch,
+                             uint8_t *destData, size_t destRowPitch, size_t destDepthPitch);
+
+void GenerateMipR32G32B32A32F_SSE2(size_t sourceWidth, size_t sourceHeight, size_t sourceDepth,
+                                   const uint8_t *sourceData, size_t sourceRowPitch, size_t sourceDepthPitch,
+                                   uint8_t *destData, size_t destRowPitch, size_t destDepthPitch);
+
+// Defined in srgbtables.cpp, which is generated by srgbtables.py
+float SRGB8ToLinear(uint8_t value);
+uint8_t LinearToSRGB8(float value);
+
 }
 
 #include "generatemip.inl"
@@ -263,4 +263,22 @@ inline void GenerateMip(size_t sourceWidth, size_t sourceHeight, size_t sourceDe
                        mipWidth, mipHeight, mipDepth, destData, destRowPitch, destDepthPitch);
 }
 
+
+template <FallbackPredicateFunction pred, MipGenerationFunction prefered, MipGenerationFunction fallback>
+inline void FallbackMip(size_t sourceWidth, size_t sourceHeight, size_t sourceDepth,
+                        const uint8_t *sourceData, size_t sourceRowPitch, size_t sourceDepthPitch,
+                        uint8_t *destData, size_t destRowPitch, size_t destDepthPitch)
+{
+    if (pred())
+    {
+        prefered(sourceWidth, sourceHeight, sourceDepth, sourceData, sourceRowPitch, sourceDepthPitch,
+                 destData, destRowPitch, destDepthPitch);
+    }
+    else
+    {
+        fallback(sourceWidth, sourceHeight, sourceDepth, sourceData, sourceRowPitch, sourceDepthPitch,
+                 destData, destRowPitch, destDepthPitch);
+    }
+}
+
 }
@@ -0,0 +1,392 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// generatemipSSE2.cpp: Defines mip generation functions that use SSE2. It's
+// in a separated file for GCC, which can enable SSE usage only per-file,
+// not for code blocks that use SSE2 explicitly.
+
+#include "libANGLE/renderer/d3d/generatemip.h"
+
+#include "common/platform.h"
+#include "libANGLE/Float16ToFloat32SSE2.h"
+
+#ifdef ANGLE_USE_SSE
+#include <emmintrin.h>
+#endif
+
+namespace rx
+{
+
+#if defined(ANGLE_USE_SSE)
+namespace
+{
+
+// Each kernel filters DestTexelsPerIteration texels from either two source rows, or four for 3D
+// textures. The rows are ordered by y and then by z, and are averaged in the same order as
+// GenerateMip: first along z, then along y and last along x.
+
+inline __m128i AverageBytes(__m128i a, __m128i b)
+{
+    // Rounds down, like the average functions of the 8 bit formats
+    __m128i halfDifference = _mm_and_si128(_mm_srli_epi16(_mm_xor_si128(a, b), 1), _mm_set1_epi8(0x7F));
+    return _mm_add_epi8(_mm_and_si128(a, b), halfDifference);
+}
+
+inline __m128i LoadColumnBytes(const uint8_t *const *rows, size_t rowCount, size_t offset)
+{
+    __m128i average = AverageBytes(_mm_loadu_si128(reinterpret_cast<const __m128i*>(rows[0] + offset)),
+                                   _mm_loadu_si128(reinterpret_cast<const __m128i*>(rows[1] + offset)));
+    if (rowCount == 4)
+    {
+        __m128i back = AverageBytes(_mm_loadu_si128(reinterpret_cast<const __m128i*>(rows[2] + offset)),
+                                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(rows[3] + offset)));
+        average = AverageBytes(average, back);
+    }
+    return average;
+}
+
+inline __m128 AverageFloats(__m128 a, __m128 b)
+{
+    return _mm_mul_ps(_mm_add_ps(a, b), _mm_set1_ps(0.5f));
+}
+
+// Averages the pairs of neighbouring texels in a and b, which hold eight consecutive components
+template <size_t componentCount>
+inline __m128 AverageNeighbours(__m128 a, __m128 b);
+
+template <>
+inline __m128 AverageNeighbours<1>(__m128 a, __m128 b)
+{
+    return AverageFloats(_mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+}
+
+template <>
+inline __m128 AverageNeighbours<2>(__m128 a, __m128 b)
+{
+    return AverageFloats(_mm_movelh_ps(a, b), _mm_movehl_ps(b, a));
+}
+
+template <>
+inline __m128 AverageNeighbours<4>(__m128 a, __m128 b)
+{
+    return AverageFloats(a, b);
+}
+
+inline void LoadColumnHalves(const uint8_t *const *rows, size_t rowCount, size_t offset, __m128 *lo, __m128 *hi)
+{
+    __m128 rowLo[4];
+    __m128 rowHi[4];
+    for (size_t row = 0; row < rowCount; row++)
+    {
+        __m128i halves = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rows[row] + offset));
+        rowLo[row] = gl::Float16ToFloat32SSE2(_mm_unpacklo_epi16(halves, _mm_setzero_si128()));
+        rowHi[row] = gl::Float16ToFloat32SSE2(_mm_unpackhi_epi16(halves, _mm_setzero_si128()));
+    }
+
+    *lo = AverageFloats(rowLo[0], rowLo[1]);
+    *hi = AverageFloats(rowHi[0], rowHi[1]);
+    if (rowCount == 4)
+    {
+        *lo = AverageFloats(*lo, AverageFloats(rowLo[2], rowLo[3]));
+        *hi = AverageFloats(*hi, AverageFloats(rowHi[2], rowHi[3]));
+    }
+}
+
+inline __m128 LoadColumnFloats(const uint8_t *const *rows, size_t rowCount, size_t offset)
+{
+    __m128 average = AverageFloats(_mm_loadu_ps(reinterpret_cast<const float*>(rows[0] + offset)),
+                                   _mm_loadu_ps(reinterpret_cast<const float*>(rows[1] + offset)));
+    if (rowCount == 4)
+    {
+        __m128 back = AverageFloats(_mm_loadu_ps(reinterpret_cast<const float*>(rows[2] + offset)),
+                                    _mm_loadu_ps(reinterpret_cast<const float*>(rows[3] + offset)));
+        average = AverageFloats(average, back);
+    }
+    return average;
+}
+
+// Filters one texel with the average function of the format, for the end of a row
+template <typename T>
+void AverageTexel(const uint8_t *const *rows, size_t rowCount, size_t offset, uint8_t *dest)
+{
+    T columns[2];
+    for (size_t x = 0; x < 2; x++)
+    {
+        const T *src0 = reinterpret_cast<const T*>(rows[0] + offset) + x;
+        const T *src1 = reinterpret_cast<const T*>(rows[1] + offset) + x;
+        if (rowCount == 4)
+        {
+            const T *src2 = reinterpret_cast<const T*>(rows[2] + offset) + x;
+            const T *src3 = reinterpret_cast<const T*>(rows[3] + offset) + x;
+
+            T tmp0, tmp1;
+            T::average(&tmp0, src0, src1);
+            T::average(&tmp1, src2, src3);
+            T::average(&columns[x], &tmp0, &tmp1);
+        }
+        else
+        {
+            T::average(&columns[x], src0, src1);
+        }
+    }
+
+    T::average(reinterpret_cast<T*>(dest), &columns[0], &columns[1]);
+}
+
+template <typename T, bool opaque>
+struct Byte4Kernel
+{
+    enum { DestTexelsPerIteration = 4, TexelBytes = 4 };
+
+    static void filter(const uint8_t *const *rows, size_t rowCount, size_t offset, uint8_t *dest)
+    {
+        __m128 left = _mm_castsi128_ps(LoadColumnBytes(rows, rowCount, offset));
+        __m128 right = _mm_castsi128_ps(LoadColumnBytes(rows, rowCount, offset + 16));
+
+        __m128i even = _mm_castps_si128(_mm_shuffle_ps(left, right, _MM_SHUFFLE(2, 0, 2, 0)));
+        __m128i odd = _mm_castps_si128(_mm_shuffle_ps(left, right, _MM_SHUFFLE(3, 1, 3, 1)));
+        __m128i result = AverageBytes(even, odd);
+        if (opaque)
+        {
+            result = _mm_or_si128(result, _mm_set1_epi32(0xFF000000));
+        }
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dest), result);
+    }
+
+    static void filterTexel(const uint8_t *const *rows, size_t rowCount, size_t offset, uint8_t *dest)
+    {
+        AverageTexel<T>(rows, rowCount, offset, dest);
+    }
+};
+
+template <typename T>
+struct Float32Kernel
+{
+    enum
+    {
+        ComponentCount = sizeof(T) / sizeof(float),
+        DestTexelsPerIteration = 4 / ComponentCount,
+        TexelBytes = sizeof(T),
+    };
+
+    static void filter(const uint8_t *const *rows, size_t rowCount, size_t offset, uint8_t *dest)
+    {
+        __m128 left = LoadColumnFloats(rows, rowCount, offset);
+        __m128 right = LoadColumnFloats(rows, rowCount, offset + 16);
+        _mm_storeu_ps(reinterpret_cast<float*>(dest), AverageNeighbours<ComponentCount>(left, right));
+    }
+
+    static void filterTexel(const uint8_t *const *rows, size_t rowCount, size_t offset, uint8_t *dest)
+    {
+        AverageTexel<T>(rows, rowCount, offset, dest);
+    }
+};
+
+template <size_t componentCount>
+struct Float16Kernel
+{
+    enum { DestTexelsPerIteration = 4 / componentCount, TexelBytes = componentCount * 2 };
+
+    static void filter(const uint8_t *const *rows, size_t rowCount, size_t offset, uint8_t *dest)
+    {
+        __m128 left, right;
+        LoadColumnHalves(rows, rowCount, offset, &left, &right);
+
+        // Sign extend the halves so that they are packed without saturating
+        __m128i halves = gl::Float32ToFloat16SSE2(AverageNeighbours<componentCount>(left, right));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dest), gl::PackFloat16SSE2(halves, halves));
+    }
+
+    static void filterTexel(const uint8_t *const *rows, size_t rowCount, size_t offset, uint8_t *dest)
+    {
+        uint16_t *halves = reinterpret_cast<uint16_t*>(dest);
+        for (size_t i = 0; i < componentCount; i++)
+        {
+            float columns[2];
+            for (size_t x = 0; x < 2; x++)
+            {
+                const size_t componentOffset = offset + (x * componentCount + i) * 2;
+                float values[4];
+                for (size_t row = 0; row < rowCount; row++)
+                {
+                    values[row] = gl::float16ToFloat32(*reinterpret_cast<const uint16_t*>(rows[row] + componentOffset));
+                }
+
+                columns[x] = gl::average(values[0], values[1]);
+                if (rowCount == 4)
+                {
+                    columns[x] = gl::average(columns[x], gl::average(values[2], values[3]));
+                }
+            }
+
+            halves[i] = gl::float32ToFloat16(gl::average(columns[0], columns[1]));
+        }
+    }
+};
+
+template <typename Kernel>
+void GenerateMipWithKernel(size_t sourceWidth, size_t sourceHeight, size_t sourceDepth,
+                           const uint8_t *sourceData, size_t sourceRowPitch, size_t sourceDepthPitch,
+                           uint8_t *destData, size_t destRowPitch, size_t destDepthPitch,
+                           MipGenerationFunction fallback)
+{
+    if (sourceWidth < 2 || sourceHeight < 2)
+    {
+        fallback(sourceWidth, sourceHeight, sourceDepth, sourceData, sourceRowPitch, sourceDepthPitch,
+                 destData, destRowPitch, destDepthPitch);
+        return;
+    }
+
+    size_t mipWidth = sourceWidth >> 1;
+    size_t mipHeight = sourceHeight >> 1;
+    size_t mipDepth = std::max<size_t>(1, sourceDepth >> 1);
+
+    size_t rowCount = (sourceDepth > 1) ? 4 : 2;
+    size_t vectorWidth = mipWidth - (mipWidth % Kernel::DestTexelsPerIteration);
+
+    for (size_t z = 0; z < mipDepth; z++)
+    {
+        for (size_t y = 0; y < mipHeight; y++)
+        {
+            const uint8_t *front = sourceData + (y * 2) * sourceRowPitch + (z * 2) * sourceDepthPitch;
+            const uint8_t *rows[4];
+            if (rowCount == 4)
+            {
+                rows[0] = front;
+                rows[1] = front + sourceDepthPitch;
+                rows[2] = front + sourceRowPitch;
+                rows[3] = front + sourceRowPitch + sourceDepthPitch;
+            }
+            else
+            {
+                rows[0] = front;
+                rows[1] = front + sourceRowPitch;
+            }
+
+            uint8_t *dest = destData + y * destRowPitch + z * destDepthPitch;
+
+            size_t x = 0;
+            for (; x < vectorWidth; x += Kernel::DestTexelsPerIteration)
+            {
+                Kernel::filter(rows, rowCount, x * 2 * Kernel::TexelBytes, dest + x * Kernel::TexelBytes);
+            }
+            for (; x < mipWidth; x++)
+            {
+                Kernel::filterTexel(rows, rowCount, x * 2 * Kernel::TexelBytes, dest + x * Kernel::TexelBytes);
+            }
+        }
+    }
+}
+
+}
+#endif // ANGLE_USE_SSE
+
+void GenerateMipR8G8B8A8_SSE2(size_t sourceWidth, size_t sourceHeight, size_t sourceDepth,
+                              const uint8_t *sourceData, size_t sourceRowPitch, size_t sourceDepthPitch,
+                              uint8_t *destData, size_t destRowPitch, size_t destDepthPitch)
+{
+#if defined(ANGLE_USE_SSE)
+    GenerateMipWithKernel<Byte4Kernel<R8G8B8A8, false>>(sourceWidth, sourceHeight, sourceDepth, sourceData,
+                                                        sourceRowPitch, sourceDepthPitch, destData, destRowPitch,
+                                                        destDepthPitch, GenerateMip<R8G8B8A8>);
+#else
+    UNIMPLEMENTED();
+#endif
+}
+
+void GenerateMipB8G8R8X8_SSE2(size_t sourceWidth, size_t sourceHeight, size_t sourceDepth,
+                              const uint8_t *sourceData, size_t sourceRowPitch, size_t sourceDepthPitch,
+                              uint8_t *destData, size_t destRowPitch, size_t destDepthPitch)
+{
+#if defined(ANGLE_USE_SSE)
+    GenerateMipWithKernel<Byte4Kernel<B8G8R8X8, true>>(sourceWidth, sourceHeight, sourceDepth, sourceData,
+                                                       sourceRowPitch, sourceDepthPitch, destData, destRowPitch,
+                                                       destDepthPitch, GenerateMip<B8G8R8X8>);
+#else
+    UNIMPLEMENTED();
+#endif
+}
+
+void GenerateMipR16F_SSE2(size_t sourceWidth, size_t sourceHeight, size_t sourceDepth,
+                          const uint8_t *sourceData, size_t sourceRowPitch, size_t sourceDepthPitch,
+                          uint8_t *destData, size_t destRowPitch, size_t destDepthPitch)
+{
+#if defined(ANGLE_USE_SSE)
+    GenerateMipWithKernel<Float16Kernel<1>>(sourceWidth, sourceHeight, sourceDepth, sourceData, sourceRowPitch,
+                                            sourceDepthPitch, destData, destRowPitch, destDepthPitch,
+                                            GenerateMipR16F);
+#else
+    UNIMPLEMENTED();
+#endif
+}
+
+void GenerateMipR16G16F_SSE2(size_t sourceWidth, size_t sourceHeight, size_t sourceDepth,
+                             const uint8_t *sourceData, size_t sourceRowPitch, size_t sourceDepthPitch,
+                             uint8_t *destData, size_t destRowPitch, size_t destDepthPitch)
+{
+#if defined(ANGLE_USE_SSE)
+    GenerateMipWithKernel<Float16Kernel<2>>(sourceWidth, sourceHeight, sourceDepth, sourceData, sourceRowPitch,
+                                            sourceDepthPitch, destData, destRowPitch, destDepthPitch,
+                                            GenerateMipR16G16F);
+#else
+    UNIMPLEMENTED();
+#endif
+}
+
+void GenerateMipR16G16B16A16F_SSE2(size_t sourceWidth, size_t sourceHeight, size_t sourceDepth,
+                                   const uint8_t *sourceData, size_t sourceRowPitch, size_t sourceDepthPitch,
+                                   uint8_t *destData, size_t destRowPitch, size_t destDepthPitch)
+{
+#if defined(ANGLE_USE_SSE)
+    GenerateMipWithKernel<Float16Kernel<4>>(sourceWidth, sourceHeight, sourceDepth, sourceData, sourceRowPitch,
+                                            sourceDepthPitch, destData, destRowPitch, destDepthPitch,
+                                            GenerateMipR16G16B16A16F);
+#else
+    UNIMPLEMENTED();
+#endif
+}
+
+void GenerateMipR32F_SSE2(size_t sourceWidth, size_t sourceHeight, size_t sourceDepth,
+                          const uint8_t *sourceData, size_t sourceRowPitch, size_t sourceDepthPitch,
+                          uint8_t *destData, size_t destRowPitch, size_t destDepthPitch)
+{
+#if defined(ANGLE_USE_SSE)
+    GenerateMipWithKernel<Float32Kernel<R32F>>(sourceWidth, sourceHeight, sourceDepth, sourceData, sourceRowPitch,
+                                               sourceDepthPitch, destData, destRowPitch, destDepthPitch,
+                                               GenerateMip<R32F>);
+#else
+    UNIMPLEMENTED();
+#endif
+}
+
+void GenerateMipR32G32F_SSE2(size_t sourceWidth, size_t sourceHeight, size_t sourceDepth,
+                             const uint8_t *sourceData, size_t sourceRowPitch, size_t sourceDepthPitch,
+                             uint8_t *destData, size_t destRowPitch, size_t destDepthPitch)
+{
+#if defined(ANGLE_USE_SSE)
+    GenerateMipWithKernel<Float32Kernel<R32G32F>>(sourceWidth, sourceHeight, sourceDepth, sourceData,
+                                                  sourceRowPitch, sourceDepthPitch, destData, destRowPitch,
+                                                  destDepthPitch, GenerateMip<R32G32F>);
+#else
+    UNIMPLEMENTED();
+#endif
+}
+
+void GenerateMipR32G32B32A32F_SSE2(size_t sourceWidth, size_t sourceHeight, size_t sourceDepth,
+                                   const uint8_t *sourceData, size_t sourceRowPitch, size_t sourceDepthPitch,
+                                   uint8_t *destData, size_t destRowPitch, size_t destDepthPitch)
+{
+#if defined(ANGLE_USE_SSE)
+    GenerateMipWithKernel<Float32Kernel<R32G32B32A32F>>(sourceWidth, sourceHeight, sourceDepth, sourceData,
+                                                        sourceRowPitch, sourceDepthPitch, destData, destRowPitch,
+                                                        destDepthPitch, GenerateMip<R32G32B32A32F>);
+#else
+    UNIMPLEMENTED();
+#endif
+}
+
+}
@@ -0,0 +1,232 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// generatemip_unittest.cpp: Unit tests that the vectorized mip generation functions produce the
+// same levels as the scalar ones, and that sRGB levels are averaged in linear space.
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "common/platform.h"
+#include "libANGLE/renderer/d3d/generatemip.h"
+
+using namespace rx;
+
+namespace
+{
+
+struct MipTestImage
+{
+    MipTestImage(size_t width, size_t height, size_t depth, size_t texelBytes)
+        : width(width),
+          height(height),
+          depth(depth),
+          texelBytes(texelBytes),
+          // Pad the rows and slices so that functions which ignore the pitches are caught
+          sourceRowPitch(width * texelBytes + 8),
+          sourceDepthPitch(sourceRowPitch * height + 24),
+          destRowPitch(std::max<size_t>(1, width >> 1) * texelBytes + 16),
+          destDepthPitch(destRowPitch * std::max<size_t>(1, height >> 1) + 8),
+          source(sourceDepthPitch * depth)
+    {
+    }
+
+    std::vector<uint8_t> generate(MipGenerationFunction mipFunction) const
+    {
+        std::vector<uint8_t> dest(destDepthPitch * std::max<size_t>(1, depth >> 1), 0xCD);
+        mipFunction(width, height, depth, &source[0], sourceRowPitch, sourceDepthPitch,
+                    &dest[0], destRowPitch, destDepthPitch);
+        return dest;
+    }
+
+    size_t width;
+    size_t height;
+    size_t depth;
+    size_t texelBytes;
+    size_t sourceRowPitch;
+    size_t sourceDepthPitch;
+    size_t destRowPitch;
+    size_t destDepthPitch;
+    std::vector<uint8_t> source;
+};
+
+unsigned int NextRandom(unsigned int *seed)
+{
+    *seed = *seed * 1664525u + 1013904223u;
+    return *seed >> 8;
+}
+
+void FillBytes(std::vector<uint8_t> *data)
+{
+    unsigned int seed = 0x12345678u;
+    for (size_t i = 0; i < data->size(); i++)
+    {
+        (*data)[i] = static_cast<uint8_t>(NextRandom(&seed));
+    }
+}
+
+void FillFloats(std::vector<uint8_t> *data)
+{
+    unsigned int seed = 0x9ABCDEF0u;
+    float *floats = reinterpret_cast<float*>(&(*data)[0]);
+    for (size_t i = 0; i < data->size() / sizeof(float); i++)
+    {
+        floats[i] = static_cast<float>(NextRandom(&seed) % 20000) / 1000.0f - 10.0f;
+    }
+}
+
+// Random half floats, without infinities and NaNs whose sign and payload after averaging depend on
+// the order of the operands
+void FillHalfFloats(std::vector<uint8_t> *data)
+{
+    unsigned int seed = 0x2468ACE0u;
+    uint16_t *halves = reinterpret_cast<uint16_t*>(&(*data)[0]);
+    for (size_t i = 0; i < data->size() / sizeof(uint16_t); i++)
+    {
+        halves[i] = static_cast<uint16_t>(NextRandom(&seed));
+        if ((halves[i] & 0x7C00) == 0x7C00)
+        {
+            halves[i] &= 0xBFFF;
+        }
+    }
+}
+
+// Compares the levels generated by two functions from every shape of source, including ones that
+// are one texel wide, high or deep, odd sizes and rows that leave a remainder after the vectors.
+void CheckMipGeneration(MipGenerationFunction mipFunction, MipGenerationFunction referenceFunction,
+                        size_t texelBytes, void (*fill)(std::vector<uint8_t> *))
+{
+    const size_t sizes[] = { 1, 2, 3, 4, 7, 8, 9, 17, 34 };
+    const size_t depths[] = { 1, 2, 3 };
+
+    for (size_t width : sizes)
+    {
+        for (size_t height : sizes)
+        {
+            for (size_t depth : depths)
+            {
+                if (width == 1 && height == 1 && depth == 1)
+                {
+                    continue;
+                }
+
+                MipTestImage image(width, height, depth, texelBytes);
+                fill(&image.source);
+                EXPECT_TRUE(image.generate(referenceFunction) == image.generate(mipFunction))
+                    << width << "x" << height << "x" << depth;
+            }
+        }
+    }
+}
+
+#if defined(ANGLE_USE_SSE)
+
+bool CheckSSE2Support()
+{
+    if (!gl::supportsSSE2())
+    {
+        std::cout << "Test skipped because SSE2 is not available." << std::endl;
+        return false;
+    }
+    return true;
+}
+
+TEST(GenerateMipTest, R8G8B8A8SSE2)
+{
+    if (CheckSSE2Support())
+    {
+        CheckMipGeneration(GenerateMipR8G8B8A8_SSE2, GenerateMip<R8G8B8A8>, 4, FillBytes);
+        CheckMipGeneration(GenerateMipR8G8B8A8_SSE2, GenerateMip<B8G8R8A8>, 4, FillBytes);
+    }
+}
+
+TEST(GenerateMipTest, B8G8R8X8SSE2)
+{
+    if (CheckSSE2Support())
+    {
+        CheckMipGeneration(GenerateMipB8G8R8X8_SSE2, GenerateMip<B8G8R8X8>, 4, FillBytes);
+    }
+}
+
+// Random values cover half float denormals, which are converted one at a time.
+TEST(GenerateMipTest, HalfFloatSSE2)
+{
+    if (CheckSSE2Support())
+    {
+        CheckMipGeneration(GenerateMipR16F_SSE2, GenerateMipR16F, 2, FillHalfFloats);
+        CheckMipGeneration(GenerateMipR16G16F_SSE2, GenerateMipR16G16F, 4, FillHalfFloats);
+        CheckMipGeneration(GenerateMipR16G16B16A16F_SSE2, GenerateMipR16G16B16A16F, 8, FillHalfFloats);
+    }
+}
+
+TEST(GenerateMipTest, FloatSSE2)
+{
+    if (CheckSSE2Support())
+    {
+        CheckMipGeneration(GenerateMipR32F_SSE2, GenerateMip<R32F>, 4, FillFloats);
+        CheckMipGeneration(GenerateMipR32G32F_SSE2, GenerateMip<R32G32F>, 8, FillFloats);
+        CheckMipGeneration(GenerateMipR32G32B32A32F_SSE2, GenerateMip<R32G32B32A32F>, 16, FillFloats);
+    }
+}
+
+#endif // ANGLE_USE_SSE
+
+// Half floats are rounded once for each texel rather than after every pair of texels, where ties
+// that round up can add up.
+TEST(GenerateMipTest, HalfFloatRoundsOnce)
+{
+    MipTestImage image(2, 2, 2, 2);
+    const uint16_t values[] = { 0x3C01, 0x3C01, 0x3C01, 0x3C02 };
+    for (size_t i = 0; i < 8; i++)
+    {
+        size_t y = (i / 2) % 2;
+        size_t z = i / 4;
+        *reinterpret_cast<uint16_t*>(&image.source[(i % 2) * 2 + y * image.sourceRowPitch +
+                                                   z * image.sourceDepthPitch]) = values[i % 4];
+    }
+
+    // The exact average is 1.0012207, which is nearest to 0x3C01. Rounding each pair gives 0x3C02.
+    std::vector<uint8_t> dest = image.generate(GenerateMipR16F);
+    EXPECT_EQ(0x3C01, *reinterpret_cast<uint16_t*>(&dest[0]));
+}
+
+TEST(GenerateMipTest, SRGBRoundTrip)
+{
+    for (unsigned int value = 0; value < 256; value++)
+    {
+        EXPECT_EQ(value, LinearToSRGB8(SRGB8ToLinear(static_cast<uint8_t>(value))));
+    }
+}
+
+// Averaging black and white in linear space gives a lighter grey than averaging the encoded values.
+TEST(GenerateMipTest, SRGBAveragedInLinearSpace)
+{
+    MipTestImage image(2, 2, 1, 4);
+    const uint8_t texels[4][4] =
+    {
+        { 0, 0, 0, 255 }, { 255, 255, 255, 0 },
+        { 255, 255, 255, 0 }, { 0, 0, 0, 255 },
+    };
+    for (size_t y = 0; y < 2; y++)
+    {
+        for (size_t x = 0; x < 2; x++)
+        {
+            memcpy(&image.source[x * 4 + y * image.sourceRowPitch], texels[y * 2 + x], 4);
+        }
+    }
+
+    std::vector<uint8_t> dest = image.generate(GenerateMipR8G8B8A8SRGB);
+    EXPECT_EQ(188, dest[0]);
+    EXPECT_EQ(188, dest[1]);
+    EXPECT_EQ(188, dest[2]);
+    EXPECT_EQ(128, dest[3]);
+}
+
+}
@@ -0,0 +1,97 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// indexconversion.cpp: Defines the functions that copy and widen index data for the index buffers
+// of the D3D renderers.
+
+#include "libANGLE/renderer/d3d/indexconversion.h"
+
+#include "libANGLE/formatutils.h"
+
+namespace rx
+{
+
+namespace
+{
+
+template <typename SourceType, typename DestinationType>
+void ConvertTypedIndices(const SourceType *input, size_t count, DestinationType *output,
+                         bool primitiveRestart, gl::RangeUI *outRange)
+{
+    const SourceType restartIndex = std::numeric_limits<SourceType>::max();
+
+    SourceType minIndex = std::numeric_limits<SourceType>::max();
+    SourceType maxIndex = 0;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        SourceType index = input[i];
+        if (primitiveRestart && index == restartIndex)
+        {
+            if (output)
+            {
+                output[i] = std::numeric_limits<DestinationType>::max();
+            }
+            continue;
+        }
+
+        if (output)
+        {
+            output[i] = index;
+        }
+        minIndex = std::min(minIndex, index);
+        maxIndex = std::max(maxIndex, index);
+    }
+
+    if (outRange)
+    {
+        // The minimum is only above the maximum when no index was counted
+        *outRange = (minIndex > maxIndex) ? gl::RangeUI(0, 0) : gl::RangeUI(minIndex, maxIndex);
+    }
+}
+
+}
+
+void ConvertIndices(GLenum sourceType, GLenum destinationType, const void *input, size_t count,
+                    void *output, bool primitiveRestart, gl::RangeUI *outRange)
+{
+    // Primitive restart only changes the indices that are widened
+    if (sourceType == destinationType && output && !outRange)
+    {
+        memcpy(output, input, count * gl::GetTypeInfo(sourceType).bytes);
+        return;
+    }
+
+    if (sourceType == GL_UNSIGNED_BYTE)
+    {
+        ASSERT(destinationType == GL_UNSIGNED_SHORT);
+        ConvertTypedIndices(static_cast<const GLubyte*>(input), count, static_cast<GLushort*>(output),
+                            primitiveRestart, outRange);
+    }
+    else if (sourceType == GL_UNSIGNED_INT)
+    {
+        ASSERT(destinationType == GL_UNSIGNED_INT);
+        ConvertTypedIndices(static_cast<const GLuint*>(input), count, static_cast<GLuint*>(output),
+                            primitiveRestart, outRange);
+    }
+    else if (sourceType == GL_UNSIGNED_SHORT)
+    {
+        if (destinationType == GL_UNSIGNED_SHORT)
+        {
+            ConvertTypedIndices(static_cast<const GLushort*>(input), count, static_cast<GLushort*>(output),
+                                primitiveRestart, outRange);
+        }
+        else if (destinationType == GL_UNSIGNED_INT)
+        {
+            ConvertTypedIndices(static_cast<const GLushort*>(input), count, static_cast<GLuint*>(output),
+                                primitiveRestart, outRange);
+        }
+        else UNREACHABLE();
+    }
+    else UNREACHABLE();
+}
+
+}
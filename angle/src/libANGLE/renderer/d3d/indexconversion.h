@@ -0,0 +1,33 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// indexconversion.h: Defines the functions that copy and widen index data for the index buffers
+// of the D3D renderers.
+
+#ifndef LIBANGLE_RENDERER_D3D_INDEXCONVERSION_H_
+#define LIBANGLE_RENDERER_D3D_INDEXCONVERSION_H_
+
+#include <GLES2/gl2.h>
+
+#include "common/mathutil.h"
+
+namespace rx
+{
+
+// Copies count indices of sourceType to output as destinationType, which is the same type or a
+// wider one. When outRange isn't null, the range of the indices is computed in the same pass, and
+// when output is null only the range is. With primitiveRestart, the fixed restart index of the
+// source type is written as the one of the destination type and is left out of the range, which
+// is (0, 0) when every index restarts.
+void ConvertIndices(GLenum sourceType, GLenum destinationType, const void *input, size_t count,
+                    void *output, bool primitiveRestart, gl::RangeUI *outRange);
+
+void ConvertIndices_SSE2(GLenum sourceType, GLenum destinationType, const void *input, size_t count,
+                         void *output, bool primitiveRestart, gl::RangeUI *outRange);
+
+}
+
+#endif // LIBANGLE_RENDERER_D3D_INDEXCONVERSION_H_
@@ -0,0 +1,214 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// indexconversionSSE2.cpp: Defines the index conversion functions that use SSE2. It's
+// in a separated file for GCC, which can enable SSE usage only per-file,
+// not for code blocks that use SSE2 explicitly.
+
+#include "libANGLE/renderer/d3d/indexconversion.h"
+
+#include "common/platform.h"
+#include "libANGLE/formatutils.h"
+
+#ifdef ANGLE_USE_SSE
+#include <emmintrin.h>
+#endif
+
+namespace rx
+{
+
+#if defined(ANGLE_USE_SSE)
+namespace
+{
+
+// SSE2 only compares unsigned bytes and signed words and dwords, so the running minimum and
+// maximum of wider indices are kept biased into the signed range.
+struct UByteIndices
+{
+    typedef GLubyte Type;
+    enum { IndicesPerVector = 16 };
+
+    static __m128i RestartMask(__m128i indices) { return _mm_cmpeq_epi8(indices, _mm_set1_epi8(-1)); }
+    static __m128i Bias(__m128i indices) { return indices; }
+    static __m128i Min(__m128i a, __m128i b) { return _mm_min_epu8(a, b); }
+    static __m128i Max(__m128i a, __m128i b) { return _mm_max_epu8(a, b); }
+};
+
+struct UShortIndices
+{
+    typedef GLushort Type;
+    enum { IndicesPerVector = 8 };
+
+    static __m128i RestartMask(__m128i indices) { return _mm_cmpeq_epi16(indices, _mm_set1_epi16(-1)); }
+    static __m128i Bias(__m128i indices) { return _mm_xor_si128(indices, _mm_set1_epi16(static_cast<short>(0x8000))); }
+    static __m128i Min(__m128i a, __m128i b) { return _mm_min_epi16(a, b); }
+    static __m128i Max(__m128i a, __m128i b) { return _mm_max_epi16(a, b); }
+};
+
+struct UIntIndices
+{
+    typedef GLuint Type;
+    enum { IndicesPerVector = 4 };
+
+    static __m128i RestartMask(__m128i indices) { return _mm_cmpeq_epi32(indices, _mm_set1_epi32(-1)); }
+    static __m128i Bias(__m128i indices) { return _mm_xor_si128(indices, _mm_set1_epi32(static_cast<int>(0x80000000u))); }
+
+    // There is no dword min or max in SSE2, so select with the comparison masks
+    static __m128i Min(__m128i a, __m128i b)
+    {
+        __m128i greater = _mm_cmpgt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(greater, b), _mm_andnot_si128(greater, a));
+    }
+
+    static __m128i Max(__m128i a, __m128i b)
+    {
+        __m128i greater = _mm_cmpgt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(greater, a), _mm_andnot_si128(greater, b));
+    }
+};
+
+// Writes a vector of indices as the destination type. Widened indices take their high halves from
+// highBits, which is all ones for the restart indices in primitive restart mode and zero otherwise.
+inline void StoreIndices(const GLubyte *, __m128i indices, __m128i highBits, GLushort *output)
+{
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(output),     _mm_unpacklo_epi8(indices, highBits));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(output + 8), _mm_unpackhi_epi8(indices, highBits));
+}
+
+inline void StoreIndices(const GLushort *, __m128i indices, __m128i, GLushort *output)
+{
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(output), indices);
+}
+
+inline void StoreIndices(const GLushort *, __m128i indices, __m128i highBits, GLuint *output)
+{
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(output),     _mm_unpacklo_epi16(indices, highBits));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(output + 4), _mm_unpackhi_epi16(indices, highBits));
+}
+
+inline void StoreIndices(const GLuint *, __m128i indices, __m128i, GLuint *output)
+{
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(output), indices);
+}
+
+template <typename Traits, typename DestinationType>
+void ConvertTypedIndices(const typename Traits::Type *input, size_t count, DestinationType *output,
+                         bool primitiveRestart, gl::RangeUI *outRange)
+{
+    typedef typename Traits::Type SourceType;
+    const size_t vectorCount = count - (count % Traits::IndicesPerVector);
+
+    __m128i minIndices = Traits::Bias(_mm_set1_epi8(-1));
+    __m128i maxIndices = Traits::Bias(_mm_setzero_si128());
+    for (size_t i = 0; i < vectorCount; i += Traits::IndicesPerVector)
+    {
+        __m128i indices = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+        __m128i restarts = primitiveRestart ? Traits::RestartMask(indices) : _mm_setzero_si128();
+
+        if (output)
+        {
+            StoreIndices(input + i, indices, restarts, output + i);
+        }
+
+        if (outRange)
+        {
+            // Restart indices are the largest value of the type, so they can't lower the minimum,
+            // and they are cleared before they can raise the maximum.
+            minIndices = Traits::Min(minIndices, Traits::Bias(indices));
+            maxIndices = Traits::Max(maxIndices, Traits::Bias(_mm_andnot_si128(restarts, indices)));
+        }
+    }
+
+    SourceType minIndex = std::numeric_limits<SourceType>::max();
+    SourceType maxIndex = 0;
+    if (outRange && vectorCount > 0)
+    {
+        SourceType minLanes[Traits::IndicesPerVector];
+        SourceType maxLanes[Traits::IndicesPerVector];
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(minLanes), Traits::Bias(minIndices));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(maxLanes), Traits::Bias(maxIndices));
+        for (size_t lane = 0; lane < Traits::IndicesPerVector; lane++)
+        {
+            minIndex = std::min(minIndex, minLanes[lane]);
+            maxIndex = std::max(maxIndex, maxLanes[lane]);
+        }
+    }
+
+    const SourceType restartIndex = std::numeric_limits<SourceType>::max();
+    for (size_t i = vectorCount; i < count; i++)
+    {
+        SourceType index = input[i];
+        if (primitiveRestart && index == restartIndex)
+        {
+            if (output)
+            {
+                output[i] = std::numeric_limits<DestinationType>::max();
+            }
+            continue;
+        }
+
+        if (output)
+        {
+            output[i] = index;
+        }
+        minIndex = std::min(minIndex, index);
+        maxIndex = std::max(maxIndex, index);
+    }
+
+    if (outRange)
+    {
+        // The minimum is only above the maximum when no index was counted
+        *outRange = (minIndex > maxIndex) ? gl::RangeUI(0, 0) : gl::RangeUI(minIndex, maxIndex);
+    }
+}
+
+}
+#endif
+
+void ConvertIndices_SSE2(GLenum sourceType, GLenum destinationType, const void *input, size_t count,
+                         void *output, bool primitiveRestart, gl::RangeUI *outRange)
+{
+#if defined(ANGLE_USE_SSE)
+    // Primitive restart only changes the indices that are widened
+    if (sourceType == destinationType && output && !outRange)
+    {
+        memcpy(output, input, count * gl::GetTypeInfo(sourceType).bytes);
+        return;
+    }
+
+    if (sourceType == GL_UNSIGNED_BYTE)
+    {
+        ASSERT(destinationType == GL_UNSIGNED_SHORT);
+        ConvertTypedIndices<UByteIndices>(static_cast<const GLubyte*>(input), count,
+                                          static_cast<GLushort*>(output), primitiveRestart, outRange);
+    }
+    else if (sourceType == GL_UNSIGNED_INT)
+    {
+        ASSERT(destinationType == GL_UNSIGNED_INT);
+        ConvertTypedIndices<UIntIndices>(static_cast<const GLuint*>(input), count,
+                                         static_cast<GLuint*>(output), primitiveRestart, outRange);
+    }
+    else if (sourceType == GL_UNSIGNED_SHORT)
+    {
+        if (destinationType == GL_UNSIGNED_SHORT)
+        {
+            ConvertTypedIndices<UShortIndices>(static_cast<const GLushort*>(input), count,
+                                               static_cast<GLushort*>(output), primitiveRestart, outRange);
+        }
+        else if (destinationType == GL_UNSIGNED_INT)
+        {
+            ConvertTypedIndices<UShortIndices>(static_cast<const GLushort*>(input), count,
+                                               static_cast<GLuint*>(output), primitiveRestart, outRange);
+        }
+        else UNREACHABLE();
+    }
+    else UNREACHABLE();
+#else
+    UNIMPLEMENTED();
+#endif
+}
+
+}
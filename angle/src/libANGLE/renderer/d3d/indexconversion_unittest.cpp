@@ -0,0 +1,162 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// indexconversion_unittest.cpp: Unit tests that the vectorized index conversions produce the same
+// indices and ranges as the scalar ones, and that primitive restart indices are rewritten.
+
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "common/platform.h"
+#include "libANGLE/renderer/d3d/indexconversion.h"
+
+using namespace rx;
+
+namespace
+{
+
+TEST(IndexConversionTest, WidensIndices)
+{
+    const GLubyte input[] = { 3, 0, 200, 7 };
+    GLushort output[4];
+    gl::RangeUI range;
+    ConvertIndices(GL_UNSIGNED_BYTE, GL_UNSIGNED_SHORT, input, 4, output, false, &range);
+
+    EXPECT_EQ(3u, output[0]);
+    EXPECT_EQ(0u, output[1]);
+    EXPECT_EQ(200u, output[2]);
+    EXPECT_EQ(7u, output[3]);
+    EXPECT_EQ(0u, range.start);
+    EXPECT_EQ(200u, range.end);
+}
+
+// The restart index of the source type becomes the one of the destination type, and isn't counted
+// in the range.
+TEST(IndexConversionTest, RewritesRestartIndices)
+{
+    const GLushort input[] = { 9, 0xFFFF, 4, 0xFFFF, 6 };
+    GLuint output[5];
+    gl::RangeUI range;
+    ConvertIndices(GL_UNSIGNED_SHORT, GL_UNSIGNED_INT, input, 5, output, true, &range);
+
+    EXPECT_EQ(9u, output[0]);
+    EXPECT_EQ(0xFFFFFFFFu, output[1]);
+    EXPECT_EQ(4u, output[2]);
+    EXPECT_EQ(0xFFFFFFFFu, output[3]);
+    EXPECT_EQ(6u, output[4]);
+    EXPECT_EQ(4u, range.start);
+    EXPECT_EQ(9u, range.end);
+
+    // Without primitive restart, the largest index is an index like the others
+    ConvertIndices(GL_UNSIGNED_SHORT, GL_UNSIGNED_INT, input, 5, output, false, &range);
+    EXPECT_EQ(0xFFFFu, output[1]);
+    EXPECT_EQ(4u, range.start);
+    EXPECT_EQ(0xFFFFu, range.end);
+}
+
+TEST(IndexConversionTest, RestartIndicesOnly)
+{
+    const GLubyte input[] = { 0xFF, 0xFF };
+    gl::RangeUI range(1, 2);
+    ConvertIndices(GL_UNSIGNED_BYTE, GL_UNSIGNED_SHORT, input, 2, nullptr, true, &range);
+
+    EXPECT_EQ(0u, range.start);
+    EXPECT_EQ(0u, range.end);
+}
+
+#if defined(ANGLE_USE_SSE)
+
+unsigned int NextRandom(unsigned int *seed)
+{
+    *seed = *seed * 1664525u + 1013904223u;
+    return *seed >> 8;
+}
+
+// Random indices, of which about one in eight is the largest value of the type
+template <typename SourceType>
+std::vector<SourceType> MakeIndices(size_t count, unsigned int seed)
+{
+    std::vector<SourceType> indices(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        unsigned int random = NextRandom(&seed);
+        unsigned int high = NextRandom(&seed) << 16;
+        indices[i] = (random % 8 == 0) ? std::numeric_limits<SourceType>::max()
+                                       : static_cast<SourceType>(high ^ NextRandom(&seed));
+    }
+    return indices;
+}
+
+template <typename SourceType, typename DestinationType>
+void CheckConversion(GLenum sourceType, GLenum destinationType)
+{
+    if (!gl::supportsSSE2())
+    {
+        std::cout << "Test skipped because SSE2 is not available." << std::endl;
+        return;
+    }
+
+    for (size_t count = 1; count <= 40; count++)
+    {
+        std::vector<SourceType> input = MakeIndices<SourceType>(count, static_cast<unsigned int>(count));
+
+        for (int primitiveRestart = 0; primitiveRestart < 2; primitiveRestart++)
+        {
+            // The elements past the last index catch functions that write too much
+            std::vector<DestinationType> expected(count + 8, 0xCD);
+            std::vector<DestinationType> actual(count + 8, 0xCD);
+            gl::RangeUI expectedRange;
+            gl::RangeUI actualRange;
+
+            ConvertIndices(sourceType, destinationType, &input[0], count, &expected[0],
+                           primitiveRestart != 0, &expectedRange);
+            ConvertIndices_SSE2(sourceType, destinationType, &input[0], count, &actual[0],
+                                primitiveRestart != 0, &actualRange);
+            EXPECT_EQ(expected, actual) << count << " indices, primitive restart " << primitiveRestart;
+            EXPECT_EQ(expectedRange.start, actualRange.start) << count << " indices, primitive restart " << primitiveRestart;
+            EXPECT_EQ(expectedRange.end, actualRange.end) << count << " indices, primitive restart " << primitiveRestart;
+
+            // Converting without the range, and computing the range alone
+            std::vector<DestinationType> converted(count + 8, 0xCD);
+            ConvertIndices_SSE2(sourceType, destinationType, &input[0], count, &converted[0],
+                                primitiveRestart != 0, nullptr);
+            EXPECT_EQ(expected, converted) << count << " indices, primitive restart " << primitiveRestart;
+
+            gl::RangeUI range;
+            ConvertIndices_SSE2(sourceType, destinationType, &input[0], count, nullptr,
+                                primitiveRestart != 0, &range);
+            EXPECT_EQ(expectedRange.start, range.start) << count << " indices, primitive restart " << primitiveRestart;
+            EXPECT_EQ(expectedRange.end, range.end) << count << " indices, primitive restart " << primitiveRestart;
+        }
+    }
+}
+
+TEST(IndexConversionTest, UnsignedByteToUnsignedShortSSE2)
+{
+    CheckConversion<GLubyte, GLushort>(GL_UNSIGNED_BYTE, GL_UNSIGNED_SHORT);
+}
+
+TEST(IndexConversionTest, UnsignedShortSSE2)
+{
+    CheckConversion<GLushort, GLushort>(GL_UNSIGNED_SHORT, GL_UNSIGNED_SHORT);
+}
+
+TEST(IndexConversionTest, UnsignedShortToUnsignedIntSSE2)
+{
+    CheckConversion<GLushort, GLuint>(GL_UNSIGNED_SHORT, GL_UNSIGNED_INT);
+}
+
+TEST(IndexConversionTest, UnsignedIntSSE2)
+{
+    CheckConversion<GLuint, GLuint>(GL_UNSIGNED_INT, GL_UNSIGNED_INT);
+}
+
+#endif // ANGLE_USE_SSE
+
+}
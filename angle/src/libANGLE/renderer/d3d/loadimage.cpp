@@ -8,9 +8,32 @@
 
 #include "libANGLE/renderer/d3d/loadimage.h"
 
+#include "common/platform.h"
+#include "libANGLE/features.h"
+
+#include <algorithm>
+
+#if ANGLE_MULTITHREADED_TEXTURE_LOAD == ANGLE_ENABLED && !defined(ANGLE_ENABLE_WINDOWS_STORE)
+// Windows Store applications can't wait on async tasks from every thread, so they load serially.
+#define ANGLE_PARALLEL_IMAGE_LOAD
+#include <future>
+#include <thread>
+#include <vector>
+#endif
+
 namespace rx
 {
 
+namespace
+{
+
+// Each thread is given at least this many bytes of output, so that the cost of starting the task
+// is small next to the conversion.
+const size_t MinParallelLoadBytes = 1024 * 1024;
+const size_t MaxParallelLoadTasks = 8;
+
+}
+
 void LoadA8ToRGBA8(size_t width, size_t height, size_t depth,
                    const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
                    uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
@@ -687,11 +710,16 @@ void LoadRGB32FToRGBA16F(size_t width, size_t height, size_t depth,
         {
             const float *source = OffsetDataPointer<float>(input, y, z, inputRowPitch, inputDepthPitch);
             uint16_t *dest = OffsetDataPointer<uint16_t>(output, y, z, outputRowPitch, outputDepthPitch);
+
+            // Convert the whole row into the end of the destination row, then spread it out to
+            // four channels from the start. Each texel is read before it can be overwritten.
+            const uint16_t *converted = dest + width;
+            gl::float32ToFloat16N(source, width * 3, dest + width);
             for (size_t x = 0; x < width; x++)
             {
-                dest[x * 4 + 0] = gl::float32ToFloat16(source[x * 3 + 0]);
-                dest[x * 4 + 1] = gl::float32ToFloat16(source[x * 3 + 1]);
-                dest[x * 4 + 2] = gl::float32ToFloat16(source[x * 3 + 2]);
+                dest[x * 4 + 0] = converted[x * 3 + 0];
+                dest[x * 4 + 1] = converted[x * 3 + 1];
+                dest[x * 4 + 2] = converted[x * 3 + 2];
                 dest[x * 4 + 3] = gl::Float16One;
             }
         }
@@ -735,4 +763,82 @@ void LoadR32ToR24G8(size_t width, size_t height, size_t depth,
     }
 }
 
+void LoadImageParallel(LoadImageFunction loadFunction, size_t inputBlockHeight, size_t outputBlockHeight,
+                       size_t width, size_t height, size_t depth,
+                       const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                       uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+    ASSERT(inputBlockHeight > 0 && outputBlockHeight > 0);
+    ASSERT(inputBlockHeight % outputBlockHeight == 0);
+
+#if defined(ANGLE_PARALLEL_IMAGE_LOAD)
+    // Bands hold whole rows of the input, which each fill one or more rows of the output
+    const size_t blockRows = (height + inputBlockHeight - 1) / inputBlockHeight;
+    const size_t outputRowsPerBlockRow = inputBlockHeight / outputBlockHeight;
+    const size_t outputBytes = outputRowPitch * ((height + outputBlockHeight - 1) / outputBlockHeight) * depth;
+
+    size_t taskCount = std::min(outputBytes / MinParallelLoadBytes, MaxParallelLoadTasks);
+    taskCount = std::min(taskCount, static_cast<size_t>(std::thread::hardware_concurrency()));
+
+    // Arrays and 3D textures are split into bands of whole slices when there are enough of them,
+    // everything else into bands of rows that run through all of the slices.
+    const bool splitSlices = (depth >= taskCount);
+    const size_t bandUnits = splitSlices ? depth : blockRows;
+    taskCount = std::min(taskCount, bandUnits);
+
+    if (taskCount > 1)
+    {
+        std::vector<std::future<void>> tasks;
+        tasks.reserve(taskCount - 1);
+
+        for (size_t task = 0; task < taskCount; task++)
+        {
+            const size_t bandBegin = bandUnits * task / taskCount;
+            const size_t bandEnd = bandUnits * (task + 1) / taskCount;
+
+            size_t bandHeight = height;
+            size_t bandDepth = depth;
+            const uint8_t *bandInput = input;
+            uint8_t *bandOutput = output;
+
+            if (splitSlices)
+            {
+                bandDepth = bandEnd - bandBegin;
+                bandInput += bandBegin * inputDepthPitch;
+                bandOutput += bandBegin * outputDepthPitch;
+            }
+            else
+            {
+                bandHeight = std::min(bandEnd * inputBlockHeight, height) - bandBegin * inputBlockHeight;
+                bandInput += bandBegin * inputRowPitch;
+                bandOutput += bandBegin * outputRowsPerBlockRow * outputRowPitch;
+            }
+
+            // The calling thread loads the last band itself
+            if (task + 1 < taskCount)
+            {
+                tasks.push_back(std::async(std::launch::async, [=]()
+                {
+                    loadFunction(width, bandHeight, bandDepth, bandInput, inputRowPitch, inputDepthPitch,
+                                 bandOutput, outputRowPitch, outputDepthPitch);
+                }));
+            }
+            else
+            {
+                loadFunction(width, bandHeight, bandDepth, bandInput, inputRowPitch, inputDepthPitch,
+                             bandOutput, outputRowPitch, outputDepthPitch);
+            }
+        }
+
+        for (size_t task = 0; task < tasks.size(); task++)
+        {
+            tasks[task].wait();
+        }
+        return;
+    }
+#endif // ANGLE_PARALLEL_IMAGE_LOAD
+
+    loadFunction(width, height, depth, input, inputRowPitch, inputDepthPitch, output, outputRowPitch, outputDepthPitch);
+}
+
 }
@@ -97,10 +97,7 @@ inline void Load32FTo16F(size_t width, size_t height, size_t depth,
             const float *source = OffsetDataPointer<float>(input, y, z, inputRowPitch, inputDepthPitch);
             uint16_t *dest = OffsetDataPointer<uint16_t>(output, y, z, outputRowPitch, outputDepthPitch);
 
-            for (size_t x = 0; x < elementWidth; x++)
-            {
-                dest[x] = gl::float32ToFloat16(source[x]);
-            }
+            gl::float32ToFloat16N(source, elementWidth, dest);
         }
     }
 }
@@ -153,4 +150,19 @@ inline void Initialize4ComponentData(size_t width, size_t height, size_t depth,
     }
 }
 
+template <FallbackPredicateFunction pred, LoadImageFunction prefered, LoadImageFunction fallback>
+inline void FallbackLoad(size_t width, size_t height, size_t depth,
+                         const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                         uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+    if (pred())
+    {
+        prefered(width, height, depth, input, inputRowPitch, inputDepthPitch, output, outputRowPitch, outputDepthPitch);
+    }
+    else
+    {
+        fallback(width, height, depth, input, inputRowPitch, inputDepthPitch, output, outputRowPitch, outputDepthPitch);
+    }
+}
+
 }
@@ -0,0 +1,433 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// loadimageETC.cpp: Defines the load functions that decode the ETC2 and EAC compressed formats of
+// ES 3.0, for the D3D renderers which have no native support for them. The block layouts are
+// described in appendix C.1 of the ES 3.0 spec.
+
+#include "libANGLE/renderer/d3d/loadimage.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace rx
+{
+
+namespace
+{
+
+// The intensity modifiers of the individual and differential modes, for the pixel indices that
+// add to the base color. The other two indices subtract the same values.
+const int IntensityModifiers[8][2] =
+{
+    {  2,   8 },
+    {  5,  17 },
+    {  9,  29 },
+    { 13,  42 },
+    { 18,  60 },
+    { 24,  80 },
+    { 33, 106 },
+    { 47, 183 },
+};
+
+// The distances between the paint colors of the T and H modes
+const int PaintDistances[8] = { 3, 6, 11, 16, 23, 32, 41, 64 };
+
+const int EACModifiers[16][8] =
+{
+    { -3, -6,  -9, -15, 2, 5, 8, 14 },
+    { -3, -7, -10, -13, 2, 6, 9, 12 },
+    { -2, -5,  -8, -13, 1, 4, 7, 12 },
+    { -2, -4,  -6, -13, 1, 3, 5, 12 },
+    { -3, -6,  -8, -12, 2, 5, 7, 11 },
+    { -3, -7,  -9, -11, 2, 6, 8, 10 },
+    { -4, -7,  -8, -11, 3, 6, 7, 10 },
+    { -3, -5,  -8, -11, 2, 4, 7, 10 },
+    { -2, -6,  -8, -10, 1, 5, 7,  9 },
+    { -2, -5,  -8, -10, 1, 4, 7,  9 },
+    { -2, -4,  -8, -10, 1, 3, 7,  9 },
+    { -2, -5,  -7, -10, 1, 4, 6,  9 },
+    { -3, -4,  -7, -10, 2, 3, 6,  9 },
+    { -1, -2,  -3, -10, 0, 1, 2,  9 },
+    { -4, -6,  -8,  -9, 3, 5, 7,  8 },
+    { -3, -5,  -7,  -9, 2, 4, 6,  8 },
+};
+
+// Blocks are 64-bit words stored with their most significant byte first
+inline uint64_t ReadBlock(const uint8_t *data)
+{
+    uint64_t block = 0;
+    for (size_t i = 0; i < 8; i++)
+    {
+        block = (block << 8) | data[i];
+    }
+    return block;
+}
+
+inline int Bits(uint64_t block, unsigned int lowBit, unsigned int count)
+{
+    return static_cast<int>((block >> lowBit) & ((1u << count) - 1));
+}
+
+inline int Extend4(int value) { return (value << 4) | value; }
+inline int Extend5(int value) { return (value << 3) | (value >> 2); }
+inline int Extend6(int value) { return (value << 2) | (value >> 4); }
+inline int Extend7(int value) { return (value << 1) | (value >> 6); }
+
+inline int Clamp255(int value)
+{
+    return std::min(std::max(value, 0), 255);
+}
+
+inline uint32_t PackRGBA8(int red, int green, int blue)
+{
+    return 0xFF000000u | (Clamp255(blue) << 16) | (Clamp255(green) << 8) | Clamp255(red);
+}
+
+// The four colors that the pixels of a subblock in individual or differential mode select from.
+// With punchthrough alpha and the opaque bit cleared, the first index adds nothing to the base
+// color and the third one is transparent black.
+void ComputeSubblockColors(int red, int green, int blue, int table, bool transparent, uint32_t colors[4])
+{
+    const int smallModifier = transparent ? 0 : IntensityModifiers[table][0];
+    const int largeModifier = IntensityModifiers[table][1];
+
+    colors[0] = PackRGBA8(red + smallModifier, green + smallModifier, blue + smallModifier);
+    colors[1] = PackRGBA8(red + largeModifier, green + largeModifier, blue + largeModifier);
+    colors[2] = transparent ? 0 : PackRGBA8(red - smallModifier, green - smallModifier, blue - smallModifier);
+    colors[3] = PackRGBA8(red - largeModifier, green - largeModifier, blue - largeModifier);
+}
+
+// Each pixel has a two bit index, with its high bit in the second 16 bits of the block and its low
+// bit in the first 16. Pixels are numbered down the columns.
+inline int PixelIndex(uint32_t indexBits, size_t pixel)
+{
+    return (((indexBits >> (pixel + 16)) & 1) << 1) | ((indexBits >> pixel) & 1);
+}
+
+void DecodePaintColors(uint64_t block, const uint32_t colors[4], uint32_t *pixels)
+{
+    const uint32_t indexBits = static_cast<uint32_t>(block);
+    for (size_t pixel = 0; pixel < 16; pixel++)
+    {
+        pixels[(pixel & 3) * 4 + (pixel >> 2)] = colors[PixelIndex(indexBits, pixel)];
+    }
+}
+
+void DecodeTMode(uint64_t block, bool transparent, uint32_t *pixels)
+{
+    const int red1 = Extend4((Bits(block, 59, 2) << 2) | Bits(block, 56, 2));
+    const int green1 = Extend4(Bits(block, 52, 4));
+    const int blue1 = Extend4(Bits(block, 48, 4));
+    const int red2 = Extend4(Bits(block, 44, 4));
+    const int green2 = Extend4(Bits(block, 40, 4));
+    const int blue2 = Extend4(Bits(block, 36, 4));
+    const int distance = PaintDistances[(Bits(block, 34, 2) << 1) | Bits(block, 32, 1)];
+
+    uint32_t colors[4];
+    colors[0] = PackRGBA8(red1, green1, blue1);
+    colors[1] = PackRGBA8(red2 + distance, green2 + distance, blue2 + distance);
+    colors[2] = transparent ? 0 : PackRGBA8(red2, green2, blue2);
+    colors[3] = PackRGBA8(red2 - distance, green2 - distance, blue2 - distance);
+    DecodePaintColors(block, colors, pixels);
+}
+
+void DecodeHMode(uint64_t block, bool transparent, uint32_t *pixels)
+{
+    const int packed1 = (Bits(block, 59, 4) << 8) |
+                        (((Bits(block, 56, 3) << 1) | Bits(block, 52, 1)) << 4) |
+                        ((Bits(block, 51, 1) << 3) | Bits(block, 47, 3));
+    const int packed2 = (Bits(block, 43, 4) << 8) | (Bits(block, 39, 4) << 4) | Bits(block, 35, 4);
+
+    // The order of the base colors holds the lowest bit of the distance index
+    const int distanceIndex = (Bits(block, 34, 1) << 2) | (Bits(block, 32, 1) << 1) | (packed1 >= packed2 ? 1 : 0);
+    const int distance = PaintDistances[distanceIndex];
+
+    const int red1 = Extend4(packed1 >> 8);
+    const int green1 = Extend4((packed1 >> 4) & 0xF);
+    const int blue1 = Extend4(packed1 & 0xF);
+    const int red2 = Extend4(packed2 >> 8);
+    const int green2 = Extend4((packed2 >> 4) & 0xF);
+    const int blue2 = Extend4(packed2 & 0xF);
+
+    uint32_t colors[4];
+    colors[0] = PackRGBA8(red1 + distance, green1 + distance, blue1 + distance);
+    colors[1] = PackRGBA8(red1 - distance, green1 - distance, blue1 - distance);
+    colors[2] = transparent ? 0 : PackRGBA8(red2 + distance, green2 + distance, blue2 + distance);
+    colors[3] = PackRGBA8(red2 - distance, green2 - distance, blue2 - distance);
+    DecodePaintColors(block, colors, pixels);
+}
+
+// Planar blocks are always opaque
+void DecodePlanarMode(uint64_t block, uint32_t *pixels)
+{
+    const int redO = Extend6(Bits(block, 57, 6));
+    const int greenO = Extend7((Bits(block, 56, 1) << 6) | Bits(block, 49, 6));
+    const int blueO = Extend6((Bits(block, 48, 1) << 5) | (Bits(block, 43, 2) << 3) | Bits(block, 39, 3));
+    const int redH = Extend6((Bits(block, 34, 5) << 1) | Bits(block, 32, 1));
+    const int greenH = Extend7(Bits(block, 25, 7));
+    const int blueH = Extend6(Bits(block, 19, 6));
+    const int redV = Extend6(Bits(block, 13, 6));
+    const int greenV = Extend7(Bits(block, 6, 7));
+    const int blueV = Extend6(Bits(block, 0, 6));
+
+    for (int y = 0; y < 4; y++)
+    {
+        for (int x = 0; x < 4; x++)
+        {
+            pixels[y * 4 + x] = PackRGBA8((x * (redH - redO) + y * (redV - redO) + 4 * redO + 2) >> 2,
+                                          (x * (greenH - greenO) + y * (greenV - greenO) + 4 * greenO + 2) >> 2,
+                                          (x * (blueH - blueO) + y * (blueV - blueO) + 4 * blueO + 2) >> 2);
+        }
+    }
+}
+
+// Decodes an ETC2 color block into 16 RGBA8 pixels, stored row by row. ETC1 blocks are the ETC2
+// blocks that use the individual and differential modes only.
+void DecodeETC2ColorBlock(uint64_t block, bool punchthroughAlpha, uint32_t *pixels)
+{
+    // With punchthrough alpha, the bit that selects the differential mode is the opaque bit
+    // instead, and blocks are always in differential mode or in one of the modes it overflows to.
+    const bool differential = punchthroughAlpha || Bits(block, 33, 1) != 0;
+    const bool transparent = punchthroughAlpha && Bits(block, 33, 1) == 0;
+
+    uint32_t subblockColors[2][4];
+    if (!differential)
+    {
+        ComputeSubblockColors(Extend4(Bits(block, 60, 4)), Extend4(Bits(block, 52, 4)), Extend4(Bits(block, 44, 4)),
+                              Bits(block, 37, 3), false, subblockColors[0]);
+        ComputeSubblockColors(Extend4(Bits(block, 56, 4)), Extend4(Bits(block, 48, 4)), Extend4(Bits(block, 40, 4)),
+                              Bits(block, 34, 3), false, subblockColors[1]);
+    }
+    else
+    {
+        // The deltas are three bit two's complement values
+        const int red = Bits(block, 59, 5);
+        const int green = Bits(block, 51, 5);
+        const int blue = Bits(block, 43, 5);
+        const int red2 = red + (Bits(block, 56, 3) ^ 4) - 4;
+        const int green2 = green + (Bits(block, 48, 3) ^ 4) - 4;
+        const int blue2 = blue + (Bits(block, 40, 3) ^ 4) - 4;
+
+        // A second color that overflows selects one of the modes added in ETC2
+        if (red2 < 0 || red2 > 31)
+        {
+            DecodeTMode(block, transparent, pixels);
+            return;
+        }
+        if (green2 < 0 || green2 > 31)
+        {
+            DecodeHMode(block, transparent, pixels);
+            return;
+        }
+        if (blue2 < 0 || blue2 > 31)
+        {
+            DecodePlanarMode(block, pixels);
+            return;
+        }
+
+        ComputeSubblockColors(Extend5(red), Extend5(green), Extend5(blue), Bits(block, 37, 3), transparent,
+                              subblockColors[0]);
+        ComputeSubblockColors(Extend5(red2), Extend5(green2), Extend5(blue2), Bits(block, 34, 3), transparent,
+                              subblockColors[1]);
+    }
+
+    // The subblocks are the left and right halves of the block, or the top and bottom ones when
+    // the flip bit is set
+    const bool flip = Bits(block, 32, 1) != 0;
+    const uint32_t indexBits = static_cast<uint32_t>(block);
+    for (size_t pixel = 0; pixel < 16; pixel++)
+    {
+        const size_t x = pixel >> 2;
+        const size_t y = pixel & 3;
+        const size_t subblock = (flip ? y : x) >> 1;
+        pixels[y * 4 + x] = subblockColors[subblock][PixelIndex(indexBits, pixel)];
+    }
+}
+
+inline uint8_t ComputeEACAlpha(int base, int modifier, int multiplier)
+{
+    return static_cast<uint8_t>(Clamp255(base + modifier * multiplier));
+}
+
+// 11 bit values are widened to 16 bits by replicating their high bits
+inline uint16_t ComputeEACUnsignedR11(int base, int modifier, int multiplier)
+{
+    const int scaledModifier = (multiplier == 0) ? modifier : modifier * multiplier * 8;
+    const int value = std::min(std::max(base * 8 + 4 + scaledModifier, 0), 2047);
+    return static_cast<uint16_t>((value << 5) | (value >> 6));
+}
+
+inline uint16_t ComputeEACSignedR11(int base, int modifier, int multiplier)
+{
+    // The base is a two's complement byte, where -128 means the same as -127
+    const int signedBase = std::max(static_cast<int>(static_cast<int8_t>(base)), -127);
+    const int scaledModifier = (multiplier == 0) ? modifier : modifier * multiplier * 8;
+    const int value = std::min(std::max(signedBase * 8 + scaledModifier, -1023), 1023);
+    const int magnitude = std::abs(value);
+    const int widened = (magnitude << 5) | (magnitude >> 5);
+    return static_cast<uint16_t>(value < 0 ? -widened : widened);
+}
+
+// Decodes an EAC block, whose pixels each select one of eight values computed from its base
+// codeword, modifier table and multiplier. The 16 values are written row by row, pixelStride
+// elements apart, so that they can fill one channel of a wider pixel.
+template <typename T, T (*computeValue)(int, int, int)>
+void DecodeEACBlock(uint64_t block, T *pixels, size_t pixelStride)
+{
+    const int base = Bits(block, 56, 8);
+    const int multiplier = Bits(block, 52, 4);
+    const int *modifiers = EACModifiers[Bits(block, 48, 4)];
+
+    T values[8];
+    for (size_t i = 0; i < 8; i++)
+    {
+        values[i] = computeValue(base, modifiers[i], multiplier);
+    }
+
+    // Three bit indices, from the most significant bits down, with the pixels numbered down the
+    // columns
+    for (size_t pixel = 0; pixel < 16; pixel++)
+    {
+        const size_t index = static_cast<size_t>(block >> (45 - 3 * pixel)) & 7;
+        pixels[((pixel & 3) * 4 + (pixel >> 2)) * pixelStride] = values[index];
+    }
+}
+
+void DecodeRGB8Block(const uint8_t *source, uint32_t *pixels)
+{
+    DecodeETC2ColorBlock(ReadBlock(source), false, pixels);
+}
+
+void DecodeRGB8A1Block(const uint8_t *source, uint32_t *pixels)
+{
+    DecodeETC2ColorBlock(ReadBlock(source), true, pixels);
+}
+
+// The alpha block comes before the color block, and fills the last byte of each pixel
+void DecodeRGBA8Block(const uint8_t *source, uint32_t *pixels)
+{
+    DecodeETC2ColorBlock(ReadBlock(source + 8), false, pixels);
+    DecodeEACBlock<uint8_t, ComputeEACAlpha>(ReadBlock(source), reinterpret_cast<uint8_t*>(pixels) + 3, 4);
+}
+
+void DecodeR11Block(const uint8_t *source, uint16_t *pixels)
+{
+    DecodeEACBlock<uint16_t, ComputeEACUnsignedR11>(ReadBlock(source), pixels, 1);
+}
+
+void DecodeSignedR11Block(const uint8_t *source, uint16_t *pixels)
+{
+    DecodeEACBlock<uint16_t, ComputeEACSignedR11>(ReadBlock(source), pixels, 1);
+}
+
+// The red block comes before the green block
+void DecodeRG11Block(const uint8_t *source, uint32_t *pixels)
+{
+    uint16_t *channels = reinterpret_cast<uint16_t*>(pixels);
+    DecodeEACBlock<uint16_t, ComputeEACUnsignedR11>(ReadBlock(source), channels, 2);
+    DecodeEACBlock<uint16_t, ComputeEACUnsignedR11>(ReadBlock(source + 8), channels + 1, 2);
+}
+
+void DecodeSignedRG11Block(const uint8_t *source, uint32_t *pixels)
+{
+    uint16_t *channels = reinterpret_cast<uint16_t*>(pixels);
+    DecodeEACBlock<uint16_t, ComputeEACSignedR11>(ReadBlock(source), channels, 2);
+    DecodeEACBlock<uint16_t, ComputeEACSignedR11>(ReadBlock(source + 8), channels + 1, 2);
+}
+
+// Decodes each four by four block of the input and copies the pixels which are inside the image,
+// so that the partial blocks at the right and bottom edges don't write past the rows of the output.
+template <typename T, size_t blockSize, void (*decodeBlock)(const uint8_t *, T *)>
+void LoadETCBlocks(size_t width, size_t height, size_t depth,
+                   const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                   uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+    const size_t columns = (width + 3) / 4;
+    const size_t rows = (height + 3) / 4;
+
+    T pixels[16];
+    for (size_t z = 0; z < depth; z++)
+    {
+        for (size_t blockY = 0; blockY < rows; blockY++)
+        {
+            const uint8_t *source = OffsetDataPointer<uint8_t>(input, blockY, z, inputRowPitch, inputDepthPitch);
+            const size_t pixelRows = std::min<size_t>(4, height - blockY * 4);
+
+            for (size_t blockX = 0; blockX < columns; blockX++)
+            {
+                decodeBlock(source + blockX * blockSize, pixels);
+
+                const size_t pixelColumns = std::min<size_t>(4, width - blockX * 4);
+                for (size_t y = 0; y < pixelRows; y++)
+                {
+                    T *dest = OffsetDataPointer<T>(output, blockY * 4 + y, z, outputRowPitch, outputDepthPitch);
+                    memcpy(dest + blockX * 4, pixels + y * 4, pixelColumns * sizeof(T));
+                }
+            }
+        }
+    }
+}
+
+}
+
+void LoadETC2RGB8ToRGBA8(size_t width, size_t height, size_t depth,
+                         const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                         uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+    LoadETCBlocks<uint32_t, 8, DecodeRGB8Block>(width, height, depth, input, inputRowPitch, inputDepthPitch,
+                                                output, outputRowPitch, outputDepthPitch);
+}
+
+void LoadETC2RGB8A1ToRGBA8(size_t width, size_t height, size_t depth,
+                           const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                           uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+    LoadETCBlocks<uint32_t, 8, DecodeRGB8A1Block>(width, height, depth, input, inputRowPitch, inputDepthPitch,
+                                                  output, outputRowPitch, outputDepthPitch);
+}
+
+void LoadETC2RGBA8ToRGBA8(size_t width, size_t height, size_t depth,
+                          const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                          uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+    LoadETCBlocks<uint32_t, 16, DecodeRGBA8Block>(width, height, depth, input, inputRowPitch, inputDepthPitch,
+                                                  output, outputRowPitch, outputDepthPitch);
+}
+
+void LoadEACR11ToR16(size_t width, size_t height, size_t depth,
+                     const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                     uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+    LoadETCBlocks<uint16_t, 8, DecodeR11Block>(width, height, depth, input, inputRowPitch, inputDepthPitch,
+                                               output, outputRowPitch, outputDepthPitch);
+}
+
+void LoadEACR11SToR16S(size_t width, size_t height, size_t depth,
+                       const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                       uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+    LoadETCBlocks<uint16_t, 8, DecodeSignedR11Block>(width, height, depth, input, inputRowPitch, inputDepthPitch,
+                                                     output, outputRowPitch, outputDepthPitch);
+}
+
+void LoadEACRG11ToRG16(size_t width, size_t height, size_t depth,
+                       const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                       uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+    LoadETCBlocks<uint32_t, 16, DecodeRG11Block>(width, height, depth, input, inputRowPitch, inputDepthPitch,
+                                                 output, outputRowPitch, outputDepthPitch);
+}
+
+void LoadEACRG11SToRG16S(size_t width, size_t height, size_t depth,
+                         const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                         uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+    LoadETCBlocks<uint32_t, 16, DecodeSignedRG11Block>(width, height, depth, input, inputRowPitch, inputDepthPitch,
+                                                       output, outputRowPitch, outputDepthPitch);
+}
+
+}
@@ -0,0 +1,356 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// loadimageETC_unittest.cpp: Unit tests that the ETC2 and EAC load functions decode each block mode
+// to the values given by appendix C.1 of the ES 3.0 spec.
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "libANGLE/renderer/d3d/loadimage.h"
+
+using namespace rx;
+
+namespace
+{
+
+void SetBits(uint64_t *block, unsigned int lowBit, unsigned int count, uint64_t value)
+{
+    const uint64_t mask = ((uint64_t(1) << count) - 1) << lowBit;
+    *block = (*block & ~mask) | ((value << lowBit) & mask);
+}
+
+// Blocks are stored with their most significant byte first
+void WriteBlock(uint64_t block, uint8_t *data)
+{
+    for (size_t i = 0; i < 8; i++)
+    {
+        data[i] = static_cast<uint8_t>(block >> (56 - 8 * i));
+    }
+}
+
+// Gives every pixel of row y the two bit index y
+const uint64_t IndicesByRow = 0xCCCCAAAAu;
+
+// Decodes the blocks of one four by four block of pixels into tightly packed rows
+std::vector<uint8_t> DecodeBlock(LoadImageFunction loadFunction, const uint8_t *input, size_t blockBytes,
+                                 size_t pixelBytes)
+{
+    std::vector<uint8_t> output(16 * pixelBytes, 0xCD);
+    loadFunction(4, 4, 1, input, blockBytes, blockBytes, &output[0], 4 * pixelBytes, 16 * pixelBytes);
+    return output;
+}
+
+std::vector<uint8_t> DecodeColorBlock(LoadImageFunction loadFunction, uint64_t block)
+{
+    uint8_t input[8];
+    WriteBlock(block, input);
+    return DecodeBlock(loadFunction, input, 8, 4);
+}
+
+void ExpectRGBA(const std::vector<uint8_t> &pixels, size_t x, size_t y, int red, int green, int blue, int alpha)
+{
+    const uint8_t *pixel = &pixels[(y * 4 + x) * 4];
+    EXPECT_EQ(red, pixel[0]) << "pixel " << x << ", " << y;
+    EXPECT_EQ(green, pixel[1]) << "pixel " << x << ", " << y;
+    EXPECT_EQ(blue, pixel[2]) << "pixel " << x << ", " << y;
+    EXPECT_EQ(alpha, pixel[3]) << "pixel " << x << ", " << y;
+}
+
+uint16_t Channel16(const std::vector<uint8_t> &pixels, size_t x, size_t y, size_t channelCount, size_t channel)
+{
+    const uint8_t *value = &pixels[((y * 4 + x) * channelCount + channel) * 2];
+    return static_cast<uint16_t>(value[0] | (value[1] << 8));
+}
+
+// Individual mode has two 4 bit colors, and the subblocks are side by side without the flip bit
+TEST(LoadImageETCTest, IndividualMode)
+{
+    uint64_t block = IndicesByRow;
+    SetBits(&block, 60, 4, 0xA);
+    SetBits(&block, 56, 4, 0x3);
+    SetBits(&block, 52, 4, 0x5);
+    SetBits(&block, 48, 4, 0xC);
+    SetBits(&block, 44, 4, 0x0);
+    SetBits(&block, 40, 4, 0xF);
+    SetBits(&block, 37, 3, 2);
+    SetBits(&block, 34, 3, 7);
+
+    std::vector<uint8_t> pixels = DecodeColorBlock(LoadETC2RGB8ToRGBA8, block);
+    for (size_t x = 0; x < 2; x++)
+    {
+        ExpectRGBA(pixels, x, 0, 0xB3, 0x5E, 0x09, 0xFF);
+        ExpectRGBA(pixels, x, 1, 0xC7, 0x72, 0x1D, 0xFF);
+        ExpectRGBA(pixels, x, 2, 0xA1, 0x4C, 0x00, 0xFF);
+        ExpectRGBA(pixels, x, 3, 0x8D, 0x38, 0x00, 0xFF);
+    }
+    for (size_t x = 2; x < 4; x++)
+    {
+        ExpectRGBA(pixels, x, 0, 0x62, 0xFB, 0xFF, 0xFF);
+        ExpectRGBA(pixels, x, 1, 0xEA, 0xFF, 0xFF, 0xFF);
+        ExpectRGBA(pixels, x, 2, 0x04, 0x9D, 0xD0, 0xFF);
+        ExpectRGBA(pixels, x, 3, 0x00, 0x15, 0x48, 0xFF);
+    }
+}
+
+// Differential mode has a 5 bit color and a second one relative to it. With the flip bit, the
+// subblocks are the top and bottom halves.
+TEST(LoadImageETCTest, DifferentialMode)
+{
+    uint64_t block = 0;
+    SetBits(&block, 59, 5, 10);
+    SetBits(&block, 56, 3, 3);
+    SetBits(&block, 51, 5, 20);
+    SetBits(&block, 48, 3, 4);
+    SetBits(&block, 43, 5, 31);
+    SetBits(&block, 40, 3, 0);
+    SetBits(&block, 37, 3, 0);
+    SetBits(&block, 34, 3, 1);
+    SetBits(&block, 33, 1, 1);
+    SetBits(&block, 32, 1, 1);
+
+    // The last pixel has the index 3, the others 0
+    SetBits(&block, 31, 1, 1);
+    SetBits(&block, 15, 1, 1);
+
+    std::vector<uint8_t> pixels = DecodeColorBlock(LoadETC2RGB8ToRGBA8, block);
+    for (size_t x = 0; x < 4; x++)
+    {
+        ExpectRGBA(pixels, x, 0, 84, 167, 255, 255);
+        ExpectRGBA(pixels, x, 1, 84, 167, 255, 255);
+        ExpectRGBA(pixels, x, 2, 112, 137, 255, 255);
+    }
+    ExpectRGBA(pixels, 0, 3, 112, 137, 255, 255);
+    ExpectRGBA(pixels, 3, 3, 90, 115, 238, 255);
+}
+
+// A red component that overflows in differential mode selects the T mode
+uint64_t MakeTModeBlock()
+{
+    uint64_t block = IndicesByRow;
+    SetBits(&block, 58, 1, 1);
+    SetBits(&block, 59, 2, 2);
+    SetBits(&block, 56, 2, 1);
+    SetBits(&block, 52, 4, 0x6);
+    SetBits(&block, 48, 4, 0xF);
+    SetBits(&block, 44, 4, 0x8);
+    SetBits(&block, 40, 4, 0x8);
+    SetBits(&block, 36, 4, 0x8);
+    SetBits(&block, 34, 2, 2);
+    SetBits(&block, 33, 1, 1);
+    SetBits(&block, 32, 1, 1);
+    return block;
+}
+
+TEST(LoadImageETCTest, TMode)
+{
+    std::vector<uint8_t> pixels = DecodeColorBlock(LoadETC2RGB8ToRGBA8, MakeTModeBlock());
+    for (size_t x = 0; x < 4; x++)
+    {
+        ExpectRGBA(pixels, x, 0, 0x99, 0x66, 0xFF, 0xFF);
+        ExpectRGBA(pixels, x, 1, 168, 168, 168, 255);
+        ExpectRGBA(pixels, x, 2, 136, 136, 136, 255);
+        ExpectRGBA(pixels, x, 3, 104, 104, 104, 255);
+    }
+}
+
+// A green component that overflows selects the H mode. The order of its base colors holds the
+// lowest bit of the distance index.
+TEST(LoadImageETCTest, HMode)
+{
+    uint64_t block = IndicesByRow;
+    SetBits(&block, 59, 4, 0x3);
+    SetBits(&block, 56, 3, 0x2);
+    SetBits(&block, 52, 1, 0x1);
+    SetBits(&block, 51, 1, 0x1);
+    SetBits(&block, 50, 1, 0x1);
+    SetBits(&block, 47, 3, 0x0);
+    SetBits(&block, 43, 4, 0x4);
+    SetBits(&block, 39, 4, 0x5);
+    SetBits(&block, 35, 4, 0x6);
+    SetBits(&block, 34, 1, 1);
+    SetBits(&block, 33, 1, 1);
+
+    std::vector<uint8_t> pixels = DecodeColorBlock(LoadETC2RGB8ToRGBA8, block);
+    for (size_t x = 0; x < 4; x++)
+    {
+        ExpectRGBA(pixels, x, 0, 74, 108, 159, 255);
+        ExpectRGBA(pixels, x, 1, 28, 62, 113, 255);
+        ExpectRGBA(pixels, x, 2, 91, 108, 125, 255);
+        ExpectRGBA(pixels, x, 3, 45, 62, 79, 255);
+    }
+}
+
+// A blue component that overflows selects the planar mode, which interpolates three colors
+TEST(LoadImageETCTest, PlanarMode)
+{
+    uint64_t block = 0;
+    SetBits(&block, 57, 6, 32);
+    SetBits(&block, 56, 1, 1);
+    SetBits(&block, 42, 1, 1);
+    SetBits(&block, 34, 5, 0x1F);
+    SetBits(&block, 33, 1, 1);
+    SetBits(&block, 32, 1, 1);
+    SetBits(&block, 25, 7, 127);
+    SetBits(&block, 0, 6, 63);
+
+    std::vector<uint8_t> pixels = DecodeColorBlock(LoadETC2RGB8ToRGBA8, block);
+    ExpectRGBA(pixels, 0, 0, 130, 129, 0, 255);
+    ExpectRGBA(pixels, 3, 0, 224, 224, 0, 255);
+    ExpectRGBA(pixels, 1, 2, 96, 96, 128, 255);
+    ExpectRGBA(pixels, 0, 3, 33, 32, 191, 255);
+    ExpectRGBA(pixels, 3, 3, 126, 127, 191, 255);
+}
+
+// Without the opaque bit, the third index is transparent black and the first one doesn't modify
+// the base color
+TEST(LoadImageETCTest, PunchthroughAlpha)
+{
+    uint64_t block = IndicesByRow;
+    SetBits(&block, 59, 5, 10);
+    SetBits(&block, 51, 5, 20);
+    SetBits(&block, 43, 5, 31);
+
+    std::vector<uint8_t> pixels = DecodeColorBlock(LoadETC2RGB8A1ToRGBA8, block);
+    for (size_t x = 0; x < 4; x++)
+    {
+        ExpectRGBA(pixels, x, 0, 82, 165, 255, 255);
+        ExpectRGBA(pixels, x, 1, 90, 173, 255, 255);
+        ExpectRGBA(pixels, x, 2, 0, 0, 0, 0);
+        ExpectRGBA(pixels, x, 3, 74, 157, 247, 255);
+    }
+
+    // Opaque blocks decode like the ones of the RGB8 format
+    SetBits(&block, 33, 1, 1);
+    EXPECT_EQ(DecodeColorBlock(LoadETC2RGB8ToRGBA8, block), DecodeColorBlock(LoadETC2RGB8A1ToRGBA8, block));
+
+    // The T and H modes have a transparent index too
+    block = MakeTModeBlock();
+    SetBits(&block, 33, 1, 0);
+    pixels = DecodeColorBlock(LoadETC2RGB8A1ToRGBA8, block);
+    ExpectRGBA(pixels, 0, 1, 168, 168, 168, 255);
+    ExpectRGBA(pixels, 0, 2, 0, 0, 0, 0);
+}
+
+// Pixel i of an EAC block selects entry i % 8 of the modifier table
+uint64_t MakeEACBlock(int base, int multiplier, int table)
+{
+    uint64_t block = 0;
+    SetBits(&block, 56, 8, base);
+    SetBits(&block, 52, 4, multiplier);
+    SetBits(&block, 48, 4, table);
+    for (unsigned int pixel = 0; pixel < 16; pixel++)
+    {
+        SetBits(&block, 45 - 3 * pixel, 3, pixel % 8);
+    }
+    return block;
+}
+
+// The pixels of column x select the modifiers in the range [4 * (x % 2), 4 * (x % 2) + 3]
+TEST(LoadImageETCTest, EACAlpha)
+{
+    uint8_t input[16];
+    WriteBlock(MakeEACBlock(100, 3, 0), input);
+    WriteBlock(0, input + 8);
+
+    std::vector<uint8_t> pixels = DecodeBlock(LoadETC2RGBA8ToRGBA8, input, 16, 4);
+    const int alphas[8] = { 91, 82, 73, 55, 106, 115, 124, 142 };
+    for (size_t x = 0; x < 4; x++)
+    {
+        for (size_t y = 0; y < 4; y++)
+        {
+            ExpectRGBA(pixels, x, y, 2, 2, 2, alphas[(x % 2) * 4 + y]);
+        }
+    }
+
+    // The values are clamped
+    WriteBlock(MakeEACBlock(250, 15, 0), input);
+    pixels = DecodeBlock(LoadETC2RGBA8ToRGBA8, input, 16, 4);
+    ExpectRGBA(pixels, 0, 3, 2, 2, 2, 25);
+    ExpectRGBA(pixels, 1, 3, 2, 2, 2, 255);
+}
+
+TEST(LoadImageETCTest, EACR11)
+{
+    uint8_t input[8];
+    WriteBlock(MakeEACBlock(128, 2, 13), input);
+    std::vector<uint8_t> pixels = DecodeBlock(LoadEACR11ToR16, input, 8, 2);
+    EXPECT_EQ(27789u, Channel16(pixels, 0, 3, 1, 0));
+    EXPECT_EQ(32912u, Channel16(pixels, 1, 0, 1, 0));
+    EXPECT_EQ(37522u, Channel16(pixels, 1, 3, 1, 0));
+
+    // A multiplier of zero adds the modifiers unscaled
+    WriteBlock(MakeEACBlock(128, 0, 13), input);
+    pixels = DecodeBlock(LoadEACR11ToR16, input, 8, 2);
+    EXPECT_EQ(32591u, Channel16(pixels, 0, 3, 1, 0));
+
+    // The values are clamped
+    WriteBlock(MakeEACBlock(255, 15, 0), input);
+    pixels = DecodeBlock(LoadEACR11ToR16, input, 8, 2);
+    EXPECT_EQ(7811u, Channel16(pixels, 0, 3, 1, 0));
+    EXPECT_EQ(65535u, Channel16(pixels, 1, 3, 1, 0));
+
+    WriteBlock(MakeEACBlock(0, 15, 0), input);
+    pixels = DecodeBlock(LoadEACR11ToR16, input, 8, 2);
+    EXPECT_EQ(0u, Channel16(pixels, 0, 3, 1, 0));
+}
+
+TEST(LoadImageETCTest, EACSignedR11)
+{
+    // A base of -128 is treated as -127
+    uint8_t input[8];
+    WriteBlock(MakeEACBlock(0x80, 1, 0), input);
+    std::vector<uint8_t> pixels = DecodeBlock(LoadEACR11SToR16S, input, 8, 2);
+    EXPECT_EQ(-32767, static_cast<int16_t>(Channel16(pixels, 0, 0, 1, 0)));
+    EXPECT_EQ(-28956, static_cast<int16_t>(Channel16(pixels, 1, 3, 1, 0)));
+
+    WriteBlock(MakeEACBlock(16, 0, 0), input);
+    pixels = DecodeBlock(LoadEACR11SToR16S, input, 8, 2);
+    EXPECT_EQ(4164, static_cast<int16_t>(Channel16(pixels, 1, 0, 1, 0)));
+}
+
+// The red block comes before the green block
+TEST(LoadImageETCTest, EACRG11)
+{
+    uint8_t input[16];
+    WriteBlock(MakeEACBlock(128, 2, 13), input);
+    WriteBlock(MakeEACBlock(255, 15, 0), input + 8);
+
+    std::vector<uint8_t> pixels = DecodeBlock(LoadEACRG11ToRG16, input, 16, 4);
+    EXPECT_EQ(27789u, Channel16(pixels, 0, 3, 2, 0));
+    EXPECT_EQ(7811u, Channel16(pixels, 0, 3, 2, 1));
+    EXPECT_EQ(37522u, Channel16(pixels, 1, 3, 2, 0));
+    EXPECT_EQ(65535u, Channel16(pixels, 1, 3, 2, 1));
+
+    WriteBlock(MakeEACBlock(16, 0, 0), input + 8);
+    pixels = DecodeBlock(LoadEACRG11SToRG16S, input, 16, 4);
+    EXPECT_EQ(4164, static_cast<int16_t>(Channel16(pixels, 1, 0, 2, 1)));
+}
+
+// The blocks at the right and bottom edges only write the pixels inside the image
+TEST(LoadImageETCTest, PartialBlocks)
+{
+    uint8_t input[16];
+    WriteBlock(MakeTModeBlock(), input);
+    WriteBlock(MakeTModeBlock(), input + 8);
+
+    const size_t outputRowPitch = 7 * 4 + 8;
+    std::vector<uint8_t> output(outputRowPitch * 3, 0xCD);
+    LoadETC2RGB8ToRGBA8(7, 2, 1, input, 16, 16, &output[0], outputRowPitch, outputRowPitch * 2);
+
+    for (size_t y = 0; y < 3; y++)
+    {
+        for (size_t x = 0; x < outputRowPitch; x++)
+        {
+            bool written = (y < 2 && x < 7 * 4);
+            EXPECT_EQ(written, output[y * outputRowPitch + x] != 0xCD) << "byte " << x << ", " << y;
+        }
+    }
+    EXPECT_EQ(168, output[outputRowPitch + 6 * 4]);
+}
+
+}
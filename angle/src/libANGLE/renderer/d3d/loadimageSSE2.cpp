@@ -19,6 +19,195 @@
 namespace rx
 {
 
+#if defined(ANGLE_USE_SSE)
+namespace
+{
+
+// Each kernel converts PixelsPerIteration pixels to four bytes each, and may read up to
+// SourceBytesRead bytes of input, which can be more than the pixels it converts.
+
+// Writes eight pixels from 16 bit lanes that hold one 8 bit channel each
+inline void StoreRGBA8(__m128i r, __m128i g, __m128i b, __m128i a, uint8_t *dest)
+{
+    __m128i rg = _mm_or_si128(r, _mm_slli_epi16(g, 8));
+    __m128i ba = _mm_or_si128(b, _mm_slli_epi16(a, 8));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dest), _mm_unpacklo_epi16(rg, ba));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + 16), _mm_unpackhi_epi16(rg, ba));
+}
+
+struct L8ToRGBA8Kernel
+{
+    enum { PixelsPerIteration = 16, SourcePixelBytes = 1, SourceBytesRead = 16 };
+
+    static void convert(const uint8_t *source, uint8_t *dest)
+    {
+        const __m128i alpha = _mm_set1_epi32(0xFF000000);
+
+        __m128i luminance = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source));
+        __m128i lo = _mm_unpacklo_epi8(luminance, luminance);
+        __m128i hi = _mm_unpackhi_epi8(luminance, luminance);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dest),      _mm_or_si128(_mm_unpacklo_epi16(lo, lo), alpha));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + 16), _mm_or_si128(_mm_unpackhi_epi16(lo, lo), alpha));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + 32), _mm_or_si128(_mm_unpacklo_epi16(hi, hi), alpha));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + 48), _mm_or_si128(_mm_unpackhi_epi16(hi, hi), alpha));
+    }
+};
+
+struct LA8ToRGBA8Kernel
+{
+    enum { PixelsPerIteration = 8, SourcePixelBytes = 2, SourceBytesRead = 16 };
+
+    static void convert(const uint8_t *source, uint8_t *dest)
+    {
+        const __m128i keepMask = _mm_set1_epi32(0xFFFF00FF);
+        const __m128i greenMask = _mm_set1_epi32(0x0000FF00);
+
+        // Repeating each LA pair gives LALA, then the A in the second byte is replaced with L
+        __m128i la = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source));
+        __m128i lo = _mm_unpacklo_epi16(la, la);
+        __m128i hi = _mm_unpackhi_epi16(la, la);
+        lo = _mm_or_si128(_mm_and_si128(lo, keepMask), _mm_and_si128(_mm_slli_epi32(lo, 8), greenMask));
+        hi = _mm_or_si128(_mm_and_si128(hi, keepMask), _mm_and_si128(_mm_slli_epi32(hi, 8), greenMask));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dest), lo);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + 16), hi);
+    }
+};
+
+template <bool swapRB>
+struct RGB8ToRGBA8Kernel
+{
+    // Four pixels are twelve bytes, but the load is sixteen
+    enum { PixelsPerIteration = 4, SourcePixelBytes = 3, SourceBytesRead = 16 };
+
+    static void convert(const uint8_t *source, uint8_t *dest)
+    {
+        const __m128i alpha = _mm_set1_epi32(0xFF000000);
+
+        // Shift each three byte pixel up into its own 32 bit lane
+        __m128i rgb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source));
+        __m128i pixel0 = _mm_and_si128(rgb,                    _mm_set_epi32(0, 0, 0, 0x00FFFFFF));
+        __m128i pixel1 = _mm_and_si128(_mm_slli_si128(rgb, 1), _mm_set_epi32(0, 0, 0x00FFFFFF, 0));
+        __m128i pixel2 = _mm_and_si128(_mm_slli_si128(rgb, 2), _mm_set_epi32(0, 0x00FFFFFF, 0, 0));
+        __m128i pixel3 = _mm_and_si128(_mm_slli_si128(rgb, 3), _mm_set_epi32(0x00FFFFFF, 0, 0, 0));
+        __m128i rgba = _mm_or_si128(_mm_or_si128(pixel0, pixel1), _mm_or_si128(pixel2, pixel3));
+
+        if (swapRB)
+        {
+            const __m128i brMask = _mm_set1_epi32(0x00ff00ff);
+            __m128i gComponents = _mm_andnot_si128(brMask, rgba);
+            __m128i brComponents = _mm_and_si128(rgba, brMask);
+            __m128i brSwapped = _mm_shufflehi_epi16(_mm_shufflelo_epi16(brComponents, _MM_SHUFFLE(2, 3, 0, 1)), _MM_SHUFFLE(2, 3, 0, 1));
+            rgba = _mm_or_si128(gComponents, brSwapped);
+        }
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dest), _mm_or_si128(rgba, alpha));
+    }
+};
+
+// The packed 16 bit kernels widen each channel like the scalar functions do, by repeating its high
+// bits below it.
+template <bool swapRB>
+struct R5G6B5ToRGBA8Kernel
+{
+    enum { PixelsPerIteration = 8, SourcePixelBytes = 2, SourceBytesRead = 16 };
+
+    static void convert(const uint8_t *source, uint8_t *dest)
+    {
+        __m128i rgb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source));
+
+        __m128i r = _mm_and_si128(rgb, _mm_set1_epi16(static_cast<short>(0xF800)));
+        r = _mm_or_si128(_mm_srli_epi16(r, 8), _mm_srli_epi16(r, 13));
+        __m128i g = _mm_and_si128(rgb, _mm_set1_epi16(0x07E0));
+        g = _mm_or_si128(_mm_srli_epi16(g, 3), _mm_srli_epi16(g, 9));
+        __m128i b = _mm_and_si128(rgb, _mm_set1_epi16(0x001F));
+        b = _mm_or_si128(_mm_slli_epi16(b, 3), _mm_srli_epi16(b, 2));
+        __m128i a = _mm_set1_epi16(0x00FF);
+
+        StoreRGBA8(swapRB ? b : r, g, swapRB ? r : b, a, dest);
+    }
+};
+
+template <bool swapRB>
+struct RGBA4ToRGBA8Kernel
+{
+    enum { PixelsPerIteration = 8, SourcePixelBytes = 2, SourceBytesRead = 16 };
+
+    static void convert(const uint8_t *source, uint8_t *dest)
+    {
+        __m128i rgba = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source));
+
+        __m128i r = _mm_and_si128(rgba, _mm_set1_epi16(static_cast<short>(0xF000)));
+        r = _mm_or_si128(_mm_srli_epi16(r, 8), _mm_srli_epi16(r, 12));
+        __m128i g = _mm_and_si128(rgba, _mm_set1_epi16(0x0F00));
+        g = _mm_or_si128(_mm_srli_epi16(g, 4), _mm_srli_epi16(g, 8));
+        __m128i b = _mm_and_si128(rgba, _mm_set1_epi16(0x00F0));
+        b = _mm_or_si128(b, _mm_srli_epi16(b, 4));
+        __m128i a = _mm_and_si128(rgba, _mm_set1_epi16(0x000F));
+        a = _mm_or_si128(_mm_slli_epi16(a, 4), a);
+
+        StoreRGBA8(swapRB ? b : r, g, swapRB ? r : b, a, dest);
+    }
+};
+
+template <bool swapRB>
+struct RGB5A1ToRGBA8Kernel
+{
+    enum { PixelsPerIteration = 8, SourcePixelBytes = 2, SourceBytesRead = 16 };
+
+    static void convert(const uint8_t *source, uint8_t *dest)
+    {
+        __m128i rgba = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source));
+
+        __m128i r = _mm_and_si128(rgba, _mm_set1_epi16(static_cast<short>(0xF800)));
+        r = _mm_or_si128(_mm_srli_epi16(r, 8), _mm_srli_epi16(r, 13));
+        __m128i g = _mm_and_si128(rgba, _mm_set1_epi16(0x07C0));
+        g = _mm_or_si128(_mm_srli_epi16(g, 3), _mm_srli_epi16(g, 8));
+        __m128i b = _mm_and_si128(rgba, _mm_set1_epi16(0x003E));
+        b = _mm_or_si128(_mm_slli_epi16(b, 2), _mm_srli_epi16(b, 3));
+
+        // Negating the alpha bit sets every bit of the lane, which is then masked down to a byte
+        __m128i a = _mm_and_si128(rgba, _mm_set1_epi16(0x0001));
+        a = _mm_and_si128(_mm_sub_epi16(_mm_setzero_si128(), a), _mm_set1_epi16(0x00FF));
+
+        StoreRGBA8(swapRB ? b : r, g, swapRB ? r : b, a, dest);
+    }
+};
+
+// Runs the kernel along each row, and finishes the pixels at the end of the row that it can't
+// reach with the scalar load function.
+template <typename Kernel>
+void LoadWithKernel(size_t width, size_t height, size_t depth,
+                    const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                    uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch,
+                    LoadImageFunction loadRemainder)
+{
+    for (size_t z = 0; z < depth; z++)
+    {
+        for (size_t y = 0; y < height; y++)
+        {
+            const uint8_t *source = OffsetDataPointer<uint8_t>(input, y, z, inputRowPitch, inputDepthPitch);
+            uint8_t *dest = OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
+
+            size_t x = 0;
+            for (; (width - x) * Kernel::SourcePixelBytes >= Kernel::SourceBytesRead; x += Kernel::PixelsPerIteration)
+            {
+                Kernel::convert(source + x * Kernel::SourcePixelBytes, dest + x * 4);
+            }
+
+            if (x < width)
+            {
+                loadRemainder(width - x, 1, 1, source + x * Kernel::SourcePixelBytes, inputRowPitch, inputDepthPitch,
+                              dest + x * 4, outputRowPitch, outputDepthPitch);
+            }
+        }
+    }
+}
+
+}
+#endif // ANGLE_USE_SSE
+
 void LoadA8ToBGRA8_SSE2(size_t width, size_t height, size_t depth,
                         const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
                         uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
@@ -121,5 +310,132 @@ void LoadRGBA8ToBGRA8_SSE2(size_t width, size_t height, size_t depth,
 #endif
 }
 
+void LoadA8ToRGBA8_SSE2(size_t width, size_t height, size_t depth,
+                        const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                        uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+    // Same as loading to BGRA
+    LoadA8ToBGRA8_SSE2(width, height, depth, input, inputRowPitch, inputDepthPitch, output, outputRowPitch, outputDepthPitch);
+}
+
+void LoadL8ToRGBA8_SSE2(size_t width, size_t height, size_t depth,
+                        const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                        uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+#if defined(ANGLE_USE_SSE)
+    LoadWithKernel<L8ToRGBA8Kernel>(width, height, depth, input, inputRowPitch, inputDepthPitch,
+                                    output, outputRowPitch, outputDepthPitch, LoadL8ToRGBA8);
+#else
+    UNIMPLEMENTED();
+#endif
+}
+
+void LoadLA8ToRGBA8_SSE2(size_t width, size_t height, size_t depth,
+                         const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                         uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+#if defined(ANGLE_USE_SSE)
+    LoadWithKernel<LA8ToRGBA8Kernel>(width, height, depth, input, inputRowPitch, inputDepthPitch,
+                                     output, outputRowPitch, outputDepthPitch, LoadLA8ToRGBA8);
+#else
+    UNIMPLEMENTED();
+#endif
+}
+
+void LoadRGB8ToBGRX8_SSE2(size_t width, size_t height, size_t depth,
+                          const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                          uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+#if defined(ANGLE_USE_SSE)
+    LoadWithKernel<RGB8ToRGBA8Kernel<true>>(width, height, depth, input, inputRowPitch, inputDepthPitch,
+                                            output, outputRowPitch, outputDepthPitch, LoadRGB8ToBGRX8);
+#else
+    UNIMPLEMENTED();
+#endif
+}
+
+void LoadRGB8ToRGBA8_SSE2(size_t width, size_t height, size_t depth,
+                          const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                          uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+#if defined(ANGLE_USE_SSE)
+    LoadWithKernel<RGB8ToRGBA8Kernel<false>>(width, height, depth, input, inputRowPitch, inputDepthPitch,
+                                             output, outputRowPitch, outputDepthPitch, LoadToNative3To4<uint8_t, 0xFF>);
+#else
+    UNIMPLEMENTED();
+#endif
+}
+
+void LoadR5G6B5ToBGRA8_SSE2(size_t width, size_t height, size_t depth,
+                            const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                            uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+#if defined(ANGLE_USE_SSE)
+    LoadWithKernel<R5G6B5ToRGBA8Kernel<true>>(width, height, depth, input, inputRowPitch, inputDepthPitch,
+                                              output, outputRowPitch, outputDepthPitch, LoadR5G6B5ToBGRA8);
+#else
+    UNIMPLEMENTED();
+#endif
+}
+
+void LoadR5G6B5ToRGBA8_SSE2(size_t width, size_t height, size_t depth,
+                            const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                            uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+#if defined(ANGLE_USE_SSE)
+    LoadWithKernel<R5G6B5ToRGBA8Kernel<false>>(width, height, depth, input, inputRowPitch, inputDepthPitch,
+                                               output, outputRowPitch, outputDepthPitch, LoadR5G6B5ToRGBA8);
+#else
+    UNIMPLEMENTED();
+#endif
+}
+
+void LoadRGBA4ToBGRA8_SSE2(size_t width, size_t height, size_t depth,
+                           const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                           uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+#if defined(ANGLE_USE_SSE)
+    LoadWithKernel<RGBA4ToRGBA8Kernel<true>>(width, height, depth, input, inputRowPitch, inputDepthPitch,
+                                             output, outputRowPitch, outputDepthPitch, LoadRGBA4ToBGRA8);
+#else
+    UNIMPLEMENTED();
+#endif
+}
+
+void LoadRGBA4ToRGBA8_SSE2(size_t width, size_t height, size_t depth,
+                           const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                           uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+#if defined(ANGLE_USE_SSE)
+    LoadWithKernel<RGBA4ToRGBA8Kernel<false>>(width, height, depth, input, inputRowPitch, inputDepthPitch,
+                                              output, outputRowPitch, outputDepthPitch, LoadRGBA4ToRGBA8);
+#else
+    UNIMPLEMENTED();
+#endif
 }
 
+void LoadRGB5A1ToBGRA8_SSE2(size_t width, size_t height, size_t depth,
+                            const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                            uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+#if defined(ANGLE_USE_SSE)
+    LoadWithKernel<RGB5A1ToRGBA8Kernel<true>>(width, height, depth, input, inputRowPitch, inputDepthPitch,
+                                              output, outputRowPitch, outputDepthPitch, LoadRGB5A1ToBGRA8);
+#else
+    UNIMPLEMENTED();
+#endif
+}
+
+void LoadRGB5A1ToRGBA8_SSE2(size_t width, size_t height, size_t depth,
+                            const uint8_t *input, size_t inputRowPitch, size_t inputDepthPitch,
+                            uint8_t *output, size_t outputRowPitch, size_t outputDepthPitch)
+{
+#if defined(ANGLE_USE_SSE)
+    LoadWithKernel<RGB5A1ToRGBA8Kernel<false>>(width, height, depth, input, inputRowPitch, inputDepthPitch,
+                                               output, outputRowPitch, outputDepthPitch, LoadRGB5A1ToRGBA8);
+#else
+    UNIMPLEMENTED();
+#endif
+}
+
+}
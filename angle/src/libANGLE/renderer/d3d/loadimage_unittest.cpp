@@ -0,0 +1,198 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// loadimage_unittest.cpp: Unit tests that the vectorized and parallel image loads produce the same
+// output as the scalar load functions.
+
+#include <iostream>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "common/platform.h"
+#include "libANGLE/renderer/d3d/loadimage.h"
+
+using namespace rx;
+
+namespace
+{
+
+struct LoadTestImage
+{
+    // inputBlockHeight and outputBlockHeight are the numbers of pixel rows in each row of input and
+    // output, which are more than one for compressed formats.
+    LoadTestImage(size_t width, size_t height, size_t depth, size_t inputRowBytes, size_t outputRowBytes,
+                  size_t inputBlockHeight, size_t outputBlockHeight)
+        : width(width),
+          height(height),
+          depth(depth),
+          inputBlockHeight(inputBlockHeight),
+          outputBlockHeight(outputBlockHeight),
+          // Pad the rows and slices so that loads which ignore the pitches are caught
+          inputRowPitch(inputRowBytes + 5),
+          inputDepthPitch(inputRowPitch * ((height + inputBlockHeight - 1) / inputBlockHeight) + 3),
+          outputRowPitch(outputRowBytes + 12),
+          outputDepthPitch(outputRowPitch * ((height + outputBlockHeight - 1) / outputBlockHeight) + 16),
+          input(inputDepthPitch * depth)
+    {
+        unsigned int seed = 0x12345678u;
+        for (size_t i = 0; i < input.size(); i++)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            input[i] = static_cast<uint8_t>(seed >> 24);
+        }
+    }
+
+    std::vector<uint8_t> load(LoadImageFunction loadFunction) const
+    {
+        std::vector<uint8_t> output(outputDepthPitch * depth, 0xCD);
+        loadFunction(width, height, depth, &input[0], inputRowPitch, inputDepthPitch,
+                     &output[0], outputRowPitch, outputDepthPitch);
+        return output;
+    }
+
+    std::vector<uint8_t> loadParallel(LoadImageFunction loadFunction) const
+    {
+        std::vector<uint8_t> output(outputDepthPitch * depth, 0xCD);
+        LoadImageParallel(loadFunction, inputBlockHeight, outputBlockHeight, width, height, depth, &input[0],
+                          inputRowPitch, inputDepthPitch, &output[0], outputRowPitch, outputDepthPitch);
+        return output;
+    }
+
+    size_t width;
+    size_t height;
+    size_t depth;
+    size_t inputBlockHeight;
+    size_t outputBlockHeight;
+    size_t inputRowPitch;
+    size_t inputDepthPitch;
+    size_t outputRowPitch;
+    size_t outputDepthPitch;
+    std::vector<uint8_t> input;
+};
+
+#if defined(ANGLE_USE_SSE)
+
+void CheckSSE2Load(LoadImageFunction sse2Function, LoadImageFunction scalarFunction, size_t inputPixelBytes)
+{
+    if (!gl::supportsSSE2())
+    {
+        std::cout << "Test skipped because SSE2 is not available." << std::endl;
+        return;
+    }
+
+    // Cover widths that are shorter than one vector iteration and ones that leave a remainder
+    for (size_t width = 1; width <= 41; width++)
+    {
+        LoadTestImage image(width, 3, 2, width * inputPixelBytes, width * 4, 1, 1);
+        EXPECT_EQ(image.load(scalarFunction), image.load(sse2Function)) << "width " << width;
+    }
+}
+
+TEST(LoadImageTest, A8SSE2)
+{
+    CheckSSE2Load(LoadA8ToRGBA8_SSE2, LoadA8ToRGBA8, 1);
+}
+
+TEST(LoadImageTest, L8SSE2)
+{
+    CheckSSE2Load(LoadL8ToRGBA8_SSE2, LoadL8ToRGBA8, 1);
+}
+
+TEST(LoadImageTest, LA8SSE2)
+{
+    CheckSSE2Load(LoadLA8ToRGBA8_SSE2, LoadLA8ToRGBA8, 2);
+}
+
+TEST(LoadImageTest, RGB8SSE2)
+{
+    CheckSSE2Load(LoadRGB8ToRGBA8_SSE2, LoadToNative3To4<uint8_t, 0xFF>, 3);
+    CheckSSE2Load(LoadRGB8ToBGRX8_SSE2, LoadRGB8ToBGRX8, 3);
+}
+
+TEST(LoadImageTest, R5G6B5SSE2)
+{
+    CheckSSE2Load(LoadR5G6B5ToRGBA8_SSE2, LoadR5G6B5ToRGBA8, 2);
+    CheckSSE2Load(LoadR5G6B5ToBGRA8_SSE2, LoadR5G6B5ToBGRA8, 2);
+}
+
+TEST(LoadImageTest, RGBA4SSE2)
+{
+    CheckSSE2Load(LoadRGBA4ToRGBA8_SSE2, LoadRGBA4ToRGBA8, 2);
+    CheckSSE2Load(LoadRGBA4ToBGRA8_SSE2, LoadRGBA4ToBGRA8, 2);
+}
+
+TEST(LoadImageTest, RGB5A1SSE2)
+{
+    CheckSSE2Load(LoadRGB5A1ToRGBA8_SSE2, LoadRGB5A1ToRGBA8, 2);
+    CheckSSE2Load(LoadRGB5A1ToBGRA8_SSE2, LoadRGB5A1ToBGRA8, 2);
+}
+
+#endif // ANGLE_USE_SSE
+
+// Large images are split into bands of rows, which must line up with the rows of the image.
+TEST(LoadImageTest, ParallelRows)
+{
+    LoadTestImage image(1023, 1031, 1, 1023 * 3, 1023 * 4, 1, 1);
+    EXPECT_TRUE(image.load(LoadRGB8ToBGRX8) == image.loadParallel(LoadRGB8ToBGRX8));
+}
+
+// Arrays and 3D textures with enough slices are split into bands of slices.
+TEST(LoadImageTest, ParallelSlices)
+{
+    LoadTestImage image(256, 250, 33, 256 * 2, 256 * 4, 1, 1);
+    EXPECT_TRUE(image.load(LoadRGBA4ToRGBA8) == image.loadParallel(LoadRGBA4ToRGBA8));
+}
+
+// The bands of a compressed image hold whole rows of blocks, including the partial last row.
+TEST(LoadImageTest, ParallelCompressedRows)
+{
+    // DXT1 blocks are four by four pixels in eight bytes
+    LoadTestImage image(2048, 2046, 1, 512 * 8, 512 * 8, 4, 4);
+    EXPECT_TRUE(image.load(LoadCompressedToNative<4, 4, 8>) ==
+                image.loadParallel(LoadCompressedToNative<4, 4, 8>));
+}
+
+// Decoded compressed images have four rows of output for each row of blocks
+TEST(LoadImageTest, ParallelDecodedRows)
+{
+    // ETC2 RGB8 blocks are four by four pixels in eight bytes
+    LoadTestImage image(1022, 1030, 1, 256 * 8, 1022 * 4, 4, 1);
+    EXPECT_TRUE(image.load(LoadETC2RGB8ToRGBA8) == image.loadParallel(LoadETC2RGB8ToRGBA8));
+}
+
+// The float loads convert whole rows at once, and RGB rows are expanded to RGBA in place
+TEST(LoadImageTest, RGB32FToRGBA16F)
+{
+    for (size_t width = 1; width <= 41; width++)
+    {
+        LoadTestImage image(width, 3, 2, width * 12, width * 8, 1, 1);
+        std::vector<uint8_t> output = image.load(LoadRGB32FToRGBA16F);
+
+        for (size_t z = 0; z < image.depth; z++)
+        {
+            for (size_t y = 0; y < image.height; y++)
+            {
+                const uint8_t *source = &image.input[z * image.inputDepthPitch + y * image.inputRowPitch];
+                const uint8_t *dest = &output[z * image.outputDepthPitch + y * image.outputRowPitch];
+                for (size_t x = 0; x < width * 4; x++)
+                {
+                    float value = 1.0f;
+                    if (x % 4 != 3)
+                    {
+                        memcpy(&value, source + ((x / 4) * 3 + x % 4) * sizeof(float), sizeof(float));
+                    }
+
+                    uint16_t half = 0;
+                    memcpy(&half, dest + x * sizeof(uint16_t), sizeof(uint16_t));
+                    EXPECT_EQ(gl::float32ToFloat16(value), half) << "width " << width << " x " << x;
+                }
+            }
+        }
+    }
+}
+
+}
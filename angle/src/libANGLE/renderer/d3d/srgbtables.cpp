@@ -0,0 +1,4649 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// This file is automatically generated.
+
+#include <stdint.h>
+
+namespace rx
+{
+
+const static float g_sRGBToLinear[256] = {
+    0.000000000e+00f,
+    3.035269910e-04f,
+    6.070539821e-04f,
+    9.105809731e-04f,
+    1.214107964e-03f,
+    1.517634955e-03f,
+    1.821161946e-03f,
+    2.124688821e-03f,
+    2.428215928e-03f,
+    2.731742803e-03f,
+    3.035269910e-03f,
+    3.346535843e-03f,
+    3.676507389e-03f,
+    4.024717025e-03f,
+    4.391442053e-03f,
+    4.776953254e-03f,
+    5.181516521e-03f,
+    5.605391692e-03f,
+    6.048833020e-03f,
+    6.512090564e-03f,
+    6.995410193e-03f,
+    7.499032188e-03f,
+    8.023193106e-03f,
+    8.568125777e-03f,
+    9.134058841e-03f,
+    9.721217677e-03f,
+    1.032982301e-02f,
+    1.096009370e-02f,
+    1.161224488e-02f,
+    1.228648797e-02f,
+    1.298303250e-02f,
+    1.370208338e-02f,
+    1.444384363e-02f,
+    1.520851441e-02f,
+    1.599629410e-02f,
+    1.680737548e-02f,
+    1.764195412e-02f,
+    1.850022003e-02f,
+    1.938236132e-02f,
+    2.028856240e-02f,
+    2.121900953e-02f,
+    2.217388526e-02f,
+    2.315336652e-02f,
+    2.415763214e-02f,
+    2.518685907e-02f,
+    2.624122240e-02f,
+    2.732089162e-02f,
+    2.842603996e-02f,
+    2.955683507e-02f,
+    3.071344458e-02f,
+    3.189603239e-02f,
+    3.310476616e-02f,
+    3.433980793e-02f,
+    3.560131416e-02f,
+    3.688944876e-02f,
+    3.820437193e-02f,
+    3.954623640e-02f,
+    4.091519862e-02f,
+    4.231141135e-02f,
+    4.373503104e-02f,
+    4.518620297e-02f,
+    4.666508734e-02f,
+    4.817182571e-02f,
+    4.970656708e-02f,
+    5.126945674e-02f,
+    5.286064744e-02f,
+    5.448027700e-02f,
+    5.612849072e-02f,
+    5.780543014e-02f,
+    5.951123685e-02f,
+    6.124605238e-02f,
+    6.301001459e-02f,
+    6.480326504e-02f,
+    6.662593782e-02f,
+    6.847816706e-02f,
+    7.036009431e-02f,
+    7.227185369e-02f,
+    7.421357185e-02f,
+    7.618538290e-02f,
+    7.818742096e-02f,
+    8.021982014e-02f,
+    8.228270710e-02f,
+    8.437620848e-02f,
+    8.650045842e-02f,
+    8.865558356e-02f,
+    9.084171057e-02f,
+    9.305896610e-02f,
+    9.530746937e-02f,
+    9.758734703e-02f,
+    9.989872575e-02f,
+    1.022417322e-01f,
+    1.046164855e-01f,
+    1.070231050e-01f,
+    1.094617099e-01f,
+    1.119324267e-01f,
+    1.144353747e-01f,
+    1.169706658e-01f,
+    1.195384264e-01f,
+    1.221387759e-01f,
+    1.247718185e-01f,
+    1.274376810e-01f,
+    1.301364750e-01f,
+    1.328683197e-01f,
+    1.356333345e-01f,
+    1.384316087e-01f,
+    1.412632912e-01f,
+    1.441284716e-01f,
+    1.470272690e-01f,
+    1.499597877e-01f,
+    1.529261470e-01f,
+    1.559264660e-01f,
+    1.589608341e-01f,
+    1.620293707e-01f,
+    1.651321948e-01f,
+    1.682693958e-01f,
+    1.714411080e-01f,
+    1.746474057e-01f,
+    1.778884232e-01f,
+    1.811642498e-01f,
+    1.844749898e-01f,
+    1.878207773e-01f,
+    1.912016869e-01f,
+    1.946178377e-01f,
+    1.980693191e-01f,
+    2.015562505e-01f,
+    2.050787359e-01f,
+    2.086368650e-01f,
+    2.122307569e-01f,
+    2.158605009e-01f,
+    2.195262015e-01f,
+    2.232279629e-01f,
+    2.269658744e-01f,
+    2.307400554e-01f,
+    2.345505804e-01f,
+    2.383975685e-01f,
+    2.422811240e-01f,
+    2.462013215e-01f,
+    2.501582801e-01f,
+    2.541520894e-01f,
+    2.581828535e-01f,
+    2.622506618e-01f,
+    2.663556039e-01f,
+    2.704977989e-01f,
+    2.746773064e-01f,
+    2.788942754e-01f,
+    2.831487358e-01f,
+    2.874408364e-01f,
+    2.917706370e-01f,
+    2.961382568e-01f,
+    3.005437851e-01f,
+    3.049873114e-01f,
+    3.094689250e-01f,
+    3.139887154e-01f,
+    3.185467720e-01f,
+    3.231432140e-01f,
+    3.277781010e-01f,
+    3.324515224e-01f,
+    3.371636271e-01f,
+    3.419144154e-01f,
+    3.467040658e-01f,
+    3.515326083e-01f,
+    3.564001322e-01f,
+    3.613067865e-01f,
+    3.662526011e-01f,
+    3.712376952e-01f,
+    3.762621284e-01f,
+    3.813260198e-01f,
+    3.864294291e-01f,
+    3.915724754e-01f,
+    3.967552185e-01f,
+    4.019777775e-01f,
+    4.072402120e-01f,
+    4.125426114e-01f,
+    4.178850651e-01f,
+    4.232676625e-01f,
+    4.286904931e-01f,
+    4.341536462e-01f,
+    4.396571815e-01f,
+    4.452011883e-01f,
+    4.507857859e-01f,
+    4.564110339e-01f,
+    4.620769918e-01f,
+    4.677838087e-01f,
+    4.735314846e-01f,
+    4.793201685e-01f,
+    4.851499498e-01f,
+    4.910208583e-01f,
+    4.969329834e-01f,
+    5.028864741e-01f,
+    5.088813305e-01f,
+    5.149176717e-01f,
+    5.209955573e-01f,
+    5.271151066e-01f,
+    5.332763791e-01f,
+    5.394794941e-01f,
+    5.457244515e-01f,
+    5.520114303e-01f,
+    5.583403707e-01f,
+    5.647115111e-01f,
+    5.711248517e-01f,
+    5.775804520e-01f,
+    5.840784311e-01f,
+    5.906188488e-01f,
+    5.972017646e-01f,
+    6.038273573e-01f,
+    6.104955673e-01f,
+    6.172065735e-01f,
+    6.239603758e-01f,
+    6.307571530e-01f,
+    6.375968456e-01f,
+    6.444796920e-01f,
+    6.514056325e-01f,
+    6.583748460e-01f,
+    6.653872728e-01f,
+    6.724431515e-01f,
+    6.795424819e-01f,
+    6.866853237e-01f,
+    6.938717365e-01f,
+    7.011018991e-01f,
+    7.083757520e-01f,
+    7.156934738e-01f,
+    7.230551243e-01f,
+    7.304607630e-01f,
+    7.379103899e-01f,
+    7.454041839e-01f,
+    7.529422045e-01f,
+    7.605245113e-01f,
+    7.681511641e-01f,
+    7.758222222e-01f,
+    7.835378051e-01f,
+    7.912979126e-01f,
+    7.991027236e-01f,
+    8.069522381e-01f,
+    8.148465753e-01f,
+    8.227857351e-01f,
+    8.307698965e-01f,
+    8.387989998e-01f,
+    8.468732238e-01f,
+    8.549926281e-01f,
+    8.631572127e-01f,
+    8.713670969e-01f,
+    8.796223998e-01f,
+    8.879231215e-01f,
+    8.962693810e-01f,
+    9.046611786e-01f,
+    9.130986333e-01f,
+    9.215818644e-01f,
+    9.301108718e-01f,
+    9.386857152e-01f,
+    9.473065138e-01f,
+    9.559733272e-01f,
+    9.646862745e-01f,
+    9.734452963e-01f,
+    9.822505713e-01f,
+    9.911020994e-01f,
+    1.000000000e+00f,
+};
+
+const static float g_linearToSRGBThresholds[255] = {
+    1.517634955e-04f,
+    4.552904866e-04f,
+    7.588174776e-04f,
+    1.062344410e-03f,
+    1.365871402e-03f,
+    1.669398393e-03f,
+    1.972925384e-03f,
+    2.276452491e-03f,
+    2.579979366e-03f,
+    2.883506240e-03f,
+    3.188300878e-03f,
+    3.509259317e-03f,
+    3.848314984e-03f,
+    4.205747973e-03f,
+    4.581832793e-03f,
+    4.976837430e-03f,
+    5.391024053e-03f,
+    5.824650638e-03f,
+    6.277969573e-03f,
+    6.751227658e-03f,
+    7.244668435e-03f,
+    7.758530322e-03f,
+    8.293048479e-03f,
+    8.848452941e-03f,
+    9.424970485e-03f,
+    1.002282556e-02f,
+    1.064223703e-02f,
+    1.128342096e-02f,
+    1.194659248e-02f,
+    1.263196021e-02f,
+    1.333973184e-02f,
+    1.407011226e-02f,
+    1.482330263e-02f,
+    1.559950318e-02f,
+    1.639891043e-02f,
+    1.722171530e-02f,
+    1.806811430e-02f,
+    1.893829368e-02f,
+    1.983244345e-02f,
+    2.075074427e-02f,
+    2.169338241e-02f,
+    2.266053855e-02f,
+    2.365238965e-02f,
+    2.466911450e-02f,
+    2.571088821e-02f,
+    2.677788213e-02f,
+    2.787026949e-02f,
+    2.898821980e-02f,
+    3.013190255e-02f,
+    3.130147979e-02f,
+    3.249712288e-02f,
+    3.371898830e-02f,
+    3.496724367e-02f,
+    3.624204546e-02f,
+    3.754355386e-02f,
+    3.887192532e-02f,
+    4.022732005e-02f,
+    4.160988703e-02f,
+    4.301978648e-02f,
+    4.445716366e-02f,
+    4.592217132e-02f,
+    4.741496220e-02f,
+    4.893568531e-02f,
+    5.048448592e-02f,
+    5.206150562e-02f,
+    5.366689712e-02f,
+    5.530080199e-02f,
+    5.696336180e-02f,
+    5.865471810e-02f,
+    6.037501246e-02f,
+    6.212438270e-02f,
+    6.390297413e-02f,
+    6.571091712e-02f,
+    6.754834950e-02f,
+    6.941541284e-02f,
+    7.131223381e-02f,
+    7.323895395e-02f,
+    7.519570738e-02f,
+    7.718261331e-02f,
+    7.919982076e-02f,
+    8.124744147e-02f,
+    8.332562447e-02f,
+    8.543448895e-02f,
+    8.757415414e-02f,
+    8.974476904e-02f,
+    9.194643795e-02f,
+    9.417930245e-02f,
+    9.644347429e-02f,
+    9.873909503e-02f,
+    1.010662690e-01f,
+    1.034251302e-01f,
+    1.058158055e-01f,
+    1.082383990e-01f,
+    1.106930450e-01f,
+    1.131798625e-01f,
+    1.156989709e-01f,
+    1.182504818e-01f,
+    1.208345219e-01f,
+    1.234512031e-01f,
+    1.261006445e-01f,
+    1.287829578e-01f,
+    1.314982623e-01f,
+    1.342466772e-01f,
+    1.370283067e-01f,
+    1.398432702e-01f,
+    1.426916867e-01f,
+    1.455736607e-01f,
+    1.484893113e-01f,
+    1.514387280e-01f,
+    1.544220597e-01f,
+    1.574393809e-01f,
+    1.604908258e-01f,
+    1.635764986e-01f,
+    1.666964889e-01f,
+    1.698509306e-01f,
+    1.730399132e-01f,
+    1.762635708e-01f,
+    1.795219779e-01f,
+    1.828152537e-01f,
+    1.861435026e-01f,
+    1.895068288e-01f,
+    1.929053515e-01f,
+    1.963391453e-01f,
+    1.998083442e-01f,
+    2.033130378e-01f,
+    2.068533450e-01f,
+    2.104293406e-01f,
+    2.140411437e-01f,
+    2.176888436e-01f,
+    2.213725597e-01f,
+    2.250923961e-01f,
+    2.288484275e-01f,
+    2.326407582e-01f,
+    2.364695072e-01f,
+    2.403347790e-01f,
+    2.442366332e-01f,
+    2.481752038e-01f,
+    2.521505654e-01f,
+    2.561628520e-01f,
+    2.602121234e-01f,
+    2.642984688e-01f,
+    2.684220374e-01f,
+    2.725828886e-01f,
+    2.767811120e-01f,
+    2.810167968e-01f,
+    2.852900922e-01f,
+    2.896010280e-01f,
+    2.939497232e-01f,
+    2.983362973e-01f,
+    3.027608097e-01f,
+    3.072233498e-01f,
+    3.117240369e-01f,
+    3.162629604e-01f,
+    3.208401799e-01f,
+    3.254558444e-01f,
+    3.301099837e-01f,
+    3.348027468e-01f,
+    3.395341635e-01f,
+    3.443043828e-01f,
+    3.491134644e-01f,
+    3.539614975e-01f,
+    3.588485718e-01f,
+    3.637747765e-01f,
+    3.687402308e-01f,
+    3.737449646e-01f,
+    3.787891269e-01f,
+    3.838727772e-01f,
+    3.889960051e-01f,
+    3.941588998e-01f,
+    3.993615210e-01f,
+    4.046040177e-01f,
+    4.098864198e-01f,
+    4.152088165e-01f,
+    4.205713570e-01f,
+    4.259740412e-01f,
+    4.314170182e-01f,
+    4.369003475e-01f,
+    4.424241185e-01f,
+    4.479884207e-01f,
+    4.535933137e-01f,
+    4.592389166e-01f,
+    4.649252892e-01f,
+    4.706525207e-01f,
+    4.764207006e-01f,
+    4.822299182e-01f,
+    4.880802333e-01f,
+    4.939717650e-01f,
+    4.999045432e-01f,
+    5.058786869e-01f,
+    5.118942857e-01f,
+    5.179514289e-01f,
+    5.240501165e-01f,
+    5.301905274e-01f,
+    5.363727212e-01f,
+    5.425967574e-01f,
+    5.488626957e-01f,
+    5.551706553e-01f,
+    5.615206957e-01f,
+    5.679128766e-01f,
+    5.743473172e-01f,
+    5.808241367e-01f,
+    5.873433352e-01f,
+    5.939049721e-01f,
+    6.005092263e-01f,
+    6.071560979e-01f,
+    6.138457060e-01f,
+    6.205781102e-01f,
+    6.273533702e-01f,
+    6.341716051e-01f,
+    6.410328746e-01f,
+    6.479372382e-01f,
+    6.548848152e-01f,
+    6.618756652e-01f,
+    6.689097881e-01f,
+    6.759873629e-01f,
+    6.831084490e-01f,
+    6.902731061e-01f,
+    6.974813342e-01f,
+    7.047333717e-01f,
+    7.120291591e-01f,
+    7.193688154e-01f,
+    7.267524600e-01f,
+    7.341800332e-01f,
+    7.416517735e-01f,
+    7.491676807e-01f,
+    7.567278147e-01f,
+    7.643322945e-01f,
+    7.719811201e-01f,
+    7.796744108e-01f,
+    7.874122858e-01f,
+    7.951947451e-01f,
+    8.030219078e-01f,
+    8.108938336e-01f,
+    8.188105226e-01f,
+    8.267722130e-01f,
+    8.347787857e-01f,
+    8.428304791e-01f,
+    8.509272933e-01f,
+    8.590692282e-01f,
+    8.672565222e-01f,
+    8.754890561e-01f,
+    8.837670684e-01f,
+    8.920905590e-01f,
+    9.004595876e-01f,
+    9.088742137e-01f,
+    9.173345566e-01f,
+    9.258406162e-01f,
+    9.343925714e-01f,
+    9.429903626e-01f,
+    9.516341686e-01f,
+    9.603240490e-01f,
+    9.690600038e-01f,
+    9.778421521e-01f,
+    9.866705537e-01f,
+    9.955452681e-01f,
+};
+
+const static uint8_t g_linearToSRGBBuckets[4096] = {
+    0,
+    1,
+    2,
+    2,
+    3,
+    4,
+    5,
+    6,
+    6,
+    7,
+    8,
+    9,
+    10,
+    10,
+    11,
+    12,
+    13,
+    13,
+    14,
+    15,
+    15,
+    16,
+    16,
+    17,
+    18,
+    18,
+    19,
+    19,
+    20,
+    20,
+    21,
+    21,
+    22,
+    22,
+    23,
+    23,
+    23,
+    24,
+    24,
+    25,
+    25,
+    25,
+    26,
+    26,
+    27,
+    27,
+    27,
+    28,
+    28,
+    29,
+    29,
+    29,
+    30,
+    30,
+    30,
+    31,
+    31,
+    31,
+    32,
+    32,
+    32,
+    33,
+    33,
+    33,
+    34,
+    34,
+    34,
+    34,
+    35,
+    35,
+    35,
+    36,
+    36,
+    36,
+    36,
+    37,
+    37,
+    37,
+    38,
+    38,
+    38,
+    38,
+    39,
+    39,
+    39,
+    40,
+    40,
+    40,
+    40,
+    41,
+    41,
+    41,
+    41,
+    42,
+    42,
+    42,
+    42,
+    43,
+    43,
+    43,
+    43,
+    43,
+    44,
+    44,
+    44,
+    44,
+    45,
+    45,
+    45,
+    45,
+    46,
+    46,
+    46,
+    46,
+    46,
+    47,
+    47,
+    47,
+    47,
+    48,
+    48,
+    48,
+    48,
+    48,
+    49,
+    49,
+    49,
+    49,
+    49,
+    50,
+    50,
+    50,
+    50,
+    50,
+    51,
+    51,
+    51,
+    51,
+    51,
+    52,
+    52,
+    52,
+    52,
+    52,
+    53,
+    53,
+    53,
+    53,
+    53,
+    54,
+    54,
+    54,
+    54,
+    54,
+    55,
+    55,
+    55,
+    55,
+    55,
+    55,
+    56,
+    56,
+    56,
+    56,
+    56,
+    57,
+    57,
+    57,
+    57,
+    57,
+    57,
+    58,
+    58,
+    58,
+    58,
+    58,
+    58,
+    59,
+    59,
+    59,
+    59,
+    59,
+    59,
+    60,
+    60,
+    60,
+    60,
+    60,
+    60,
+    61,
+    61,
+    61,
+    61,
+    61,
+    61,
+    62,
+    62,
+    62,
+    62,
+    62,
+    62,
+    63,
+    63,
+    63,
+    63,
+    63,
+    63,
+    64,
+    64,
+    64,
+    64,
+    64,
+    64,
+    64,
+    65,
+    65,
+    65,
+    65,
+    65,
+    65,
+    66,
+    66,
+    66,
+    66,
+    66,
+    66,
+    66,
+    67,
+    67,
+    67,
+    67,
+    67,
+    67,
+    67,
+    68,
+    68,
+    68,
+    68,
+    68,
+    68,
+    68,
+    69,
+    69,
+    69,
+    69,
+    69,
+    69,
+    69,
+    70,
+    70,
+    70,
+    70,
+    70,
+    70,
+    70,
+    71,
+    71,
+    71,
+    71,
+    71,
+    71,
+    71,
+    72,
+    72,
+    72,
+    72,
+    72,
+    72,
+    72,
+    72,
+    73,
+    73,
+    73,
+    73,
+    73,
+    73,
+    73,
+    74,
+    74,
+    74,
+    74,
+    74,
+    74,
+    74,
+    74,
+    75,
+    75,
+    75,
+    75,
+    75,
+    75,
+    75,
+    75,
+    76,
+    76,
+    76,
+    76,
+    76,
+    76,
+    76,
+    77,
+    77,
+    77,
+    77,
+    77,
+    77,
+    77,
+    77,
+    77,
+    78,
+    78,
+    78,
+    78,
+    78,
+    78,
+    78,
+    78,
+    79,
+    79,
+    79,
+    79,
+    79,
+    79,
+    79,
+    79,
+    80,
+    80,
+    80,
+    80,
+    80,
+    80,
+    80,
+    80,
+    81,
+    81,
+    81,
+    81,
+    81,
+    81,
+    81,
+    81,
+    81,
+    82,
+    82,
+    82,
+    82,
+    82,
+    82,
+    82,
+    82,
+    83,
+    83,
+    83,
+    83,
+    83,
+    83,
+    83,
+    83,
+    83,
+    84,
+    84,
+    84,
+    84,
+    84,
+    84,
+    84,
+    84,
+    84,
+    85,
+    85,
+    85,
+    85,
+    85,
+    85,
+    85,
+    85,
+    85,
+    86,
+    86,
+    86,
+    86,
+    86,
+    86,
+    86,
+    86,
+    86,
+    87,
+    87,
+    87,
+    87,
+    87,
+    87,
+    87,
+    87,
+    87,
+    87,
+    88,
+    88,
+    88,
+    88,
+    88,
+    88,
+    88,
+    88,
+    88,
+    89,
+    89,
+    89,
+    89,
+    89,
+    89,
+    89,
+    89,
+    89,
+    90,
+    90,
+    90,
+    90,
+    90,
+    90,
+    90,
+    90,
+    90,
+    90,
+    91,
+    91,
+    91,
+    91,
+    91,
+    91,
+    91,
+    91,
+    91,
+    91,
+    92,
+    92,
+    92,
+    92,
+    92,
+    92,
+    92,
+    92,
+    92,
+    92,
+    93,
+    93,
+    93,
+    93,
+    93,
+    93,
+    93,
+    93,
+    93,
+    93,
+    94,
+    94,
+    94,
+    94,
+    94,
+    94,
+    94,
+    94,
+    94,
+    94,
+    95,
+    95,
+    95,
+    95,
+    95,
+    95,
+    95,
+    95,
+    95,
+    95,
+    96,
+    96,
+    96,
+    96,
+    96,
+    96,
+    96,
+    96,
+    96,
+    96,
+    96,
+    97,
+    97,
+    97,
+    97,
+    97,
+    97,
+    97,
+    97,
+    97,
+    97,
+    98,
+    98,
+    98,
+    98,
+    98,
+    98,
+    98,
+    98,
+    98,
+    98,
+    98,
+    99,
+    99,
+    99,
+    99,
+    99,
+    99,
+    99,
+    99,
+    99,
+    99,
+    99,
+    100,
+    100,
+    100,
+    100,
+    100,
+    100,
+    100,
+    100,
+    100,
+    100,
+    100,
+    101,
+    101,
+    101,
+    101,
+    101,
+    101,
+    101,
+    101,
+    101,
+    101,
+    101,
+    102,
+    102,
+    102,
+    102,
+    102,
+    102,
+    102,
+    102,
+    102,
+    102,
+    102,
+    103,
+    103,
+    103,
+    103,
+    103,
+    103,
+    103,
+    103,
+    103,
+    103,
+    103,
+    103,
+    104,
+    104,
+    104,
+    104,
+    104,
+    104,
+    104,
+    104,
+    104,
+    104,
+    104,
+    105,
+    105,
+    105,
+    105,
+    105,
+    105,
+    105,
+    105,
+    105,
+    105,
+    105,
+    105,
+    106,
+    106,
+    106,
+    106,
+    106,
+    106,
+    106,
+    106,
+    106,
+    106,
+    106,
+    106,
+    107,
+    107,
+    107,
+    107,
+    107,
+    107,
+    107,
+    107,
+    107,
+    107,
+    107,
+    107,
+    108,
+    108,
+    108,
+    108,
+    108,
+    108,
+    108,
+    108,
+    108,
+    108,
+    108,
+    108,
+    109,
+    109,
+    109,
+    109,
+    109,
+    109,
+    109,
+    109,
+    109,
+    109,
+    109,
+    109,
+    110,
+    110,
+    110,
+    110,
+    110,
+    110,
+    110,
+    110,
+    110,
+    110,
+    110,
+    110,
+    111,
+    111,
+    111,
+    111,
+    111,
+    111,
+    111,
+    111,
+    111,
+    111,
+    111,
+    111,
+    111,
+    112,
+    112,
+    112,
+    112,
+    112,
+    112,
+    112,
+    112,
+    112,
+    112,
+    112,
+    112,
+    112,
+    113,
+    113,
+    113,
+    113,
+    113,
+    113,
+    113,
+    113,
+    113,
+    113,
+    113,
+    113,
+    114,
+    114,
+    114,
+    114,
+    114,
+    114,
+    114,
+    114,
+    114,
+    114,
+    114,
+    114,
+    114,
+    115,
+    115,
+    115,
+    115,
+    115,
+    115,
+    115,
+    115,
+    115,
+    115,
+    115,
+    115,
+    115,
+    116,
+    116,
+    116,
+    116,
+    116,
+    116,
+    116,
+    116,
+    116,
+    116,
+    116,
+    116,
+    116,
+    117,
+    117,
+    117,
+    117,
+    117,
+    117,
+    117,
+    117,
+    117,
+    117,
+    117,
+    117,
+    117,
+    117,
+    118,
+    118,
+    118,
+    118,
+    118,
+    118,
+    118,
+    118,
+    118,
+    118,
+    118,
+    118,
+    118,
+    119,
+    119,
+    119,
+    119,
+    119,
+    119,
+    119,
+    119,
+    119,
+    119,
+    119,
+    119,
+    119,
+    119,
+    120,
+    120,
+    120,
+    120,
+    120,
+    120,
+    120,
+    120,
+    120,
+    120,
+    120,
+    120,
+    120,
+    120,
+    121,
+    121,
+    121,
+    121,
+    121,
+    121,
+    121,
+    121,
+    121,
+    121,
+    121,
+    121,
+    121,
+    121,
+    122,
+    122,
+    122,
+    122,
+    122,
+    122,
+    122,
+    122,
+    122,
+    122,
+    122,
+    122,
+    122,
+    122,
+    123,
+    123,
+    123,
+    123,
+    123,
+    123,
+    123,
+    123,
+    123,
+    123,
+    123,
+    123,
+    123,
+    123,
+    124,
+    124,
+    124,
+    124,
+    124,
+    124,
+    124,
+    124,
+    124,
+    124,
+    124,
+    124,
+    124,
+    124,
+    125,
+    125,
+    125,
+    125,
+    125,
+    125,
+    125,
+    125,
+    125,
+    125,
+    125,
+    125,
+    125,
+    125,
+    125,
+    126,
+    126,
+    126,
+    126,
+    126,
+    126,
+    126,
+    126,
+    126,
+    126,
+    126,
+    126,
+    126,
+    126,
+    127,
+    127,
+    127,
+    127,
+    127,
+    127,
+    127,
+    127,
+    127,
+    127,
+    127,
+    127,
+    127,
+    127,
+    127,
+    128,
+    128,
+    128,
+    128,
+    128,
+    128,
+    128,
+    128,
+    128,
+    128,
+    128,
+    128,
+    128,
+    128,
+    128,
+    129,
+    129,
+    129,
+    129,
+    129,
+    129,
+    129,
+    129,
+    129,
+    129,
+    129,
+    129,
+    129,
+    129,
+    129,
+    130,
+    130,
+    130,
+    130,
+    130,
+    130,
+    130,
+    130,
+    130,
+    130,
+    130,
+    130,
+    130,
+    130,
+    130,
+    131,
+    131,
+    131,
+    131,
+    131,
+    131,
+    131,
+    131,
+    131,
+    131,
+    131,
+    131,
+    131,
+    131,
+    131,
+    131,
+    132,
+    132,
+    132,
+    132,
+    132,
+    132,
+    132,
+    132,
+    132,
+    132,
+    132,
+    132,
+    132,
+    132,
+    132,
+    133,
+    133,
+    133,
+    133,
+    133,
+    133,
+    133,
+    133,
+    133,
+    133,
+    133,
+    133,
+    133,
+    133,
+    133,
+    133,
+    134,
+    134,
+    134,
+    134,
+    134,
+    134,
+    134,
+    134,
+    134,
+    134,
+    134,
+    134,
+    134,
+    134,
+    134,
+    134,
+    135,
+    135,
+    135,
+    135,
+    135,
+    135,
+    135,
+    135,
+    135,
+    135,
+    135,
+    135,
+    135,
+    135,
+    135,
+    135,
+    136,
+    136,
+    136,
+    136,
+    136,
+    136,
+    136,
+    136,
+    136,
+    136,
+    136,
+    136,
+    136,
+    136,
+    136,
+    136,
+    137,
+    137,
+    137,
+    137,
+    137,
+    137,
+    137,
+    137,
+    137,
+    137,
+    137,
+    137,
+    137,
+    137,
+    137,
+    137,
+    138,
+    138,
+    138,
+    138,
+    138,
+    138,
+    138,
+    138,
+    138,
+    138,
+    138,
+    138,
+    138,
+    138,
+    138,
+    138,
+    138,
+    139,
+    139,
+    139,
+    139,
+    139,
+    139,
+    139,
+    139,
+    139,
+    139,
+    139,
+    139,
+    139,
+    139,
+    139,
+    139,
+    140,
+    140,
+    140,
+    140,
+    140,
+    140,
+    140,
+    140,
+    140,
+    140,
+    140,
+    140,
+    140,
+    140,
+    140,
+    140,
+    140,
+    141,
+    141,
+    141,
+    141,
+    141,
+    141,
+    141,
+    141,
+    141,
+    141,
+    141,
+    141,
+    141,
+    141,
+    141,
+    141,
+    141,
+    142,
+    142,
+    142,
+    142,
+    142,
+    142,
+    142,
+    142,
+    142,
+    142,
+    142,
+    142,
+    142,
+    142,
+    142,
+    142,
+    142,
+    143,
+    143,
+    143,
+    143,
+    143,
+    143,
+    143,
+    143,
+    143,
+    143,
+    143,
+    143,
+    143,
+    143,
+    143,
+    143,
+    143,
+    144,
+    144,
+    144,
+    144,
+    144,
+    144,
+    144,
+    144,
+    144,
+    144,
+    144,
+    144,
+    144,
+    144,
+    144,
+    144,
+    144,
+    144,
+    145,
+    145,
+    145,
+    145,
+    145,
+    145,
+    145,
+    145,
+    145,
+    145,
+    145,
+    145,
+    145,
+    145,
+    145,
+    145,
+    145,
+    146,
+    146,
+    146,
+    146,
+    146,
+    146,
+    146,
+    146,
+    146,
+    146,
+    146,
+    146,
+    146,
+    146,
+    146,
+    146,
+    146,
+    146,
+    147,
+    147,
+    147,
+    147,
+    147,
+    147,
+    147,
+    147,
+    147,
+    147,
+    147,
+    147,
+    147,
+    147,
+    147,
+    147,
+    147,
+    147,
+    148,
+    148,
+    148,
+    148,
+    148,
+    148,
+    148,
+    148,
+    148,
+    148,
+    148,
+    148,
+    148,
+    148,
+    148,
+    148,
+    148,
+    149,
+    149,
+    149,
+    149,
+    149,
+    149,
+    149,
+    149,
+    149,
+    149,
+    149,
+    149,
+    149,
+    149,
+    149,
+    149,
+    149,
+    149,
+    149,
+    150,
+    150,
+    150,
+    150,
+    150,
+    150,
+    150,
+    150,
+    150,
+    150,
+    150,
+    150,
+    150,
+    150,
+    150,
+    150,
+    150,
+    150,
+    151,
+    151,
+    151,
+    151,
+    151,
+    151,
+    151,
+    151,
+    151,
+    151,
+    151,
+    151,
+    151,
+    151,
+    151,
+    151,
+    151,
+    151,
+    152,
+    152,
+    152,
+    152,
+    152,
+    152,
+    152,
+    152,
+    152,
+    152,
+    152,
+    152,
+    152,
+    152,
+    152,
+    152,
+    152,
+    152,
+    152,
+    153,
+    153,
+    153,
+    153,
+    153,
+    153,
+    153,
+    153,
+    153,
+    153,
+    153,
+    153,
+    153,
+    153,
+    153,
+    153,
+    153,
+    153,
+    153,
+    154,
+    154,
+    154,
+    154,
+    154,
+    154,
+    154,
+    154,
+    154,
+    154,
+    154,
+    154,
+    154,
+    154,
+    154,
+    154,
+    154,
+    154,
+    154,
+    155,
+    155,
+    155,
+    155,
+    155,
+    155,
+    155,
+    155,
+    155,
+    155,
+    155,
+    155,
+    155,
+    155,
+    155,
+    155,
+    155,
+    155,
+    155,
+    156,
+    156,
+    156,
+    156,
+    156,
+    156,
+    156,
+    156,
+    156,
+    156,
+    156,
+    156,
+    156,
+    156,
+    156,
+    156,
+    156,
+    156,
+    156,
+    157,
+    157,
+    157,
+    157,
+    157,
+    157,
+    157,
+    157,
+    157,
+    157,
+    157,
+    157,
+    157,
+    157,
+    157,
+    157,
+    157,
+    157,
+    157,
+    158,
+    158,
+    158,
+    158,
+    158,
+    158,
+    158,
+    158,
+    158,
+    158,
+    158,
+    158,
+    158,
+    158,
+    158,
+    158,
+    158,
+    158,
+    158,
+    158,
+    159,
+    159,
+    159,
+    159,
+    159,
+    159,
+    159,
+    159,
+    159,
+    159,
+    159,
+    159,
+    159,
+    159,
+    159,
+    159,
+    159,
+    159,
+    159,
+    160,
+    160,
+    160,
+    160,
+    160,
+    160,
+    160,
+    160,
+    160,
+    160,
+    160,
+    160,
+    160,
+    160,
+    160,
+    160,
+    160,
+    160,
+    160,
+    160,
+    161,
+    161,
+    161,
+    161,
+    161,
+    161,
+    161,
+    161,
+    161,
+    161,
+    161,
+    161,
+    161,
+    161,
+    161,
+    161,
+    161,
+    161,
+    161,
+    161,
+    162,
+    162,
+    162,
+    162,
+    162,
+    162,
+    162,
+    162,
+    162,
+    162,
+    162,
+    162,
+    162,
+    162,
+    162,
+    162,
+    162,
+    162,
+    162,
+    162,
+    162,
+    163,
+    163,
+    163,
+    163,
+    163,
+    163,
+    163,
+    163,
+    163,
+    163,
+    163,
+    163,
+    163,
+    163,
+    163,
+    163,
+    163,
+    163,
+    163,
+    163,
+    164,
+    164,
+    164,
+    164,
+    164,
+    164,
+    164,
+    164,
+    164,
+    164,
+    164,
+    164,
+    164,
+    164,
+    164,
+    164,
+    164,
+    164,
+    164,
+    164,
+    165,
+    165,
+    165,
+    165,
+    165,
+    165,
+    165,
+    165,
+    165,
+    165,
+    165,
+    165,
+    165,
+    165,
+    165,
+    165,
+    165,
+    165,
+    165,
+    165,
+    165,
+    166,
+    166,
+    166,
+    166,
+    166,
+    166,
+    166,
+    166,
+    166,
+    166,
+    166,
+    166,
+    166,
+    166,
+    166,
+    166,
+    166,
+    166,
+    166,
+    166,
+    166,
+    167,
+    167,
+    167,
+    167,
+    167,
+    167,
+    167,
+    167,
+    167,
+    167,
+    167,
+    167,
+    167,
+    167,
+    167,
+    167,
+    167,
+    167,
+    167,
+    167,
+    167,
+    168,
+    168,
+    168,
+    168,
+    168,
+    168,
+    168,
+    168,
+    168,
+    168,
+    168,
+    168,
+    168,
+    168,
+    168,
+    168,
+    168,
+    168,
+    168,
+    168,
+    168,
+    169,
+    169,
+    169,
+    169,
+    169,
+    169,
+    169,
+    169,
+    169,
+    169,
+    169,
+    169,
+    169,
+    169,
+    169,
+    169,
+    169,
+    169,
+    169,
+    169,
+    169,
+    170,
+    170,
+    170,
+    170,
+    170,
+    170,
+    170,
+    170,
+    170,
+    170,
+    170,
+    170,
+    170,
+    170,
+    170,
+    170,
+    170,
+    170,
+    170,
+    170,
+    170,
+    170,
+    171,
+    171,
+    171,
+    171,
+    171,
+    171,
+    171,
+    171,
+    171,
+    171,
+    171,
+    171,
+    171,
+    171,
+    171,
+    171,
+    171,
+    171,
+    171,
+    171,
+    171,
+    172,
+    172,
+    172,
+    172,
+    172,
+    172,
+    172,
+    172,
+    172,
+    172,
+    172,
+    172,
+    172,
+    172,
+    172,
+    172,
+    172,
+    172,
+    172,
+    172,
+    172,
+    172,
+    173,
+    173,
+    173,
+    173,
+    173,
+    173,
+    173,
+    173,
+    173,
+    173,
+    173,
+    173,
+    173,
+    173,
+    173,
+    173,
+    173,
+    173,
+    173,
+    173,
+    173,
+    173,
+    174,
+    174,
+    174,
+    174,
+    174,
+    174,
+    174,
+    174,
+    174,
+    174,
+    174,
+    174,
+    174,
+    174,
+    174,
+    174,
+    174,
+    174,
+    174,
+    174,
+    174,
+    174,
+    175,
+    175,
+    175,
+    175,
+    175,
+    175,
+    175,
+    175,
+    175,
+    175,
+    175,
+    175,
+    175,
+    175,
+    175,
+    175,
+    175,
+    175,
+    175,
+    175,
+    175,
+    175,
+    175,
+    176,
+    176,
+    176,
+    176,
+    176,
+    176,
+    176,
+    176,
+    176,
+    176,
+    176,
+    176,
+    176,
+    176,
+    176,
+    176,
+    176,
+    176,
+    176,
+    176,
+    176,
+    176,
+    177,
+    177,
+    177,
+    177,
+    177,
+    177,
+    177,
+    177,
+    177,
+    177,
+    177,
+    177,
+    177,
+    177,
+    177,
+    177,
+    177,
+    177,
+    177,
+    177,
+    177,
+    177,
+    177,
+    178,
+    178,
+    178,
+    178,
+    178,
+    178,
+    178,
+    178,
+    178,
+    178,
+    178,
+    178,
+    178,
+    178,
+    178,
+    178,
+    178,
+    178,
+    178,
+    178,
+    178,
+    178,
+    179,
+    179,
+    179,
+    179,
+    179,
+    179,
+    179,
+    179,
+    179,
+    179,
+    179,
+    179,
+    179,
+    179,
+    179,
+    179,
+    179,
+    179,
+    179,
+    179,
+    179,
+    179,
+    179,
+    180,
+    180,
+    180,
+    180,
+    180,
+    180,
+    180,
+    180,
+    180,
+    180,
+    180,
+    180,
+    180,
+    180,
+    180,
+    180,
+    180,
+    180,
+    180,
+    180,
+    180,
+    180,
+    180,
+    180,
+    181,
+    181,
+    181,
+    181,
+    181,
+    181,
+    181,
+    181,
+    181,
+    181,
+    181,
+    181,
+    181,
+    181,
+    181,
+    181,
+    181,
+    181,
+    181,
+    181,
+    181,
+    181,
+    181,
+    182,
+    182,
+    182,
+    182,
+    182,
+    182,
+    182,
+    182,
+    182,
+    182,
+    182,
+    182,
+    182,
+    182,
+    182,
+    182,
+    182,
+    182,
+    182,
+    182,
+    182,
+    182,
+    182,
+    183,
+    183,
+    183,
+    183,
+    183,
+    183,
+    183,
+    183,
+    183,
+    183,
+    183,
+    183,
+    183,
+    183,
+    183,
+    183,
+    183,
+    183,
+    183,
+    183,
+    183,
+    183,
+    183,
+    183,
+    184,
+    184,
+    184,
+    184,
+    184,
+    184,
+    184,
+    184,
+    184,
+    184,
+    184,
+    184,
+    184,
+    184,
+    184,
+    184,
+    184,
+    184,
+    184,
+    184,
+    184,
+    184,
+    184,
+    184,
+    185,
+    185,
+    185,
+    185,
+    185,
+    185,
+    185,
+    185,
+    185,
+    185,
+    185,
+    185,
+    185,
+    185,
+    185,
+    185,
+    185,
+    185,
+    185,
+    185,
+    185,
+    185,
+    185,
+    185,
+    186,
+    186,
+    186,
+    186,
+    186,
+    186,
+    186,
+    186,
+    186,
+    186,
+    186,
+    186,
+    186,
+    186,
+    186,
+    186,
+    186,
+    186,
+    186,
+    186,
+    186,
+    186,
+    186,
+    186,
+    187,
+    187,
+    187,
+    187,
+    187,
+    187,
+    187,
+    187,
+    187,
+    187,
+    187,
+    187,
+    187,
+    187,
+    187,
+    187,
+    187,
+    187,
+    187,
+    187,
+    187,
+    187,
+    187,
+    187,
+    188,
+    188,
+    188,
+    188,
+    188,
+    188,
+    188,
+    188,
+    188,
+    188,
+    188,
+    188,
+    188,
+    188,
+    188,
+    188,
+    188,
+    188,
+    188,
+    188,
+    188,
+    188,
+    188,
+    188,
+    188,
+    189,
+    189,
+    189,
+    189,
+    189,
+    189,
+    189,
+    189,
+    189,
+    189,
+    189,
+    189,
+    189,
+    189,
+    189,
+    189,
+    189,
+    189,
+    189,
+    189,
+    189,
+    189,
+    189,
+    189,
+    190,
+    190,
+    190,
+    190,
+    190,
+    190,
+    190,
+    190,
+    190,
+    190,
+    190,
+    190,
+    190,
+    190,
+    190,
+    190,
+    190,
+    190,
+    190,
+    190,
+    190,
+    190,
+    190,
+    190,
+    190,
+    191,
+    191,
+    191,
+    191,
+    191,
+    191,
+    191,
+    191,
+    191,
+    191,
+    191,
+    191,
+    191,
+    191,
+    191,
+    191,
+    191,
+    191,
+    191,
+    191,
+    191,
+    191,
+    191,
+    191,
+    191,
+    192,
+    192,
+    192,
+    192,
+    192,
+    192,
+    192,
+    192,
+    192,
+    192,
+    192,
+    192,
+    192,
+    192,
+    192,
+    192,
+    192,
+    192,
+    192,
+    192,
+    192,
+    192,
+    192,
+    192,
+    192,
+    193,
+    193,
+    193,
+    193,
+    193,
+    193,
+    193,
+    193,
+    193,
+    193,
+    193,
+    193,
+    193,
+    193,
+    193,
+    193,
+    193,
+    193,
+    193,
+    193,
+    193,
+    193,
+    193,
+    193,
+    193,
+    194,
+    194,
+    194,
+    194,
+    194,
+    194,
+    194,
+    194,
+    194,
+    194,
+    194,
+    194,
+    194,
+    194,
+    194,
+    194,
+    194,
+    194,
+    194,
+    194,
+    194,
+    194,
+    194,
+    194,
+    194,
+    194,
+    195,
+    195,
+    195,
+    195,
+    195,
+    195,
+    195,
+    195,
+    195,
+    195,
+    195,
+    195,
+    195,
+    195,
+    195,
+    195,
+    195,
+    195,
+    195,
+    195,
+    195,
+    195,
+    195,
+    195,
+    195,
+    195,
+    196,
+    196,
+    196,
+    196,
+    196,
+    196,
+    196,
+    196,
+    196,
+    196,
+    196,
+    196,
+    196,
+    196,
+    196,
+    196,
+    196,
+    196,
+    196,
+    196,
+    196,
+    196,
+    196,
+    196,
+    196,
+    197,
+    197,
+    197,
+    197,
+    197,
+    197,
+    197,
+    197,
+    197,
+    197,
+    197,
+    197,
+    197,
+    197,
+    197,
+    197,
+    197,
+    197,
+    197,
+    197,
+    197,
+    197,
+    197,
+    197,
+    197,
+    197,
+    198,
+    198,
+    198,
+    198,
+    198,
+    198,
+    198,
+    198,
+    198,
+    198,
+    198,
+    198,
+    198,
+    198,
+    198,
+    198,
+    198,
+    198,
+    198,
+    198,
+    198,
+    198,
+    198,
+    198,
+    198,
+    198,
+    198,
+    199,
+    199,
+    199,
+    199,
+    199,
+    199,
+    199,
+    199,
+    199,
+    199,
+    199,
+    199,
+    199,
+    199,
+    199,
+    199,
+    199,
+    199,
+    199,
+    199,
+    199,
+    199,
+    199,
+    199,
+    199,
+    199,
+    200,
+    200,
+    200,
+    200,
+    200,
+    200,
+    200,
+    200,
+    200,
+    200,
+    200,
+    200,
+    200,
+    200,
+    200,
+    200,
+    200,
+    200,
+    200,
+    200,
+    200,
+    200,
+    200,
+    200,
+    200,
+    200,
+    200,
+    201,
+    201,
+    201,
+    201,
+    201,
+    201,
+    201,
+    201,
+    201,
+    201,
+    201,
+    201,
+    201,
+    201,
+    201,
+    201,
+    201,
+    201,
+    201,
+    201,
+    201,
+    201,
+    201,
+    201,
+    201,
+    201,
+    202,
+    202,
+    202,
+    202,
+    202,
+    202,
+    202,
+    202,
+    202,
+    202,
+    202,
+    202,
+    202,
+    202,
+    202,
+    202,
+    202,
+    202,
+    202,
+    202,
+    202,
+    202,
+    202,
+    202,
+    202,
+    202,
+    202,
+    203,
+    203,
+    203,
+    203,
+    203,
+    203,
+    203,
+    203,
+    203,
+    203,
+    203,
+    203,
+    203,
+    203,
+    203,
+    203,
+    203,
+    203,
+    203,
+    203,
+    203,
+    203,
+    203,
+    203,
+    203,
+    203,
+    203,
+    204,
+    204,
+    204,
+    204,
+    204,
+    204,
+    204,
+    204,
+    204,
+    204,
+    204,
+    204,
+    204,
+    204,
+    204,
+    204,
+    204,
+    204,
+    204,
+    204,
+    204,
+    204,
+    204,
+    204,
+    204,
+    204,
+    204,
+    205,
+    205,
+    205,
+    205,
+    205,
+    205,
+    205,
+    205,
+    205,
+    205,
+    205,
+    205,
+    205,
+    205,
+    205,
+    205,
+    205,
+    205,
+    205,
+    205,
+    205,
+    205,
+    205,
+    205,
+    205,
+    205,
+    205,
+    205,
+    206,
+    206,
+    206,
+    206,
+    206,
+    206,
+    206,
+    206,
+    206,
+    206,
+    206,
+    206,
+    206,
+    206,
+    206,
+    206,
+    206,
+    206,
+    206,
+    206,
+    206,
+    206,
+    206,
+    206,
+    206,
+    206,
+    206,
+    207,
+    207,
+    207,
+    207,
+    207,
+    207,
+    207,
+    207,
+    207,
+    207,
+    207,
+    207,
+    207,
+    207,
+    207,
+    207,
+    207,
+    207,
+    207,
+    207,
+    207,
+    207,
+    207,
+    207,
+    207,
+    207,
+    207,
+    207,
+    208,
+    208,
+    208,
+    208,
+    208,
+    208,
+    208,
+    208,
+    208,
+    208,
+    208,
+    208,
+    208,
+    208,
+    208,
+    208,
+    208,
+    208,
+    208,
+    208,
+    208,
+    208,
+    208,
+    208,
+    208,
+    208,
+    208,
+    208,
+    209,
+    209,
+    209,
+    209,
+    209,
+    209,
+    209,
+    209,
+    209,
+    209,
+    209,
+    209,
+    209,
+    209,
+    209,
+    209,
+    209,
+    209,
+    209,
+    209,
+    209,
+    209,
+    209,
+    209,
+    209,
+    209,
+    209,
+    209,
+    210,
+    210,
+    210,
+    210,
+    210,
+    210,
+    210,
+    210,
+    210,
+    210,
+    210,
+    210,
+    210,
+    210,
+    210,
+    210,
+    210,
+    210,
+    210,
+    210,
+    210,
+    210,
+    210,
+    210,
+    210,
+    210,
+    210,
+    210,
+    211,
+    211,
+    211,
+    211,
+    211,
+    211,
+    211,
+    211,
+    211,
+    211,
+    211,
+    211,
+    211,
+    211,
+    211,
+    211,
+    211,
+    211,
+    211,
+    211,
+    211,
+    211,
+    211,
+    211,
+    211,
+    211,
+    211,
+    211,
+    211,
+    212,
+    212,
+    212,
+    212,
+    212,
+    212,
+    212,
+    212,
+    212,
+    212,
+    212,
+    212,
+    212,
+    212,
+    212,
+    212,
+    212,
+    212,
+    212,
+    212,
+    212,
+    212,
+    212,
+    212,
+    212,
+    212,
+    212,
+    212,
+    212,
+    213,
+    213,
+    213,
+    213,
+    213,
+    213,
+    213,
+    213,
+    213,
+    213,
+    213,
+    213,
+    213,
+    213,
+    213,
+    213,
+    213,
+    213,
+    213,
+    213,
+    213,
+    213,
+    213,
+    213,
+    213,
+    213,
+    213,
+    213,
+    214,
+    214,
+    214,
+    214,
+    214,
+    214,
+    214,
+    214,
+    214,
+    214,
+    214,
+    214,
+    214,
+    214,
+    214,
+    214,
+    214,
+    214,
+    214,
+    214,
+    214,
+    214,
+    214,
+    214,
+    214,
+    214,
+    214,
+    214,
+    214,
+    215,
+    215,
+    215,
+    215,
+    215,
+    215,
+    215,
+    215,
+    215,
+    215,
+    215,
+    215,
+    215,
+    215,
+    215,
+    215,
+    215,
+    215,
+    215,
+    215,
+    215,
+    215,
+    215,
+    215,
+    215,
+    215,
+    215,
+    215,
+    215,
+    215,
+    216,
+    216,
+    216,
+    216,
+    216,
+    216,
+    216,
+    216,
+    216,
+    216,
+    216,
+    216,
+    216,
+    216,
+    216,
+    216,
+    216,
+    216,
+    216,
+    216,
+    216,
+    216,
+    216,
+    216,
+    216,
+    216,
+    216,
+    216,
+    216,
+    217,
+    217,
+    217,
+    217,
+    217,
+    217,
+    217,
+    217,
+    217,
+    217,
+    217,
+    217,
+    217,
+    217,
+    217,
+    217,
+    217,
+    217,
+    217,
+    217,
+    217,
+    217,
+    217,
+    217,
+    217,
+    217,
+    217,
+    217,
+    217,
+    218,
+    218,
+    218,
+    218,
+    218,
+    218,
+    218,
+    218,
+    218,
+    218,
+    218,
+    218,
+    218,
+    218,
+    218,
+    218,
+    218,
+    218,
+    218,
+    218,
+    218,
+    218,
+    218,
+    218,
+    218,
+    218,
+    218,
+    218,
+    218,
+    218,
+    219,
+    219,
+    219,
+    219,
+    219,
+    219,
+    219,
+    219,
+    219,
+    219,
+    219,
+    219,
+    219,
+    219,
+    219,
+    219,
+    219,
+    219,
+    219,
+    219,
+    219,
+    219,
+    219,
+    219,
+    219,
+    219,
+    219,
+    219,
+    219,
+    219,
+    220,
+    220,
+    220,
+    220,
+    220,
+    220,
+    220,
+    220,
+    220,
+    220,
+    220,
+    220,
+    220,
+    220,
+    220,
+    220,
+    220,
+    220,
+    220,
+    220,
+    220,
+    220,
+    220,
+    220,
+    220,
+    220,
+    220,
+    220,
+    220,
+    220,
+    221,
+    221,
+    221,
+    221,
+    221,
+    221,
+    221,
+    221,
+    221,
+    221,
+    221,
+    221,
+    221,
+    221,
+    221,
+    221,
+    221,
+    221,
+    221,
+    221,
+    221,
+    221,
+    221,
+    221,
+    221,
+    221,
+    221,
+    221,
+    221,
+    221,
+    222,
+    222,
+    222,
+    222,
+    222,
+    222,
+    222,
+    222,
+    222,
+    222,
+    222,
+    222,
+    222,
+    222,
+    222,
+    222,
+    222,
+    222,
+    222,
+    222,
+    222,
+    222,
+    222,
+    222,
+    222,
+    222,
+    222,
+    222,
+    222,
+    222,
+    222,
+    223,
+    223,
+    223,
+    223,
+    223,
+    223,
+    223,
+    223,
+    223,
+    223,
+    223,
+    223,
+    223,
+    223,
+    223,
+    223,
+    223,
+    223,
+    223,
+    223,
+    223,
+    223,
+    223,
+    223,
+    223,
+    223,
+    223,
+    223,
+    223,
+    223,
+    224,
+    224,
+    224,
+    224,
+    224,
+    224,
+    224,
+    224,
+    224,
+    224,
+    224,
+    224,
+    224,
+    224,
+    224,
+    224,
+    224,
+    224,
+    224,
+    224,
+    224,
+    224,
+    224,
+    224,
+    224,
+    224,
+    224,
+    224,
+    224,
+    224,
+    224,
+    225,
+    225,
+    225,
+    225,
+    225,
+    225,
+    225,
+    225,
+    225,
+    225,
+    225,
+    225,
+    225,
+    225,
+    225,
+    225,
+    225,
+    225,
+    225,
+    225,
+    225,
+    225,
+    225,
+    225,
+    225,
+    225,
+    225,
+    225,
+    225,
+    225,
+    225,
+    226,
+    226,
+    226,
+    226,
+    226,
+    226,
+    226,
+    226,
+    226,
+    226,
+    226,
+    226,
+    226,
+    226,
+    226,
+    226,
+    226,
+    226,
+    226,
+    226,
+    226,
+    226,
+    226,
+    226,
+    226,
+    226,
+    226,
+    226,
+    226,
+    226,
+    226,
+    227,
+    227,
+    227,
+    227,
+    227,
+    227,
+    227,
+    227,
+    227,
+    227,
+    227,
+    227,
+    227,
+    227,
+    227,
+    227,
+    227,
+    227,
+    227,
+    227,
+    227,
+    227,
+    227,
+    227,
+    227,
+    227,
+    227,
+    227,
+    227,
+    227,
+    227,
+    227,
+    228,
+    228,
+    228,
+    228,
+    228,
+    228,
+    228,
+    228,
+    228,
+    228,
+    228,
+    228,
+    228,
+    228,
+    228,
+    228,
+    228,
+    228,
+    228,
+    228,
+    228,
+    228,
+    228,
+    228,
+    228,
+    228,
+    228,
+    228,
+    228,
+    228,
+    228,
+    229,
+    229,
+    229,
+    229,
+    229,
+    229,
+    229,
+    229,
+    229,
+    229,
+    229,
+    229,
+    229,
+    229,
+    229,
+    229,
+    229,
+    229,
+    229,
+    229,
+    229,
+    229,
+    229,
+    229,
+    229,
+    229,
+    229,
+    229,
+    229,
+    229,
+    229,
+    229,
+    230,
+    230,
+    230,
+    230,
+    230,
+    230,
+    230,
+    230,
+    230,
+    230,
+    230,
+    230,
+    230,
+    230,
+    230,
+    230,
+    230,
+    230,
+    230,
+    230,
+    230,
+    230,
+    230,
+    230,
+    230,
+    230,
+    230,
+    230,
+    230,
+    230,
+    230,
+    230,
+    231,
+    231,
+    231,
+    231,
+    231,
+    231,
+    231,
+    231,
+    231,
+    231,
+    231,
+    231,
+    231,
+    231,
+    231,
+    231,
+    231,
+    231,
+    231,
+    231,
+    231,
+    231,
+    231,
+    231,
+    231,
+    231,
+    231,
+    231,
+    231,
+    231,
+    231,
+    231,
+    232,
+    232,
+    232,
+    232,
+    232,
+    232,
+    232,
+    232,
+    232,
+    232,
+    232,
+    232,
+    232,
+    232,
+    232,
+    232,
+    232,
+    232,
+    232,
+    232,
+    232,
+    232,
+    232,
+    232,
+    232,
+    232,
+    232,
+    232,
+    232,
+    232,
+    232,
+    232,
+    233,
+    233,
+    233,
+    233,
+    233,
+    233,
+    233,
+    233,
+    233,
+    233,
+    233,
+    233,
+    233,
+    233,
+    233,
+    233,
+    233,
+    233,
+    233,
+    233,
+    233,
+    233,
+    233,
+    233,
+    233,
+    233,
+    233,
+    233,
+    233,
+    233,
+    233,
+    233,
+    234,
+    234,
+    234,
+    234,
+    234,
+    234,
+    234,
+    234,
+    234,
+    234,
+    234,
+    234,
+    234,
+    234,
+    234,
+    234,
+    234,
+    234,
+    234,
+    234,
+    234,
+    234,
+    234,
+    234,
+    234,
+    234,
+    234,
+    234,
+    234,
+    234,
+    234,
+    234,
+    234,
+    235,
+    235,
+    235,
+    235,
+    235,
+    235,
+    235,
+    235,
+    235,
+    235,
+    235,
+    235,
+    235,
+    235,
+    235,
+    235,
+    235,
+    235,
+    235,
+    235,
+    235,
+    235,
+    235,
+    235,
+    235,
+    235,
+    235,
+    235,
+    235,
+    235,
+    235,
+    235,
+    235,
+    236,
+    236,
+    236,
+    236,
+    236,
+    236,
+    236,
+    236,
+    236,
+    236,
+    236,
+    236,
+    236,
+    236,
+    236,
+    236,
+    236,
+    236,
+    236,
+    236,
+    236,
+    236,
+    236,
+    236,
+    236,
+    236,
+    236,
+    236,
+    236,
+    236,
+    236,
+    236,
+    236,
+    237,
+    237,
+    237,
+    237,
+    237,
+    237,
+    237,
+    237,
+    237,
+    237,
+    237,
+    237,
+    237,
+    237,
+    237,
+    237,
+    237,
+    237,
+    237,
+    237,
+    237,
+    237,
+    237,
+    237,
+    237,
+    237,
+    237,
+    237,
+    237,
+    237,
+    237,
+    237,
+    237,
+    238,
+    238,
+    238,
+    238,
+    238,
+    238,
+    238,
+    238,
+    238,
+    238,
+    238,
+    238,
+    238,
+    238,
+    238,
+    238,
+    238,
+    238,
+    238,
+    238,
+    238,
+    238,
+    238,
+    238,
+    238,
+    238,
+    238,
+    238,
+    238,
+    238,
+    238,
+    238,
+    238,
+    239,
+    239,
+    239,
+    239,
+    239,
+    239,
+    239,
+    239,
+    239,
+    239,
+    239,
+    239,
+    239,
+    239,
+    239,
+    239,
+    239,
+    239,
+    239,
+    239,
+    239,
+    239,
+    239,
+    239,
+    239,
+    239,
+    239,
+    239,
+    239,
+    239,
+    239,
+    239,
+    239,
+    239,
+    240,
+    240,
+    240,
+    240,
+    240,
+    240,
+    240,
+    240,
+    240,
+    240,
+    240,
+    240,
+    240,
+    240,
+    240,
+    240,
+    240,
+    240,
+    240,
+    240,
+    240,
+    240,
+    240,
+    240,
+    240,
+    240,
+    240,
+    240,
+    240,
+    240,
+    240,
+    240,
+    240,
+    240,
+    241,
+    241,
+    241,
+    241,
+    241,
+    241,
+    241,
+    241,
+    241,
+    241,
+    241,
+    241,
+    241,
+    241,
+    241,
+    241,
+    241,
+    241,
+    241,
+    241,
+    241,
+    241,
+    241,
+    241,
+    241,
+    241,
+    241,
+    241,
+    241,
+    241,
+    241,
+    241,
+    241,
+    242,
+    242,
+    242,
+    242,
+    242,
+    242,
+    242,
+    242,
+    242,
+    242,
+    242,
+    242,
+    242,
+    242,
+    242,
+    242,
+    242,
+    242,
+    242,
+    242,
+    242,
+    242,
+    242,
+    242,
+    242,
+    242,
+    242,
+    242,
+    242,
+    242,
+    242,
+    242,
+    242,
+    242,
+    242,
+    243,
+    243,
+    243,
+    243,
+    243,
+    243,
+    243,
+    243,
+    243,
+    243,
+    243,
+    243,
+    243,
+    243,
+    243,
+    243,
+    243,
+    243,
+    243,
+    243,
+    243,
+    243,
+    243,
+    243,
+    243,
+    243,
+    243,
+    243,
+    243,
+    243,
+    243,
+    243,
+    243,
+    243,
+    244,
+    244,
+    244,
+    244,
+    244,
+    244,
+    244,
+    244,
+    244,
+    244,
+    244,
+    244,
+    244,
+    244,
+    244,
+    244,
+    244,
+    244,
+    244,
+    244,
+    244,
+    244,
+    244,
+    244,
+    244,
+    244,
+    244,
+    244,
+    244,
+    244,
+    244,
+    244,
+    244,
+    244,
+    245,
+    245,
+    245,
+    245,
+    245,
+    245,
+    245,
+    245,
+    245,
+    245,
+    245,
+    245,
+    245,
+    245,
+    245,
+    245,
+    245,
+    245,
+    245,
+    245,
+    245,
+    245,
+    245,
+    245,
+    245,
+    245,
+    245,
+    245,
+    245,
+    245,
+    245,
+    245,
+    245,
+    245,
+    245,
+    246,
+    246,
+    246,
+    246,
+    246,
+    246,
+    246,
+    246,
+    246,
+    246,
+    246,
+    246,
+    246,
+    246,
+    246,
+    246,
+    246,
+    246,
+    246,
+    246,
+    246,
+    246,
+    246,
+    246,
+    246,
+    246,
+    246,
+    246,
+    246,
+    246,
+    246,
+    246,
+    246,
+    246,
+    246,
+    247,
+    247,
+    247,
+    247,
+    247,
+    247,
+    247,
+    247,
+    247,
+    247,
+    247,
+    247,
+    247,
+    247,
+    247,
+    247,
+    247,
+    247,
+    247,
+    247,
+    247,
+    247,
+    247,
+    247,
+    247,
+    247,
+    247,
+    247,
+    247,
+    247,
+    247,
+    247,
+    247,
+    247,
+    247,
+    248,
+    248,
+    248,
+    248,
+    248,
+    248,
+    248,
+    248,
+    248,
+    248,
+    248,
+    248,
+    248,
+    248,
+    248,
+    248,
+    248,
+    248,
+    248,
+    248,
+    248,
+    248,
+    248,
+    248,
+    248,
+    248,
+    248,
+    248,
+    248,
+    248,
+    248,
+    248,
+    248,
+    248,
+    248,
+    249,
+    249,
+    249,
+    249,
+    249,
+    249,
+    249,
+    249,
+    249,
+    249,
+    249,
+    249,
+    249,
+    249,
+    249,
+    249,
+    249,
+    249,
+    249,
+    249,
+    249,
+    249,
+    249,
+    249,
+    249,
+    249,
+    249,
+    249,
+    249,
+    249,
+    249,
+    249,
+    249,
+    249,
+    249,
+    250,
+    250,
+    250,
+    250,
+    250,
+    250,
+    250,
+    250,
+    250,
+    250,
+    250,
+    250,
+    250,
+    250,
+    250,
+    250,
+    250,
+    250,
+    250,
+    250,
+    250,
+    250,
+    250,
+    250,
+    250,
+    250,
+    250,
+    250,
+    250,
+    250,
+    250,
+    250,
+    250,
+    250,
+    250,
+    250,
+    251,
+    251,
+    251,
+    251,
+    251,
+    251,
+    251,
+    251,
+    251,
+    251,
+    251,
+    251,
+    251,
+    251,
+    251,
+    251,
+    251,
+    251,
+    251,
+    251,
+    251,
+    251,
+    251,
+    251,
+    251,
+    251,
+    251,
+    251,
+    251,
+    251,
+    251,
+    251,
+    251,
+    251,
+    251,
+    251,
+    252,
+    252,
+    252,
+    252,
+    252,
+    252,
+    252,
+    252,
+    252,
+    252,
+    252,
+    252,
+    252,
+    252,
+    252,
+    252,
+    252,
+    252,
+    252,
+    252,
+    252,
+    252,
+    252,
+    252,
+    252,
+    252,
+    252,
+    252,
+    252,
+    252,
+    252,
+    252,
+    252,
+    252,
+    252,
+    252,
+    253,
+    253,
+    253,
+    253,
+    253,
+    253,
+    253,
+    253,
+    253,
+    253,
+    253,
+    253,
+    253,
+    253,
+    253,
+    253,
+    253,
+    253,
+    253,
+    253,
+    253,
+    253,
+    253,
+    253,
+    253,
+    253,
+    253,
+    253,
+    253,
+    253,
+    253,
+    253,
+    253,
+    253,
+    253,
+    253,
+    254,
+    254,
+    254,
+    254,
+    254,
+    254,
+    254,
+    254,
+    254,
+    254,
+    254,
+    254,
+    254,
+    254,
+    254,
+    254,
+    254,
+    254,
+    254,
+    254,
+    254,
+    254,
+    254,
+    254,
+    254,
+    254,
+    254,
+    254,
+    254,
+    254,
+    254,
+    254,
+    254,
+    254,
+    254,
+    254,
+    255,
+    255,
+    255,
+    255,
+    255,
+    255,
+    255,
+    255,
+    255,
+    255,
+    255,
+    255,
+    255,
+    255,
+    255,
+    255,
+    255,
+    255,
+};
+
+float SRGB8ToLinear(uint8_t value)
+{
+    return g_sRGBToLinear[value];
+}
+
+uint8_t LinearToSRGB8(float value)
+{
+    // No bucket holds more than one threshold, so the value is at most one above the first
+    // value of its bucket
+    int bucket = static_cast<int>(value * 4096.0f);
+    bucket = (bucket < 0) ? 0 : ((bucket > 4095) ? 4095 : bucket);
+
+    unsigned int result = g_linearToSRGBBuckets[bucket];
+    if (result < 255 && value >= g_linearToSRGBThresholds[result])
+    {
+        result++;
+    }
+    return static_cast<uint8_t>(result);
+}
+}
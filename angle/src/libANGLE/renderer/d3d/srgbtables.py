@@ -0,0 +1,81 @@
+# Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+# Use of this source code is governed by a BSD-style license that can be
+# found in the LICENSE file.
+#
+
+# This script generates the functions that convert 8-bit sRGB values to linear
+# floats and back, which mip generation uses to average sRGB texels in linear
+# space.
+
+import struct
+
+def toFloat32(value):
+    return struct.unpack('f', struct.pack('f', value))[0]
+
+def linearize(value):
+    if value <= 0.04045:
+        return value / 12.92
+    else:
+        return ((value + 0.055) / 1.055) ** 2.4
+
+def formatFloat(value):
+    return "%.9ef" % toFloat32(value)
+
+print("""//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// This file is automatically generated.
+
+#include <stdint.h>
+
+namespace rx
+{
+""")
+
+print("const static float g_sRGBToLinear[256] = {")
+for i in range(0, 256):
+    print("    %s," % formatFloat(linearize(i / 255.0)))
+print("};\n")
+
+# The linear value halfway between each pair of adjacent sRGB values, so that
+# encoding rounds to the nearest sRGB value
+thresholds = [toFloat32(linearize((i + 0.5) / 255.0)) for i in range(0, 255)]
+
+print("const static float g_linearToSRGBThresholds[255] = {")
+for threshold in thresholds:
+    print("    %s," % formatFloat(threshold))
+print("};\n")
+
+# The sRGB value at the start of each of the equal ranges of linear values
+bucketCount = 4096
+assert thresholds[1] - thresholds[0] > 1.0 / bucketCount
+
+print("const static uint8_t g_linearToSRGBBuckets[%d] = {" % bucketCount)
+for i in range(0, bucketCount):
+    start = toFloat32(i / float(bucketCount))
+    print("    %d," % len([threshold for threshold in thresholds if threshold <= start]))
+print("};\n")
+
+print("""float SRGB8ToLinear(uint8_t value)
+{
+    return g_sRGBToLinear[value];
+}
+
+uint8_t LinearToSRGB8(float value)
+{
+    // No bucket holds more than one threshold, so the value is at most one above the first
+    // value of its bucket
+    int bucket = static_cast<int>(value * %d.0f);
+    bucket = (bucket < 0) ? 0 : ((bucket > %d) ? %d : bucket);
+
+    unsigned int result = g_linearToSRGBBuckets[bucket];
+    if (result < 255 && value >= g_linearToSRGBThresholds[result])
+    {
+        result++;
+    }
+    return static_cast<uint8_t>(result);
+}
+}""" % (bucketCount, bucketCount - 1, bucketCount - 1))
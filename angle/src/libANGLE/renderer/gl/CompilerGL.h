@@ -9,35 +9,16 @@
 #ifndef LIBANGLE_RENDERER_GL_COMPILERGL_H_
 #define LIBANGLE_RENDERER_GL_COMPILERGL_H_
 
-#include "libANGLE/renderer/CompilerImpl.h"
-
-#include "GLSLANG/ShaderLang.h"
-
-namespace gl
-{
-struct Data;
-}
+#include "libANGLE/renderer/CompilerTranslator.h"
 
 namespace rx
 {
 
-class CompilerGL : public CompilerImpl
+class CompilerGL : public CompilerTranslator
 {
   public:
     CompilerGL(const gl::Data &data);
     ~CompilerGL() override;
-
-    gl::Error release() override;
-
-    ShHandle getCompilerHandle(GLenum type);
-
-  private:
-    ShShaderSpec mSpec;
-    ShShaderOutput mOutputType;
-    ShBuiltInResources mResources;
-
-    ShHandle mFragmentCompiler;
-    ShHandle mVertexCompiler;
 };
 
 }
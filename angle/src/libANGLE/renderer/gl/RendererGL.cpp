@@ -148,6 +148,11 @@ gl::Error RendererGL::drawElements(const gl::Data &data, GLenum mode, GLsizei co
     return gl::Error(GL_NO_ERROR);
 }
 
+void RendererGL::syncState(const gl::State &state, const gl::State::DirtyBits &dirtyBits)
+{
+    mStateManager->syncState(state, dirtyBits);
+}
+
 CompilerImpl *RendererGL::createCompiler(const gl::Data &data)
 {
     return new CompilerGL(data);
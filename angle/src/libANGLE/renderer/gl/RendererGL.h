@@ -31,6 +31,8 @@ class RendererGL : public Renderer
                            const GLvoid *indices, GLsizei instances,
                            const gl::RangeUI &indexRange) override;
 
+    void syncState(const gl::State &state, const gl::State::DirtyBits &dirtyBits) override;
+
     // Shader creation
     CompilerImpl *createCompiler(const gl::Data &data) override;
     ShaderImpl *createShader(GLenum type) override;
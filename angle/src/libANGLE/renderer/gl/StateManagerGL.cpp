@@ -396,68 +396,131 @@ gl::Error StateManagerGL::setGenericDrawState(const gl::Data &data)
     const FramebufferGL *framebufferGL = GetImplAs<FramebufferGL>(framebuffer);
     bindFramebuffer(GL_DRAW_FRAMEBUFFER, framebufferGL->getFramebufferID());
 
-    setScissorTestEnabled(state.isScissorTestEnabled());
-    if (state.isScissorTestEnabled())
-    {
-        setScissor(state.getScissor());
-    }
+    // Fixed function state is applied incrementally by syncState. The multisample
+    // flag has no setter in gl::State so it is not tracked by the dirty bits.
+    setMultisampleEnabled(state.getRasterizerState().multiSample);
 
-    setViewport(state.getViewport());
-    setDepthRange(state.getNearPlane(), state.getFarPlane());
+    return gl::Error(GL_NO_ERROR);
+}
 
-    const gl::BlendState &blendState = state.getBlendState();
-    setBlendEnabled(blendState.blend);
-    if (blendState.blend)
+void StateManagerGL::syncState(const gl::State &state, const gl::State::DirtyBits &dirtyBits)
+{
+    if (dirtyBits.none())
     {
-        setBlendColor(state.getBlendColor());
-        setBlendFuncs(blendState.sourceBlendRGB, blendState.destBlendRGB, blendState.sourceBlendAlpha, blendState.destBlendAlpha);
-        setBlendEquations(blendState.blendEquationRGB, blendState.blendEquationAlpha);
+        return;
     }
-    setColorMask(blendState.colorMaskRed, blendState.colorMaskGreen, blendState.colorMaskBlue, blendState.colorMaskAlpha);
-    setSampleAlphaToCoverageEnabled(blendState.sampleAlphaToCoverage);
-    setSampleCoverageEnabled(state.isSampleCoverageEnabled());
-    setSampleCoverage(state.getSampleCoverageValue(), state.getSampleCoverageInvert());
 
+    // Bindings are not synced here: the GL objects rebind them behind our back while
+    // uploading data, so setGenericDrawState re-checks them against the cache on each draw.
+    const gl::BlendState &blendState = state.getBlendState();
     const gl::DepthStencilState &depthStencilState = state.getDepthStencilState();
-    setDepthTestEnabled(depthStencilState.depthTest);
-    if (depthStencilState.depthTest)
-    {
-        setDepthFunc(depthStencilState.depthFunc);
-    }
-    setDepthMask(depthStencilState.depthMask);
-
-    setStencilTestEnabled(depthStencilState.stencilTest);
-    if (depthStencilState.stencilTest)
-    {
-        setStencilFrontFuncs(depthStencilState.stencilFunc, state.getStencilRef(), depthStencilState.stencilMask);
-        setStencilBackFuncs(depthStencilState.stencilBackFunc, state.getStencilBackRef(), depthStencilState.stencilBackMask);
-        setStencilFrontOps(depthStencilState.stencilFail, depthStencilState.stencilPassDepthFail, depthStencilState.stencilPassDepthPass);
-        setStencilBackOps(depthStencilState.stencilBackFail, depthStencilState.stencilBackPassDepthFail, depthStencilState.stencilBackPassDepthPass);
-    }
-    setStencilFrontWritemask(state.getDepthStencilState().stencilWritemask);
-    setStencilBackWritemask(state.getDepthStencilState().stencilBackWritemask);
-
     const gl::RasterizerState &rasterizerState = state.getRasterizerState();
-    setCullFaceEnabled(rasterizerState.cullFace);
-    if (rasterizerState.cullFace)
-    {
-        setCullFace(rasterizerState.cullMode);
-    }
-    setFrontFace(rasterizerState.frontFace);
 
-    setPolygonOffsetFillEnabled(rasterizerState.polygonOffsetFill);
-    if (rasterizerState.polygonOffsetFill)
-    {
-        setPolygonOffset(rasterizerState.polygonOffsetFactor, rasterizerState.polygonOffsetUnits);
+    for (size_t dirtyBit = 0; dirtyBit < dirtyBits.size(); dirtyBit++)
+    {
+        if (!dirtyBits.test(dirtyBit))
+        {
+            continue;
+        }
+
+        switch (dirtyBit)
+        {
+          case gl::State::DIRTY_BIT_SCISSOR_TEST_ENABLED:
+            setScissorTestEnabled(state.isScissorTestEnabled());
+            break;
+          case gl::State::DIRTY_BIT_SCISSOR:
+            setScissor(state.getScissor());
+            break;
+          case gl::State::DIRTY_BIT_VIEWPORT:
+            setViewport(state.getViewport());
+            break;
+          case gl::State::DIRTY_BIT_DEPTH_RANGE:
+            setDepthRange(state.getNearPlane(), state.getFarPlane());
+            break;
+          case gl::State::DIRTY_BIT_BLEND_ENABLED:
+            setBlendEnabled(blendState.blend);
+            break;
+          case gl::State::DIRTY_BIT_BLEND_COLOR:
+            setBlendColor(state.getBlendColor());
+            break;
+          case gl::State::DIRTY_BIT_BLEND_FUNCS:
+            setBlendFuncs(blendState.sourceBlendRGB, blendState.destBlendRGB, blendState.sourceBlendAlpha, blendState.destBlendAlpha);
+            break;
+          case gl::State::DIRTY_BIT_BLEND_EQUATIONS:
+            setBlendEquations(blendState.blendEquationRGB, blendState.blendEquationAlpha);
+            break;
+          case gl::State::DIRTY_BIT_COLOR_MASK:
+            setColorMask(blendState.colorMaskRed, blendState.colorMaskGreen, blendState.colorMaskBlue, blendState.colorMaskAlpha);
+            break;
+          case gl::State::DIRTY_BIT_SAMPLE_ALPHA_TO_COVERAGE_ENABLED:
+            setSampleAlphaToCoverageEnabled(blendState.sampleAlphaToCoverage);
+            break;
+          case gl::State::DIRTY_BIT_SAMPLE_COVERAGE_ENABLED:
+            setSampleCoverageEnabled(state.isSampleCoverageEnabled());
+            break;
+          case gl::State::DIRTY_BIT_SAMPLE_COVERAGE:
+            setSampleCoverage(state.getSampleCoverageValue(), state.getSampleCoverageInvert());
+            break;
+          case gl::State::DIRTY_BIT_DEPTH_TEST_ENABLED:
+            setDepthTestEnabled(depthStencilState.depthTest);
+            break;
+          case gl::State::DIRTY_BIT_DEPTH_FUNC:
+            setDepthFunc(depthStencilState.depthFunc);
+            break;
+          case gl::State::DIRTY_BIT_DEPTH_MASK:
+            setDepthMask(depthStencilState.depthMask);
+            break;
+          case gl::State::DIRTY_BIT_STENCIL_TEST_ENABLED:
+            setStencilTestEnabled(depthStencilState.stencilTest);
+            break;
+          case gl::State::DIRTY_BIT_STENCIL_FUNCS_FRONT:
+            setStencilFrontFuncs(depthStencilState.stencilFunc, state.getStencilRef(), depthStencilState.stencilMask);
+            break;
+          case gl::State::DIRTY_BIT_STENCIL_FUNCS_BACK:
+            setStencilBackFuncs(depthStencilState.stencilBackFunc, state.getStencilBackRef(), depthStencilState.stencilBackMask);
+            break;
+          case gl::State::DIRTY_BIT_STENCIL_OPS_FRONT:
+            setStencilFrontOps(depthStencilState.stencilFail, depthStencilState.stencilPassDepthFail, depthStencilState.stencilPassDepthPass);
+            break;
+          case gl::State::DIRTY_BIT_STENCIL_OPS_BACK:
+            setStencilBackOps(depthStencilState.stencilBackFail, depthStencilState.stencilBackPassDepthFail, depthStencilState.stencilBackPassDepthPass);
+            break;
+          case gl::State::DIRTY_BIT_STENCIL_WRITEMASK_FRONT:
+            setStencilFrontWritemask(depthStencilState.stencilWritemask);
+            break;
+          case gl::State::DIRTY_BIT_STENCIL_WRITEMASK_BACK:
+            setStencilBackWritemask(depthStencilState.stencilBackWritemask);
+            break;
+          case gl::State::DIRTY_BIT_CULL_FACE_ENABLED:
+            setCullFaceEnabled(rasterizerState.cullFace);
+            break;
+          case gl::State::DIRTY_BIT_CULL_FACE:
+            setCullFace(rasterizerState.cullMode);
+            break;
+          case gl::State::DIRTY_BIT_FRONT_FACE:
+            setFrontFace(rasterizerState.frontFace);
+            break;
+          case gl::State::DIRTY_BIT_POLYGON_OFFSET_FILL_ENABLED:
+            setPolygonOffsetFillEnabled(rasterizerState.polygonOffsetFill);
+            break;
+          case gl::State::DIRTY_BIT_POLYGON_OFFSET:
+            setPolygonOffset(rasterizerState.polygonOffsetFactor, rasterizerState.polygonOffsetUnits);
+            break;
+          case gl::State::DIRTY_BIT_RASTERIZER_DISCARD_ENABLED:
+            setRasterizerDiscardEnabled(rasterizerState.rasterizerDiscard);
+            break;
+          case gl::State::DIRTY_BIT_LINE_WIDTH:
+            setLineWidth(state.getLineWidth());
+            break;
+          case gl::State::DIRTY_BIT_PRIMITIVE_RESTART_ENABLED:
+            setPrimitiveRestartEnabled(state.isPrimitiveRestartEnabled());
+            break;
+          default:
+            // Clear values are applied by setClearState, pixel store state by the
+            // texture and framebuffer objects that use it.
+            break;
+        }
     }
-
-    setMultisampleEnabled(rasterizerState.multiSample);
-    setRasterizerDiscardEnabled(rasterizerState.rasterizerDiscard);
-    setLineWidth(state.getLineWidth());
-
-    setPrimitiveRestartEnabled(state.isPrimitiveRestartEnabled());
-
-    return gl::Error(GL_NO_ERROR);
 }
 
 void StateManagerGL::setAttributeCurrentData(size_t index, const gl::VertexAttribCurrentValueData &data)
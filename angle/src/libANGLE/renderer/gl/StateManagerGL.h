@@ -11,6 +11,7 @@
 
 #include "common/debug.h"
 #include "libANGLE/Error.h"
+#include "libANGLE/State.h"
 #include "libANGLE/angletypes.h"
 #include "libANGLE/renderer/gl/functionsgl_typedefs.h"
 
@@ -20,7 +21,6 @@ namespace gl
 {
 struct Caps;
 struct Data;
-class State;
 }
 
 namespace rx
@@ -51,6 +51,8 @@ class StateManagerGL : angle::NonCopyable
 
     void setClearState(const gl::State &state, GLbitfield mask);
 
+    void syncState(const gl::State &state, const gl::State::DirtyBits &dirtyBits);
+
     gl::Error setDrawArraysState(const gl::Data &data, GLint first, GLsizei count);
     gl::Error setDrawElementsState(const gl::Data &data, GLsizei count, GLenum type, const GLvoid *indices,
                                    const GLvoid **outIndices);
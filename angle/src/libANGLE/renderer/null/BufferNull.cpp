@@ -0,0 +1,88 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// BufferNull.cpp: Implements the class methods for BufferNull.
+
+#include "libANGLE/renderer/null/BufferNull.h"
+
+#include "common/debug.h"
+#include "common/utilities.h"
+#include "libANGLE/angletypes.h"
+
+#include <cstring>
+
+namespace rx
+{
+
+BufferNull::BufferNull()
+    : BufferImpl()
+{}
+
+BufferNull::~BufferNull()
+{}
+
+gl::Error BufferNull::setData(const void* data, size_t size, GLenum usage)
+{
+    mData.resize(size);
+    if (data != nullptr && size > 0)
+    {
+        memcpy(mData.data(), data, size);
+    }
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error BufferNull::setSubData(const void* data, size_t size, size_t offset)
+{
+    ASSERT(offset + size <= mData.size());
+    if (data != nullptr && size > 0)
+    {
+        memcpy(mData.data() + offset, data, size);
+    }
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error BufferNull::copySubData(BufferImpl* source, GLintptr sourceOffset, GLintptr destOffset, GLsizeiptr size)
+{
+    BufferNull *sourceNull = GetAs<BufferNull>(source);
+    ASSERT(static_cast<size_t>(sourceOffset + size) <= sourceNull->mData.size());
+    ASSERT(static_cast<size_t>(destOffset + size) <= mData.size());
+
+    // The ranges may overlap when copying within the same buffer
+    memmove(mData.data() + destOffset, sourceNull->mData.data() + sourceOffset, size);
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error BufferNull::map(GLenum access, GLvoid **mapPtr)
+{
+    *mapPtr = mData.data();
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error BufferNull::mapRange(size_t offset, size_t length, GLbitfield access, GLvoid **mapPtr)
+{
+    ASSERT(offset + length <= mData.size());
+    *mapPtr = mData.data() + offset;
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error BufferNull::unmap(GLboolean *result)
+{
+    *result = GL_TRUE;
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error BufferNull::getIndexRange(GLenum type, size_t offset, size_t count, gl::RangeUI *outRange)
+{
+    *outRange = gl::ComputeIndexRange(type, mData.data() + offset, count);
+    return gl::Error(GL_NO_ERROR);
+}
+
+uint8_t *BufferNull::getData()
+{
+    return mData.data();
+}
+
+}
@@ -0,0 +1,42 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// BufferNull.h: Defines the class interface for BufferNull.
+
+#ifndef LIBANGLE_RENDERER_NULL_BUFFERNULL_H_
+#define LIBANGLE_RENDERER_NULL_BUFFERNULL_H_
+
+#include "libANGLE/renderer/BufferImpl.h"
+
+#include <vector>
+
+namespace rx
+{
+
+class BufferNull : public BufferImpl
+{
+  public:
+    BufferNull();
+    ~BufferNull() override;
+
+    gl::Error setData(const void* data, size_t size, GLenum usage) override;
+    gl::Error setSubData(const void* data, size_t size, size_t offset) override;
+    gl::Error copySubData(BufferImpl* source, GLintptr sourceOffset, GLintptr destOffset, GLsizeiptr size) override;
+    gl::Error map(GLenum access, GLvoid **mapPtr) override;
+    gl::Error mapRange(size_t offset, size_t length, GLbitfield access, GLvoid **mapPtr) override;
+    gl::Error unmap(GLboolean *result) override;
+
+    gl::Error getIndexRange(GLenum type, size_t offset, size_t count, gl::RangeUI *outRange) override;
+
+    uint8_t *getData();
+
+  private:
+    std::vector<uint8_t> mData;
+};
+
+}
+
+#endif // LIBANGLE_RENDERER_NULL_BUFFERNULL_H_
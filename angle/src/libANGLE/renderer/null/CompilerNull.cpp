@@ -0,0 +1,23 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// CompilerNull.cpp: Implements the class methods for CompilerNull.
+
+#include "libANGLE/renderer/null/CompilerNull.h"
+
+namespace rx
+{
+
+CompilerNull::CompilerNull(const gl::Data &data)
+    : CompilerTranslator(data, SH_ESSL_OUTPUT)
+{
+}
+
+CompilerNull::~CompilerNull()
+{
+}
+
+}
@@ -0,0 +1,26 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// CompilerNull.h: Defines the class interface for CompilerNull.
+
+#ifndef LIBANGLE_RENDERER_NULL_COMPILERNULL_H_
+#define LIBANGLE_RENDERER_NULL_COMPILERNULL_H_
+
+#include "libANGLE/renderer/CompilerTranslator.h"
+
+namespace rx
+{
+
+class CompilerNull : public CompilerTranslator
+{
+  public:
+    CompilerNull(const gl::Data &data);
+    ~CompilerNull() override;
+};
+
+}
+
+#endif // LIBANGLE_RENDERER_NULL_COMPILERNULL_H_
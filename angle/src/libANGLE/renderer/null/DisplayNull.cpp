@@ -0,0 +1,172 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// DisplayNull.cpp: Implements the class methods for DisplayNull.
+
+#include "libANGLE/renderer/null/DisplayNull.h"
+
+#include "common/debug.h"
+#include "libANGLE/AttributeMap.h"
+#include "libANGLE/Context.h"
+#include "libANGLE/Surface.h"
+#include "libANGLE/renderer/null/RendererNull.h"
+#include "libANGLE/renderer/null/SurfaceNull.h"
+
+#include <EGL/eglext.h>
+
+namespace rx
+{
+
+// Window surfaces are never presented, so they don't look at the native window
+// and report a fixed size instead.
+static const EGLint DefaultWindowWidth = 1280;
+static const EGLint DefaultWindowHeight = 720;
+
+DisplayNull::DisplayNull()
+    : DisplayImpl(),
+      mRenderer(nullptr)
+{
+}
+
+DisplayNull::~DisplayNull()
+{
+}
+
+egl::Error DisplayNull::initialize(egl::Display *display)
+{
+    mRenderer = new RendererNull();
+    return egl::Error(EGL_SUCCESS);
+}
+
+void DisplayNull::terminate()
+{
+    SafeDelete(mRenderer);
+}
+
+SurfaceImpl *DisplayNull::createWindowSurface(const egl::Config *configuration,
+                                              EGLNativeWindowType window,
+                                              const egl::AttributeMap &attribs,
+                                              bool allowRenderToBackBuffer)
+{
+    return new SurfaceNull(DefaultWindowWidth, DefaultWindowHeight);
+}
+
+SurfaceImpl *DisplayNull::createPbufferSurface(const egl::Config *configuration,
+                                               const egl::AttributeMap &attribs)
+{
+    EGLint width = attribs.get(EGL_WIDTH, 0);
+    EGLint height = attribs.get(EGL_HEIGHT, 0);
+    return new SurfaceNull(width, height);
+}
+
+SurfaceImpl *DisplayNull::createPbufferFromClientBuffer(const egl::Config *configuration,
+                                                        EGLClientBuffer shareHandle,
+                                                        const egl::AttributeMap &attribs)
+{
+    UNIMPLEMENTED();
+    return nullptr;
+}
+
+SurfaceImpl *DisplayNull::createPixmapSurface(const egl::Config *configuration,
+                                              NativePixmapType nativePixmap,
+                                              const egl::AttributeMap &attribs)
+{
+    UNIMPLEMENTED();
+    return nullptr;
+}
+
+egl::Error DisplayNull::createContext(const egl::Config *config, const gl::Context *shareContext, const egl::AttributeMap &attribs,
+                                      gl::Context **outContext)
+{
+    ASSERT(mRenderer != nullptr);
+
+    EGLint clientVersion = attribs.get(EGL_CONTEXT_CLIENT_VERSION, 1);
+    bool notifyResets = (attribs.get(EGL_CONTEXT_OPENGL_RESET_NOTIFICATION_STRATEGY_EXT, EGL_NO_RESET_NOTIFICATION_EXT) == EGL_LOSE_CONTEXT_ON_RESET_EXT);
+    bool robustAccess = (attribs.get(EGL_CONTEXT_OPENGL_ROBUST_ACCESS_EXT, EGL_FALSE) == EGL_TRUE);
+
+    *outContext = new gl::Context(config, clientVersion, shareContext, mRenderer, notifyResets, robustAccess);
+    return egl::Error(EGL_SUCCESS);
+}
+
+egl::Error DisplayNull::makeCurrent(egl::Surface *drawSurface, egl::Surface *readSurface, gl::Context *context)
+{
+    return egl::Error(EGL_SUCCESS);
+}
+
+egl::ConfigSet DisplayNull::generateConfigs() const
+{
+    egl::ConfigSet configs;
+
+    egl::Config config;
+    config.renderTargetFormat = GL_RGBA8;
+    config.depthStencilFormat = GL_DEPTH24_STENCIL8;
+    config.bufferSize = 32;
+    config.redSize = 8;
+    config.greenSize = 8;
+    config.blueSize = 8;
+    config.alphaSize = 8;
+    config.depthSize = 24;
+    config.stencilSize = 8;
+    config.colorBufferType = EGL_RGB_BUFFER;
+    config.configCaveat = EGL_NONE;
+    config.conformant = EGL_OPENGL_ES2_BIT | EGL_OPENGL_ES3_BIT_KHR;
+    config.renderableType = EGL_OPENGL_ES2_BIT | EGL_OPENGL_ES3_BIT_KHR;
+    config.surfaceType = EGL_WINDOW_BIT | EGL_PBUFFER_BIT;
+    config.maxSwapInterval = 1;
+    config.minSwapInterval = 1;
+    config.maxPBufferWidth = 8192;
+    config.maxPBufferHeight = 8192;
+    config.maxPBufferPixels = 8192 * 8192;
+    config.transparentType = EGL_NONE;
+    config.matchNativePixmap = EGL_NONE;
+
+    configs.add(config);
+    return configs;
+}
+
+bool DisplayNull::isDeviceLost() const
+{
+    return false;
+}
+
+bool DisplayNull::testDeviceLost()
+{
+    return false;
+}
+
+egl::Error DisplayNull::restoreLostDevice()
+{
+    return egl::Error(EGL_SUCCESS);
+}
+
+bool DisplayNull::isValidNativeWindow(EGLNativeWindowType window) const
+{
+    return true;
+}
+
+std::string DisplayNull::getVendorString() const
+{
+    return "";
+}
+
+egl::Error DisplayNull::getDevice(DeviceImpl **device)
+{
+    return egl::Error(EGL_BAD_DISPLAY);
+}
+
+void DisplayNull::generateExtensions(egl::DisplayExtensions *outExtensions) const
+{
+    outExtensions->createContextRobustness = true;
+    outExtensions->postSubBuffer = true;
+    outExtensions->createContext = true;
+}
+
+void DisplayNull::generateCaps(egl::Caps *outCaps) const
+{
+    outCaps->textureNPOT = true;
+}
+
+}
@@ -0,0 +1,39 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// FenceNVNull.cpp: Implements the class methods for FenceNVNull.
+
+#include "libANGLE/renderer/null/FenceNVNull.h"
+
+#include "common/debug.h"
+
+namespace rx
+{
+
+FenceNVNull::FenceNVNull()
+    : FenceNVImpl()
+{}
+
+FenceNVNull::~FenceNVNull()
+{}
+
+gl::Error FenceNVNull::set(GLenum condition)
+{
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error FenceNVNull::test(GLboolean *outFinished)
+{
+    *outFinished = GL_TRUE;
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error FenceNVNull::finish()
+{
+    return gl::Error(GL_NO_ERROR);
+}
+
+}
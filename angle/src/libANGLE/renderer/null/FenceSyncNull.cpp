@@ -0,0 +1,45 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// FenceSyncNull.cpp: Implements the class methods for FenceSyncNull.
+
+#include "libANGLE/renderer/null/FenceSyncNull.h"
+
+#include "common/debug.h"
+
+namespace rx
+{
+
+FenceSyncNull::FenceSyncNull()
+    : FenceSyncImpl()
+{}
+
+FenceSyncNull::~FenceSyncNull()
+{}
+
+gl::Error FenceSyncNull::set(GLenum condition, GLbitfield flags)
+{
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error FenceSyncNull::clientWait(GLbitfield flags, GLuint64 timeout, GLenum *outResult)
+{
+    *outResult = GL_ALREADY_SIGNALED;
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error FenceSyncNull::serverWait(GLbitfield flags, GLuint64 timeout)
+{
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error FenceSyncNull::getStatus(GLint *outResult)
+{
+    *outResult = GL_SIGNALED;
+    return gl::Error(GL_NO_ERROR);
+}
+
+}
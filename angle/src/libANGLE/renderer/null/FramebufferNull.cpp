@@ -0,0 +1,142 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// FramebufferNull.cpp: Implements the class methods for FramebufferNull.
+
+#include "libANGLE/renderer/null/FramebufferNull.h"
+
+#include "common/debug.h"
+#include "libANGLE/Buffer.h"
+#include "libANGLE/State.h"
+#include "libANGLE/angletypes.h"
+#include "libANGLE/formatutils.h"
+#include "libANGLE/renderer/null/BufferNull.h"
+
+#include <cstring>
+
+namespace rx
+{
+
+FramebufferNull::FramebufferNull(const gl::Framebuffer::Data &data)
+    : FramebufferImpl(data)
+{}
+
+FramebufferNull::~FramebufferNull()
+{}
+
+void FramebufferNull::onUpdateColorAttachment(size_t index)
+{
+}
+
+void FramebufferNull::onUpdateDepthAttachment()
+{
+}
+
+void FramebufferNull::onUpdateStencilAttachment()
+{
+}
+
+void FramebufferNull::onUpdateDepthStencilAttachment()
+{
+}
+
+void FramebufferNull::setDrawBuffers(size_t count, const GLenum *buffers)
+{
+}
+
+void FramebufferNull::setReadBuffer(GLenum buffer)
+{
+}
+
+gl::Error FramebufferNull::discard(size_t count, const GLenum *attachments)
+{
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error FramebufferNull::invalidate(size_t count, const GLenum *attachments)
+{
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error FramebufferNull::invalidateSub(size_t count, const GLenum *attachments, const gl::Rectangle &area)
+{
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error FramebufferNull::clear(const gl::Data &data, GLbitfield mask)
+{
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error FramebufferNull::clearBufferfv(const gl::State &state, GLenum buffer, GLint drawbuffer, const GLfloat *values)
+{
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error FramebufferNull::clearBufferuiv(const gl::State &state, GLenum buffer, GLint drawbuffer, const GLuint *values)
+{
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error FramebufferNull::clearBufferiv(const gl::State &state, GLenum buffer, GLint drawbuffer, const GLint *values)
+{
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error FramebufferNull::clearBufferfi(const gl::State &state, GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil)
+{
+    return gl::Error(GL_NO_ERROR);
+}
+
+GLenum FramebufferNull::getImplementationColorReadFormat() const
+{
+    return GL_RGBA;
+}
+
+GLenum FramebufferNull::getImplementationColorReadType() const
+{
+    return GL_UNSIGNED_BYTE;
+}
+
+gl::Error FramebufferNull::readPixels(const gl::State &state, const gl::Rectangle &area, GLenum format, GLenum type, GLvoid *pixels) const
+{
+    const gl::PixelPackState &packState = state.getPackState();
+
+    uint8_t *dest = reinterpret_cast<uint8_t*>(pixels);
+    const gl::Buffer *packBuffer = packState.pixelBuffer.get();
+    if (packBuffer != nullptr)
+    {
+        BufferNull *bufferNull = GetAs<BufferNull>(packBuffer->getImplementation());
+        dest = bufferNull->getData() + reinterpret_cast<uintptr_t>(pixels);
+    }
+
+    // Nothing is ever rendered, so every read returns zeros
+    GLenum sizedInternalFormat = gl::GetSizedInternalFormat(format, type);
+    const gl::InternalFormat &sizedFormatInfo = gl::GetInternalFormatInfo(sizedInternalFormat);
+    GLuint outputPitch = sizedFormatInfo.computeRowPitch(type, area.width, packState.alignment, packState.rowLength);
+    GLuint pixelBytes = sizedFormatInfo.computeBlockSize(type, 1, 1);
+
+    dest += packState.skipRows * outputPitch + packState.skipPixels * pixelBytes;
+    for (GLint y = 0; y < area.height; y++)
+    {
+        memset(dest + y * outputPitch, 0, area.width * pixelBytes);
+    }
+
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error FramebufferNull::blit(const gl::State &state, const gl::Rectangle &sourceArea, const gl::Rectangle &destArea,
+                                GLbitfield mask, GLenum filter, const gl::Framebuffer *sourceFramebuffer)
+{
+    return gl::Error(GL_NO_ERROR);
+}
+
+GLenum FramebufferNull::checkStatus() const
+{
+    return GL_FRAMEBUFFER_COMPLETE;
+}
+
+}
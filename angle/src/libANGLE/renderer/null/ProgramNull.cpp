@@ -0,0 +1,604 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// ProgramNull.cpp: Implements the class methods for ProgramNull.
+
+#include "libANGLE/renderer/null/ProgramNull.h"
+
+#include "common/debug.h"
+#include "common/utilities.h"
+#include "compiler/translator/blocklayout.h"
+#include "libANGLE/renderer/null/ShaderNull.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+
+bool IsRowMajorLayout(const sh::InterfaceBlockField &var)
+{
+    return var.isRowMajorLayout;
+}
+
+bool IsRowMajorLayout(const sh::ShaderVariable &var)
+{
+    return false;
+}
+
+}
+
+namespace rx
+{
+
+// Default block uniforms are kept in gl::LinkedUniform::data, laid out the
+// same way as on D3D: every row of every element is padded to four
+// components, booleans are stored as GLint and matrices are stored transposed,
+// one row per four-component slot.
+
+ProgramNull::ProgramNull()
+    : ProgramImpl(),
+      mShaderVersion(100),
+      mTransformFeedbackBufferMode(GL_NONE)
+{
+}
+
+ProgramNull::~ProgramNull()
+{
+    reset();
+}
+
+bool ProgramNull::usesPointSize() const
+{
+    return false;
+}
+
+int ProgramNull::getShaderVersion() const
+{
+    return mShaderVersion;
+}
+
+GLenum ProgramNull::getTransformFeedbackBufferMode() const
+{
+    return mTransformFeedbackBufferMode;
+}
+
+GLenum ProgramNull::getBinaryFormat()
+{
+    UNIMPLEMENTED();
+    return GLenum();
+}
+
+LinkResult ProgramNull::load(gl::InfoLog &infoLog, gl::BinaryInputStream *stream)
+{
+    UNIMPLEMENTED();
+    return LinkResult(false, gl::Error(GL_INVALID_OPERATION));
+}
+
+gl::Error ProgramNull::save(gl::BinaryOutputStream *stream)
+{
+    UNIMPLEMENTED();
+    return gl::Error(GL_INVALID_OPERATION);
+}
+
+LinkResult ProgramNull::link(const gl::Data &data, gl::InfoLog &infoLog,
+                             gl::Shader *fragmentShader, gl::Shader *vertexShader,
+                             const std::vector<std::string> &transformFeedbackVaryings,
+                             GLenum transformFeedbackBufferMode,
+                             int *registers, std::vector<gl::LinkedVarying> *linkedVaryings,
+                             std::map<int, gl::VariableLocation> *outputVariables)
+{
+    ShaderNull *vertexShaderNull = GetImplAs<ShaderNull>(vertexShader);
+
+    mShaderVersion = vertexShaderNull->getShaderVersion();
+    mTransformFeedbackBufferMode = transformFeedbackBufferMode;
+    *registers = 0;
+
+    if (!gl::Program::linkVaryings(infoLog, fragmentShader, vertexShader))
+    {
+        return LinkResult(false, gl::Error(GL_NO_ERROR));
+    }
+
+    // Any vertex shader output can be captured with transform feedback. The
+    // semantic index count is only used to count the captured components.
+    const std::vector<gl::PackedVarying> &varyings = vertexShader->getVaryings();
+    for (size_t varyingIndex = 0; varyingIndex < varyings.size(); varyingIndex++)
+    {
+        const gl::PackedVarying &varying = varyings[varyingIndex];
+        if (!varying.isBuiltIn())
+        {
+            unsigned int registerCount = gl::VariableRowCount(varying.type) * varying.elementCount();
+            linkedVaryings->push_back(gl::LinkedVarying(varying.name, varying.type, varying.elementCount(),
+                                                        std::string(), 0, registerCount));
+        }
+    }
+
+    const std::vector<sh::Attribute> &shaderOutputVars = fragmentShader->getActiveOutputVariables();
+    for (unsigned int outputVariableIndex = 0; outputVariableIndex < shaderOutputVars.size(); outputVariableIndex++)
+    {
+        const sh::Attribute &outputVariable = shaderOutputVars[outputVariableIndex];
+        const int baseLocation = outputVariable.location == -1 ? 0 : outputVariable.location;
+
+        if (outputVariable.arraySize > 0)
+        {
+            for (unsigned int elementIndex = 0; elementIndex < outputVariable.arraySize; elementIndex++)
+            {
+                (*outputVariables)[baseLocation + elementIndex] =
+                    gl::VariableLocation(outputVariable.name, elementIndex, outputVariableIndex);
+            }
+        }
+        else
+        {
+            (*outputVariables)[baseLocation] =
+                gl::VariableLocation(outputVariable.name, GL_INVALID_INDEX, outputVariableIndex);
+        }
+    }
+
+    const std::vector<sh::Attribute> &shaderAttributes = vertexShader->getActiveAttributes();
+    for (size_t attributeIndex = 0; attributeIndex < shaderAttributes.size(); attributeIndex++)
+    {
+        setShaderAttribute(attributeIndex, shaderAttributes[attributeIndex]);
+    }
+
+    return LinkResult(true, gl::Error(GL_NO_ERROR));
+}
+
+void ProgramNull::bindAttributeLocation(GLuint index, const std::string &name)
+{
+}
+
+void ProgramNull::setUniform1fv(GLint location, GLsizei count, const GLfloat *v)
+{
+    setUniform(location, count, v, GL_FLOAT);
+}
+
+void ProgramNull::setUniform2fv(GLint location, GLsizei count, const GLfloat *v)
+{
+    setUniform(location, count, v, GL_FLOAT_VEC2);
+}
+
+void ProgramNull::setUniform3fv(GLint location, GLsizei count, const GLfloat *v)
+{
+    setUniform(location, count, v, GL_FLOAT_VEC3);
+}
+
+void ProgramNull::setUniform4fv(GLint location, GLsizei count, const GLfloat *v)
+{
+    setUniform(location, count, v, GL_FLOAT_VEC4);
+}
+
+void ProgramNull::setUniform1iv(GLint location, GLsizei count, const GLint *v)
+{
+    setUniform(location, count, v, GL_INT);
+}
+
+void ProgramNull::setUniform2iv(GLint location, GLsizei count, const GLint *v)
+{
+    setUniform(location, count, v, GL_INT_VEC2);
+}
+
+void ProgramNull::setUniform3iv(GLint location, GLsizei count, const GLint *v)
+{
+    setUniform(location, count, v, GL_INT_VEC3);
+}
+
+void ProgramNull::setUniform4iv(GLint location, GLsizei count, const GLint *v)
+{
+    setUniform(location, count, v, GL_INT_VEC4);
+}
+
+void ProgramNull::setUniform1uiv(GLint location, GLsizei count, const GLuint *v)
+{
+    setUniform(location, count, v, GL_UNSIGNED_INT);
+}
+
+void ProgramNull::setUniform2uiv(GLint location, GLsizei count, const GLuint *v)
+{
+    setUniform(location, count, v, GL_UNSIGNED_INT_VEC2);
+}
+
+void ProgramNull::setUniform3uiv(GLint location, GLsizei count, const GLuint *v)
+{
+    setUniform(location, count, v, GL_UNSIGNED_INT_VEC3);
+}
+
+void ProgramNull::setUniform4uiv(GLint location, GLsizei count, const GLuint *v)
+{
+    setUniform(location, count, v, GL_UNSIGNED_INT_VEC4);
+}
+
+void ProgramNull::setUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    setUniformMatrixfv<2, 2>(location, count, transpose, value);
+}
+
+void ProgramNull::setUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    setUniformMatrixfv<3, 3>(location, count, transpose, value);
+}
+
+void ProgramNull::setUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    setUniformMatrixfv<4, 4>(location, count, transpose, value);
+}
+
+void ProgramNull::setUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    setUniformMatrixfv<2, 3>(location, count, transpose, value);
+}
+
+void ProgramNull::setUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    setUniformMatrixfv<3, 2>(location, count, transpose, value);
+}
+
+void ProgramNull::setUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    setUniformMatrixfv<2, 4>(location, count, transpose, value);
+}
+
+void ProgramNull::setUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    setUniformMatrixfv<4, 2>(location, count, transpose, value);
+}
+
+void ProgramNull::setUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    setUniformMatrixfv<3, 4>(location, count, transpose, value);
+}
+
+void ProgramNull::setUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    setUniformMatrixfv<4, 3>(location, count, transpose, value);
+}
+
+void ProgramNull::getUniformfv(GLint location, GLfloat *params)
+{
+    getUniformv(location, params);
+}
+
+void ProgramNull::getUniformiv(GLint location, GLint *params)
+{
+    getUniformv(location, params);
+}
+
+void ProgramNull::getUniformuiv(GLint location, GLuint *params)
+{
+    getUniformv(location, params);
+}
+
+GLint ProgramNull::getSamplerMapping(gl::SamplerType type, unsigned int samplerIndex, const gl::Caps &caps) const
+{
+    return -1;
+}
+
+GLenum ProgramNull::getSamplerTextureType(gl::SamplerType type, unsigned int samplerIndex) const
+{
+    return GL_TEXTURE_2D;
+}
+
+GLint ProgramNull::getUsedSamplerRange(gl::SamplerType type) const
+{
+    return 0;
+}
+
+void ProgramNull::updateSamplerMapping()
+{
+}
+
+bool ProgramNull::validateSamplers(gl::InfoLog *infoLog, const gl::Caps &caps)
+{
+    return true;
+}
+
+LinkResult ProgramNull::compileProgramExecutables(gl::InfoLog &infoLog, gl::Shader *fragmentShader, gl::Shader *vertexShader,
+                                                  int registers)
+{
+    return LinkResult(true, gl::Error(GL_NO_ERROR));
+}
+
+bool ProgramNull::linkUniforms(gl::InfoLog &infoLog, const gl::Shader &vertexShader, const gl::Shader &fragmentShader,
+                               const gl::Caps &caps)
+{
+    const std::vector<sh::Uniform> &vertexUniforms = vertexShader.getUniforms();
+    const std::vector<sh::Uniform> &fragmentUniforms = fragmentShader.getUniforms();
+
+    // Check that uniforms defined in the vertex and fragment shaders are identical
+    typedef std::map<std::string, const sh::Uniform*> UniformMap;
+    UniformMap linkedUniforms;
+
+    for (unsigned int vertexUniformIndex = 0; vertexUniformIndex < vertexUniforms.size(); vertexUniformIndex++)
+    {
+        const sh::Uniform &vertexUniform = vertexUniforms[vertexUniformIndex];
+        linkedUniforms[vertexUniform.name] = &vertexUniform;
+    }
+
+    for (unsigned int fragmentUniformIndex = 0; fragmentUniformIndex < fragmentUniforms.size(); fragmentUniformIndex++)
+    {
+        const sh::Uniform &fragmentUniform = fragmentUniforms[fragmentUniformIndex];
+        UniformMap::const_iterator entry = linkedUniforms.find(fragmentUniform.name);
+        if (entry != linkedUniforms.end())
+        {
+            const sh::Uniform &vertexUniform = *entry->second;
+            const std::string &uniformName = "uniform '" + vertexUniform.name + "'";
+            if (!gl::Program::linkValidateUniforms(infoLog, uniformName, vertexUniform, fragmentUniform))
+            {
+                return false;
+            }
+        }
+    }
+
+    for (unsigned int uniformIndex = 0; uniformIndex < vertexUniforms.size(); uniformIndex++)
+    {
+        const sh::Uniform &uniform = vertexUniforms[uniformIndex];
+        if (uniform.staticUse)
+        {
+            defineUniform(uniform, uniform.name);
+        }
+    }
+
+    for (unsigned int uniformIndex = 0; uniformIndex < fragmentUniforms.size(); uniformIndex++)
+    {
+        const sh::Uniform &uniform = fragmentUniforms[uniformIndex];
+        if (uniform.staticUse)
+        {
+            defineUniform(uniform, uniform.name);
+        }
+    }
+
+    for (size_t uniformIndex = 0; uniformIndex < mUniforms.size(); uniformIndex++)
+    {
+        const gl::LinkedUniform &uniform = *mUniforms[uniformIndex];
+        if (uniform.isBuiltIn() || !uniform.isInDefaultBlock())
+        {
+            continue;
+        }
+
+        for (unsigned int arrayIndex = 0; arrayIndex < uniform.elementCount(); arrayIndex++)
+        {
+            mUniformIndex.push_back(gl::VariableLocation(uniform.name, arrayIndex, static_cast<unsigned int>(uniformIndex)));
+        }
+    }
+
+    return true;
+}
+
+bool ProgramNull::defineUniformBlock(gl::InfoLog &infoLog, const gl::Shader &shader, const sh::InterfaceBlock &interfaceBlock,
+                                     const gl::Caps &caps)
+{
+    // Create uniform block entries if they do not exist. There are no
+    // registers to assign, every block is laid out as std140.
+    if (getUniformBlockIndex(interfaceBlock.name) == GL_INVALID_INDEX)
+    {
+        std::vector<unsigned int> blockUniformIndexes;
+        const unsigned int blockIndex = static_cast<unsigned int>(mUniformBlocks.size());
+
+        sh::Std140BlockEncoder encoder;
+        defineUniformBlockMembers(interfaceBlock.fields, "", blockIndex, &encoder, &blockUniformIndexes,
+                                  interfaceBlock.isRowMajorLayout);
+
+        unsigned int dataSize = static_cast<unsigned int>(encoder.getBlockSize());
+
+        if (interfaceBlock.arraySize > 0)
+        {
+            for (unsigned int uniformBlockElement = 0; uniformBlockElement < interfaceBlock.arraySize; uniformBlockElement++)
+            {
+                gl::UniformBlock *newUniformBlock = new gl::UniformBlock(interfaceBlock.name, uniformBlockElement, dataSize);
+                newUniformBlock->memberUniformIndexes = blockUniformIndexes;
+                mUniformBlocks.push_back(newUniformBlock);
+            }
+        }
+        else
+        {
+            gl::UniformBlock *newUniformBlock = new gl::UniformBlock(interfaceBlock.name, GL_INVALID_INDEX, dataSize);
+            newUniformBlock->memberUniformIndexes = blockUniformIndexes;
+            mUniformBlocks.push_back(newUniformBlock);
+        }
+    }
+
+    return true;
+}
+
+gl::Error ProgramNull::applyUniforms()
+{
+    for (size_t uniformIndex = 0; uniformIndex < mUniforms.size(); uniformIndex++)
+    {
+        mUniforms[uniformIndex]->dirty = false;
+    }
+
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error ProgramNull::applyUniformBuffers(const gl::Data &data, GLuint uniformBlockBindings[])
+{
+    return gl::Error(GL_NO_ERROR);
+}
+
+bool ProgramNull::assignUniformBlockRegister(gl::InfoLog &infoLog, gl::UniformBlock *uniformBlock, GLenum shader,
+                                             unsigned int registerIndex, const gl::Caps &caps)
+{
+    return true;
+}
+
+void ProgramNull::reset()
+{
+    ProgramImpl::reset();
+
+    mShaderVersion = 100;
+    mTransformFeedbackBufferMode = GL_NONE;
+}
+
+void ProgramNull::defineUniform(const sh::ShaderVariable &uniform, const std::string &fullName)
+{
+    if (uniform.isStruct())
+    {
+        for (unsigned int elementIndex = 0; elementIndex < uniform.elementCount(); elementIndex++)
+        {
+            const std::string &elementString = (uniform.isArray() ? ArrayString(elementIndex) : "");
+
+            for (size_t fieldIndex = 0; fieldIndex < uniform.fields.size(); fieldIndex++)
+            {
+                const sh::ShaderVariable &field = uniform.fields[fieldIndex];
+                const std::string &fieldFullName = (fullName + elementString + "." + field.name);
+
+                defineUniform(field, fieldFullName);
+            }
+        }
+    }
+    else if (getUniformByName(fullName) == nullptr)
+    {
+        // Uniforms used by both shaders are only defined once
+        mUniforms.push_back(new gl::LinkedUniform(uniform.type, uniform.precision, fullName, uniform.arraySize,
+                                                  -1, sh::BlockMemberInfo::getDefaultBlockInfo()));
+    }
+}
+
+template <typename VarT>
+void ProgramNull::defineUniformBlockMembers(const std::vector<VarT> &fields, const std::string &prefix, int blockIndex,
+                                            sh::BlockLayoutEncoder *encoder, std::vector<unsigned int> *blockUniformIndexes,
+                                            bool inRowMajorLayout)
+{
+    for (unsigned int uniformIndex = 0; uniformIndex < fields.size(); uniformIndex++)
+    {
+        const VarT &field = fields[uniformIndex];
+        const std::string &fieldName = (prefix.empty() ? field.name : prefix + "." + field.name);
+
+        if (field.isStruct())
+        {
+            bool rowMajorLayout = (inRowMajorLayout || IsRowMajorLayout(field));
+
+            for (unsigned int arrayElement = 0; arrayElement < field.elementCount(); arrayElement++)
+            {
+                encoder->enterAggregateType();
+
+                const std::string uniformElementName = fieldName + (field.isArray() ? ArrayString(arrayElement) : "");
+                defineUniformBlockMembers(field.fields, uniformElementName, blockIndex, encoder, blockUniformIndexes, rowMajorLayout);
+
+                encoder->exitAggregateType();
+            }
+        }
+        else
+        {
+            bool isRowMajorMatrix = (gl::IsMatrixType(field.type) && inRowMajorLayout);
+
+            sh::BlockMemberInfo memberInfo = encoder->encodeType(field.type, field.arraySize, isRowMajorMatrix);
+
+            gl::LinkedUniform *newUniform = new gl::LinkedUniform(field.type, field.precision, fieldName, field.arraySize,
+                                                                  blockIndex, memberInfo);
+
+            // add to uniform list, but not index, since uniform block uniforms have no location
+            blockUniformIndexes->push_back(static_cast<unsigned int>(mUniforms.size()));
+            mUniforms.push_back(newUniform);
+        }
+    }
+}
+
+template <typename T>
+void ProgramNull::setUniform(GLint location, GLsizei count, const T *v, GLenum targetUniformType)
+{
+    const int components = gl::VariableComponentCount(targetUniformType);
+    const GLenum targetBoolType = gl::VariableBoolVectorType(targetUniformType);
+
+    gl::LinkedUniform *targetUniform = getUniformByLocation(location);
+    const unsigned int element = mUniformIndex[location].element;
+
+    count = std::min(static_cast<GLsizei>(targetUniform->elementCount() - element), count);
+
+    // Samplers are set with glUniform1i and stored like an int
+    ASSERT(targetUniform->type == targetUniformType || targetUniform->type == targetBoolType ||
+           (gl::IsSamplerType(targetUniform->type) && targetUniformType == GL_INT));
+    const bool isBool = (targetUniform->type == targetBoolType && targetUniform->type != targetUniformType);
+
+    GLint *target = reinterpret_cast<GLint*>(targetUniform->data) + element * 4;
+    for (GLsizei i = 0; i < count; i++)
+    {
+        GLint *dest = target + (i * 4);
+        const T *source = v + (i * components);
+
+        for (int c = 0; c < components; c++)
+        {
+            if (isBool)
+            {
+                dest[c] = (source[c] == static_cast<T>(0)) ? GL_FALSE : GL_TRUE;
+            }
+            else
+            {
+                memcpy(dest + c, source + c, sizeof(T));
+            }
+        }
+    }
+
+    targetUniform->dirty = true;
+}
+
+template <int cols, int rows>
+void ProgramNull::setUniformMatrixfv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    gl::LinkedUniform *targetUniform = getUniformByLocation(location);
+    const unsigned int element = mUniformIndex[location].element;
+
+    count = std::min(static_cast<GLsizei>(targetUniform->elementCount() - element), count);
+
+    GLfloat *target = reinterpret_cast<GLfloat*>(targetUniform->data) + element * 4 * rows;
+    for (GLsizei i = 0; i < count; i++)
+    {
+        for (int row = 0; row < rows; row++)
+        {
+            for (int col = 0; col < cols; col++)
+            {
+                // The source is column-major unless transpose is set
+                target[row * 4 + col] = (transpose == GL_FALSE) ? value[col * rows + row] : value[row * cols + col];
+            }
+        }
+
+        target += 4 * rows;
+        value += cols * rows;
+    }
+
+    targetUniform->dirty = true;
+}
+
+template <typename T>
+void ProgramNull::getUniformv(GLint location, T *params)
+{
+    const gl::LinkedUniform *targetUniform = getUniformByLocation(location);
+    const unsigned int element = mUniformIndex[location].element;
+
+    const int rows = gl::VariableRowCount(targetUniform->type);
+    const int cols = gl::VariableColumnCount(targetUniform->type);
+    const GLenum componentType = gl::VariableComponentType(targetUniform->type);
+
+    const uint8_t *source = targetUniform->data + element * gl::VariableInternalSize(targetUniform->type);
+    for (int row = 0; row < rows; row++)
+    {
+        for (int col = 0; col < cols; col++)
+        {
+            // Matrices are returned column-major
+            T *dest = gl::IsMatrixType(targetUniform->type) ? &params[col * rows + row] : &params[col];
+            const uint8_t *component = source + (row * 4 + col) * 4;
+
+            switch (componentType)
+            {
+              case GL_FLOAT:
+                *dest = static_cast<T>(*reinterpret_cast<const GLfloat*>(component));
+                break;
+              case GL_INT:
+                *dest = static_cast<T>(*reinterpret_cast<const GLint*>(component));
+                break;
+              case GL_UNSIGNED_INT:
+                *dest = static_cast<T>(*reinterpret_cast<const GLuint*>(component));
+                break;
+              case GL_BOOL:
+                *dest = (*reinterpret_cast<const GLint*>(component) == GL_FALSE) ? static_cast<T>(0) : static_cast<T>(1);
+                break;
+              default:
+                UNREACHABLE();
+            }
+        }
+    }
+}
+
+}
@@ -0,0 +1,46 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// QueryNull.cpp: Implements the class methods for QueryNull.
+
+#include "libANGLE/renderer/null/QueryNull.h"
+
+#include "common/debug.h"
+
+namespace rx
+{
+
+QueryNull::QueryNull(GLenum type)
+    : QueryImpl(type)
+{}
+
+QueryNull::~QueryNull()
+{}
+
+gl::Error QueryNull::begin()
+{
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error QueryNull::end()
+{
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error QueryNull::getResult(GLuint *params)
+{
+    // Nothing is ever drawn, so no samples pass and no primitives are written
+    *params = 0;
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error QueryNull::isResultAvailable(GLuint *available)
+{
+    *available = GL_TRUE;
+    return gl::Error(GL_NO_ERROR);
+}
+
+}
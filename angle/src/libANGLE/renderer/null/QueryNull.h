@@ -0,0 +1,31 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// QueryNull.h: Defines the class interface for QueryNull.
+
+#ifndef LIBANGLE_RENDERER_NULL_QUERYNULL_H_
+#define LIBANGLE_RENDERER_NULL_QUERYNULL_H_
+
+#include "libANGLE/renderer/QueryImpl.h"
+
+namespace rx
+{
+
+class QueryNull : public QueryImpl
+{
+  public:
+    QueryNull(GLenum type);
+    ~QueryNull() override;
+
+    gl::Error begin() override;
+    gl::Error end() override;
+    gl::Error getResult(GLuint *params) override;
+    gl::Error isResultAvailable(GLuint *available) override;
+};
+
+}
+
+#endif // LIBANGLE_RENDERER_NULL_QUERYNULL_H_
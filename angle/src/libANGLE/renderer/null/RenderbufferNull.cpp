@@ -0,0 +1,45 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// RenderbufferNull.cpp: Implements the class methods for RenderbufferNull.
+
+#include "libANGLE/renderer/null/RenderbufferNull.h"
+
+#include "common/debug.h"
+#include "libANGLE/formatutils.h"
+
+#include <algorithm>
+
+namespace rx
+{
+
+RenderbufferNull::RenderbufferNull()
+    : RenderbufferImpl()
+{}
+
+RenderbufferNull::~RenderbufferNull()
+{}
+
+gl::Error RenderbufferNull::setStorage(GLenum internalformat, size_t width, size_t height)
+{
+    return setStorageMultisample(0, internalformat, width, height);
+}
+
+gl::Error RenderbufferNull::setStorageMultisample(size_t samples, GLenum internalformat, size_t width, size_t height)
+{
+    const gl::InternalFormat &formatInfo = gl::GetInternalFormatInfo(internalformat);
+    mData.assign(formatInfo.pixelBytes * width * height * std::max<size_t>(samples, 1), 0);
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error RenderbufferNull::getAttachmentRenderTarget(const gl::FramebufferAttachment::Target &target,
+                                                      FramebufferAttachmentRenderTarget **rtOut)
+{
+    *rtOut = nullptr;
+    return gl::Error(GL_INVALID_OPERATION, "The null renderer has no render targets");
+}
+
+}
@@ -0,0 +1,37 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// RenderbufferNull.h: Defines the class interface for RenderbufferNull.
+
+#ifndef LIBANGLE_RENDERER_NULL_RENDERBUFFERNULL_H_
+#define LIBANGLE_RENDERER_NULL_RENDERBUFFERNULL_H_
+
+#include "libANGLE/renderer/RenderbufferImpl.h"
+
+#include <vector>
+
+namespace rx
+{
+
+class RenderbufferNull : public RenderbufferImpl
+{
+  public:
+    RenderbufferNull();
+    ~RenderbufferNull() override;
+
+    gl::Error setStorage(GLenum internalformat, size_t width, size_t height) override;
+    gl::Error setStorageMultisample(size_t samples, GLenum internalformat, size_t width, size_t height) override;
+
+    gl::Error getAttachmentRenderTarget(const gl::FramebufferAttachment::Target &target,
+                                        FramebufferAttachmentRenderTarget **rtOut) override;
+
+  private:
+    std::vector<uint8_t> mData;
+};
+
+}
+
+#endif // LIBANGLE_RENDERER_NULL_RENDERBUFFERNULL_H_
@@ -0,0 +1,312 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// RendererNull.cpp: Implements the class methods for RendererNull.
+
+#include "libANGLE/renderer/null/RendererNull.h"
+
+#include "common/debug.h"
+#include "libANGLE/formatutils.h"
+#include "libANGLE/renderer/null/BufferNull.h"
+#include "libANGLE/renderer/null/CompilerNull.h"
+#include "libANGLE/renderer/null/FenceNVNull.h"
+#include "libANGLE/renderer/null/FenceSyncNull.h"
+#include "libANGLE/renderer/null/FramebufferNull.h"
+#include "libANGLE/renderer/null/ProgramNull.h"
+#include "libANGLE/renderer/null/QueryNull.h"
+#include "libANGLE/renderer/null/RenderbufferNull.h"
+#include "libANGLE/renderer/null/ShaderNull.h"
+#include "libANGLE/renderer/null/TextureNull.h"
+#include "libANGLE/renderer/null/TransformFeedbackNull.h"
+#include "libANGLE/renderer/null/VertexArrayNull.h"
+
+#include <limits>
+
+namespace rx
+{
+
+RendererNull::RendererNull()
+    : Renderer()
+{
+}
+
+RendererNull::~RendererNull()
+{
+}
+
+gl::Error RendererNull::flush()
+{
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error RendererNull::finish()
+{
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error RendererNull::drawArrays(const gl::Data &data, GLenum mode,
+                                   GLint first, GLsizei count, GLsizei instances)
+{
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error RendererNull::drawElements(const gl::Data &data, GLenum mode, GLsizei count, GLenum type,
+                                     const GLvoid *indices, GLsizei instances,
+                                     const gl::RangeUI &indexRange)
+{
+    return gl::Error(GL_NO_ERROR);
+}
+
+void RendererNull::syncState(const gl::State &state, const gl::State::DirtyBits &dirtyBits)
+{
+}
+
+void RendererNull::notifyDeviceLost()
+{
+}
+
+bool RendererNull::isDeviceLost() const
+{
+    return false;
+}
+
+bool RendererNull::testDeviceLost()
+{
+    return false;
+}
+
+bool RendererNull::testDeviceResettable()
+{
+    return false;
+}
+
+VendorID RendererNull::getVendorId() const
+{
+    return VendorID();
+}
+
+std::string RendererNull::getVendorString() const
+{
+    return "ANGLE";
+}
+
+std::string RendererNull::getRendererDescription() const
+{
+    return "Null";
+}
+
+CompilerImpl *RendererNull::createCompiler(const gl::Data &data)
+{
+    return new CompilerNull(data);
+}
+
+ShaderImpl *RendererNull::createShader(GLenum type)
+{
+    return new ShaderNull(type);
+}
+
+ProgramImpl *RendererNull::createProgram()
+{
+    return new ProgramNull();
+}
+
+FramebufferImpl *RendererNull::createDefaultFramebuffer(const gl::Framebuffer::Data &data)
+{
+    return new FramebufferNull(data);
+}
+
+FramebufferImpl *RendererNull::createFramebuffer(const gl::Framebuffer::Data &data)
+{
+    return new FramebufferNull(data);
+}
+
+TextureImpl *RendererNull::createTexture(GLenum target)
+{
+    return new TextureNull(target);
+}
+
+RenderbufferImpl *RendererNull::createRenderbuffer()
+{
+    return new RenderbufferNull();
+}
+
+BufferImpl *RendererNull::createBuffer()
+{
+    return new BufferNull();
+}
+
+VertexArrayImpl *RendererNull::createVertexArray()
+{
+    return new VertexArrayNull();
+}
+
+QueryImpl *RendererNull::createQuery(GLenum type)
+{
+    return new QueryNull(type);
+}
+
+FenceNVImpl *RendererNull::createFenceNV()
+{
+    return new FenceNVNull();
+}
+
+FenceSyncImpl *RendererNull::createFenceSync()
+{
+    return new FenceSyncNull();
+}
+
+TransformFeedbackImpl *RendererNull::createTransformFeedback()
+{
+    return new TransformFeedbackNull();
+}
+
+void RendererNull::generateCaps(gl::Caps *outCaps, gl::TextureCapsMap* outTextureCaps, gl::Extensions *outExtensions) const
+{
+    // Nothing is executed, so advertise generous ES3 limits in the range of a
+    // desktop GPU to keep the front-end on its common paths.
+    outCaps->maxElementIndex = static_cast<GLint64>(std::numeric_limits<unsigned int>::max());
+    outCaps->max3DTextureSize = 2048;
+    outCaps->max2DTextureSize = 16384;
+    outCaps->maxArrayTextureLayers = 2048;
+    outCaps->maxLODBias = 15.0f;
+    outCaps->maxCubeMapTextureSize = 16384;
+    outCaps->maxRenderbufferSize = 16384;
+    outCaps->maxDrawBuffers = 8;
+    outCaps->maxColorAttachments = 8;
+    outCaps->maxViewportWidth = 16384;
+    outCaps->maxViewportHeight = 16384;
+    outCaps->minAliasedPointSize = 1.0f;
+    outCaps->maxAliasedPointSize = 1024.0f;
+    outCaps->minAliasedLineWidth = 1.0f;
+    outCaps->maxAliasedLineWidth = 1.0f;
+
+    outCaps->maxElementsIndices = std::numeric_limits<GLint>::max();
+    outCaps->maxElementsVertices = std::numeric_limits<GLint>::max();
+
+    outCaps->vertexHighpFloat.setIEEEFloat();
+    outCaps->vertexMediumpFloat.setIEEEFloat();
+    outCaps->vertexLowpFloat.setIEEEFloat();
+    outCaps->fragmentHighpFloat.setIEEEFloat();
+    outCaps->fragmentMediumpFloat.setIEEEFloat();
+    outCaps->fragmentLowpFloat.setIEEEFloat();
+    outCaps->vertexHighpInt.setTwosComplementInt(32);
+    outCaps->vertexMediumpInt.setTwosComplementInt(32);
+    outCaps->vertexLowpInt.setTwosComplementInt(32);
+    outCaps->fragmentHighpInt.setTwosComplementInt(32);
+    outCaps->fragmentMediumpInt.setTwosComplementInt(32);
+    outCaps->fragmentLowpInt.setTwosComplementInt(32);
+
+    outCaps->maxServerWaitTimeout = 0;
+
+    outCaps->maxVertexAttributes = 16;
+    outCaps->maxVertexUniformVectors = 1024;
+    outCaps->maxVertexUniformComponents = outCaps->maxVertexUniformVectors * 4;
+    outCaps->maxVertexUniformBlocks = 12;
+    outCaps->maxVertexOutputComponents = 64;
+    outCaps->maxVertexTextureImageUnits = 16;
+
+    outCaps->maxFragmentUniformVectors = 1024;
+    outCaps->maxFragmentUniformComponents = outCaps->maxFragmentUniformVectors * 4;
+    outCaps->maxFragmentUniformBlocks = 12;
+    outCaps->maxFragmentInputComponents = 60;
+    outCaps->maxTextureImageUnits = 16;
+    outCaps->minProgramTexelOffset = -8;
+    outCaps->maxProgramTexelOffset = 7;
+
+    outCaps->maxUniformBufferBindings = 24;
+    outCaps->maxUniformBlockSize = 65536;
+    outCaps->uniformBufferOffsetAlignment = 256;
+    outCaps->maxCombinedUniformBlocks = outCaps->maxVertexUniformBlocks + outCaps->maxFragmentUniformBlocks;
+    outCaps->maxCombinedVertexUniformComponents = (static_cast<GLint64>(outCaps->maxVertexUniformBlocks) * static_cast<GLint64>(outCaps->maxUniformBlockSize / 4)) +
+                                                  static_cast<GLint64>(outCaps->maxVertexUniformComponents);
+    outCaps->maxCombinedFragmentUniformComponents = (static_cast<GLint64>(outCaps->maxFragmentUniformBlocks) * static_cast<GLint64>(outCaps->maxUniformBlockSize / 4)) +
+                                                    static_cast<GLint64>(outCaps->maxFragmentUniformComponents);
+    outCaps->maxVaryingVectors = 15;
+    outCaps->maxVaryingComponents = outCaps->maxVaryingVectors * 4;
+    outCaps->maxCombinedTextureImageUnits = outCaps->maxVertexTextureImageUnits + outCaps->maxTextureImageUnits;
+
+    outCaps->maxTransformFeedbackInterleavedComponents = 64;
+    outCaps->maxTransformFeedbackSeparateAttributes = 4;
+    outCaps->maxTransformFeedbackSeparateComponents = 4;
+
+    outCaps->maxSamples = 4;
+
+    // Extensions that don't depend on texture formats
+    outExtensions->elementIndexUint = true;
+    outExtensions->packedDepthStencil = true;
+    outExtensions->rgb8rgba8 = true;
+    outExtensions->readFormatBGRA = true;
+    outExtensions->pixelBufferObject = true;
+    outExtensions->mapBuffer = true;
+    outExtensions->mapBufferRange = true;
+    outExtensions->textureStorage = true;
+    outExtensions->textureNPOT = true;
+    outExtensions->drawBuffers = true;
+    outExtensions->textureFilterAnisotropic = true;
+    outExtensions->maxTextureAnisotropy = 16.0f;
+    outExtensions->occlusionQueryBoolean = true;
+    outExtensions->fence = true;
+    outExtensions->robustness = true;
+    outExtensions->blendMinMax = true;
+    outExtensions->framebufferBlit = true;
+    outExtensions->framebufferMultisample = true;
+    outExtensions->instancedArrays = true;
+    outExtensions->standardDerivatives = true;
+    outExtensions->shaderTextureLOD = true;
+    outExtensions->fragDepth = true;
+    outExtensions->textureUsage = true;
+    outExtensions->translatedShaderSource = true;
+    outExtensions->fboRenderMipmap = true;
+    outExtensions->discardFramebuffer = true;
+
+    // Every format the front-end knows about is supported, as far as the
+    // format tables allow it in ES3 with all of the format extensions.
+    gl::Extensions allFormatExtensions = *outExtensions;
+    allFormatExtensions.textureFormatBGRA8888 = true;
+    allFormatExtensions.textureHalfFloat = true;
+    allFormatExtensions.textureHalfFloatLinear = true;
+    allFormatExtensions.textureFloat = true;
+    allFormatExtensions.textureFloatLinear = true;
+    allFormatExtensions.textureRG = true;
+    allFormatExtensions.textureCompressionDXT1 = true;
+    allFormatExtensions.textureCompressionDXT3 = true;
+    allFormatExtensions.textureCompressionDXT5 = true;
+    allFormatExtensions.sRGB = true;
+    allFormatExtensions.depthTextures = true;
+    allFormatExtensions.colorBufferFloat = true;
+
+    const gl::FormatSet &allFormats = gl::GetAllSizedInternalFormats();
+    for (gl::FormatSet::const_iterator i = allFormats.begin(); i != allFormats.end(); i++)
+    {
+        const gl::InternalFormat &formatInfo = gl::GetInternalFormatInfo(*i);
+
+        gl::TextureCaps textureCaps;
+        textureCaps.texturable = formatInfo.textureSupport(3, allFormatExtensions);
+        textureCaps.renderable = formatInfo.renderSupport(3, allFormatExtensions);
+        textureCaps.filterable = formatInfo.filterSupport(3, allFormatExtensions);
+        if (textureCaps.renderable)
+        {
+            textureCaps.sampleCounts.insert(1);
+            textureCaps.sampleCounts.insert(2);
+            textureCaps.sampleCounts.insert(4);
+        }
+        outTextureCaps->insert(*i, textureCaps);
+
+        if (textureCaps.texturable && formatInfo.compressed)
+        {
+            outCaps->compressedTextureFormats.push_back(*i);
+        }
+    }
+
+    outExtensions->setTextureExtensionSupport(*outTextureCaps);
+}
+
+Workarounds RendererNull::generateWorkarounds() const
+{
+    return Workarounds();
+}
+
+}
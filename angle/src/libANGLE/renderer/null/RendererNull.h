@@ -0,0 +1,82 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// RendererNull.h: Defines the class interface for RendererNull.
+
+#ifndef LIBANGLE_RENDERER_NULL_RENDERERNULL_H_
+#define LIBANGLE_RENDERER_NULL_RENDERERNULL_H_
+
+#include "libANGLE/renderer/Renderer.h"
+
+namespace rx
+{
+
+class RendererNull : public Renderer
+{
+  public:
+    RendererNull();
+    ~RendererNull() override;
+
+    gl::Error flush() override;
+    gl::Error finish() override;
+
+    gl::Error drawArrays(const gl::Data &data, GLenum mode,
+                         GLint first, GLsizei count, GLsizei instances) override;
+    gl::Error drawElements(const gl::Data &data, GLenum mode, GLsizei count, GLenum type,
+                           const GLvoid *indices, GLsizei instances,
+                           const gl::RangeUI &indexRange) override;
+
+    void syncState(const gl::State &state, const gl::State::DirtyBits &dirtyBits) override;
+
+    // lost device
+    void notifyDeviceLost() override;
+    bool isDeviceLost() const override;
+    bool testDeviceLost() override;
+    bool testDeviceResettable() override;
+
+    VendorID getVendorId() const override;
+    std::string getVendorString() const override;
+    std::string getRendererDescription() const override;
+
+    // Renderer capabilities
+
+    // Shader creation
+    CompilerImpl *createCompiler(const gl::Data &data) override;
+    ShaderImpl *createShader(GLenum type) override;
+    ProgramImpl *createProgram() override;
+
+    // Framebuffer creation
+    FramebufferImpl *createDefaultFramebuffer(const gl::Framebuffer::Data &data) override;
+    FramebufferImpl *createFramebuffer(const gl::Framebuffer::Data &data) override;
+
+    // Texture creation
+    TextureImpl *createTexture(GLenum target) override;
+
+    // Renderbuffer creation
+    RenderbufferImpl *createRenderbuffer() override;
+
+    // Buffer creation
+    BufferImpl *createBuffer() override;
+
+    // Vertex Array creation
+    VertexArrayImpl *createVertexArray() override;
+
+    // Query and Fence creation
+    QueryImpl *createQuery(GLenum type) override;
+    FenceNVImpl *createFenceNV() override;
+    FenceSyncImpl *createFenceSync() override;
+
+    // Transform Feedback creation
+    TransformFeedbackImpl *createTransformFeedback() override;
+
+  private:
+    void generateCaps(gl::Caps *outCaps, gl::TextureCapsMap* outTextureCaps, gl::Extensions *outExtensions) const override;
+    Workarounds generateWorkarounds() const override;
+};
+
+}
+
+#endif // LIBANGLE_RENDERER_NULL_RENDERERNULL_H_
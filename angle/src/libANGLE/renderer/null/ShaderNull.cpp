@@ -0,0 +1,111 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// ShaderNull.cpp: Implements the class methods for ShaderNull.
+
+#include "libANGLE/renderer/null/ShaderNull.h"
+
+#include "common/debug.h"
+#include "libANGLE/Compiler.h"
+#include "libANGLE/renderer/null/CompilerNull.h"
+
+template <typename VarT>
+static std::vector<VarT> GetFilteredShaderVariables(const std::vector<VarT> *variableList)
+{
+    ASSERT(variableList);
+    std::vector<VarT> result;
+    for (size_t varIndex = 0; varIndex < variableList->size(); varIndex++)
+    {
+        const VarT &var = variableList->at(varIndex);
+        if (var.staticUse)
+        {
+            result.push_back(var);
+        }
+    }
+    return result;
+}
+
+template <typename VarT>
+static const std::vector<VarT> &GetShaderVariables(const std::vector<VarT> *variableList)
+{
+    ASSERT(variableList);
+    return *variableList;
+}
+
+namespace rx
+{
+
+ShaderNull::ShaderNull(GLenum type)
+    : ShaderImpl(),
+      mType(type),
+      mShaderVersion(100)
+{
+}
+
+ShaderNull::~ShaderNull()
+{
+}
+
+bool ShaderNull::compile(gl::Compiler *compiler, const std::string &source)
+{
+    // Reset the previous state
+    mActiveAttributes.clear();
+    mVaryings.clear();
+    mUniforms.clear();
+    mInterfaceBlocks.clear();
+    mActiveOutputVariables.clear();
+
+    // Run the translator so that validation and reflection cost the same as on
+    // the other backends; the translated source is kept but never used.
+    CompilerNull *compilerNull = GetImplAs<CompilerNull>(compiler);
+    ShHandle compilerHandle = compilerNull->getCompilerHandle(mType);
+
+    int compileOptions = (SH_OBJECT_CODE | SH_VARIABLES);
+    const char* sourceCString = source.c_str();
+    if (!ShCompile(compilerHandle, &sourceCString, 1, compileOptions))
+    {
+        mInfoLog = ShGetInfoLog(compilerHandle);
+        TRACE("\n%s", mInfoLog.c_str());
+        return false;
+    }
+
+    mTranslatedSource = ShGetObjectCode(compilerHandle);
+    mShaderVersion = ShGetShaderVersion(compilerHandle);
+
+    // Gather the shader information
+    if (mType == GL_VERTEX_SHADER)
+    {
+        mActiveAttributes = GetFilteredShaderVariables(ShGetAttributes(compilerHandle));
+    }
+
+    const std::vector<sh::Varying> &varyings = GetShaderVariables(ShGetVaryings(compilerHandle));
+    for (size_t varyingIndex = 0; varyingIndex < varyings.size(); varyingIndex++)
+    {
+        mVaryings.push_back(gl::PackedVarying(varyings[varyingIndex]));
+    }
+
+    mUniforms = GetShaderVariables(ShGetUniforms(compilerHandle));
+    mInterfaceBlocks = GetShaderVariables(ShGetInterfaceBlocks(compilerHandle));
+
+    if (mType == GL_FRAGMENT_SHADER)
+    {
+        mActiveOutputVariables = GetFilteredShaderVariables(ShGetOutputVariables(compilerHandle));
+    }
+
+    return true;
+}
+
+std::string ShaderNull::getDebugInfo() const
+{
+    return std::string();
+}
+
+int ShaderNull::getShaderVersion() const
+{
+    return mShaderVersion;
+}
+
+}
@@ -0,0 +1,35 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// ShaderNull.h: Defines the class interface for ShaderNull.
+
+#ifndef LIBANGLE_RENDERER_NULL_SHADERNULL_H_
+#define LIBANGLE_RENDERER_NULL_SHADERNULL_H_
+
+#include "libANGLE/renderer/ShaderImpl.h"
+
+namespace rx
+{
+
+class ShaderNull : public ShaderImpl
+{
+  public:
+    ShaderNull(GLenum type);
+    ~ShaderNull() override;
+
+    bool compile(gl::Compiler *compiler, const std::string &source) override;
+    std::string getDebugInfo() const override;
+
+    int getShaderVersion() const;
+
+  private:
+    GLenum mType;
+    int mShaderVersion;
+};
+
+}
+
+#endif // LIBANGLE_RENDERER_NULL_SHADERNULL_H_
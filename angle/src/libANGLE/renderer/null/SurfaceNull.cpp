@@ -0,0 +1,85 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// SurfaceNull.cpp: Implements the class methods for SurfaceNull.
+
+#include "libANGLE/renderer/null/SurfaceNull.h"
+
+#include "common/debug.h"
+
+namespace rx
+{
+
+SurfaceNull::SurfaceNull(EGLint width, EGLint height)
+    : SurfaceImpl(),
+      mWidth(width),
+      mHeight(height)
+{
+}
+
+SurfaceNull::~SurfaceNull()
+{
+}
+
+egl::Error SurfaceNull::initialize()
+{
+    return egl::Error(EGL_SUCCESS);
+}
+
+egl::Error SurfaceNull::swap()
+{
+    return egl::Error(EGL_SUCCESS);
+}
+
+egl::Error SurfaceNull::postSubBuffer(EGLint x, EGLint y, EGLint width, EGLint height)
+{
+    return egl::Error(EGL_SUCCESS);
+}
+
+egl::Error SurfaceNull::querySurfacePointerANGLE(EGLint attribute, void **value)
+{
+    // There is no share handle or D3D texture behind the surface
+    *value = nullptr;
+    return egl::Error(EGL_BAD_ACCESS);
+}
+
+egl::Error SurfaceNull::bindTexImage(EGLint buffer)
+{
+    return egl::Error(EGL_SUCCESS);
+}
+
+egl::Error SurfaceNull::releaseTexImage(EGLint buffer)
+{
+    return egl::Error(EGL_SUCCESS);
+}
+
+void SurfaceNull::setSwapInterval(EGLint interval)
+{
+}
+
+EGLint SurfaceNull::getWidth() const
+{
+    return mWidth;
+}
+
+EGLint SurfaceNull::getHeight() const
+{
+    return mHeight;
+}
+
+EGLint SurfaceNull::isPostSubBufferSupported() const
+{
+    return EGL_TRUE;
+}
+
+gl::Error SurfaceNull::getAttachmentRenderTarget(const gl::FramebufferAttachment::Target &target,
+                                                 FramebufferAttachmentRenderTarget **rtOut)
+{
+    *rtOut = nullptr;
+    return gl::Error(GL_INVALID_OPERATION, "The null renderer has no render targets");
+}
+
+}
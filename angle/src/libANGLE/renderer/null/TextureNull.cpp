@@ -0,0 +1,280 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// TextureNull.cpp: Implements the class methods for TextureNull.
+
+#include "libANGLE/renderer/null/TextureNull.h"
+
+#include "common/debug.h"
+#include "common/mathutil.h"
+#include "common/utilities.h"
+#include "libANGLE/Buffer.h"
+#include "libANGLE/angletypes.h"
+#include "libANGLE/formatutils.h"
+#include "libANGLE/renderer/null/BufferNull.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace rx
+{
+
+// Returns the client memory described by the unpack state, which is an offset
+// into the unpack buffer when one is bound.
+static const uint8_t *GetUnpackPointer(const gl::PixelUnpackState &unpack, const uint8_t *pixels)
+{
+    const gl::Buffer *unpackBuffer = unpack.pixelBuffer.get();
+    if (unpackBuffer != nullptr)
+    {
+        BufferNull *bufferNull = GetAs<BufferNull>(unpackBuffer->getImplementation());
+        return bufferNull->getData() + reinterpret_cast<uintptr_t>(pixels);
+    }
+    return pixels;
+}
+
+static void CopyImageRows(const uint8_t *source, size_t sourceRowPitch, size_t sourceDepthPitch,
+                          uint8_t *dest, size_t destRowPitch, size_t destDepthPitch,
+                          size_t rowBytes, size_t rows, size_t depth)
+{
+    for (size_t z = 0; z < depth; z++)
+    {
+        for (size_t y = 0; y < rows; y++)
+        {
+            memcpy(dest + z * destDepthPitch + y * destRowPitch,
+                   source + z * sourceDepthPitch + y * sourceRowPitch, rowBytes);
+        }
+    }
+}
+
+TextureNull::Image::Image()
+    : size(),
+      format(GL_NONE),
+      type(GL_NONE),
+      data()
+{
+}
+
+TextureNull::TextureNull(GLenum type)
+    : TextureImpl(),
+      mTextureType(type)
+{
+}
+
+TextureNull::~TextureNull()
+{
+}
+
+void TextureNull::setUsage(GLenum usage)
+{
+}
+
+gl::Error TextureNull::setImage(GLenum target, size_t level, GLenum internalFormat, const gl::Extents &size, GLenum format, GLenum type,
+                                const gl::PixelUnpackState &unpack, const uint8_t *pixels)
+{
+    redefineImage(target, level, internalFormat, size, type);
+
+    const uint8_t *source = GetUnpackPointer(unpack, pixels);
+    if (source == nullptr)
+    {
+        return gl::Error(GL_NO_ERROR);
+    }
+
+    gl::Box area(0, 0, 0, size.width, size.height, size.depth);
+    return setSubImage(target, level, area, format, type, unpack, pixels);
+}
+
+gl::Error TextureNull::setSubImage(GLenum target, size_t level, const gl::Box &area, GLenum format, GLenum type,
+                                   const gl::PixelUnpackState &unpack, const uint8_t *pixels)
+{
+    Image *image = getImage(target, level);
+    const uint8_t *source = GetUnpackPointer(unpack, pixels);
+    if (image == nullptr || source == nullptr)
+    {
+        return gl::Error(GL_NO_ERROR);
+    }
+
+    const gl::InternalFormat &formatInfo = gl::GetInternalFormatInfo(image->format);
+    const size_t pixelBytes = formatInfo.computeBlockSize(image->type, 1, 1);
+
+    const size_t sourceRowPitch = formatInfo.computeRowPitch(image->type, area.width, unpack.alignment, unpack.rowLength);
+    const size_t sourceImageHeight = (unpack.imageHeight > 0) ? unpack.imageHeight : area.height;
+    const size_t sourceDepthPitch = sourceRowPitch * sourceImageHeight;
+    source += unpack.skipImages * sourceDepthPitch + unpack.skipRows * sourceRowPitch + unpack.skipPixels * pixelBytes;
+
+    const size_t destRowPitch = formatInfo.computeBlockSize(image->type, image->size.width, 1);
+    const size_t destDepthPitch = formatInfo.computeBlockSize(image->type, image->size.width, image->size.height);
+    uint8_t *dest = image->data.data() + area.z * destDepthPitch + area.y * destRowPitch + area.x * pixelBytes;
+
+    CopyImageRows(source, sourceRowPitch, sourceDepthPitch, dest, destRowPitch, destDepthPitch,
+                  area.width * pixelBytes, area.height, area.depth);
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error TextureNull::setCompressedImage(GLenum target, size_t level, GLenum internalFormat, const gl::Extents &size,
+                                          const gl::PixelUnpackState &unpack, const uint8_t *pixels)
+{
+    redefineImage(target, level, internalFormat, size, GL_UNSIGNED_BYTE);
+
+    const uint8_t *source = GetUnpackPointer(unpack, pixels);
+    if (source == nullptr)
+    {
+        return gl::Error(GL_NO_ERROR);
+    }
+
+    // Compressed data is always tightly packed
+    Image *image = getImage(target, level);
+    memcpy(image->data.data(), source, image->data.size());
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error TextureNull::setCompressedSubImage(GLenum target, size_t level, const gl::Box &area, GLenum format,
+                                             const gl::PixelUnpackState &unpack, const uint8_t *pixels)
+{
+    Image *image = getImage(target, level);
+    const uint8_t *source = GetUnpackPointer(unpack, pixels);
+    if (image == nullptr || source == nullptr)
+    {
+        return gl::Error(GL_NO_ERROR);
+    }
+
+    const gl::InternalFormat &formatInfo = gl::GetInternalFormatInfo(image->format);
+    ASSERT(area.x % formatInfo.compressedBlockWidth == 0 && area.y % formatInfo.compressedBlockHeight == 0);
+
+    const size_t blockRows = (area.height + formatInfo.compressedBlockHeight - 1) / formatInfo.compressedBlockHeight;
+    const size_t sourceRowPitch = formatInfo.computeRowPitch(image->type, area.width, 1, 0);
+    const size_t sourceDepthPitch = sourceRowPitch * blockRows;
+
+    const size_t destRowPitch = formatInfo.computeRowPitch(image->type, image->size.width, 1, 0);
+    const size_t destDepthPitch = formatInfo.computeBlockSize(image->type, image->size.width, image->size.height);
+    const size_t blockOffset = formatInfo.computeBlockSize(image->type, area.x, 1);
+    uint8_t *dest = image->data.data() + area.z * destDepthPitch +
+                    (area.y / formatInfo.compressedBlockHeight) * destRowPitch + blockOffset;
+
+    CopyImageRows(source, sourceRowPitch, sourceDepthPitch, dest, destRowPitch, destDepthPitch,
+                  sourceRowPitch, blockRows, area.depth);
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error TextureNull::copyImage(GLenum target, size_t level, const gl::Rectangle &sourceArea, GLenum internalFormat,
+                                 const gl::Framebuffer *source)
+{
+    // Nothing is ever rendered, so the copied contents are left as zeros
+    GLenum sizedInternalFormat = gl::GetSizedInternalFormat(internalFormat, GL_UNSIGNED_BYTE);
+    const gl::InternalFormat &formatInfo = gl::GetInternalFormatInfo(sizedInternalFormat);
+    redefineImage(target, level, sizedInternalFormat, gl::Extents(sourceArea.width, sourceArea.height, 1), formatInfo.type);
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error TextureNull::copySubImage(GLenum target, size_t level, const gl::Offset &destOffset, const gl::Rectangle &sourceArea,
+                                    const gl::Framebuffer *source)
+{
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error TextureNull::setStorage(GLenum target, size_t levels, GLenum internalFormat, const gl::Extents &size)
+{
+    const gl::InternalFormat &formatInfo = gl::GetInternalFormatInfo(internalFormat);
+
+    for (size_t level = 0; level < levels; level++)
+    {
+        gl::Extents levelSize(std::max(size.width >> level, 1),
+                              std::max(size.height >> level, 1),
+                              (target == GL_TEXTURE_3D) ? std::max(size.depth >> level, 1) : size.depth);
+
+        if (target == GL_TEXTURE_CUBE_MAP)
+        {
+            for (GLenum face = gl::FirstCubeMapTextureTarget; face <= gl::LastCubeMapTextureTarget; face++)
+            {
+                redefineImage(face, level, internalFormat, levelSize, formatInfo.type);
+            }
+        }
+        else
+        {
+            redefineImage(target, level, internalFormat, levelSize, formatInfo.type);
+        }
+    }
+
+    return gl::Error(GL_NO_ERROR);
+}
+
+gl::Error TextureNull::generateMipmaps(const gl::SamplerState &samplerState)
+{
+    // Allocate the mip chain below the base level; its contents are not computed
+    std::vector<GLenum> targets;
+    if (mTextureType == GL_TEXTURE_CUBE_MAP)
+    {
+        for (GLenum face = gl::FirstCubeMapTextureTarget; face <= gl::LastCubeMapTextureTarget; face++)
+        {
+            targets.push_back(face);
+        }
+    }
+    else
+    {
+        targets.push_back(mTextureType);
+    }
+
+    const size_t baseLevel = samplerState.baseLevel;
+    for (size_t targetIndex = 0; targetIndex < targets.size(); targetIndex++)
+    {
+        GLenum target = targets[targetIndex];
+        const Image *baseImage = getImage(target, baseLevel);
+        if (baseImage == nullptr)
+        {
+            continue;
+        }
+
+        const gl::Extents baseSize = baseImage->size;
+        const GLenum baseFormat = baseImage->format;
+        const GLenum baseType = baseImage->type;
+
+        const GLint maxDimension = std::max(baseSize.width, std::max(baseSize.height,
+                                            (mTextureType == GL_TEXTURE_3D) ? baseSize.depth : 1));
+        const size_t levelCount = gl::log2(maxDimension) + 1;
+        for (size_t level = 1; level < levelCount && baseLevel + level <= static_cast<size_t>(samplerState.maxLevel); level++)
+        {
+            gl::Extents levelSize(std::max(baseSize.width >> level, 1),
+                                  std::max(baseSize.height >> level, 1),
+                                  (mTextureType == GL_TEXTURE_3D) ? std::max(baseSize.depth >> level, 1) : baseSize.depth);
+            redefineImage(target, baseLevel + level, baseFormat, levelSize, baseType);
+        }
+    }
+
+    return gl::Error(GL_NO_ERROR);
+}
+
+void TextureNull::bindTexImage(egl::Surface *surface)
+{
+}
+
+void TextureNull::releaseTexImage()
+{
+}
+
+gl::Error TextureNull::getAttachmentRenderTarget(const gl::FramebufferAttachment::Target &target,
+                                                 FramebufferAttachmentRenderTarget **rtOut)
+{
+    *rtOut = nullptr;
+    return gl::Error(GL_INVALID_OPERATION, "The null renderer has no render targets");
+}
+
+TextureNull::Image *TextureNull::getImage(GLenum target, size_t level)
+{
+    auto iter = mImages.find(ImageKey(target, level));
+    return (iter != mImages.end()) ? &iter->second : nullptr;
+}
+
+void TextureNull::redefineImage(GLenum target, size_t level, GLenum internalFormat, const gl::Extents &size, GLenum type)
+{
+    Image &image = mImages[ImageKey(target, level)];
+    image.size = size;
+    image.format = gl::GetSizedInternalFormat(internalFormat, type);
+    image.type = type;
+
+    const gl::InternalFormat &formatInfo = gl::GetInternalFormatInfo(image.format);
+    image.data.assign(formatInfo.computeBlockSize(type, size.width, size.height) * size.depth, 0);
+}
+
+}
@@ -0,0 +1,78 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// TextureNull.h: Defines the class interface for TextureNull.
+
+#ifndef LIBANGLE_RENDERER_NULL_TEXTURENULL_H_
+#define LIBANGLE_RENDERER_NULL_TEXTURENULL_H_
+
+#include "libANGLE/angletypes.h"
+#include "libANGLE/renderer/TextureImpl.h"
+
+#include <map>
+#include <vector>
+
+namespace rx
+{
+
+class TextureNull : public TextureImpl
+{
+  public:
+    TextureNull(GLenum type);
+    ~TextureNull() override;
+
+    void setUsage(GLenum usage) override;
+
+    gl::Error setImage(GLenum target, size_t level, GLenum internalFormat, const gl::Extents &size, GLenum format, GLenum type,
+                       const gl::PixelUnpackState &unpack, const uint8_t *pixels) override;
+    gl::Error setSubImage(GLenum target, size_t level, const gl::Box &area, GLenum format, GLenum type,
+                          const gl::PixelUnpackState &unpack, const uint8_t *pixels) override;
+
+    gl::Error setCompressedImage(GLenum target, size_t level, GLenum internalFormat, const gl::Extents &size,
+                                 const gl::PixelUnpackState &unpack, const uint8_t *pixels) override;
+    gl::Error setCompressedSubImage(GLenum target, size_t level, const gl::Box &area, GLenum format,
+                                    const gl::PixelUnpackState &unpack, const uint8_t *pixels) override;
+
+    gl::Error copyImage(GLenum target, size_t level, const gl::Rectangle &sourceArea, GLenum internalFormat,
+                        const gl::Framebuffer *source) override;
+    gl::Error copySubImage(GLenum target, size_t level, const gl::Offset &destOffset, const gl::Rectangle &sourceArea,
+                           const gl::Framebuffer *source) override;
+
+    gl::Error setStorage(GLenum target, size_t levels, GLenum internalFormat, const gl::Extents &size) override;
+
+    gl::Error generateMipmaps(const gl::SamplerState &samplerState) override;
+
+    void bindTexImage(egl::Surface *surface) override;
+    void releaseTexImage() override;
+
+    gl::Error getAttachmentRenderTarget(const gl::FramebufferAttachment::Target &target,
+                                        FramebufferAttachmentRenderTarget **rtOut) override;
+
+  private:
+    // Images are stored tightly packed in the format and type they were
+    // specified with.
+    struct Image
+    {
+        Image();
+
+        gl::Extents size;
+        GLenum format;
+        GLenum type;
+        std::vector<uint8_t> data;
+    };
+
+    typedef std::pair<GLenum, size_t> ImageKey;
+
+    Image *getImage(GLenum target, size_t level);
+    void redefineImage(GLenum target, size_t level, GLenum internalFormat, const gl::Extents &size, GLenum type);
+
+    GLenum mTextureType;
+    std::map<ImageKey, Image> mImages;
+};
+
+}
+
+#endif // LIBANGLE_RENDERER_NULL_TEXTURENULL_H_
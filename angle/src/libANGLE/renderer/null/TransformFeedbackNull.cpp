@@ -0,0 +1,47 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// TransformFeedbackNull.cpp: Implements the class methods for TransformFeedbackNull.
+
+#include "libANGLE/renderer/null/TransformFeedbackNull.h"
+
+#include "common/debug.h"
+
+namespace rx
+{
+
+TransformFeedbackNull::TransformFeedbackNull()
+    : TransformFeedbackImpl()
+{}
+
+TransformFeedbackNull::~TransformFeedbackNull()
+{}
+
+void TransformFeedbackNull::begin(GLenum primitiveMode)
+{
+}
+
+void TransformFeedbackNull::end()
+{
+}
+
+void TransformFeedbackNull::pause()
+{
+}
+
+void TransformFeedbackNull::resume()
+{
+}
+
+void TransformFeedbackNull::bindGenericBuffer(const BindingPointer<gl::Buffer> &binding)
+{
+}
+
+void TransformFeedbackNull::bindIndexedBuffer(size_t index, const OffsetBindingPointer<gl::Buffer> &binding)
+{
+}
+
+}
@@ -0,0 +1,39 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// VertexArrayNull.cpp: Implements the class methods for VertexArrayNull.
+
+#include "libANGLE/renderer/null/VertexArrayNull.h"
+
+#include "common/debug.h"
+
+namespace rx
+{
+
+VertexArrayNull::VertexArrayNull()
+    : VertexArrayImpl()
+{}
+
+VertexArrayNull::~VertexArrayNull()
+{}
+
+void VertexArrayNull::setElementArrayBuffer(const gl::Buffer *buffer)
+{
+}
+
+void VertexArrayNull::setAttribute(size_t idx, const gl::VertexAttribute &attr)
+{
+}
+
+void VertexArrayNull::setAttributeDivisor(size_t idx, GLuint divisor)
+{
+}
+
+void VertexArrayNull::enableAttribute(size_t idx, bool enabledState)
+{
+}
+
+}
@@ -0,0 +1,31 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// VertexArrayNull.h: Defines the class interface for VertexArrayNull.
+
+#ifndef LIBANGLE_RENDERER_NULL_VERTEXARRAYNULL_H_
+#define LIBANGLE_RENDERER_NULL_VERTEXARRAYNULL_H_
+
+#include "libANGLE/renderer/VertexArrayImpl.h"
+
+namespace rx
+{
+
+class VertexArrayNull : public VertexArrayImpl
+{
+  public:
+    VertexArrayNull();
+    ~VertexArrayNull() override;
+
+    void setElementArrayBuffer(const gl::Buffer *buffer) override;
+    void setAttribute(size_t idx, const gl::VertexAttribute &attr) override;
+    void setAttributeDivisor(size_t idx, GLuint divisor) override;
+    void enableAttribute(size_t idx, bool enabledState) override;
+};
+
+}
+
+#endif // LIBANGLE_RENDERER_NULL_VERTEXARRAYNULL_H_
@@ -23,6 +23,9 @@
 #include "common/mathutil.h"
 #include "common/utilities.h"
 
+#include <algorithm>
+#include <limits>
+
 namespace gl
 {
 
@@ -1337,29 +1340,11 @@ bool ValidateCopyTexImageParametersBase(gl::Context *context, GLenum target, GLi
     return true;
 }
 
-static bool ValidateDrawBase(Context *context, GLenum mode, GLsizei count, GLsizei maxVertex, GLsizei primcount)
+// Runs the draw checks that only depend on bound state, and finds the largest vertex and
+// instance counts that the bound vertex buffers can serve. The result stays valid until
+// State drops it, so repeated draws with unchanged state skip these checks.
+static bool ValidateDrawState(Context *context, GLint64 *maxVertexOut, GLint64 *maxPrimcountOut)
 {
-    switch (mode)
-    {
-      case GL_POINTS:
-      case GL_LINES:
-      case GL_LINE_LOOP:
-      case GL_LINE_STRIP:
-      case GL_TRIANGLES:
-      case GL_TRIANGLE_STRIP:
-      case GL_TRIANGLE_FAN:
-        break;
-      default:
-        context->recordError(Error(GL_INVALID_ENUM));
-        return false;
-    }
-
-    if (count < 0)
-    {
-        context->recordError(Error(GL_INVALID_VALUE));
-        return false;
-    }
-
     const State &state = context->getState();
 
     // Check for mapped buffers
@@ -1403,6 +1388,9 @@ static bool ValidateDrawBase(Context *context, GLenum mode, GLsizei count, GLsiz
     }
 
     // Buffer validations
+    GLint64 maxVertex = std::numeric_limits<GLint64>::max();
+    GLint64 maxPrimcount = std::numeric_limits<GLint64>::max();
+
     const VertexArray *vao = state.getVertexArray();
     const auto &vertexAttribs = vao->getVertexAttributes();
     const int *semanticIndexes = program->getSemanticIndexes();
@@ -1417,27 +1405,24 @@ static bool ValidateDrawBase(Context *context, GLenum mode, GLsizei count, GLsiz
 
             if (buffer)
             {
+                // [OpenGL ES 3.0.2] section 2.9.4 page 40:
+                // We can return INVALID_OPERATION if our vertex attribute does not have
+                // enough backing data. Record how many elements this buffer holds.
                 GLint64 attribStride = static_cast<GLint64>(ComputeVertexAttributeStride(attrib));
-                GLint64 maxVertexElement = 0;
+                GLint64 maxElement = buffer->getSize() / attribStride;
 
                 if (attrib.divisor > 0)
                 {
-                    maxVertexElement = static_cast<GLint64>(primcount) / static_cast<GLint64>(attrib.divisor);
+                    // An instanced attribute reads element primcount / divisor
+                    if (maxElement < std::numeric_limits<GLsizei>::max())
+                    {
+                        GLint64 divisor = static_cast<GLint64>(attrib.divisor);
+                        maxPrimcount = std::min(maxPrimcount, (maxElement + 1) * divisor - 1);
+                    }
                 }
                 else
                 {
-                    maxVertexElement = static_cast<GLint64>(maxVertex);
-                }
-
-                GLint64 attribDataSize = maxVertexElement * attribStride;
-
-                // [OpenGL ES 3.0.2] section 2.9.4 page 40:
-                // We can return INVALID_OPERATION if our vertex attribute does not have
-                // enough backing data.
-                if (attribDataSize > buffer->getSize())
-                {
-                    context->recordError(Error(GL_INVALID_OPERATION));
-                    return false;
+                    maxVertex = std::min(maxVertex, maxElement);
                 }
             }
             else if (attrib.pointer == NULL)
@@ -1480,6 +1465,65 @@ static bool ValidateDrawBase(Context *context, GLenum mode, GLsizei count, GLsiz
         }
     }
 
+    *maxVertexOut = maxVertex;
+    *maxPrimcountOut = maxPrimcount;
+    return true;
+}
+
+static bool ValidateDrawBase(Context *context, GLenum mode, GLsizei count, GLsizei maxVertex, GLsizei primcount)
+{
+    switch (mode)
+    {
+      case GL_POINTS:
+      case GL_LINES:
+      case GL_LINE_LOOP:
+      case GL_LINE_STRIP:
+      case GL_TRIANGLES:
+      case GL_TRIANGLE_STRIP:
+      case GL_TRIANGLE_FAN:
+        break;
+      default:
+        context->recordError(Error(GL_INVALID_ENUM));
+        return false;
+    }
+
+    if (count < 0)
+    {
+        context->recordError(Error(GL_INVALID_VALUE));
+        return false;
+    }
+
+    State &state = context->getState();
+
+    if (state.isDrawStateValidated())
+    {
+        // Completeness is not part of the cached result, but the framebuffer caches it
+        // itself until one of its attachments changes, so this check stays cheap.
+        const gl::Framebuffer *fbo = state.getDrawFramebuffer();
+        if (!fbo || fbo->checkStatus(context->getData()) != GL_FRAMEBUFFER_COMPLETE)
+        {
+            context->recordError(Error(GL_INVALID_FRAMEBUFFER_OPERATION));
+            return false;
+        }
+    }
+    else
+    {
+        GLint64 maxValidVertex = 0;
+        GLint64 maxValidPrimcount = 0;
+        if (!ValidateDrawState(context, &maxValidVertex, &maxValidPrimcount))
+        {
+            return false;
+        }
+        state.setDrawStateValidated(maxValidVertex, maxValidPrimcount);
+    }
+
+    if (static_cast<GLint64>(maxVertex) > state.getMaxValidatedVertex() ||
+        static_cast<GLint64>(primcount) > state.getMaxValidatedPrimcount())
+    {
+        context->recordError(Error(GL_INVALID_OPERATION));
+        return false;
+    }
+
     // No-op if zero count
     return (count > 0);
 }
@@ -390,7 +390,7 @@ bool ValidateES3TexImageParameters(Context *context, GLenum target, GLint level,
             return false;
         }
 
-        if (!actualFormatInfo.compressed)
+        if (!actualFormatInfo.compressed || !context->getTextureCaps().get(actualInternalFormat).texturable)
         {
             context->recordError(Error(GL_INVALID_ENUM));
             return false;
@@ -937,7 +937,8 @@ bool ValidateES3TexStorageParameters(Context *context, GLenum target, GLsizei le
     }
 
     const gl::InternalFormat &formatInfo = gl::GetInternalFormatInfo(internalformat);
-    if (!formatInfo.textureSupport(context->getClientVersion(), context->getExtensions()))
+    if (!formatInfo.textureSupport(context->getClientVersion(), context->getExtensions()) ||
+        (formatInfo.compressed && !context->getTextureCaps().get(internalformat).texturable))
     {
         context->recordError(Error(GL_INVALID_ENUM));
         return false;
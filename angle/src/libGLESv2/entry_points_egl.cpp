@@ -14,6 +14,7 @@
 
 #include "libANGLE/Context.h"
 #include "libANGLE/Display.h"
+#include "libANGLE/FrameCapture.h"
 #include "libANGLE/Texture.h"
 #include "libANGLE/Surface.h"
 #include "libANGLE/validationEGL.h"
@@ -720,6 +721,12 @@ EGLBoolean EGLAPIENTRY SwapBuffers(EGLDisplay dpy, EGLSurface surface)
         return EGL_FALSE;
     }
 
+    gl::FrameCapture *frameCapture = gl::FrameCapture::GetDefault();
+    if (frameCapture != nullptr)
+    {
+        frameCapture->captureSwapBuffers(GetGlobalContext(), eglSurface->getWidth(), eglSurface->getHeight());
+    }
+
     SetGlobalError(Error(EGL_SUCCESS));
     return EGL_TRUE;
 }
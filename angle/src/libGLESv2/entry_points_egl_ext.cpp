@@ -185,6 +185,11 @@ EGLDisplay EGLAPIENTRY GetPlatformDisplayEXT(EGLenum platform, void *native_disp
                     }
                     break;
 
+#if defined(ANGLE_ENABLE_NULL)
+                  case EGL_PLATFORM_ANGLE_TYPE_NULL_ANGLE:
+                    break;
+#endif
+
                   default:
                     SetGlobalError(Error(EGL_BAD_ATTRIBUTE));
                     return EGL_NO_DISPLAY;
@@ -15,6 +15,7 @@
 #include "libANGLE/Context.h"
 #include "libANGLE/Error.h"
 #include "libANGLE/Framebuffer.h"
+#include "libANGLE/FrameCapture.h"
 #include "libANGLE/Renderbuffer.h"
 #include "libANGLE/Shader.h"
 #include "libANGLE/Program.h"
@@ -48,6 +49,8 @@ void GL_APIENTRY ActiveTexture(GLenum texture)
             return;
         }
 
+        ANGLE_CAPTURE(ActiveTexture, context, texture);
+
         context->getState().setActiveSampler(texture - GL_TEXTURE0);
     }
 }
@@ -95,6 +98,8 @@ void GL_APIENTRY AttachShader(GLuint program, GLuint shader)
             context->recordError(Error(GL_INVALID_OPERATION));
             return;
         }
+
+        ANGLE_CAPTURE(AttachShader, context, program, shader);
     }
 }
 
@@ -133,6 +138,8 @@ void GL_APIENTRY BindAttribLocation(GLuint program, GLuint index, const GLchar*
             return;
         }
 
+        ANGLE_CAPTURE(BindAttribLocation, context, program, index, CaptureString(name));
+
         programObject->bindAttributeLocation(index, name);
     }
 }
@@ -150,6 +157,8 @@ void GL_APIENTRY BindBuffer(GLenum target, GLuint buffer)
             return;
         }
 
+        ANGLE_CAPTURE(BindBuffer, context, target, buffer);
+
         switch (target)
         {
           case GL_ARRAY_BUFFER:
@@ -197,6 +206,8 @@ void GL_APIENTRY BindFramebuffer(GLenum target, GLuint framebuffer)
             return;
         }
 
+        ANGLE_CAPTURE(BindFramebuffer, context, target, framebuffer);
+
         if (target == GL_READ_FRAMEBUFFER_ANGLE || target == GL_FRAMEBUFFER)
         {
             context->bindReadFramebuffer(framebuffer);
@@ -222,6 +233,8 @@ void GL_APIENTRY BindRenderbuffer(GLenum target, GLuint renderbuffer)
             return;
         }
 
+        ANGLE_CAPTURE(BindRenderbuffer, context, target, renderbuffer);
+
         context->bindRenderbuffer(renderbuffer);
     }
 }
@@ -261,6 +274,8 @@ void GL_APIENTRY BindTexture(GLenum target, GLuint texture)
             return;
         }
 
+        ANGLE_CAPTURE(BindTexture, context, target, texture);
+
         context->bindTexture(target, texture);
     }
 }
@@ -273,6 +288,8 @@ void GL_APIENTRY BlendColor(GLclampf red, GLclampf green, GLclampf blue, GLclamp
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_CAPTURE(BlendColor, context, red, green, blue, alpha);
+
         context->getState().setBlendColor(clamp01(red), clamp01(green), clamp01(blue), clamp01(alpha));
     }
 }
@@ -317,6 +334,8 @@ void GL_APIENTRY BlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha)
             return;
         }
 
+        ANGLE_CAPTURE(BlendEquationSeparate, context, modeRGB, modeAlpha);
+
         context->getState().setBlendEquation(modeRGB, modeAlpha);
     }
 }
@@ -457,6 +476,8 @@ void GL_APIENTRY BlendFuncSeparate(GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha
             return;
         }
 
+        ANGLE_CAPTURE(BlendFuncSeparate, context, srcRGB, dstRGB, srcAlpha, dstAlpha);
+
         context->getState().setBlendFactors(srcRGB, dstRGB, srcAlpha, dstAlpha);
     }
 }
@@ -514,6 +535,8 @@ void GL_APIENTRY BufferData(GLenum target, GLsizeiptr size, const GLvoid* data,
             return;
         }
 
+        ANGLE_CAPTURE(BufferData, context, target, size, CaptureMemory(data, size), usage);
+
         Error error = buffer->bufferData(data, size, usage);
         if (error.isError())
         {
@@ -575,6 +598,8 @@ void GL_APIENTRY BufferSubData(GLenum target, GLintptr offset, GLsizeiptr size,
             return;
         }
 
+        ANGLE_CAPTURE(BufferSubData, context, target, offset, size, CaptureMemory(data, size));
+
         Error error = buffer->bufferSubData(data, size, offset);
         if (error.isError())
         {
@@ -597,6 +622,8 @@ GLenum GL_APIENTRY CheckFramebufferStatus(GLenum target)
             return 0;
         }
 
+        ANGLE_CAPTURE(CheckFramebufferStatus, context, target);
+
         Framebuffer *framebuffer = context->getState().getTargetFramebuffer(target);
         ASSERT(framebuffer);
 
@@ -628,6 +655,8 @@ void GL_APIENTRY Clear(GLbitfield mask)
             return;
         }
 
+        ANGLE_CAPTURE(Clear, context, mask);
+
         Error error = framebufferObject->clear(context->getData(), mask);
         if (error.isError())
         {
@@ -645,6 +674,8 @@ void GL_APIENTRY ClearColor(GLclampf red, GLclampf green, GLclampf blue, GLclamp
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_CAPTURE(ClearColor, context, red, green, blue, alpha);
+
         context->getState().setColorClearValue(red, green, blue, alpha);
     }
 }
@@ -656,6 +687,8 @@ void GL_APIENTRY ClearDepthf(GLclampf depth)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_CAPTURE(ClearDepthf, context, depth);
+
         context->getState().setDepthClearValue(depth);
     }
 }
@@ -667,6 +700,8 @@ void GL_APIENTRY ClearStencil(GLint s)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_CAPTURE(ClearStencil, context, s);
+
         context->getState().setStencilClearValue(s);
     }
 }
@@ -679,6 +714,8 @@ void GL_APIENTRY ColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboo
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_CAPTURE(ColorMask, context, red, green, blue, alpha);
+
         context->getState().setColorMask(red == GL_TRUE, green == GL_TRUE, blue == GL_TRUE, alpha == GL_TRUE);
     }
 }
@@ -706,6 +743,8 @@ void GL_APIENTRY CompileShader(GLuint shader)
             }
         }
 
+        ANGLE_CAPTURE(CompileShader, context, shader);
+
         shaderObject->compile(context->getCompiler());
     }
 }
@@ -741,6 +780,9 @@ void GL_APIENTRY CompressedTexImage2D(GLenum target, GLint level, GLenum interna
             return;
         }
 
+        ANGLE_CAPTURE(CompressedTexImage2D, context, target, level, internalformat, width, height, border, imageSize,
+                      CaptureCompressedPixels(context, imageSize, data));
+
         Extents size(width, height, 1);
         Texture *texture = context->getTargetTexture(IsCubeMapTextureTarget(target) ? GL_TEXTURE_CUBE_MAP : target);
         Error error = texture->setCompressedImage(target, level, internalformat, size, context->getState().getUnpackState(), 
@@ -785,6 +827,8 @@ void GL_APIENTRY CompressedTexSubImage2D(GLenum target, GLint level, GLint xoffs
             return;
         }
 
+        ANGLE_CAPTURE(CompressedTexSubImage2D, context, target, level, xoffset, yoffset, width, height, format,
+                      imageSize, CaptureCompressedPixels(context, imageSize, data));
 
         Box area(xoffset, yoffset, 0, width, height, 1);
         Texture *texture = context->getTargetTexture(IsCubeMapTextureTarget(target) ? GL_TEXTURE_CUBE_MAP : target);
@@ -821,6 +865,8 @@ void GL_APIENTRY CopyTexImage2D(GLenum target, GLint level, GLenum internalforma
             return;
         }
 
+        ANGLE_CAPTURE(CopyTexImage2D, context, target, level, internalformat, x, y, width, height, border);
+
         Rectangle sourceArea(x, y, width, height);
 
         const Framebuffer *framebuffer = context->getState().getReadFramebuffer();
@@ -857,6 +903,8 @@ void GL_APIENTRY CopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GL
             return;
         }
 
+        ANGLE_CAPTURE(CopyTexSubImage2D, context, target, level, xoffset, yoffset, x, y, width, height);
+
         Offset destOffset(xoffset, yoffset, 0);
         Rectangle sourceArea(x, y, width, height);
 
@@ -878,6 +926,8 @@ GLuint GL_APIENTRY CreateProgram(void)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_CAPTURE(CreateProgram, context);
+
         return context->createProgram();
     }
 
@@ -901,6 +951,8 @@ GLuint GL_APIENTRY CreateShader(GLenum type)
             context->recordError(Error(GL_INVALID_ENUM));
             return 0;
         }
+
+        ANGLE_CAPTURE(CreateShader, context, type);
     }
 
     return 0;
@@ -925,6 +977,8 @@ void GL_APIENTRY CullFace(GLenum mode)
             return;
         }
 
+        ANGLE_CAPTURE(CullFace, context, mode);
+
         context->getState().setCullMode(mode);
     }
 }
@@ -942,6 +996,8 @@ void GL_APIENTRY DeleteBuffers(GLsizei n, const GLuint* buffers)
             return;
         }
 
+        ANGLE_CAPTURE(DeleteBuffers, context, n, CaptureArray(buffers, n, sizeof(GLuint)));
+
         for (int i = 0; i < n; i++)
         {
             context->deleteBuffer(buffers[i]);
@@ -962,6 +1018,8 @@ void GL_APIENTRY DeleteFramebuffers(GLsizei n, const GLuint* framebuffers)
             return;
         }
 
+        ANGLE_CAPTURE(DeleteFramebuffers, context, n, CaptureArray(framebuffers, n, sizeof(GLuint)));
+
         for (int i = 0; i < n; i++)
         {
             if (framebuffers[i] != 0)
@@ -998,6 +1056,8 @@ void GL_APIENTRY DeleteProgram(GLuint program)
             }
         }
 
+        ANGLE_CAPTURE(DeleteProgram, context, program);
+
         context->deleteProgram(program);
     }
 }
@@ -1015,6 +1075,8 @@ void GL_APIENTRY DeleteRenderbuffers(GLsizei n, const GLuint* renderbuffers)
             return;
         }
 
+        ANGLE_CAPTURE(DeleteRenderbuffers, context, n, CaptureArray(renderbuffers, n, sizeof(GLuint)));
+
         for (int i = 0; i < n; i++)
         {
             context->deleteRenderbuffer(renderbuffers[i]);
@@ -1048,6 +1110,8 @@ void GL_APIENTRY DeleteShader(GLuint shader)
             }
         }
 
+        ANGLE_CAPTURE(DeleteShader, context, shader);
+
         context->deleteShader(shader);
     }
 }
@@ -1065,6 +1129,8 @@ void GL_APIENTRY DeleteTextures(GLsizei n, const GLuint* textures)
             return;
         }
 
+        ANGLE_CAPTURE(DeleteTextures, context, n, CaptureArray(textures, n, sizeof(GLuint)));
+
         for (int i = 0; i < n; i++)
         {
             if (textures[i] != 0)
@@ -1092,6 +1158,7 @@ void GL_APIENTRY DepthFunc(GLenum func)
           case GL_GREATER:
           case GL_GEQUAL:
           case GL_NOTEQUAL:
+            ANGLE_CAPTURE(DepthFunc, context, func);
             context->getState().setDepthFunc(func);
             break;
 
@@ -1109,6 +1176,8 @@ void GL_APIENTRY DepthMask(GLboolean flag)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_CAPTURE(DepthMask, context, flag);
+
         context->getState().setDepthMask(flag != GL_FALSE);
     }
 }
@@ -1120,6 +1189,8 @@ void GL_APIENTRY DepthRangef(GLclampf zNear, GLclampf zFar)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_CAPTURE(DepthRangef, context, zNear, zFar);
+
         context->getState().setDepthRange(zNear, zFar);
     }
 }
@@ -1165,6 +1236,8 @@ void GL_APIENTRY DetachShader(GLuint program, GLuint shader)
             }
         }
 
+        ANGLE_CAPTURE(DetachShader, context, program, shader);
+
         if (!programObject->detachShader(shaderObject))
         {
             context->recordError(Error(GL_INVALID_OPERATION));
@@ -1186,6 +1259,8 @@ void GL_APIENTRY Disable(GLenum cap)
             return;
         }
 
+        ANGLE_CAPTURE(Disable, context, cap);
+
         context->getState().setEnableFeature(cap, false);
     }
 }
@@ -1203,6 +1278,8 @@ void GL_APIENTRY DisableVertexAttribArray(GLuint index)
             return;
         }
 
+        ANGLE_CAPTURE(DisableVertexAttribArray, context, index);
+
         context->getState().setEnableVertexAttribArray(index, false);
     }
 }
@@ -1219,6 +1296,9 @@ void GL_APIENTRY DrawArrays(GLenum mode, GLint first, GLsizei count)
             return;
         }
 
+        ANGLE_CAPTURE_CLIENT_ARRAYS(context, static_cast<size_t>(first) + count, 0);
+        ANGLE_CAPTURE(DrawArrays, context, mode, first, count);
+
         Error error = context->drawArrays(mode, first, count, 0);
         if (error.isError())
         {
@@ -1242,6 +1322,9 @@ void GL_APIENTRY DrawElements(GLenum mode, GLsizei count, GLenum type, const GLv
             return;
         }
 
+        ANGLE_CAPTURE_CLIENT_ARRAYS(context, static_cast<size_t>(indexRange.end) + 1, 0);
+        ANGLE_CAPTURE(DrawElements, context, mode, count, type, CaptureIndices(context, count, type, indices));
+
         Error error = context->drawElements(mode, count, type, indices, 0, indexRange);
         if (error.isError())
         {
@@ -1264,6 +1347,8 @@ void GL_APIENTRY Enable(GLenum cap)
             return;
         }
 
+        ANGLE_CAPTURE(Enable, context, cap);
+
         context->getState().setEnableFeature(cap, true);
     }
 }
@@ -1281,6 +1366,8 @@ void GL_APIENTRY EnableVertexAttribArray(GLuint index)
             return;
         }
 
+        ANGLE_CAPTURE(EnableVertexAttribArray, context, index);
+
         context->getState().setEnableVertexAttribArray(index, true);
     }
 }
@@ -1292,6 +1379,8 @@ void GL_APIENTRY Finish(void)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_CAPTURE(Finish, context);
+
         Error error = context->finish();
         if (error.isError())
         {
@@ -1308,6 +1397,8 @@ void GL_APIENTRY Flush(void)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_CAPTURE(Flush, context);
+
         Error error = context->flush();
         if (error.isError())
         {
@@ -1336,6 +1427,8 @@ void GL_APIENTRY FramebufferRenderbuffer(GLenum target, GLenum attachment, GLenu
             return;
         }
 
+        ANGLE_CAPTURE(FramebufferRenderbuffer, context, target, attachment, renderbuffertarget, renderbuffer);
+
         Framebuffer *framebuffer = context->getState().getTargetFramebuffer(target);
         ASSERT(framebuffer);
 
@@ -1364,6 +1457,8 @@ void GL_APIENTRY FramebufferTexture2D(GLenum target, GLenum attachment, GLenum t
             return;
         }
 
+        ANGLE_CAPTURE(FramebufferTexture2D, context, target, attachment, textarget, texture, level);
+
         Framebuffer *framebuffer = context->getState().getTargetFramebuffer(target);
         ASSERT(framebuffer);
 
@@ -1403,6 +1498,7 @@ void GL_APIENTRY FrontFace(GLenum mode)
         {
           case GL_CW:
           case GL_CCW:
+            ANGLE_CAPTURE(FrontFace, context, mode);
             context->getState().setFrontFace(mode);
             break;
           default:
@@ -1425,6 +1521,8 @@ void GL_APIENTRY GenBuffers(GLsizei n, GLuint* buffers)
             return;
         }
 
+        ANGLE_CAPTURE(GenBuffers, context, n, CaptureOutputArray(n, sizeof(GLuint)));
+
         for (int i = 0; i < n; i++)
         {
             buffers[i] = context->createBuffer();
@@ -1499,6 +1597,8 @@ void GL_APIENTRY GenerateMipmap(GLenum target)
             return;
         }
 
+        ANGLE_CAPTURE(GenerateMipmap, context, target);
+
         Error error = texture->generateMipmaps();
         if (error.isError())
         {
@@ -1521,6 +1621,8 @@ void GL_APIENTRY GenFramebuffers(GLsizei n, GLuint* framebuffers)
             return;
         }
 
+        ANGLE_CAPTURE(GenFramebuffers, context, n, CaptureOutputArray(n, sizeof(GLuint)));
+
         for (int i = 0; i < n; i++)
         {
             framebuffers[i] = context->createFramebuffer();
@@ -1541,6 +1643,8 @@ void GL_APIENTRY GenRenderbuffers(GLsizei n, GLuint* renderbuffers)
             return;
         }
 
+        ANGLE_CAPTURE(GenRenderbuffers, context, n, CaptureOutputArray(n, sizeof(GLuint)));
+
         for (int i = 0; i < n; i++)
         {
             renderbuffers[i] = context->createRenderbuffer();
@@ -1561,6 +1665,8 @@ void GL_APIENTRY GenTextures(GLsizei n, GLuint* textures)
             return;
         }
 
+        ANGLE_CAPTURE(GenTextures, context, n, CaptureOutputArray(n, sizeof(GLuint)));
+
         for (int i = 0; i < n; i++)
         {
             textures[i] = context->createTexture();
@@ -1605,6 +1711,9 @@ void GL_APIENTRY GetActiveAttrib(GLuint program, GLuint index, GLsizei bufsize,
             return;
         }
 
+        ANGLE_CAPTURE(GetActiveAttrib, context, program, index, bufsize, CaptureOutput(0), CaptureOutput(0),
+                      CaptureOutput(0), CaptureOutput(bufsize));
+
         programObject->getActiveAttribute(index, bufsize, length, size, type, name);
     }
 }
@@ -1647,6 +1756,9 @@ void GL_APIENTRY GetActiveUniform(GLuint program, GLuint index, GLsizei bufsize,
             return;
         }
 
+        ANGLE_CAPTURE(GetActiveUniform, context, program, index, bufsize, CaptureOutput(0), CaptureOutput(0),
+                      CaptureOutput(0), CaptureOutput(bufsize));
+
         programObject->getActiveUniform(index, bufsize, length, size, type, name);
     }
 }
@@ -1681,6 +1793,9 @@ void GL_APIENTRY GetAttachedShaders(GLuint program, GLsizei maxcount, GLsizei* c
             }
         }
 
+        ANGLE_CAPTURE(GetAttachedShaders, context, program, maxcount, CaptureOutput(0),
+                      CaptureOutputArray(maxcount, sizeof(GLuint)));
+
         return programObject->getAttachedShaders(maxcount, count, shaders);
     }
 }
@@ -1714,6 +1829,8 @@ GLint GL_APIENTRY GetAttribLocation(GLuint program, const GLchar* name)
             return -1;
         }
 
+        ANGLE_CAPTURE(GetAttribLocation, context, program, CaptureString(name));
+
         return programObject->getAttributeLocation(name);
     }
 
@@ -1734,6 +1851,8 @@ void GL_APIENTRY GetBooleanv(GLenum pname, GLboolean* params)
             return;
         }
 
+        ANGLE_CAPTURE(GetBooleanv, context, pname, CaptureOutput(0));
+
         if (nativeType == GL_BOOL)
         {
             context->getBooleanv(pname, params);
@@ -1773,6 +1892,8 @@ void GL_APIENTRY GetBufferParameteriv(GLenum target, GLenum pname, GLint* params
             return;
         }
 
+        ANGLE_CAPTURE(GetBufferParameteriv, context, target, pname, CaptureOutput(0));
+
         switch (pname)
         {
           case GL_BUFFER_USAGE:
@@ -1810,6 +1931,8 @@ GLenum GL_APIENTRY GetError(void)
 
     if (context)
     {
+        ANGLE_CAPTURE(GetError, context);
+
         return context->getError();
     }
 
@@ -1830,6 +1953,8 @@ void GL_APIENTRY GetFloatv(GLenum pname, GLfloat* params)
             return;
         }
 
+        ANGLE_CAPTURE(GetFloatv, context, pname, CaptureOutput(0));
+
         if (nativeType == GL_FLOAT)
         {
             context->getFloatv(pname, params);
@@ -1974,6 +2099,8 @@ void GL_APIENTRY GetFramebufferAttachmentParameteriv(GLenum target, GLenum attac
             }
         }
 
+        ANGLE_CAPTURE(GetFramebufferAttachmentParameteriv, context, target, attachment, pname, CaptureOutput(0));
+
         const FramebufferAttachment *attachmentObject = framebuffer->getAttachment(attachment);
         if (attachmentObject)
         {
@@ -2120,6 +2247,8 @@ void GL_APIENTRY GetIntegerv(GLenum pname, GLint* params)
             return;
         }
 
+        ANGLE_CAPTURE(GetIntegerv, context, pname, CaptureOutput(0));
+
         if (nativeType == GL_INT)
         {
             context->getIntegerv(pname, params);
@@ -2160,6 +2289,8 @@ void GL_APIENTRY GetProgramiv(GLuint program, GLenum pname, GLint* params)
             }
         }
 
+        ANGLE_CAPTURE(GetProgramiv, context, program, pname, CaptureOutput(0));
+
         switch (pname)
         {
           case GL_DELETE_STATUS:
@@ -2237,6 +2368,8 @@ void GL_APIENTRY GetProgramInfoLog(GLuint program, GLsizei bufsize, GLsizei* len
             return;
         }
 
+        ANGLE_CAPTURE(GetProgramInfoLog, context, program, bufsize, CaptureOutput(0), CaptureOutput(bufsize));
+
         programObject->getInfoLog(bufsize, length, infolog);
     }
 }
@@ -2260,6 +2393,8 @@ void GL_APIENTRY GetRenderbufferParameteriv(GLenum target, GLenum pname, GLint*
             return;
         }
 
+        ANGLE_CAPTURE(GetRenderbufferParameteriv, context, target, pname, CaptureOutput(0));
+
         Renderbuffer *renderbuffer = context->getRenderbuffer(context->getState().getRenderbufferId());
 
         switch (pname)
@@ -2305,6 +2440,8 @@ void GL_APIENTRY GetShaderiv(GLuint shader, GLenum pname, GLint* params)
             return;
         }
 
+        ANGLE_CAPTURE(GetShaderiv, context, shader, pname, CaptureOutput(0));
+
         switch (pname)
         {
           case GL_SHADER_TYPE:
@@ -2355,6 +2492,8 @@ void GL_APIENTRY GetShaderInfoLog(GLuint shader, GLsizei bufsize, GLsizei* lengt
             return;
         }
 
+        ANGLE_CAPTURE(GetShaderInfoLog, context, shader, bufsize, CaptureOutput(0), CaptureOutput(bufsize));
+
         shaderObject->getInfoLog(bufsize, length, infolog);
     }
 }
@@ -2367,6 +2506,8 @@ void GL_APIENTRY GetShaderPrecisionFormat(GLenum shadertype, GLenum precisiontyp
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_CAPTURE(GetShaderPrecisionFormat, context, shadertype, precisiontype, CaptureOutput(0), CaptureOutput(0));
+
         switch (shadertype)
         {
           case GL_VERTEX_SHADER:
@@ -2455,6 +2596,8 @@ void GL_APIENTRY GetShaderSource(GLuint shader, GLsizei bufsize, GLsizei* length
             return;
         }
 
+        ANGLE_CAPTURE(GetShaderSource, context, shader, bufsize, CaptureOutput(0), CaptureOutput(bufsize));
+
         shaderObject->getSource(bufsize, length, source);
     }
 }
@@ -2526,6 +2669,8 @@ void GL_APIENTRY GetTexParameterfv(GLenum target, GLenum pname, GLfloat* params)
             return;
         }
 
+        ANGLE_CAPTURE(GetTexParameterfv, context, target, pname, CaptureOutput(0));
+
         switch (pname)
         {
           case GL_TEXTURE_MAG_FILTER:
@@ -2664,6 +2809,8 @@ void GL_APIENTRY GetTexParameteriv(GLenum target, GLenum pname, GLint* params)
             return;
         }
 
+        ANGLE_CAPTURE(GetTexParameteriv, context, target, pname, CaptureOutput(0));
+
         switch (pname)
         {
           case GL_TEXTURE_MAG_FILTER:
@@ -2793,6 +2940,8 @@ void GL_APIENTRY GetUniformfv(GLuint program, GLint location, GLfloat* params)
             return;
         }
 
+        ANGLE_CAPTURE(GetUniformfv, context, program, location, CaptureOutput(0));
+
         Program *programObject = context->getProgram(program);
         ASSERT(programObject);
 
@@ -2812,6 +2961,8 @@ void GL_APIENTRY GetUniformiv(GLuint program, GLint location, GLint* params)
             return;
         }
 
+        ANGLE_CAPTURE(GetUniformiv, context, program, location, CaptureOutput(0));
+
         Program *programObject = context->getProgram(program);
         ASSERT(programObject);
 
@@ -2853,6 +3004,8 @@ GLint GL_APIENTRY GetUniformLocation(GLuint program, const GLchar* name)
             return -1;
         }
 
+        ANGLE_CAPTURE(GetUniformLocation, context, program, CaptureString(name));
+
         return programObject->getUniformLocation(name);
     }
 
@@ -2877,6 +3030,8 @@ void GL_APIENTRY GetVertexAttribfv(GLuint index, GLenum pname, GLfloat* params)
             return;
         }
 
+        ANGLE_CAPTURE(GetVertexAttribfv, context, index, pname, CaptureOutput(0));
+
         if (pname == GL_CURRENT_VERTEX_ATTRIB)
         {
             const VertexAttribCurrentValueData &currentValueData = context->getState().getVertexAttribCurrentValue(index);
@@ -2911,6 +3066,8 @@ void GL_APIENTRY GetVertexAttribiv(GLuint index, GLenum pname, GLint* params)
             return;
         }
 
+        ANGLE_CAPTURE(GetVertexAttribiv, context, index, pname, CaptureOutput(0));
+
         if (pname == GL_CURRENT_VERTEX_ATTRIB)
         {
             const VertexAttribCurrentValueData &currentValueData = context->getState().getVertexAttribCurrentValue(index);
@@ -2947,6 +3104,8 @@ void GL_APIENTRY GetVertexAttribPointerv(GLuint index, GLenum pname, GLvoid** po
             return;
         }
 
+        ANGLE_CAPTURE(GetVertexAttribPointerv, context, index, pname, CaptureOutput(0));
+
         *pointer = const_cast<GLvoid*>(context->getState().getVertexAttribPointer(index));
     }
 }
@@ -2970,6 +3129,8 @@ void GL_APIENTRY Hint(GLenum target, GLenum mode)
             return;
         }
 
+        ANGLE_CAPTURE(Hint, context, target, mode);
+
         switch (target)
         {
           case GL_GENERATE_MIPMAP_HINT:
@@ -2994,6 +3155,8 @@ GLboolean GL_APIENTRY IsBuffer(GLuint buffer)
     Context *context = GetValidGlobalContext();
     if (context && buffer)
     {
+        ANGLE_CAPTURE(IsBuffer, context, buffer);
+
         Buffer *bufferObject = context->getBuffer(buffer);
 
         if (bufferObject)
@@ -3018,6 +3181,8 @@ GLboolean GL_APIENTRY IsEnabled(GLenum cap)
             return GL_FALSE;
         }
 
+        ANGLE_CAPTURE(IsEnabled, context, cap);
+
         return context->getState().getEnableFeature(cap);
     }
 
@@ -3031,6 +3196,8 @@ GLboolean GL_APIENTRY IsFramebuffer(GLuint framebuffer)
     Context *context = GetValidGlobalContext();
     if (context && framebuffer)
     {
+        ANGLE_CAPTURE(IsFramebuffer, context, framebuffer);
+
         Framebuffer *framebufferObject = context->getFramebuffer(framebuffer);
 
         if (framebufferObject)
@@ -3049,6 +3216,8 @@ GLboolean GL_APIENTRY IsProgram(GLuint program)
     Context *context = GetValidGlobalContext();
     if (context && program)
     {
+        ANGLE_CAPTURE(IsProgram, context, program);
+
         Program *programObject = context->getProgram(program);
 
         if (programObject)
@@ -3067,6 +3236,8 @@ GLboolean GL_APIENTRY IsRenderbuffer(GLuint renderbuffer)
     Context *context = GetValidGlobalContext();
     if (context && renderbuffer)
     {
+        ANGLE_CAPTURE(IsRenderbuffer, context, renderbuffer);
+
         Renderbuffer *renderbufferObject = context->getRenderbuffer(renderbuffer);
 
         if (renderbufferObject)
@@ -3085,6 +3256,8 @@ GLboolean GL_APIENTRY IsShader(GLuint shader)
     Context *context = GetValidGlobalContext();
     if (context && shader)
     {
+        ANGLE_CAPTURE(IsShader, context, shader);
+
         Shader *shaderObject = context->getShader(shader);
 
         if (shaderObject)
@@ -3103,6 +3276,8 @@ GLboolean GL_APIENTRY IsTexture(GLuint texture)
     Context *context = GetValidGlobalContext();
     if (context && texture)
     {
+        ANGLE_CAPTURE(IsTexture, context, texture);
+
         Texture *textureObject = context->getTexture(texture);
 
         if (textureObject)
@@ -3127,6 +3302,8 @@ void GL_APIENTRY LineWidth(GLfloat width)
             return;
         }
 
+        ANGLE_CAPTURE(LineWidth, context, width);
+
         context->getState().setLineWidth(width);
     }
 }
@@ -3154,6 +3331,8 @@ void GL_APIENTRY LinkProgram(GLuint program)
             }
         }
 
+        ANGLE_CAPTURE(LinkProgram, context, program);
+
         Error error = programObject->link(context->getData());
         if (error.isError())
         {
@@ -3193,6 +3372,8 @@ void GL_APIENTRY PixelStorei(GLenum pname, GLint param)
             return;
         }
 
+        ANGLE_CAPTURE(PixelStorei, context, pname, param);
+
         State &state = context->getState();
 
         switch (pname)
@@ -3275,6 +3456,8 @@ void GL_APIENTRY PolygonOffset(GLfloat factor, GLfloat units)
     Context *context = GetValidGlobalContext();
     if (context)
     {
+        ANGLE_CAPTURE(PolygonOffset, context, factor, units);
+
         context->getState().setPolygonOffsetParams(factor, units);
     }
 }
@@ -3301,6 +3484,9 @@ void GL_APIENTRY ReadPixels(GLint x, GLint y, GLsizei width, GLsizei height,
             return;
         }
 
+        ANGLE_CAPTURE(ReadPixels, context, x, y, width, height, format, type,
+                      CaptureReadPixels(context, format, type, width, height, pixels));
+
         Framebuffer *framebufferObject = context->getState().getReadFramebuffer();
         ASSERT(framebufferObject);
 
@@ -3322,6 +3508,8 @@ void GL_APIENTRY ReleaseShaderCompiler(void)
 
     if (context)
     {
+        ANGLE_CAPTURE(ReleaseShaderCompiler, context);
+
         Compiler *compiler = context->getCompiler();
         Error error = compiler->release();
         if (error.isError())
@@ -3346,6 +3534,8 @@ void GL_APIENTRY RenderbufferStorage(GLenum target, GLenum internalformat, GLsiz
             return;
         }
 
+        ANGLE_CAPTURE(RenderbufferStorage, context, target, internalformat, width, height);
+
         Renderbuffer *renderbuffer = context->getState().getCurrentRenderbuffer();
         Error error = renderbuffer->setStorage(internalformat, width, height);
         if (error.isError())
@@ -3364,6 +3554,8 @@ void GL_APIENTRY SampleCoverage(GLclampf value, GLboolean invert)
 
     if (context)
     {
+        ANGLE_CAPTURE(SampleCoverage, context, value, invert);
+
         context->getState().setSampleCoverageParams(clamp01(value), invert == GL_TRUE);
     }
 }
@@ -3381,6 +3573,8 @@ void GL_APIENTRY Scissor(GLint x, GLint y, GLsizei width, GLsizei height)
             return;
         }
 
+        ANGLE_CAPTURE(Scissor, context, x, y, width, height);
+
         context->getState().setScissorParams(x, y, width, height);
     }
 }
@@ -3401,6 +3595,9 @@ void GL_APIENTRY ShaderBinary(GLsizei n, const GLuint* shaders, GLenum binaryfor
             return;
         }
 
+        ANGLE_CAPTURE(ShaderBinary, context, n, CaptureArray(shaders, n, sizeof(GLuint)), binaryformat,
+                      CaptureMemory(binary, length), length);
+
         // No binary shader formats are supported.
         UNIMPLEMENTED();
     }
@@ -3436,6 +3633,8 @@ void GL_APIENTRY ShaderSource(GLuint shader, GLsizei count, const GLchar* const*
             }
         }
 
+        ANGLE_CAPTURE(ShaderSource, context, shader, count, CaptureStrings(count, string, length), CaptureNull());
+
         shaderObject->setSource(count, string, length);
     }
 }
@@ -3481,6 +3680,8 @@ void GL_APIENTRY StencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint
             return;
         }
 
+        ANGLE_CAPTURE(StencilFuncSeparate, context, face, func, ref, mask);
+
         if (face == GL_FRONT || face == GL_FRONT_AND_BACK)
         {
             context->getState().setStencilParams(func, ref, mask);
@@ -3517,6 +3718,8 @@ void GL_APIENTRY StencilMaskSeparate(GLenum face, GLuint mask)
             return;
         }
 
+        ANGLE_CAPTURE(StencilMaskSeparate, context, face, mask);
+
         if (face == GL_FRONT || face == GL_FRONT_AND_BACK)
         {
             context->getState().setStencilWritemask(mask);
@@ -3605,6 +3808,8 @@ void GL_APIENTRY StencilOpSeparate(GLenum face, GLenum fail, GLenum zfail, GLenu
             return;
         }
 
+        ANGLE_CAPTURE(StencilOpSeparate, context, face, fail, zfail, zpass);
+
         if (face == GL_FRONT || face == GL_FRONT_AND_BACK)
         {
             context->getState().setStencilOperations(fail, zfail, zpass);
@@ -3641,6 +3846,9 @@ void GL_APIENTRY TexImage2D(GLenum target, GLint level, GLint internalformat, GL
             return;
         }
 
+        ANGLE_CAPTURE(TexImage2D, context, target, level, internalformat, width, height, border, format, type,
+                      CapturePixels(context, format, type, width, height, 1, pixels));
+
         Extents size(width, height, 1);
         Texture *texture = context->getTargetTexture(IsCubeMapTextureTarget(target) ? GL_TEXTURE_CUBE_MAP : target);
         Error error = texture->setImage(target, level, internalformat, size, format, type, context->getState().getUnpackState(),
@@ -3679,6 +3887,8 @@ void GL_APIENTRY TexParameterf(GLenum target, GLenum pname, GLfloat param)
             return;
         }
 
+        ANGLE_CAPTURE(TexParameterf, context, target, pname, param);
+
         switch (pname)
         {
           case GL_TEXTURE_WRAP_S:               texture->getSamplerState().wrapS = uiround<GLenum>(param);        break;
@@ -3734,6 +3944,8 @@ void GL_APIENTRY TexParameteri(GLenum target, GLenum pname, GLint param)
             return;
         }
 
+        ANGLE_CAPTURE(TexParameteri, context, target, pname, param);
+
         switch (pname)
         {
           case GL_TEXTURE_WRAP_S:               texture->getSamplerState().wrapS = (GLenum)param;        break;
@@ -3794,6 +4006,9 @@ void GL_APIENTRY TexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint
             return;
         }
 
+        ANGLE_CAPTURE(TexSubImage2D, context, target, level, xoffset, yoffset, width, height, format, type,
+                      CapturePixels(context, format, type, width, height, 1, pixels));
+
         Box area(xoffset, yoffset, 0, width, height, 1);
         Texture *texture = context->getTargetTexture(IsCubeMapTextureTarget(target) ? GL_TEXTURE_CUBE_MAP : target);
         Error error = texture->setSubImage(target, level, area, format, type, context->getState().getUnpackState(),
@@ -3823,6 +4038,8 @@ void GL_APIENTRY Uniform1fv(GLint location, GLsizei count, const GLfloat* v)
             return;
         }
 
+        ANGLE_CAPTURE(Uniform1fv, context, location, count, CaptureArray(v, count, sizeof(GLfloat)));
+
         Program *program = context->getState().getProgram();
         program->setUniform1fv(location, count, v);
     }
@@ -3845,6 +4062,8 @@ void GL_APIENTRY Uniform1iv(GLint location, GLsizei count, const GLint* v)
             return;
         }
 
+        ANGLE_CAPTURE(Uniform1iv, context, location, count, CaptureArray(v, count, sizeof(GLint)));
+
         Program *program = context->getState().getProgram();
         program->setUniform1iv(location, count, v);
     }
@@ -3869,6 +4088,8 @@ void GL_APIENTRY Uniform2fv(GLint location, GLsizei count, const GLfloat* v)
             return;
         }
 
+        ANGLE_CAPTURE(Uniform2fv, context, location, count, CaptureArray(v, count, 2 * sizeof(GLfloat)));
+
         Program *program = context->getState().getProgram();
         program->setUniform2fv(location, count, v);
     }
@@ -3893,6 +4114,8 @@ void GL_APIENTRY Uniform2iv(GLint location, GLsizei count, const GLint* v)
             return;
         }
 
+        ANGLE_CAPTURE(Uniform2iv, context, location, count, CaptureArray(v, count, 2 * sizeof(GLint)));
+
         Program *program = context->getState().getProgram();
         program->setUniform2iv(location, count, v);
     }
@@ -3917,6 +4140,8 @@ void GL_APIENTRY Uniform3fv(GLint location, GLsizei count, const GLfloat* v)
             return;
         }
 
+        ANGLE_CAPTURE(Uniform3fv, context, location, count, CaptureArray(v, count, 3 * sizeof(GLfloat)));
+
         Program *program = context->getState().getProgram();
         program->setUniform3fv(location, count, v);
     }
@@ -3941,6 +4166,8 @@ void GL_APIENTRY Uniform3iv(GLint location, GLsizei count, const GLint* v)
             return;
         }
 
+        ANGLE_CAPTURE(Uniform3iv, context, location, count, CaptureArray(v, count, 3 * sizeof(GLint)));
+
         Program *program = context->getState().getProgram();
         program->setUniform3iv(location, count, v);
     }
@@ -3965,6 +4192,8 @@ void GL_APIENTRY Uniform4fv(GLint location, GLsizei count, const GLfloat* v)
             return;
         }
 
+        ANGLE_CAPTURE(Uniform4fv, context, location, count, CaptureArray(v, count, 4 * sizeof(GLfloat)));
+
         Program *program = context->getState().getProgram();
         program->setUniform4fv(location, count, v);
     }
@@ -3989,6 +4218,8 @@ void GL_APIENTRY Uniform4iv(GLint location, GLsizei count, const GLint* v)
             return;
         }
 
+        ANGLE_CAPTURE(Uniform4iv, context, location, count, CaptureArray(v, count, 4 * sizeof(GLint)));
+
         Program *program = context->getState().getProgram();
         program->setUniform4iv(location, count, v);
     }
@@ -4007,6 +4238,9 @@ void GL_APIENTRY UniformMatrix2fv(GLint location, GLsizei count, GLboolean trans
             return;
         }
 
+        ANGLE_CAPTURE(UniformMatrix2fv, context, location, count, transpose,
+                      CaptureArray(value, count, 4 * sizeof(GLfloat)));
+
         Program *program = context->getState().getProgram();
         program->setUniformMatrix2fv(location, count, transpose, value);
     }
@@ -4025,6 +4259,9 @@ void GL_APIENTRY UniformMatrix3fv(GLint location, GLsizei count, GLboolean trans
             return;
         }
 
+        ANGLE_CAPTURE(UniformMatrix3fv, context, location, count, transpose,
+                      CaptureArray(value, count, 9 * sizeof(GLfloat)));
+
         Program *program = context->getState().getProgram();
         program->setUniformMatrix3fv(location, count, transpose, value);
     }
@@ -4043,6 +4280,9 @@ void GL_APIENTRY UniformMatrix4fv(GLint location, GLsizei count, GLboolean trans
             return;
         }
 
+        ANGLE_CAPTURE(UniformMatrix4fv, context, location, count, transpose,
+                      CaptureArray(value, count, 16 * sizeof(GLfloat)));
+
         Program *program = context->getState().getProgram();
         program->setUniformMatrix4fv(location, count, transpose, value);
     }
@@ -4077,6 +4317,8 @@ void GL_APIENTRY UseProgram(GLuint program)
             return;
         }
 
+        ANGLE_CAPTURE(UseProgram, context, program);
+
         context->useProgram(program);
     }
 }
@@ -4104,6 +4346,8 @@ void GL_APIENTRY ValidateProgram(GLuint program)
             }
         }
 
+        ANGLE_CAPTURE(ValidateProgram, context, program);
+
         programObject->validate(context->getCaps());
     }
 }
@@ -4121,6 +4365,8 @@ void GL_APIENTRY VertexAttrib1f(GLuint index, GLfloat x)
             return;
         }
 
+        ANGLE_CAPTURE(VertexAttrib1f, context, index, x);
+
         GLfloat vals[4] = { x, 0, 0, 1 };
         context->getState().setVertexAttribf(index, vals);
     }
@@ -4139,6 +4385,8 @@ void GL_APIENTRY VertexAttrib1fv(GLuint index, const GLfloat* values)
             return;
         }
 
+        ANGLE_CAPTURE(VertexAttrib1fv, context, index, CaptureArray(values, 1, sizeof(GLfloat)));
+
         GLfloat vals[4] = { values[0], 0, 0, 1 };
         context->getState().setVertexAttribf(index, vals);
     }
@@ -4157,6 +4405,8 @@ void GL_APIENTRY VertexAttrib2f(GLuint index, GLfloat x, GLfloat y)
             return;
         }
 
+        ANGLE_CAPTURE(VertexAttrib2f, context, index, x, y);
+
         GLfloat vals[4] = { x, y, 0, 1 };
         context->getState().setVertexAttribf(index, vals);
     }
@@ -4175,6 +4425,8 @@ void GL_APIENTRY VertexAttrib2fv(GLuint index, const GLfloat* values)
             return;
         }
 
+        ANGLE_CAPTURE(VertexAttrib2fv, context, index, CaptureArray(values, 2, sizeof(GLfloat)));
+
         GLfloat vals[4] = { values[0], values[1], 0, 1 };
         context->getState().setVertexAttribf(index, vals);
     }
@@ -4193,6 +4445,8 @@ void GL_APIENTRY VertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z)
             return;
         }
 
+        ANGLE_CAPTURE(VertexAttrib3f, context, index, x, y, z);
+
         GLfloat vals[4] = { x, y, z, 1 };
         context->getState().setVertexAttribf(index, vals);
     }
@@ -4211,6 +4465,8 @@ void GL_APIENTRY VertexAttrib3fv(GLuint index, const GLfloat* values)
             return;
         }
 
+        ANGLE_CAPTURE(VertexAttrib3fv, context, index, CaptureArray(values, 3, sizeof(GLfloat)));
+
         GLfloat vals[4] = { values[0], values[1], values[2], 1 };
         context->getState().setVertexAttribf(index, vals);
     }
@@ -4229,6 +4485,8 @@ void GL_APIENTRY VertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, G
             return;
         }
 
+        ANGLE_CAPTURE(VertexAttrib4f, context, index, x, y, z, w);
+
         GLfloat vals[4] = { x, y, z, w };
         context->getState().setVertexAttribf(index, vals);
     }
@@ -4247,6 +4505,8 @@ void GL_APIENTRY VertexAttrib4fv(GLuint index, const GLfloat* values)
             return;
         }
 
+        ANGLE_CAPTURE(VertexAttrib4fv, context, index, CaptureArray(values, 4, sizeof(GLfloat)));
+
         context->getState().setVertexAttribf(index, values);
     }
 }
@@ -4321,6 +4581,8 @@ void GL_APIENTRY VertexAttribPointer(GLuint index, GLint size, GLenum type, GLbo
             return;
         }
 
+        ANGLE_CAPTURE(VertexAttribPointer, context, index, size, type, normalized, stride, CaptureOffset(ptr));
+
         context->getState().setVertexAttribState(index, context->getState().getTargetBuffer(GL_ARRAY_BUFFER), size, type,
                                                  normalized == GL_TRUE, false, stride, ptr);
     }
@@ -4339,6 +4601,8 @@ void GL_APIENTRY Viewport(GLint x, GLint y, GLsizei width, GLsizei height)
             return;
         }
 
+        ANGLE_CAPTURE(Viewport, context, x, y, width, height);
+
         context->getState().setViewportParams(x, y, width, height);
     }
 }
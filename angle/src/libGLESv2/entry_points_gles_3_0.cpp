@@ -15,6 +15,7 @@
 #include "libANGLE/Context.h"
 #include "libANGLE/Error.h"
 #include "libANGLE/Fence.h"
+#include "libANGLE/FrameCapture.h"
 #include "libANGLE/Framebuffer.h"
 #include "libANGLE/Query.h"
 #include "libANGLE/VertexArray.h"
@@ -40,6 +41,8 @@ void GL_APIENTRY ReadBuffer(GLenum mode)
             return;
         }
 
+        ANGLE_CAPTURE(ReadBuffer, context, mode);
+
         Framebuffer *readFBO = context->getState().getReadFramebuffer();
         readFBO->setReadBuffer(mode);
     }
@@ -71,6 +74,10 @@ void GL_APIENTRY DrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsize
             return;
         }
 
+        ANGLE_CAPTURE_CLIENT_ARRAYS(context, static_cast<size_t>(indexRange.end) + 1, 0);
+        ANGLE_CAPTURE(DrawRangeElements, context, mode, start, end, count, type,
+                      CaptureIndices(context, count, type, indices));
+
         // As long as index validation is done, it doesn't matter whether the context receives a drawElements or
         // a drawRangeElements call - the GL back-end is free to choose to call drawRangeElements based on the
         // validated index range. If index validation is removed, adding drawRangeElements to the context interface
@@ -107,6 +114,9 @@ void GL_APIENTRY TexImage3D(GLenum target, GLint level, GLint internalformat, GL
             return;
         }
 
+        ANGLE_CAPTURE(TexImage3D, context, target, level, internalformat, width, height, depth, border, format, type,
+                      CapturePixels(context, format, type, width, height, depth, pixels));
+
         Extents size(width, height, depth);
         Texture *texture = context->getTargetTexture(target);
         Error error = texture->setImage(target, level, internalformat, size, format, type, context->getState().getUnpackState(),
@@ -135,6 +145,9 @@ void GL_APIENTRY TexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint
             return;
         }
 
+        ANGLE_CAPTURE(TexSubImage3D, context, target, level, xoffset, yoffset, zoffset, width, height, depth, format,
+                      type, CapturePixels(context, format, type, width, height, depth, pixels));
+
         // validateES3TexImageFormat sets the error code if there is an error
         if (!ValidateES3TexImageParameters(context, target, level, GL_NONE, false, true,
                                            xoffset, yoffset, zoffset, width, height, depth, 0,
@@ -182,6 +195,8 @@ void GL_APIENTRY CopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GL
             return;
         }
 
+        ANGLE_CAPTURE(CopyTexSubImage3D, context, target, level, xoffset, yoffset, zoffset, x, y, width, height);
+
         Offset destOffset(xoffset, yoffset, zoffset);
         Rectangle sourceArea(x, y, width, height);
 
@@ -226,6 +241,9 @@ void GL_APIENTRY CompressedTexImage3D(GLenum target, GLint level, GLenum interna
             return;
         }
 
+        ANGLE_CAPTURE(CompressedTexImage3D, context, target, level, internalformat, width, height, depth, border,
+                      imageSize, CaptureCompressedPixels(context, imageSize, data));
+
         Extents size(width, height, depth);
         Texture *texture = context->getTargetTexture(target);
         Error error = texture->setCompressedImage(target, level, internalformat, size, context->getState().getUnpackState(),
@@ -280,6 +298,9 @@ void GL_APIENTRY CompressedTexSubImage3D(GLenum target, GLint level, GLint xoffs
             return;
         }
 
+        ANGLE_CAPTURE(CompressedTexSubImage3D, context, target, level, xoffset, yoffset, zoffset, width, height, depth,
+                      format, imageSize, CaptureCompressedPixels(context, imageSize, data));
+
         Box area(xoffset, yoffset, zoffset, width, height, depth);
         Texture *texture = context->getTargetTexture(target);
         Error error = texture->setCompressedSubImage(target, level, area, format, context->getState().getUnpackState(),
@@ -311,6 +332,8 @@ void GL_APIENTRY GenQueries(GLsizei n, GLuint* ids)
             return;
         }
 
+        ANGLE_CAPTURE(GenQueries, context, n, CaptureOutputArray(n, sizeof(GLuint)));
+
         for (GLsizei i = 0; i < n; i++)
         {
             ids[i] = context->createQuery();
@@ -337,6 +360,8 @@ void GL_APIENTRY DeleteQueries(GLsizei n, const GLuint* ids)
             return;
         }
 
+        ANGLE_CAPTURE(DeleteQueries, context, n, CaptureArray(ids, n, sizeof(GLuint)));
+
         for (GLsizei i = 0; i < n; i++)
         {
             context->deleteQuery(ids[i]);
@@ -357,6 +382,8 @@ GLboolean GL_APIENTRY IsQuery(GLuint id)
             return GL_FALSE;
         }
 
+        ANGLE_CAPTURE(IsQuery, context, id);
+
         return (context->getQuery(id, false, GL_NONE) != NULL) ? GL_TRUE : GL_FALSE;
     }
 
@@ -387,6 +414,8 @@ void GL_APIENTRY BeginQuery(GLenum target, GLuint id)
             context->recordError(error);
             return;
         }
+
+        ANGLE_CAPTURE(BeginQuery, context, target, id);
     }
 }
 
@@ -414,6 +443,8 @@ void GL_APIENTRY EndQuery(GLenum target)
             context->recordError(error);
             return;
         }
+
+        ANGLE_CAPTURE(EndQuery, context, target);
     }
 }
 
@@ -436,6 +467,8 @@ void GL_APIENTRY GetQueryiv(GLenum target, GLenum pname, GLint* params)
             return;
         }
 
+        ANGLE_CAPTURE(GetQueryiv, context, target, pname, CaptureOutput(0));
+
         switch (pname)
         {
           case GL_CURRENT_QUERY:
@@ -476,6 +509,8 @@ void GL_APIENTRY GetQueryObjectuiv(GLuint id, GLenum pname, GLuint* params)
             return;
         }
 
+        ANGLE_CAPTURE(GetQueryObjectuiv, context, id, pname, CaptureOutput(0));
+
         switch(pname)
         {
           case GL_QUERY_RESULT_EXT:
@@ -520,6 +555,9 @@ GLboolean GL_APIENTRY UnmapBuffer(GLenum target)
             return GL_FALSE;
         }
 
+        ANGLE_CAPTURE_MAPPED_BUFFER(context, target);
+        ANGLE_CAPTURE(UnmapBuffer, context, target);
+
         return UnmapBufferOES(target);
     }
 
@@ -539,6 +577,8 @@ void GL_APIENTRY GetBufferPointerv(GLenum target, GLenum pname, GLvoid** params)
             return;
         }
 
+        ANGLE_CAPTURE(GetBufferPointerv, context, target, pname, CaptureOutput(0));
+
         GetBufferPointervOES(target, pname, params);
     }
 }
@@ -554,6 +594,14 @@ void GL_APIENTRY DrawBuffers(GLsizei n, const GLenum* bufs)
             return;
         }
 
+        if (n < 0 || static_cast<GLuint>(n) > context->getCaps().maxDrawBuffers)
+        {
+            context->recordError(Error(GL_INVALID_VALUE));
+            return;
+        }
+
+        ANGLE_CAPTURE(DrawBuffers, context, n, CaptureArray(bufs, n, sizeof(GLenum)));
+
         DrawBuffersEXT(n, bufs);
     }
 }
@@ -571,6 +619,9 @@ void GL_APIENTRY UniformMatrix2x3fv(GLint location, GLsizei count, GLboolean tra
             return;
         }
 
+        ANGLE_CAPTURE(UniformMatrix2x3fv, context, location, count, transpose,
+                      CaptureArray(value, count, 6 * sizeof(GLfloat)));
+
         Program *program = context->getState().getProgram();
         program->setUniformMatrix2x3fv(location, count, transpose, value);
     }
@@ -589,6 +640,9 @@ void GL_APIENTRY UniformMatrix3x2fv(GLint location, GLsizei count, GLboolean tra
             return;
         }
 
+        ANGLE_CAPTURE(UniformMatrix3x2fv, context, location, count, transpose,
+                      CaptureArray(value, count, 6 * sizeof(GLfloat)));
+
         Program *program = context->getState().getProgram();
         program->setUniformMatrix3x2fv(location, count, transpose, value);
     }
@@ -607,6 +661,9 @@ void GL_APIENTRY UniformMatrix2x4fv(GLint location, GLsizei count, GLboolean tra
             return;
         }
 
+        ANGLE_CAPTURE(UniformMatrix2x4fv, context, location, count, transpose,
+                      CaptureArray(value, count, 8 * sizeof(GLfloat)));
+
         Program *program = context->getState().getProgram();
         program->setUniformMatrix2x4fv(location, count, transpose, value);
     }
@@ -625,6 +682,9 @@ void GL_APIENTRY UniformMatrix4x2fv(GLint location, GLsizei count, GLboolean tra
             return;
         }
 
+        ANGLE_CAPTURE(UniformMatrix4x2fv, context, location, count, transpose,
+                      CaptureArray(value, count, 8 * sizeof(GLfloat)));
+
         Program *program = context->getState().getProgram();
         program->setUniformMatrix4x2fv(location, count, transpose, value);
     }
@@ -643,6 +703,9 @@ void GL_APIENTRY UniformMatrix3x4fv(GLint location, GLsizei count, GLboolean tra
             return;
         }
 
+        ANGLE_CAPTURE(UniformMatrix3x4fv, context, location, count, transpose,
+                      CaptureArray(value, count, 12 * sizeof(GLfloat)));
+
         Program *program = context->getState().getProgram();
         program->setUniformMatrix3x4fv(location, count, transpose, value);
     }
@@ -661,6 +724,9 @@ void GL_APIENTRY UniformMatrix4x3fv(GLint location, GLsizei count, GLboolean tra
             return;
         }
 
+        ANGLE_CAPTURE(UniformMatrix4x3fv, context, location, count, transpose,
+                      CaptureArray(value, count, 12 * sizeof(GLfloat)));
+
         Program *program = context->getState().getProgram();
         program->setUniformMatrix4x3fv(location, count, transpose, value);
     }
@@ -681,6 +747,8 @@ void GL_APIENTRY BlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint sr
             return;
         }
 
+        ANGLE_CAPTURE(BlitFramebuffer, context, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+
         if (!ValidateBlitFramebufferParameters(context, srcX0, srcY0, srcX1, srcY1,
                                                dstX0, dstY0, dstX1, dstY1, mask, filter,
                                                false))
@@ -725,6 +793,8 @@ void GL_APIENTRY RenderbufferStorageMultisample(GLenum target, GLsizei samples,
             return;
         }
 
+        ANGLE_CAPTURE(RenderbufferStorageMultisample, context, target, samples, internalformat, width, height);
+
         Renderbuffer *renderbuffer = context->getState().getCurrentRenderbuffer();
         renderbuffer->setStorageMultisample(samples, internalformat, width, height);
     }
@@ -744,6 +814,8 @@ void GL_APIENTRY FramebufferTextureLayer(GLenum target, GLenum attachment, GLuin
             return;
         }
 
+        ANGLE_CAPTURE(FramebufferTextureLayer, context, target, attachment, texture, level, layer);
+
         Framebuffer *framebuffer = context->getState().getTargetFramebuffer(target);
         ASSERT(framebuffer);
 
@@ -786,6 +858,8 @@ GLvoid *GL_APIENTRY MapBufferRange(GLenum target, GLintptr offset, GLsizeiptr le
             return NULL;
         }
 
+        ANGLE_CAPTURE(MapBufferRange, context, target, offset, length, access);
+
         return MapBufferRangeEXT(target, offset, length, access);
     }
 
@@ -805,6 +879,8 @@ void GL_APIENTRY FlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeip
             return;
         }
 
+        ANGLE_CAPTURE(FlushMappedBufferRange, context, target, offset, length);
+
         FlushMappedBufferRangeEXT(target, offset, length);
     }
 }
@@ -832,6 +908,8 @@ void GL_APIENTRY BindVertexArray(GLuint array)
             return;
         }
 
+        ANGLE_CAPTURE(BindVertexArray, context, array);
+
         context->bindVertexArray(array);
     }
 }
@@ -855,6 +933,8 @@ void GL_APIENTRY DeleteVertexArrays(GLsizei n, const GLuint* arrays)
             return;
         }
 
+        ANGLE_CAPTURE(DeleteVertexArrays, context, n, CaptureArray(arrays, n, sizeof(GLuint)));
+
         for (int arrayIndex = 0; arrayIndex < n; arrayIndex++)
         {
             if (arrays[arrayIndex] != 0)
@@ -884,6 +964,8 @@ void GL_APIENTRY GenVertexArrays(GLsizei n, GLuint* arrays)
             return;
         }
 
+        ANGLE_CAPTURE(GenVertexArrays, context, n, CaptureOutputArray(n, sizeof(GLuint)));
+
         for (int arrayIndex = 0; arrayIndex < n; arrayIndex++)
         {
             arrays[arrayIndex] = context->createVertexArray();
@@ -909,6 +991,8 @@ GLboolean GL_APIENTRY IsVertexArray(GLuint array)
             return GL_FALSE;
         }
 
+        ANGLE_CAPTURE(IsVertexArray, context, array);
+
         VertexArray *vao = context->getVertexArray(array);
 
         return (vao != NULL ? GL_TRUE : GL_FALSE);
@@ -959,6 +1043,8 @@ void GL_APIENTRY GetIntegeri_v(GLenum target, GLuint index, GLint* data)
             return;
         }
 
+        ANGLE_CAPTURE(GetIntegeri_v, context, target, index, CaptureOutput(0));
+
         if (!(context->getIndexedIntegerv(target, index, data)))
         {
             GLenum nativeType;
@@ -1032,6 +1118,8 @@ void GL_APIENTRY BeginTransformFeedback(GLenum primitiveMode)
             return;
         }
 
+        ANGLE_CAPTURE(BeginTransformFeedback, context, primitiveMode);
+
         if (transformFeedback->isPaused())
         {
             transformFeedback->resume();
@@ -1065,6 +1153,8 @@ void GL_APIENTRY EndTransformFeedback(void)
             return;
         }
 
+        ANGLE_CAPTURE(EndTransformFeedback, context);
+
         transformFeedback->end();
     }
 }
@@ -1113,6 +1203,8 @@ void GL_APIENTRY BindBufferRange(GLenum target, GLuint index, GLuint buffer, GLi
             return;
         }
 
+        ANGLE_CAPTURE(BindBufferRange, context, target, index, buffer, offset, size);
+
         switch (target)
         {
           case GL_TRANSFORM_FEEDBACK_BUFFER:
@@ -1194,6 +1286,8 @@ void GL_APIENTRY BindBufferBase(GLenum target, GLuint index, GLuint buffer)
             return;
         }
 
+        ANGLE_CAPTURE(BindBufferBase, context, target, index, buffer);
+
         switch (target)
         {
           case GL_TRANSFORM_FEEDBACK_BUFFER:
@@ -1263,6 +1357,9 @@ void GL_APIENTRY TransformFeedbackVaryings(GLuint program, GLsizei count, const
             return;
         }
 
+        ANGLE_CAPTURE(TransformFeedbackVaryings, context, program, count, CaptureStrings(count, varyings, nullptr),
+                      bufferMode);
+
         Program *programObject = context->getProgram(program);
         ASSERT(programObject);
 
@@ -1305,6 +1402,9 @@ void GL_APIENTRY GetTransformFeedbackVarying(GLuint program, GLuint index, GLsiz
             return;
         }
 
+        ANGLE_CAPTURE(GetTransformFeedbackVarying, context, program, index, bufSize, CaptureOutput(0), CaptureOutput(0),
+                      CaptureOutput(0), CaptureOutput(bufSize));
+
         programObject->getTransformFeedbackVarying(index, bufSize, length, size, type, name);
     }
 }
@@ -1374,6 +1474,8 @@ void GL_APIENTRY VertexAttribIPointer(GLuint index, GLint size, GLenum type, GLs
             return;
         }
 
+        ANGLE_CAPTURE(VertexAttribIPointer, context, index, size, type, stride, CaptureOffset(pointer));
+
         context->getState().setVertexAttribState(index, context->getState().getTargetBuffer(GL_ARRAY_BUFFER), size, type, false, true,
                                                  stride, pointer);
     }
@@ -1404,6 +1506,8 @@ void GL_APIENTRY GetVertexAttribIiv(GLuint index, GLenum pname, GLint* params)
             return;
         }
 
+        ANGLE_CAPTURE(GetVertexAttribIiv, context, index, pname, CaptureOutput(0));
+
         if (pname == GL_CURRENT_VERTEX_ATTRIB)
         {
             const VertexAttribCurrentValueData &currentValueData = context->getState().getVertexAttribCurrentValue(index);
@@ -1445,6 +1549,8 @@ void GL_APIENTRY GetVertexAttribIuiv(GLuint index, GLenum pname, GLuint* params)
             return;
         }
 
+        ANGLE_CAPTURE(GetVertexAttribIuiv, context, index, pname, CaptureOutput(0));
+
         if (pname == GL_CURRENT_VERTEX_ATTRIB)
         {
             const VertexAttribCurrentValueData &currentValueData = context->getState().getVertexAttribCurrentValue(index);
@@ -1481,6 +1587,8 @@ void GL_APIENTRY VertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint
             return;
         }
 
+        ANGLE_CAPTURE(VertexAttribI4i, context, index, x, y, z, w);
+
         GLint vals[4] = { x, y, z, w };
         context->getState().setVertexAttribi(index, vals);
     }
@@ -1506,6 +1614,8 @@ void GL_APIENTRY VertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GL
             return;
         }
 
+        ANGLE_CAPTURE(VertexAttribI4ui, context, index, x, y, z, w);
+
         GLuint vals[4] = { x, y, z, w };
         context->getState().setVertexAttribu(index, vals);
     }
@@ -1530,6 +1640,8 @@ void GL_APIENTRY VertexAttribI4iv(GLuint index, const GLint* v)
             return;
         }
 
+        ANGLE_CAPTURE(VertexAttribI4iv, context, index, CaptureArray(v, 4, sizeof(GLint)));
+
         context->getState().setVertexAttribi(index, v);
     }
 }
@@ -1553,6 +1665,8 @@ void GL_APIENTRY VertexAttribI4uiv(GLuint index, const GLuint* v)
             return;
         }
 
+        ANGLE_CAPTURE(VertexAttribI4uiv, context, index, CaptureArray(v, 4, sizeof(GLuint)));
+
         context->getState().setVertexAttribu(index, v);
     }
 }
@@ -1570,6 +1684,8 @@ void GL_APIENTRY GetUniformuiv(GLuint program, GLint location, GLuint* params)
             return;
         }
 
+        ANGLE_CAPTURE(GetUniformuiv, context, program, location, CaptureOutput(0));
+
         Program *programObject = context->getProgram(program);
         ASSERT(programObject);
 
@@ -1605,6 +1721,8 @@ GLint GL_APIENTRY GetFragDataLocation(GLuint program, const GLchar *name)
             return -1;
         }
 
+        ANGLE_CAPTURE(GetFragDataLocation, context, program, CaptureString(name));
+
         return programObject->getFragDataLocation(name);
     }
 
@@ -1647,6 +1765,8 @@ void GL_APIENTRY Uniform1uiv(GLint location, GLsizei count, const GLuint* value)
             return;
         }
 
+        ANGLE_CAPTURE(Uniform1uiv, context, location, count, CaptureArray(value, count, sizeof(GLuint)));
+
         Program *program = context->getState().getProgram();
         program->setUniform1uiv(location, count, value);
     }
@@ -1665,6 +1785,8 @@ void GL_APIENTRY Uniform2uiv(GLint location, GLsizei count, const GLuint* value)
             return;
         }
 
+        ANGLE_CAPTURE(Uniform2uiv, context, location, count, CaptureArray(value, count, 2 * sizeof(GLuint)));
+
         Program *program = context->getState().getProgram();
         program->setUniform2uiv(location, count, value);
     }
@@ -1683,6 +1805,8 @@ void GL_APIENTRY Uniform3uiv(GLint location, GLsizei count, const GLuint* value)
             return;
         }
 
+        ANGLE_CAPTURE(Uniform3uiv, context, location, count, CaptureArray(value, count, 3 * sizeof(GLuint)));
+
         Program *program = context->getState().getProgram();
         program->setUniform3uiv(location, count, value);
     }
@@ -1701,6 +1825,8 @@ void GL_APIENTRY Uniform4uiv(GLint location, GLsizei count, const GLuint* value)
             return;
         }
 
+        ANGLE_CAPTURE(Uniform4uiv, context, location, count, CaptureArray(value, count, 4 * sizeof(GLuint)));
+
         Program *program = context->getState().getProgram();
         program->setUniform4uiv(location, count, value);
     }
@@ -1742,6 +1868,9 @@ void GL_APIENTRY ClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint* val
             return;
         }
 
+        ANGLE_CAPTURE(ClearBufferiv, context, buffer, drawbuffer,
+                      CaptureArray(value, buffer == GL_COLOR ? 4 : 1, sizeof(GLint)));
+
         Framebuffer *framebufferObject = context->getState().getDrawFramebuffer();
         ASSERT(framebufferObject);
 
@@ -1782,6 +1911,9 @@ void GL_APIENTRY ClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint* v
             return;
         }
 
+        ANGLE_CAPTURE(ClearBufferuiv, context, buffer, drawbuffer,
+                      CaptureArray(value, buffer == GL_COLOR ? 4 : 1, sizeof(GLuint)));
+
         Framebuffer *framebufferObject = context->getState().getDrawFramebuffer();
         ASSERT(framebufferObject);
 
@@ -1830,6 +1962,9 @@ void GL_APIENTRY ClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat* v
             return;
         }
 
+        ANGLE_CAPTURE(ClearBufferfv, context, buffer, drawbuffer,
+                      CaptureArray(value, buffer == GL_COLOR ? 4 : 1, sizeof(GLfloat)));
+
         Framebuffer *framebufferObject = context->getState().getDrawFramebuffer();
         ASSERT(framebufferObject);
 
@@ -1870,6 +2005,8 @@ void GL_APIENTRY ClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, G
             return;
         }
 
+        ANGLE_CAPTURE(ClearBufferfi, context, buffer, drawbuffer, depth, stencil);
+
         Framebuffer *framebufferObject = context->getState().getDrawFramebuffer();
         ASSERT(framebufferObject);
 
@@ -1907,6 +2044,8 @@ const GLubyte *GL_APIENTRY GetStringi(GLenum name, GLuint index)
             return NULL;
         }
 
+        ANGLE_CAPTURE(GetStringi, context, name, index);
+
         return reinterpret_cast<const GLubyte*>(context->getExtensionString(index).c_str());
     }
 
@@ -1963,6 +2102,8 @@ void GL_APIENTRY CopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintp
             return;
         }
 
+        ANGLE_CAPTURE(CopyBufferSubData, context, readTarget, writeTarget, readOffset, writeOffset, size);
+
         // if size is zero, the copy is a successful no-op
         if (size > 0)
         {
@@ -2012,6 +2153,10 @@ void GL_APIENTRY GetUniformIndices(GLuint program, GLsizei uniformCount, const G
             }
         }
 
+        ANGLE_CAPTURE(GetUniformIndices, context, program, uniformCount,
+                      CaptureStrings(uniformCount, uniformNames, nullptr),
+                      CaptureOutputArray(uniformCount, sizeof(GLuint)));
+
         if (!programObject->isLinked())
         {
             for (int uniformId = 0; uniformId < uniformCount; uniformId++)
@@ -2099,6 +2244,10 @@ void GL_APIENTRY GetActiveUniformsiv(GLuint program, GLsizei uniformCount, const
             }
         }
 
+        ANGLE_CAPTURE(GetActiveUniformsiv, context, program, uniformCount,
+                      CaptureArray(uniformIndices, uniformCount, sizeof(GLuint)), pname,
+                      CaptureOutputArray(uniformCount, sizeof(GLint)));
+
         for (int uniformId = 0; uniformId < uniformCount; uniformId++)
         {
             const GLuint index = uniformIndices[uniformId];
@@ -2136,6 +2285,8 @@ GLuint GL_APIENTRY GetUniformBlockIndex(GLuint program, const GLchar* uniformBlo
             }
         }
 
+        ANGLE_CAPTURE(GetUniformBlockIndex, context, program, CaptureString(uniformBlockName));
+
         return programObject->getUniformBlockIndex(uniformBlockName);
     }
 
@@ -2177,6 +2328,8 @@ void GL_APIENTRY GetActiveUniformBlockiv(GLuint program, GLuint uniformBlockInde
             return;
         }
 
+        ANGLE_CAPTURE(GetActiveUniformBlockiv, context, program, uniformBlockIndex, pname, CaptureOutput(0));
+
         switch (pname)
         {
           case GL_UNIFORM_BLOCK_BINDING:
@@ -2235,6 +2388,9 @@ void GL_APIENTRY GetActiveUniformBlockName(GLuint program, GLuint uniformBlockIn
             return;
         }
 
+        ANGLE_CAPTURE(GetActiveUniformBlockName, context, program, uniformBlockIndex, bufSize, CaptureOutput(0),
+                      CaptureOutput(bufSize));
+
         programObject->getActiveUniformBlockName(uniformBlockIndex, bufSize, length, uniformBlockName);
     }
 }
@@ -2282,6 +2438,8 @@ void GL_APIENTRY UniformBlockBinding(GLuint program, GLuint uniformBlockIndex, G
             return;
         }
 
+        ANGLE_CAPTURE(UniformBlockBinding, context, program, uniformBlockIndex, uniformBlockBinding);
+
         programObject->bindUniformBlock(uniformBlockIndex, uniformBlockBinding);
     }
 }
@@ -2305,6 +2463,9 @@ void GL_APIENTRY DrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GL
             return;
         }
 
+        ANGLE_CAPTURE_CLIENT_ARRAYS(context, static_cast<size_t>(first) + count, instanceCount);
+        ANGLE_CAPTURE(DrawArraysInstanced, context, mode, first, count, instanceCount);
+
         Error error = context->drawArrays(mode, first, count, instanceCount);
         if (error.isError())
         {
@@ -2334,6 +2495,10 @@ void GL_APIENTRY DrawElementsInstanced(GLenum mode, GLsizei count, GLenum type,
             return;
         }
 
+        ANGLE_CAPTURE_CLIENT_ARRAYS(context, static_cast<size_t>(indexRange.end) + 1, instanceCount);
+        ANGLE_CAPTURE(DrawElementsInstanced, context, mode, count, type, CaptureIndices(context, count, type, indices),
+                      instanceCount);
+
         Error error = context->drawElements(mode, count, type, indices, instanceCount, indexRange);
         if (error.isError())
         {
@@ -2379,6 +2544,9 @@ GLsync GL_APIENTRY FenceSync_(GLenum condition, GLbitfield flags)
             return NULL;
         }
 
+        // The sync object is recorded after the call, so that the replay can map it to its own
+        ANGLE_CAPTURE(FenceSync, context, condition, flags, fenceSync);
+
         return fenceSync;
     }
 
@@ -2398,6 +2566,8 @@ GLboolean GL_APIENTRY IsSync(GLsync sync)
             return GL_FALSE;
         }
 
+        ANGLE_CAPTURE(IsSync, context, sync);
+
         return (context->getFenceSync(sync) != NULL);
     }
 
@@ -2423,6 +2593,8 @@ void GL_APIENTRY DeleteSync(GLsync sync)
             return;
         }
 
+        ANGLE_CAPTURE(DeleteSync, context, sync);
+
         context->deleteFenceSync(sync);
     }
 }
@@ -2455,6 +2627,8 @@ GLenum GL_APIENTRY ClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeou
             return GL_WAIT_FAILED;
         }
 
+        ANGLE_CAPTURE(ClientWaitSync, context, sync, flags, timeout);
+
         GLenum result = GL_WAIT_FAILED;
         Error error = fenceSync->clientWait(flags, timeout, &result);
         if (error.isError())
@@ -2503,6 +2677,8 @@ void GL_APIENTRY WaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
             return;
         }
 
+        ANGLE_CAPTURE(WaitSync, context, sync, flags, timeout);
+
         Error error = fenceSync->serverWait(flags, timeout);
         if (error.isError())
         {
@@ -2532,6 +2708,8 @@ void GL_APIENTRY GetInteger64v(GLenum pname, GLint64* params)
             return;
         }
 
+        ANGLE_CAPTURE(GetInteger64v, context, pname, CaptureOutput(0));
+
         if (nativeType == GL_INT_64_ANGLEX)
         {
             context->getInteger64v(pname, params);
@@ -2571,6 +2749,9 @@ void GL_APIENTRY GetSynciv(GLsync sync, GLenum pname, GLsizei bufSize, GLsizei*
             return;
         }
 
+        ANGLE_CAPTURE(GetSynciv, context, sync, pname, bufSize, CaptureOutput(0),
+                      CaptureOutputArray(bufSize, sizeof(GLint)));
+
         switch (pname)
         {
           case GL_OBJECT_TYPE:     values[0] = static_cast<GLint>(GL_SYNC_FENCE);              break;
@@ -2637,6 +2818,8 @@ void GL_APIENTRY GetInteger64i_v(GLenum target, GLuint index, GLint64* data)
             return;
         }
 
+        ANGLE_CAPTURE(GetInteger64i_v, context, target, index, CaptureOutput(0));
+
         if (!(context->getIndexedInteger64v(target, index, data)))
         {
             GLenum nativeType;
@@ -2706,6 +2889,8 @@ void GL_APIENTRY GetBufferParameteri64v(GLenum target, GLenum pname, GLint64* pa
             return;
         }
 
+        ANGLE_CAPTURE(GetBufferParameteri64v, context, target, pname, CaptureOutput(0));
+
         switch (pname)
         {
           case GL_BUFFER_USAGE:
@@ -2750,6 +2935,8 @@ void GL_APIENTRY GenSamplers(GLsizei count, GLuint* samplers)
             return;
         }
 
+        ANGLE_CAPTURE(GenSamplers, context, count, CaptureOutputArray(count, sizeof(GLuint)));
+
         for (int i = 0; i < count; i++)
         {
             samplers[i] = context->createSampler();
@@ -2776,6 +2963,8 @@ void GL_APIENTRY DeleteSamplers(GLsizei count, const GLuint* samplers)
             return;
         }
 
+        ANGLE_CAPTURE(DeleteSamplers, context, count, CaptureArray(samplers, count, sizeof(GLuint)));
+
         for (int i = 0; i < count; i++)
         {
             context->deleteSampler(samplers[i]);
@@ -2796,6 +2985,8 @@ GLboolean GL_APIENTRY IsSampler(GLuint sampler)
             return GL_FALSE;
         }
 
+        ANGLE_CAPTURE(IsSampler, context, sampler);
+
         return context->isSampler(sampler);
     }
 
@@ -2827,6 +3018,8 @@ void GL_APIENTRY BindSampler(GLuint unit, GLuint sampler)
             return;
         }
 
+        ANGLE_CAPTURE(BindSampler, context, unit, sampler);
+
         context->bindSampler(unit, sampler);
     }
 }
@@ -2860,6 +3053,8 @@ void GL_APIENTRY SamplerParameteri(GLuint sampler, GLenum pname, GLint param)
             return;
         }
 
+        ANGLE_CAPTURE(SamplerParameteri, context, sampler, pname, param);
+
         context->samplerParameteri(sampler, pname, param);
     }
 }
@@ -2898,6 +3093,8 @@ void GL_APIENTRY SamplerParameterf(GLuint sampler, GLenum pname, GLfloat param)
             return;
         }
 
+        ANGLE_CAPTURE(SamplerParameterf, context, sampler, pname, param);
+
         context->samplerParameterf(sampler, pname, param);
     }
 }
@@ -2931,6 +3128,8 @@ void GL_APIENTRY GetSamplerParameteriv(GLuint sampler, GLenum pname, GLint* para
             return;
         }
 
+        ANGLE_CAPTURE(GetSamplerParameteriv, context, sampler, pname, CaptureOutput(0));
+
         *params = context->getSamplerParameteri(sampler, pname);
     }
 }
@@ -2959,6 +3158,8 @@ void GL_APIENTRY GetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat* pa
             return;
         }
 
+        ANGLE_CAPTURE(GetSamplerParameterfv, context, sampler, pname, CaptureOutput(0));
+
         *params = context->getSamplerParameterf(sampler, pname);
     }
 }
@@ -2982,6 +3183,8 @@ void GL_APIENTRY VertexAttribDivisor(GLuint index, GLuint divisor)
             return;
         }
 
+        ANGLE_CAPTURE(VertexAttribDivisor, context, index, divisor);
+
         context->setVertexAttribDivisor(index, divisor);
     }
 }
@@ -3018,6 +3221,8 @@ void GL_APIENTRY BindTransformFeedback(GLenum target, GLuint id)
                     return;
                 }
 
+                ANGLE_CAPTURE(BindTransformFeedback, context, target, id);
+
                 context->bindTransformFeedback(id);
             }
             break;
@@ -3042,6 +3247,8 @@ void GL_APIENTRY DeleteTransformFeedbacks(GLsizei n, const GLuint* ids)
             return;
         }
 
+        ANGLE_CAPTURE(DeleteTransformFeedbacks, context, n, CaptureArray(ids, n, sizeof(GLuint)));
+
         for (int i = 0; i < n; i++)
         {
             context->deleteTransformFeedback(ids[i]);
@@ -3062,6 +3269,8 @@ void GL_APIENTRY GenTransformFeedbacks(GLsizei n, GLuint* ids)
             return;
         }
 
+        ANGLE_CAPTURE(GenTransformFeedbacks, context, n, CaptureOutputArray(n, sizeof(GLuint)));
+
         for (int i = 0; i < n; i++)
         {
             ids[i] = context->createTransformFeedback();
@@ -3082,6 +3291,8 @@ GLboolean GL_APIENTRY IsTransformFeedback(GLuint id)
             return GL_FALSE;
         }
 
+        ANGLE_CAPTURE(IsTransformFeedback, context, id);
+
         return ((context->getTransformFeedback(id) != NULL) ? GL_TRUE : GL_FALSE);
     }
 
@@ -3111,6 +3322,8 @@ void GL_APIENTRY PauseTransformFeedback(void)
             return;
         }
 
+        ANGLE_CAPTURE(PauseTransformFeedback, context);
+
         transformFeedback->pause();
     }
 }
@@ -3138,6 +3351,8 @@ void GL_APIENTRY ResumeTransformFeedback(void)
             return;
         }
 
+        ANGLE_CAPTURE(ResumeTransformFeedback, context);
+
         transformFeedback->resume();
     }
 }
@@ -3156,6 +3371,9 @@ void GL_APIENTRY GetProgramBinary(GLuint program, GLsizei bufSize, GLsizei* leng
             return;
         }
 
+        ANGLE_CAPTURE(GetProgramBinary, context, program, bufSize, CaptureOutput(0), CaptureOutput(0),
+                      CaptureOutput(bufSize));
+
         // TODO: Pipe through to the OES extension for now, needs proper validation
         return GetProgramBinaryOES(program, bufSize, length, binaryFormat, binary);
     }
@@ -3175,6 +3393,15 @@ void GL_APIENTRY ProgramBinary(GLuint program, GLenum binaryFormat, const GLvoid
             return;
         }
 
+        const std::vector<GLenum> &programBinaryFormats = context->getCaps().programBinaryFormats;
+        if (std::find(programBinaryFormats.begin(), programBinaryFormats.end(), binaryFormat) == programBinaryFormats.end())
+        {
+            context->recordError(Error(GL_INVALID_ENUM));
+            return;
+        }
+
+        ANGLE_CAPTURE(ProgramBinary, context, program, binaryFormat, CaptureMemory(binary, length), length);
+
         // TODO: Pipe through to the OES extension for now, needs proper validation
         return ProgramBinaryOES(program, binaryFormat, binary, length);
     }
@@ -3194,6 +3421,8 @@ void GL_APIENTRY ProgramParameteri(GLuint program, GLenum pname, GLint value)
             return;
         }
 
+        ANGLE_CAPTURE(ProgramParameteri, context, program, pname, value);
+
         // glProgramParameteri
         UNIMPLEMENTED();
     }
@@ -3212,6 +3441,9 @@ void GL_APIENTRY InvalidateFramebuffer(GLenum target, GLsizei numAttachments, co
             return;
         }
 
+        ANGLE_CAPTURE(InvalidateFramebuffer, context, target, numAttachments,
+                      CaptureArray(attachments, numAttachments, sizeof(GLenum)));
+
         Framebuffer *framebuffer = context->getState().getTargetFramebuffer(target);
         ASSERT(framebuffer);
 
@@ -3241,6 +3473,9 @@ void GL_APIENTRY InvalidateSubFramebuffer(GLenum target, GLsizei numAttachments,
             return;
         }
 
+        ANGLE_CAPTURE(InvalidateSubFramebuffer, context, target, numAttachments,
+                      CaptureArray(attachments, numAttachments, sizeof(GLenum)), x, y, width, height);
+
         Framebuffer *framebuffer = context->getState().getTargetFramebuffer(target);
         ASSERT(framebuffer);
 
@@ -3276,6 +3511,8 @@ void GL_APIENTRY TexStorage2D(GLenum target, GLsizei levels, GLenum internalform
             return;
         }
 
+        ANGLE_CAPTURE(TexStorage2D, context, target, levels, internalformat, width, height);
+
         Extents size(width, height, 1);
         Texture *texture = context->getTargetTexture(target);
         Error error = texture->setStorage(target, levels, internalformat, size);
@@ -3307,6 +3544,8 @@ void GL_APIENTRY TexStorage3D(GLenum target, GLsizei levels, GLenum internalform
             return;
         }
 
+        ANGLE_CAPTURE(TexStorage3D, context, target, levels, internalformat, width, height, depth);
+
         Extents size(width, height, depth);
         Texture *texture = context->getTargetTexture(target);
         Error error = texture->setStorage(target, levels, internalformat, size);
@@ -3352,6 +3591,9 @@ void GL_APIENTRY GetInternalformativ(GLenum target, GLenum internalformat, GLenu
             return;
         }
 
+        ANGLE_CAPTURE(GetInternalformativ, context, target, internalformat, pname, bufSize,
+                      CaptureOutputArray(bufSize, sizeof(GLint)));
+
         switch (pname)
         {
           case GL_NUM_SAMPLE_COUNTS:
@@ -155,6 +155,48 @@ TEST_P(UniformTest, UniformArrayLocations)
     glDeleteProgram(program);
 }
 
+// Tests the different ways of naming array elements and struct members
+TEST_P(UniformTest, UniformArrayElementNames)
+{
+    const std::string vertexShader = SHADER_SOURCE
+    (
+        precision mediump float;
+        struct S { float f; vec2 g[2]; };
+        uniform S uStruct[2];
+        uniform float uArray[3];
+        void main(void)
+        {
+            gl_Position = vec4(uStruct[1].f + uStruct[1].g[1].x + uArray[2]);
+        }
+    );
+
+    const std::string fragShader = SHADER_SOURCE
+    (
+        precision mediump float;
+        void main(void)
+        {
+            gl_FragColor = vec4(1.0);
+        }
+    );
+
+    GLuint program = CompileProgram(vertexShader, fragShader);
+    ASSERT_NE(program, 0u);
+
+    EXPECT_NE(-1, glGetUniformLocation(program, "uArray[2]"));
+    EXPECT_EQ(glGetUniformLocation(program, "uArray[1]"), glGetUniformLocation(program, "uArray[01]"));
+    EXPECT_EQ(-1, glGetUniformLocation(program, "uArray[3]"));
+    EXPECT_EQ(-1, glGetUniformLocation(program, "uArray[2"));
+
+    EXPECT_NE(-1, glGetUniformLocation(program, "uStruct[1].f"));
+    EXPECT_NE(-1, glGetUniformLocation(program, "uStruct[1].g[1]"));
+    EXPECT_EQ(glGetUniformLocation(program, "uStruct[1].g"), glGetUniformLocation(program, "uStruct[1].g[0]"));
+    EXPECT_EQ(-1, glGetUniformLocation(program, "uStruct[1].f[0]"));
+    EXPECT_EQ(-1, glGetUniformLocation(program, "uStruct[1]"));
+    EXPECT_EQ(-1, glGetUniformLocation(program, "uStruct"));
+
+    glDeleteProgram(program);
+}
+
 // Use this to select which configurations (e.g. which renderer, which GLES major version) these tests should be run against.
 ANGLE_INSTANTIATE_TEST(UniformTest, ES2_D3D9(), ES2_D3D11(), ES2_OPENGL());
 
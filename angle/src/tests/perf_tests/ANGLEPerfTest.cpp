@@ -74,6 +74,7 @@ std::string RenderTestParams::suffix() const
     {
         case EGL_PLATFORM_ANGLE_TYPE_D3D11_ANGLE: return "_d3d11";
         case EGL_PLATFORM_ANGLE_TYPE_D3D9_ANGLE: return "_d3d9";
+        case EGL_PLATFORM_ANGLE_TYPE_NULL_ANGLE: return "_null";
         default: assert(0); return "_unk";
     }
 }
@@ -0,0 +1,174 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// BindingPerf:
+//   Performance test for binding many objects, which is dominated by looking up handles.
+//
+
+#include <sstream>
+
+#include "ANGLEPerfTest.h"
+
+namespace
+{
+
+struct BindingPerfParams final : public RenderTestParams
+{
+    std::string suffix() const override
+    {
+        std::stringstream strstr;
+
+        strstr << RenderTestParams::suffix();
+        strstr << "_" << numObjects << "_objects";
+
+        if (sparseNames)
+        {
+            strstr << "_sparse_names";
+        }
+
+        return strstr.str();
+    }
+
+    unsigned int iterations;
+    unsigned int numObjects;
+
+    // Use application-chosen names spread over the whole handle range instead of generated ones
+    bool sparseNames;
+};
+
+class BindingPerfBenchmark : public ANGLERenderTest,
+                             public ::testing::WithParamInterface<BindingPerfParams>
+{
+  public:
+    BindingPerfBenchmark();
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    std::vector<GLuint> mBuffers;
+    std::vector<GLuint> mTextures;
+    std::vector<GLuint> mFramebuffers;
+};
+
+BindingPerfBenchmark::BindingPerfBenchmark()
+    : ANGLERenderTest("BindingPerf", GetParam())
+{
+    mRunTimeSeconds = 5.0;
+}
+
+void BindingPerfBenchmark::initializeBenchmark()
+{
+    const auto &params = GetParam();
+
+    ASSERT_TRUE(params.iterations > 0);
+    mDrawIterations = params.iterations;
+
+    mBuffers.resize(params.numObjects);
+    mTextures.resize(params.numObjects);
+    mFramebuffers.resize(params.numObjects);
+
+    if (params.sparseNames)
+    {
+        for (unsigned int objectIndex = 0; objectIndex < params.numObjects; ++objectIndex)
+        {
+            GLuint name = (objectIndex + 1) * 104729u;
+            mBuffers[objectIndex] = name;
+            mTextures[objectIndex] = name;
+            mFramebuffers[objectIndex] = name;
+        }
+    }
+    else
+    {
+        glGenBuffers(params.numObjects, &mBuffers[0]);
+        glGenTextures(params.numObjects, &mTextures[0]);
+        glGenFramebuffers(params.numObjects, &mFramebuffers[0]);
+    }
+
+    // The first bind creates the objects
+    for (unsigned int objectIndex = 0; objectIndex < params.numObjects; ++objectIndex)
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, mBuffers[objectIndex]);
+        glBindTexture(GL_TEXTURE_2D, mTextures[objectIndex]);
+        glBindFramebuffer(GL_FRAMEBUFFER, mFramebuffers[objectIndex]);
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    ASSERT_GL_NO_ERROR();
+}
+
+void BindingPerfBenchmark::destroyBenchmark()
+{
+    const auto &params = GetParam();
+
+    glDeleteBuffers(params.numObjects, &mBuffers[0]);
+    glDeleteTextures(params.numObjects, &mTextures[0]);
+    glDeleteFramebuffers(params.numObjects, &mFramebuffers[0]);
+}
+
+void BindingPerfBenchmark::drawBenchmark()
+{
+    const auto &params = GetParam();
+
+    for (unsigned int it = 0; it < params.iterations; it++)
+    {
+        // Visit the objects out of order so that the lookups don't just walk memory
+        unsigned int objectIndex = (it * 7919u) % params.numObjects;
+
+        glBindBuffer(GL_ARRAY_BUFFER, mBuffers[objectIndex]);
+        glBindTexture(GL_TEXTURE_2D, mTextures[objectIndex]);
+        glBindFramebuffer(GL_FRAMEBUFFER, mFramebuffers[objectIndex]);
+        glIsBuffer(mBuffers[objectIndex]);
+        glIsTexture(mTextures[objectIndex]);
+    }
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    ASSERT_GL_NO_ERROR();
+}
+
+BindingPerfParams BindingPerfD3D11Params(unsigned int numObjects, bool sparseNames)
+{
+    BindingPerfParams params;
+    params.glesMajorVersion = 2;
+    params.widowWidth = 256;
+    params.windowHeight = 256;
+    params.requestedRenderer = EGL_PLATFORM_ANGLE_TYPE_D3D11_ANGLE;
+    params.deviceType = EGL_PLATFORM_ANGLE_DEVICE_TYPE_NULL_ANGLE;
+    params.iterations = 1000;
+    params.numObjects = numObjects;
+    params.sparseNames = sparseNames;
+    return params;
+}
+
+BindingPerfParams BindingPerfNullParams(unsigned int numObjects, bool sparseNames)
+{
+    BindingPerfParams params = BindingPerfD3D11Params(numObjects, sparseNames);
+    params.requestedRenderer = EGL_PLATFORM_ANGLE_TYPE_NULL_ANGLE;
+    params.deviceType = EGL_PLATFORM_ANGLE_DEVICE_TYPE_HARDWARE_ANGLE;
+    return params;
+}
+
+TEST_P(BindingPerfBenchmark, Run)
+{
+    run();
+}
+
+const BindingPerfParams BindingPerfAllParams[] =
+{
+#if defined(ANGLE_PLATFORM_WINDOWS)
+    BindingPerfD3D11Params(1000, false),
+#endif
+    BindingPerfNullParams(100, false),
+    BindingPerfNullParams(10000, false),
+    BindingPerfNullParams(10000, true),
+};
+
+INSTANTIATE_TEST_CASE_P(BindingPerf,
+                        BindingPerfBenchmark,
+                        ::testing::ValuesIn(BindingPerfAllParams));
+
+} // namespace
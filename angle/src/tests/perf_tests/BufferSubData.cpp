@@ -315,6 +315,7 @@ void BufferSubDataBenchmark::drawBenchmark()
     ASSERT_GL_NO_ERROR();
 }
 
+#if defined(ANGLE_PLATFORM_WINDOWS)
 BufferSubDataParams BufferUpdateD3D11Params()
 {
     BufferSubDataParams params;
@@ -351,13 +352,42 @@ BufferSubDataParams BufferUpdateD3D9Params()
     return params;
 }
 
+#endif // defined(ANGLE_PLATFORM_WINDOWS)
+
+BufferSubDataParams BufferUpdateNullParams()
+{
+    BufferSubDataParams params;
+    params.glesMajorVersion = 2;
+    params.widowWidth = 512;
+    params.windowHeight = 512;
+    params.requestedRenderer = EGL_PLATFORM_ANGLE_TYPE_NULL_ANGLE;
+    params.deviceType = EGL_PLATFORM_ANGLE_DEVICE_TYPE_HARDWARE_ANGLE;
+    params.vertexType = GL_FLOAT;
+    params.vertexComponentCount = 4;
+    params.vertexNormalized = GL_FALSE;
+    params.updateSize = 3000;
+    params.bufferSize = 40000000;
+    params.iterations = 2;
+    params.updateRate = 1;
+    return params;
+}
+
 TEST_P(BufferSubDataBenchmark, Run)
 {
     run();
 }
 
+const BufferSubDataParams BufferUpdateParams[] =
+{
+#if defined(ANGLE_PLATFORM_WINDOWS)
+    BufferUpdateD3D11Params(),
+    BufferUpdateD3D9Params(),
+#endif
+    BufferUpdateNullParams(),
+};
+
 INSTANTIATE_TEST_CASE_P(BufferUpdates,
                         BufferSubDataBenchmark,
-                        ::testing::Values(BufferUpdateD3D11Params(), BufferUpdateD3D9Params()));
+                        ::testing::ValuesIn(BufferUpdateParams));
 
 } // namespace
@@ -0,0 +1,550 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// CompilerPerf:
+//   Performance tests for the shader translator. Runs a small corpus of
+//   representative shaders through each output type and option set.
+//
+
+#include <algorithm>
+#include <sstream>
+
+#include "ANGLEPerfTest.h"
+
+#include "angle_gl.h"
+#include "GLSLANG/ShaderLang.h"
+#include "compiler/translator/Compiler.h"
+
+namespace
+{
+
+struct CorpusShader
+{
+    const char *name;
+    sh::GLenum type;
+    int version;
+    const char *source;
+};
+
+const CorpusShader kSmallShader =
+{
+    "small",
+    GL_FRAGMENT_SHADER,
+    100,
+    "precision mediump float;\n"
+    "uniform sampler2D uTexture;\n"
+    "uniform vec4 uTint;\n"
+    "varying vec2 vTexCoord;\n"
+    "void main()\n"
+    "{\n"
+    "    gl_FragColor = texture2D(uTexture, vTexCoord) * uTint;\n"
+    "}\n"
+};
+
+const CorpusShader kLoopShader =
+{
+    "loops",
+    GL_FRAGMENT_SHADER,
+    100,
+    "precision highp float;\n"
+    "uniform sampler2D uTexture;\n"
+    "uniform vec2 uTexelSize;\n"
+    "uniform float uWeights[16];\n"
+    "varying vec2 vTexCoord;\n"
+    "vec4 blurPass(vec2 dir)\n"
+    "{\n"
+    "    vec4 sum = vec4(0.0);\n"
+    "    for (int i = 0; i < 16; ++i)\n"
+    "    {\n"
+    "        vec2 offset = dir * uTexelSize * float(i - 8);\n"
+    "        sum += texture2D(uTexture, vTexCoord + offset) * uWeights[i];\n"
+    "    }\n"
+    "    return sum;\n"
+    "}\n"
+    "float noise(vec2 p)\n"
+    "{\n"
+    "    float n = 0.0;\n"
+    "    for (int octave = 0; octave < 6; ++octave)\n"
+    "    {\n"
+    "        float scale = exp2(float(octave));\n"
+    "        for (int j = 0; j < 4; ++j)\n"
+    "        {\n"
+    "            n += sin(dot(p * scale, vec2(12.9898, 78.233) + float(j))) / scale;\n"
+    "            if (n > 4.0) break;\n"
+    "        }\n"
+    "    }\n"
+    "    return fract(n);\n"
+    "}\n"
+    "void main()\n"
+    "{\n"
+    "    vec4 color = blurPass(vec2(1.0, 0.0)) + blurPass(vec2(0.0, 1.0));\n"
+    "    for (int k = 0; k < 8; ++k)\n"
+    "    {\n"
+    "        color.rgb += vec3(noise(vTexCoord + float(k))) * 0.01;\n"
+    "        if (color.a > 1.0) continue;\n"
+    "        color.a = color.a * 0.5 + (k > 4 && color.r < 0.5 ? 0.1 : 0.0);\n"
+    "    }\n"
+    "    gl_FragColor = color;\n"
+    "}\n"
+};
+
+const CorpusShader kStructShader =
+{
+    "structs",
+    GL_VERTEX_SHADER,
+    100,
+    "struct Light\n"
+    "{\n"
+    "    vec3 position;\n"
+    "    vec3 color;\n"
+    "    float attenuation;\n"
+    "};\n"
+    "struct Material\n"
+    "{\n"
+    "    vec3 ambient;\n"
+    "    vec3 diffuse;\n"
+    "    vec3 specular;\n"
+    "    float shininess;\n"
+    "};\n"
+    "struct Surface\n"
+    "{\n"
+    "    vec3 position;\n"
+    "    vec3 normal;\n"
+    "    Material material;\n"
+    "};\n"
+    "uniform Light uLights[4];\n"
+    "uniform Material uMaterial;\n"
+    "uniform mat4 uModelViewProjection;\n"
+    "uniform mat3 uNormalMatrix;\n"
+    "attribute vec3 aPosition;\n"
+    "attribute vec3 aNormal;\n"
+    "varying vec3 vColor;\n"
+    "Surface makeSurface(vec3 position, vec3 normal)\n"
+    "{\n"
+    "    Surface surface = Surface(position, normalize(uNormalMatrix * normal), uMaterial);\n"
+    "    return surface;\n"
+    "}\n"
+    "vec3 shade(Surface surface, Light light)\n"
+    "{\n"
+    "    vec3 toLight = light.position - surface.position;\n"
+    "    float falloff = 1.0 / (1.0 + light.attenuation * dot(toLight, toLight));\n"
+    "    float diffuse = max(dot(surface.normal, normalize(toLight)), 0.0);\n"
+    "    float specular = pow(diffuse, surface.material.shininess);\n"
+    "    return falloff * light.color *\n"
+    "        (surface.material.diffuse * diffuse + surface.material.specular * specular);\n"
+    "}\n"
+    "void main()\n"
+    "{\n"
+    "    Surface surface = makeSurface(aPosition, aNormal);\n"
+    "    vec3 color = surface.material.ambient;\n"
+    "    color += shade(surface, uLights[0]);\n"
+    "    color += shade(surface, uLights[1]);\n"
+    "    color += shade(surface, uLights[2]);\n"
+    "    color += shade(surface, uLights[3]);\n"
+    "    vColor = color;\n"
+    "    gl_Position = uModelViewProjection * vec4(aPosition, 1.0);\n"
+    "}\n"
+};
+
+const CorpusShader kUniformBlockShader =
+{
+    "uniform_blocks",
+    GL_VERTEX_SHADER,
+    300,
+    "#version 300 es\n"
+    "layout(std140) uniform Camera\n"
+    "{\n"
+    "    mat4 view;\n"
+    "    mat4 projection;\n"
+    "    vec4 eyePosition;\n"
+    "};\n"
+    "struct Bone\n"
+    "{\n"
+    "    mat4 transform;\n"
+    "    vec4 scale;\n"
+    "};\n"
+    "layout(std140) uniform Skeleton\n"
+    "{\n"
+    "    Bone bones[32];\n"
+    "} skeleton;\n"
+    "layout(shared) uniform Instance\n"
+    "{\n"
+    "    mat4 model;\n"
+    "    vec4 tint;\n"
+    "    ivec4 flags;\n"
+    "} instances[4];\n"
+    "layout(std140, row_major) uniform Shadows\n"
+    "{\n"
+    "    mat4 cascades[4];\n"
+    "    vec4 splits;\n"
+    "};\n"
+    "in vec3 aPosition;\n"
+    "in vec4 aWeights;\n"
+    "out vec4 vColor;\n"
+    "out vec4 vShadowCoord;\n"
+    "void main()\n"
+    "{\n"
+    "    mat4 skin = mat4(0.0);\n"
+    "    for (int i = 0; i < 4; ++i)\n"
+    "    {\n"
+    "        skin += skeleton.bones[i].transform * skeleton.bones[i].scale.x * aWeights[i];\n"
+    "    }\n"
+    "    vec4 world = instances[1].model * skin * vec4(aPosition, 1.0);\n"
+    "    vColor = instances[0].tint * float(instances[2].flags.x) + instances[3].tint;\n"
+    "    vShadowCoord = cascades[0] * world + splits;\n"
+    "    gl_Position = projection * view * world + eyePosition * 0.0;\n"
+    "}\n"
+};
+
+const CorpusShader kMacroShader =
+{
+    "macros",
+    GL_FRAGMENT_SHADER,
+    100,
+    "#define SAMPLE_COUNT 4\n"
+    "#define SATURATE(x) clamp(x, 0.0, 1.0)\n"
+    "#define LUMA(c) dot((c).rgb, vec3(0.299, 0.587, 0.114))\n"
+    "#define MIX3(a, b, c, t) mix(mix(a, b, SATURATE(t)), c, SATURATE((t) - 1.0))\n"
+    "#define TAP(offset) texture2D(uTexture, vTexCoord + (offset) * uTexelSize)\n"
+    "#define WEIGHTED_TAP(x, y, w) (TAP(vec2(x, y)) * (w))\n"
+    "#define ROW(y) (WEIGHTED_TAP(-1.0, y, 0.25) + WEIGHTED_TAP(0.0, y, 0.5) + WEIGHTED_TAP(1.0, y, 0.25))\n"
+    "#define KERNEL (ROW(-1.0) * 0.25 + ROW(0.0) * 0.5 + ROW(1.0) * 0.25)\n"
+    "#if defined(GL_FRAGMENT_PRECISION_HIGH) && SAMPLE_COUNT > 2\n"
+    "precision highp float;\n"
+    "#else\n"
+    "precision mediump float;\n"
+    "#endif\n"
+    "uniform sampler2D uTexture;\n"
+    "uniform vec2 uTexelSize;\n"
+    "uniform vec3 uShadows;\n"
+    "uniform vec3 uHighlights;\n"
+    "varying vec2 vTexCoord;\n"
+    "#define GRADE(c) MIX3(uShadows, (c).rgb, uHighlights, LUMA(c) * 2.0)\n"
+    "void main()\n"
+    "{\n"
+    "    vec4 blurred = KERNEL;\n"
+    "    vec4 sharp = TAP(vec2(0.0));\n"
+    "#if SAMPLE_COUNT == 4\n"
+    "    vec3 graded = GRADE(blurred) + GRADE(sharp) + GRADE(blurred * sharp) + GRADE(sharp - blurred);\n"
+    "#else\n"
+    "    vec3 graded = GRADE(blurred);\n"
+    "#endif\n"
+    "    gl_FragColor = vec4(SATURATE(graded / float(SAMPLE_COUNT)), LUMA(sharp));\n"
+    "}\n"
+};
+
+const CorpusShader *const kCorpus[] =
+{
+    &kSmallShader,
+    &kLoopShader,
+    &kStructShader,
+    &kUniformBlockShader,
+    &kMacroShader,
+};
+
+struct CompilerPerfParams final
+{
+    std::string suffix() const;
+
+    ShShaderOutput output;
+    bool webGL;
+    int compileOptions;
+    const char *optionsName;
+};
+
+std::ostream &operator<<(std::ostream &os, const CompilerPerfParams &params)
+{
+    os << params.suffix().substr(1);
+    return os;
+}
+
+std::string CompilerPerfParams::suffix() const
+{
+    std::stringstream strstr;
+
+    switch (output)
+    {
+      case SH_ESSL_OUTPUT: strstr << "_essl"; break;
+      case SH_GLSL_COMPATIBILITY_OUTPUT: strstr << "_glsl"; break;
+      case SH_GLSL_130_OUTPUT: strstr << "_glsl130"; break;
+      case SH_GLSL_410_CORE_OUTPUT: strstr << "_glsl410"; break;
+      case SH_GLSL_420_CORE_OUTPUT: strstr << "_glsl420"; break;
+      case SH_HLSL9_OUTPUT: strstr << "_hlsl9"; break;
+      case SH_HLSL11_OUTPUT: strstr << "_hlsl11"; break;
+      default: strstr << "_unk_" << output; break;
+    }
+
+    strstr << "_" << optionsName;
+
+    return strstr.str();
+}
+
+class CompilerPerfTest : public ANGLEPerfTest,
+                         public ::testing::WithParamInterface<CompilerPerfParams>
+{
+  public:
+    CompilerPerfTest();
+
+    void step(float dt, double totalTime) override;
+
+  protected:
+    void SetUp() override;
+    void TearDown() override;
+
+  private:
+    bool compileCorpus(int compileOptions);
+    bool compileShader(size_t corpusIndex, int compileOptions);
+
+    // Microseconds per shader for the given options, averaged over a fixed number of passes.
+    double measureCompileTime(int compileOptions);
+
+    std::vector<const CorpusShader *> mCorpus;
+    std::vector<ShHandle> mCompilers;
+    std::vector<double> mCorpusTimes;
+    Timer *mPhaseTimer;
+    double mRunTimeSeconds;
+    size_t mNumCompiledShaders;
+    size_t mPeakPoolBytes;
+};
+
+CompilerPerfTest::CompilerPerfTest()
+    : ANGLEPerfTest("CompilerPerf", GetParam().suffix()),
+      mPhaseTimer(nullptr),
+      mRunTimeSeconds(3.0),
+      mNumCompiledShaders(0),
+      mPeakPoolBytes(0)
+{
+    mPhaseTimer = CreateTimer();
+}
+
+void CompilerPerfTest::SetUp()
+{
+    const CompilerPerfParams &params = GetParam();
+
+    ASSERT_TRUE(ShInitialize());
+
+    ShBuiltInResources resources;
+    ShInitBuiltInResources(&resources);
+    resources.FragmentPrecisionHigh = 1;
+    resources.MaxDrawBuffers = 4;
+    resources.OES_standard_derivatives = 1;
+    resources.MaxExpressionComplexity = 256;
+    resources.MaxCallStackDepth = 16;
+
+    for (const CorpusShader *shader : kCorpus)
+    {
+        // D3D9 has no ES3 support, so it never sees ES3 shaders.
+        if (shader->version == 300 && params.output == SH_HLSL9_OUTPUT)
+        {
+            continue;
+        }
+
+        ShShaderSpec spec = SH_GLES2_SPEC;
+        if (shader->version == 300)
+        {
+            spec = params.webGL ? SH_WEBGL2_SPEC : SH_GLES3_SPEC;
+        }
+        else if (params.webGL)
+        {
+            spec = SH_WEBGL_SPEC;
+        }
+
+        ShHandle compiler = ShConstructCompiler(shader->type, spec, params.output, &resources);
+        ASSERT_TRUE(compiler != nullptr);
+
+        mCorpus.push_back(shader);
+        mCompilers.push_back(compiler);
+    }
+
+    mCorpusTimes.resize(mCorpus.size(), 0.0);
+
+    // Validate the corpus once up front so that a broken shader fails loudly instead of
+    // producing a misleadingly fast score.
+    for (size_t corpusIndex = 0; corpusIndex < mCorpus.size(); ++corpusIndex)
+    {
+        ASSERT_TRUE(compileShader(corpusIndex, params.compileOptions))
+            << mCorpus[corpusIndex]->name << ": " << ShGetInfoLog(mCompilers[corpusIndex]);
+    }
+
+    ANGLEPerfTest::SetUp();
+}
+
+void CompilerPerfTest::TearDown()
+{
+    const CompilerPerfParams &params = GetParam();
+
+    double elapsedTime = mTimer->getElapsedTime();
+    if (elapsedTime > 0.0)
+    {
+        printResult("shaders_per_second", static_cast<double>(mNumCompiledShaders) / elapsedTime,
+                    "shaders/s", true);
+    }
+    printResult("peak_pool_memory", mPeakPoolBytes, "bytes", false);
+
+    // Break the translation down by phase: the front end (parsing and AST validation) runs
+    // for every compile, variable collection only with SH_VARIABLES and code generation only
+    // with SH_OBJECT_CODE. Each phase is the difference to the previous cumulative timing.
+    int frontEndOptions = params.compileOptions & ~(SH_VARIABLES | SH_OBJECT_CODE | SH_INTERMEDIATE_TREE);
+    int variablesOptions = frontEndOptions | (params.compileOptions & SH_VARIABLES);
+
+    double frontEndTime = measureCompileTime(frontEndOptions);
+    double variablesTime = measureCompileTime(variablesOptions);
+    double fullTime = measureCompileTime(params.compileOptions);
+
+    printResult("phase_frontend", frontEndTime, "us", false);
+    printResult("phase_variables", std::max(variablesTime - frontEndTime, 0.0), "us", false);
+    printResult("phase_output", std::max(fullTime - variablesTime, 0.0), "us", false);
+
+    for (size_t corpusIndex = 0; corpusIndex < mCorpus.size(); ++corpusIndex)
+    {
+        printResult(std::string("corpus_") + mCorpus[corpusIndex]->name, mCorpusTimes[corpusIndex],
+                    "us", false);
+    }
+
+    for (ShHandle compiler : mCompilers)
+    {
+        ShDestruct(compiler);
+    }
+    mCompilers.clear();
+    mCorpus.clear();
+
+    SafeDelete(mPhaseTimer);
+    ShFinalize();
+
+    ANGLEPerfTest::TearDown();
+}
+
+bool CompilerPerfTest::compileShader(size_t corpusIndex, int compileOptions)
+{
+    const char *shaderStrings[] = { mCorpus[corpusIndex]->source };
+    ShHandle compiler = mCompilers[corpusIndex];
+
+    bool result = ShCompile(compiler, shaderStrings, 1, compileOptions);
+
+    TShHandleBase *base = static_cast<TShHandleBase *>(compiler);
+    mPeakPoolBytes = std::max(mPeakPoolBytes, base->getAllocator().getPeakBytesInUse());
+
+    return result;
+}
+
+bool CompilerPerfTest::compileCorpus(int compileOptions)
+{
+    bool result = true;
+    for (size_t corpusIndex = 0; corpusIndex < mCorpus.size(); ++corpusIndex)
+    {
+        result = compileShader(corpusIndex, compileOptions) && result;
+    }
+    mNumCompiledShaders += mCorpus.size();
+    return result;
+}
+
+double CompilerPerfTest::measureCompileTime(int compileOptions)
+{
+    const unsigned int kPasses = 20;
+
+    std::vector<double> corpusTimes(mCorpus.size(), 0.0);
+    double totalTime = 0.0;
+
+    for (unsigned int pass = 0; pass < kPasses; ++pass)
+    {
+        for (size_t corpusIndex = 0; corpusIndex < mCorpus.size(); ++corpusIndex)
+        {
+            mPhaseTimer->start();
+            compileShader(corpusIndex, compileOptions);
+            mPhaseTimer->stop();
+
+            double time = mPhaseTimer->getElapsedTime();
+            corpusTimes[corpusIndex] += time;
+            totalTime += time;
+        }
+    }
+
+    // Keep the per-shader breakdown of the last (full) measurement.
+    for (size_t corpusIndex = 0; corpusIndex < mCorpus.size(); ++corpusIndex)
+    {
+        mCorpusTimes[corpusIndex] = corpusTimes[corpusIndex] * 1000000.0 / kPasses;
+    }
+
+    return totalTime * 1000000.0 / (kPasses * mCorpus.size());
+}
+
+void CompilerPerfTest::step(float dt, double totalTime)
+{
+    EXPECT_TRUE(compileCorpus(GetParam().compileOptions));
+
+    if (mTimer->getElapsedTime() >= mRunTimeSeconds)
+    {
+        mRunning = false;
+    }
+}
+
+const int kDefaultOptions = SH_OBJECT_CODE | SH_VARIABLES;
+
+// The workarounds the GL and D3D back ends enable for buggy drivers.
+const int kWorkaroundOptions = kDefaultOptions |
+                               SH_EMULATE_BUILT_IN_FUNCTIONS |
+                               SH_CLAMP_INDIRECT_ARRAY_BOUNDS |
+                               SH_INIT_GL_POSITION |
+                               SH_UNFOLD_SHORT_CIRCUIT |
+                               SH_SCALARIZE_VEC_AND_MAT_CONSTRUCTOR_ARGS |
+                               SH_REGENERATE_STRUCT_NAMES;
+
+// The validation a browser enables for WebGL content.
+const int kWebGLOptions = kDefaultOptions |
+                          SH_ENFORCE_PACKING_RESTRICTIONS |
+                          SH_CLAMP_INDIRECT_ARRAY_BOUNDS |
+                          SH_LIMIT_EXPRESSION_COMPLEXITY |
+                          SH_LIMIT_CALL_STACK_DEPTH |
+                          SH_INIT_VARYINGS_WITHOUT_STATIC_USE;
+
+CompilerPerfParams CompilerParams(ShShaderOutput output, int compileOptions, const char *optionsName)
+{
+    CompilerPerfParams params;
+    params.output = output;
+    params.webGL = (compileOptions == kWebGLOptions);
+    params.compileOptions = compileOptions;
+    params.optionsName = optionsName;
+    return params;
+}
+
+CompilerPerfParams DefaultParams(ShShaderOutput output)
+{
+    return CompilerParams(output, kDefaultOptions, "default");
+}
+
+CompilerPerfParams WorkaroundParams(ShShaderOutput output)
+{
+    return CompilerParams(output, kWorkaroundOptions, "workarounds");
+}
+
+CompilerPerfParams WebGLParams(ShShaderOutput output)
+{
+    return CompilerParams(output, kWebGLOptions, "webgl");
+}
+
+TEST_P(CompilerPerfTest, Run)
+{
+    run();
+}
+
+INSTANTIATE_TEST_CASE_P(CompilerPerf,
+                        CompilerPerfTest,
+                        ::testing::Values(DefaultParams(SH_ESSL_OUTPUT),
+                                          WebGLParams(SH_ESSL_OUTPUT),
+                                          DefaultParams(SH_GLSL_COMPATIBILITY_OUTPUT),
+                                          WorkaroundParams(SH_GLSL_COMPATIBILITY_OUTPUT),
+                                          WebGLParams(SH_GLSL_COMPATIBILITY_OUTPUT),
+                                          DefaultParams(SH_GLSL_410_CORE_OUTPUT),
+                                          WorkaroundParams(SH_GLSL_410_CORE_OUTPUT)
+#if defined(ANGLE_ENABLE_HLSL)
+                                          , DefaultParams(SH_HLSL9_OUTPUT),
+                                          WorkaroundParams(SH_HLSL9_OUTPUT),
+                                          DefaultParams(SH_HLSL11_OUTPUT),
+                                          WorkaroundParams(SH_HLSL11_OUTPUT),
+                                          WebGLParams(SH_HLSL11_OUTPUT)
+#endif // defined(ANGLE_ENABLE_HLSL)
+                                          ));
+
+} // namespace
@@ -0,0 +1,118 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ConvertIndicesPerf:
+//   Performance test for the D3D index conversion functions, which copy or widen the indices and
+//   compute their range in the same pass. It calls them directly, without a device.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <iostream>
+#include <vector>
+
+#include "libANGLE/formatutils.h"
+#include "libANGLE/renderer/d3d/indexconversion.h"
+
+namespace
+{
+
+typedef void (*ConvertIndicesFunction)(GLenum sourceType, GLenum destinationType, const void *input, size_t count,
+                                       void *output, bool primitiveRestart, gl::RangeUI *outRange);
+
+struct ConvertIndicesParams
+{
+    const char *suffix;
+    ConvertIndicesFunction convertFunction;
+    bool usesSSE2;
+    GLenum sourceType;
+    GLenum destinationType;
+    bool primitiveRestart;
+};
+
+class ConvertIndicesPerfTest : public ANGLEPerfTest,
+                               public ::testing::WithParamInterface<ConvertIndicesParams>
+{
+  public:
+    ConvertIndicesPerfTest();
+
+    void step(float dt, double totalTime) override;
+
+  private:
+    size_t mIndexCount;
+    std::vector<uint8_t> mInput;
+    std::vector<uint8_t> mOutput;
+};
+
+ConvertIndicesPerfTest::ConvertIndicesPerfTest()
+    : ANGLEPerfTest("ConvertIndices", GetParam().suffix),
+      mIndexCount(1 << 20),
+      mInput(mIndexCount * gl::GetTypeInfo(GetParam().sourceType).bytes),
+      mOutput(mIndexCount * gl::GetTypeInfo(GetParam().destinationType).bytes)
+{
+    for (size_t i = 0; i < mInput.size(); i++)
+    {
+        // Every 64th byte is all ones, so that some indices are restart indices
+        mInput[i] = (i % 64 == 63) ? 0xFF : static_cast<uint8_t>((i * 7) % 251);
+    }
+}
+
+void ConvertIndicesPerfTest::step(float dt, double totalTime)
+{
+    const auto &params = GetParam();
+
+    if (params.usesSSE2 && !gl::supportsSSE2())
+    {
+        std::cout << "Test skipped because SSE2 is not available." << std::endl;
+        mRunning = false;
+        return;
+    }
+
+    for (unsigned int iteration = 0; iteration < 10; ++iteration)
+    {
+        gl::RangeUI range;
+        params.convertFunction(params.sourceType, params.destinationType, &mInput[0], mIndexCount,
+                               &mOutput[0], params.primitiveRestart, &range);
+    }
+
+    if (mTimer->getElapsedTime() >= 5.0)
+    {
+        mRunning = false;
+    }
+}
+
+TEST_P(ConvertIndicesPerfTest, Run)
+{
+    run();
+}
+
+ConvertIndicesParams MakeParams(const char *suffix, ConvertIndicesFunction convertFunction, bool usesSSE2,
+                                GLenum sourceType, GLenum destinationType, bool primitiveRestart)
+{
+    ConvertIndicesParams params;
+    params.suffix = suffix;
+    params.convertFunction = convertFunction;
+    params.usesSSE2 = usesSSE2;
+    params.sourceType = sourceType;
+    params.destinationType = destinationType;
+    params.primitiveRestart = primitiveRestart;
+    return params;
+}
+
+INSTANTIATE_TEST_CASE_P(ConvertIndices,
+                        ConvertIndicesPerfTest,
+                        ::testing::Values(
+    MakeParams("_ubyte_to_ushort", rx::ConvertIndices, false, GL_UNSIGNED_BYTE, GL_UNSIGNED_SHORT, false),
+    MakeParams("_ubyte_to_ushort_sse2", rx::ConvertIndices_SSE2, true, GL_UNSIGNED_BYTE, GL_UNSIGNED_SHORT, false),
+    MakeParams("_ubyte_to_ushort_restart", rx::ConvertIndices, false, GL_UNSIGNED_BYTE, GL_UNSIGNED_SHORT, true),
+    MakeParams("_ubyte_to_ushort_restart_sse2", rx::ConvertIndices_SSE2, true, GL_UNSIGNED_BYTE, GL_UNSIGNED_SHORT, true),
+    MakeParams("_ushort", rx::ConvertIndices, false, GL_UNSIGNED_SHORT, GL_UNSIGNED_SHORT, false),
+    MakeParams("_ushort_sse2", rx::ConvertIndices_SSE2, true, GL_UNSIGNED_SHORT, GL_UNSIGNED_SHORT, false),
+    MakeParams("_ushort_to_uint", rx::ConvertIndices, false, GL_UNSIGNED_SHORT, GL_UNSIGNED_INT, false),
+    MakeParams("_ushort_to_uint_sse2", rx::ConvertIndices_SSE2, true, GL_UNSIGNED_SHORT, GL_UNSIGNED_INT, false),
+    MakeParams("_uint_restart", rx::ConvertIndices, false, GL_UNSIGNED_INT, GL_UNSIGNED_INT, true),
+    MakeParams("_uint_restart_sse2", rx::ConvertIndices_SSE2, true, GL_UNSIGNED_INT, GL_UNSIGNED_INT, true)));
+
+} // namespace
@@ -0,0 +1,110 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// CopyVertexPerf:
+//   Performance test for the D3D11 vertex copy and conversion functions. It calls them directly,
+//   without a device.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <iostream>
+#include <vector>
+
+#include "libANGLE/renderer/d3d/d3d11/copyvertex.h"
+
+namespace
+{
+
+struct CopyVertexParams
+{
+    const char *suffix;
+    rx::VertexCopyFunction copyFunction;
+    bool usesSSE2;
+    size_t inputVertexSize;
+    size_t outputVertexSize;
+};
+
+class CopyVertexPerfTest : public ANGLEPerfTest,
+                           public ::testing::WithParamInterface<CopyVertexParams>
+{
+  public:
+    CopyVertexPerfTest();
+
+    void step(float dt, double totalTime) override;
+
+  private:
+    size_t mVertexCount;
+    std::vector<uint8_t> mInput;
+    std::vector<uint8_t> mOutput;
+};
+
+CopyVertexPerfTest::CopyVertexPerfTest()
+    : ANGLEPerfTest("CopyVertex", GetParam().suffix),
+      mVertexCount(65536),
+      mInput(mVertexCount * GetParam().inputVertexSize),
+      mOutput(mVertexCount * GetParam().outputVertexSize)
+{
+    for (size_t i = 0; i < mInput.size(); i++)
+    {
+        // Small values, so that no float input is a NaN
+        mInput[i] = static_cast<uint8_t>((i * 7) % 61);
+    }
+}
+
+void CopyVertexPerfTest::step(float dt, double totalTime)
+{
+    const auto &params = GetParam();
+
+    if (params.usesSSE2 && !gl::supportsSSE2())
+    {
+        std::cout << "Test skipped because SSE2 is not available." << std::endl;
+        mRunning = false;
+        return;
+    }
+
+    for (unsigned int iteration = 0; iteration < 10; ++iteration)
+    {
+        params.copyFunction(&mInput[0], params.inputVertexSize, mVertexCount, &mOutput[0]);
+    }
+
+    if (mTimer->getElapsedTime() >= 5.0)
+    {
+        mRunning = false;
+    }
+}
+
+TEST_P(CopyVertexPerfTest, Run)
+{
+    run();
+}
+
+CopyVertexParams MakeParams(const char *suffix, rx::VertexCopyFunction copyFunction, bool usesSSE2,
+                            size_t inputVertexSize, size_t outputVertexSize)
+{
+    CopyVertexParams params;
+    params.suffix = suffix;
+    params.copyFunction = copyFunction;
+    params.usesSSE2 = usesSSE2;
+    params.inputVertexSize = inputVertexSize;
+    params.outputVertexSize = outputVertexSize;
+    return params;
+}
+
+INSTANTIATE_TEST_CASE_P(CopyVertex,
+                        CopyVertexPerfTest,
+                        ::testing::Values(
+    MakeParams("_float3_to_float4", rx::CopyNativeVertexData<GLfloat, 3, 4, gl::Float32One>, false, 12, 16),
+    MakeParams("_float3_to_float4_sse2", rx::CopyXYZToXYZWVertexData_SSE2<GLfloat, gl::Float32One>, true, 12, 16),
+    MakeParams("_snorm16x3_to_snorm16x4", rx::CopyNativeVertexData<GLshort, 3, 4, INT16_MAX>, false, 6, 8),
+    MakeParams("_snorm16x3_to_snorm16x4_sse2", rx::CopyXYZToXYZWVertexData_SSE2<GLshort, INT16_MAX>, true, 6, 8),
+    MakeParams("_snorm8x4_to_snorm16x4", rx::Copy8SnormTo16SnormVertexData<4, 4>, false, 4, 8),
+    MakeParams("_snorm8x4_to_snorm16x4_sse2", rx::Copy8SnormTo16SnormVertexData_SSE2<4, 4>, true, 4, 8),
+    MakeParams("_unorm16x3_to_float3", rx::CopyTo32FVertexData<GLushort, 3, 3, true>, false, 6, 12),
+    MakeParams("_unorm16x3_to_float3_sse2", rx::CopyTo32FVertexData_SSE2<GLushort, 3, 3, true>, true, 6, 12),
+    MakeParams("_fixed3_to_float3", rx::Copy32FixedTo32FVertexData<3, 3>, false, 12, 12),
+    MakeParams("_fixed3_to_float3_sse2", rx::Copy32FixedTo32FVertexData_SSE2<3, 3>, true, 12, 12)));
+
+} // namespace
@@ -28,12 +28,21 @@ struct DrawCallPerfParams final : public RenderTestParams
             strstr << "_validation_only";
         }
 
+        if (revalidateEachDraw)
+        {
+            strstr << "_revalidate";
+        }
+
         return strstr.str();
     }
 
     unsigned int iterations;
     double runTimeSeconds;
     int numTris;
+
+    // Respecify the vertex attribute before each draw, which drops the cached draw
+    // validation and so measures the cost of running every check on every draw.
+    bool revalidateEachDraw;
 };
 
 class DrawCallPerfBenchmark : public ANGLERenderTest,
@@ -153,12 +162,18 @@ void DrawCallPerfBenchmark::drawBenchmark()
 
     for (unsigned int it = 0; it < params.iterations; it++)
     {
+        if (params.revalidateEachDraw)
+        {
+            glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, 0);
+        }
+
         glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(3 * mNumTris));
     }
 
     ASSERT_GL_NO_ERROR();
 }
 
+#if defined(ANGLE_PLATFORM_WINDOWS)
 DrawCallPerfParams DrawCallPerfD3D11Params()
 {
     DrawCallPerfParams params;
@@ -170,6 +185,7 @@ DrawCallPerfParams DrawCallPerfD3D11Params()
     params.iterations = 50;
     params.numTris = 1;
     params.runTimeSeconds = 10.0;
+    params.revalidateEachDraw = false;
     return params;
 }
 
@@ -184,6 +200,7 @@ DrawCallPerfParams DrawCallPerfValidationOnly()
     params.iterations = 100;
     params.numTris = 0;
     params.runTimeSeconds = 5.0;
+    params.revalidateEachDraw = false;
     return params;
 }
 
@@ -198,6 +215,38 @@ DrawCallPerfParams DrawCallPerfD3D9Params()
     params.iterations = 50;
     params.numTris = 1;
     params.runTimeSeconds = 10.0;
+    params.revalidateEachDraw = false;
+    return params;
+}
+
+#endif // defined(ANGLE_PLATFORM_WINDOWS)
+
+DrawCallPerfParams DrawCallPerfNullParams()
+{
+    DrawCallPerfParams params;
+    params.glesMajorVersion = 2;
+    params.widowWidth = 256;
+    params.windowHeight = 256;
+    params.requestedRenderer = EGL_PLATFORM_ANGLE_TYPE_NULL_ANGLE;
+    params.deviceType = EGL_PLATFORM_ANGLE_DEVICE_TYPE_HARDWARE_ANGLE;
+    params.iterations = 100;
+    params.numTris = 1;
+    params.runTimeSeconds = 5.0;
+    params.revalidateEachDraw = false;
+    return params;
+}
+
+DrawCallPerfParams DrawCallPerfNullValidationOnly()
+{
+    DrawCallPerfParams params = DrawCallPerfNullParams();
+    params.numTris = 0;
+    return params;
+}
+
+DrawCallPerfParams DrawCallPerfNullRevalidate()
+{
+    DrawCallPerfParams params = DrawCallPerfNullValidationOnly();
+    params.revalidateEachDraw = true;
     return params;
 }
 
@@ -206,10 +255,21 @@ TEST_P(DrawCallPerfBenchmark, Run)
     run();
 }
 
+// The D3D renderers only exist on Windows, elsewhere only the null renderer runs
+const DrawCallPerfParams DrawCallPerfAllParams[] =
+{
+#if defined(ANGLE_PLATFORM_WINDOWS)
+    DrawCallPerfD3D11Params(),
+    DrawCallPerfD3D9Params(),
+    DrawCallPerfValidationOnly(),
+#endif
+    DrawCallPerfNullParams(),
+    DrawCallPerfNullValidationOnly(),
+    DrawCallPerfNullRevalidate(),
+};
+
 INSTANTIATE_TEST_CASE_P(DrawCallPerf,
                         DrawCallPerfBenchmark,
-                        ::testing::Values(DrawCallPerfD3D11Params(),
-                                          DrawCallPerfD3D9Params(),
-                                          DrawCallPerfValidationOnly()));
+                        ::testing::ValuesIn(DrawCallPerfAllParams));
 
 } // namespace
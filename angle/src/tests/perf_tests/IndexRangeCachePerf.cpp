@@ -0,0 +1,130 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// IndexRangeCachePerf:
+//   Performance test for the cache of index ranges kept by each buffer.
+//
+
+#include <sstream>
+
+#include "ANGLEPerfTest.h"
+
+#include "libANGLE/IndexRangeCache.h"
+
+namespace
+{
+
+struct IndexRangeCachePerfParams
+{
+    std::string suffix() const
+    {
+        std::stringstream strstr;
+        strstr << "_" << distinctRanges << "_ranges";
+        if (subDataInterval > 0)
+        {
+            strstr << "_subdata_every_" << subDataInterval;
+        }
+        return strstr.str();
+    }
+
+    // How many different offsets the draws cycle through
+    unsigned int distinctRanges;
+
+    // Draws between updates of a part of the buffer, or 0 for a static buffer
+    unsigned int subDataInterval;
+};
+
+std::ostream &operator<<(std::ostream &stream, const IndexRangeCachePerfParams &params)
+{
+    stream << params.suffix().substr(1);
+    return stream;
+}
+
+class IndexRangeCachePerfTest : public ANGLEPerfTest,
+                                public ::testing::WithParamInterface<IndexRangeCachePerfParams>
+{
+  public:
+    IndexRangeCachePerfTest();
+
+    void step(float dt, double totalTime) override;
+
+  protected:
+    void TearDown() override;
+
+  private:
+    gl::IndexRangeCache mCache;
+    unsigned int mDrawIndex;
+};
+
+IndexRangeCachePerfTest::IndexRangeCachePerfTest()
+    : ANGLEPerfTest("IndexRangeCachePerf", GetParam().suffix()),
+      mDrawIndex(0)
+{
+}
+
+void IndexRangeCachePerfTest::step(float dt, double totalTime)
+{
+    const IndexRangeCachePerfParams &params = GetParam();
+
+    // Models an app drawing sub-ranges of one big index buffer, the way a buffer looks up a range
+    // and computes it on a miss
+    const GLsizei indexCount = 300;
+    const unsigned int rangeSize = indexCount * sizeof(GLushort);
+    for (unsigned int iteration = 0; iteration < 1000; ++iteration, ++mDrawIndex)
+    {
+        unsigned int offset = (mDrawIndex * 7919u % params.distinctRanges) * rangeSize;
+
+        gl::RangeUI range;
+        if (!mCache.findRange(GL_UNSIGNED_SHORT, offset, indexCount, &range))
+        {
+            mCache.addRange(GL_UNSIGNED_SHORT, offset, indexCount, gl::RangeUI(0, indexCount - 1));
+        }
+
+        if (params.subDataInterval > 0 && mDrawIndex % params.subDataInterval == 0)
+        {
+            unsigned int updateOffset = (mDrawIndex / params.subDataInterval * 104729u % params.distinctRanges) * rangeSize;
+            mCache.invalidateRange(updateOffset, rangeSize / 2);
+        }
+    }
+
+    if (mTimer->getElapsedTime() >= 5.0)
+    {
+        mRunning = false;
+    }
+}
+
+void IndexRangeCachePerfTest::TearDown()
+{
+    unsigned int lookups = mCache.getHitCount() + mCache.getMissCount();
+    if (lookups > 0)
+    {
+        printResult("hit_rate", static_cast<double>(mCache.getHitCount()) / lookups, "fraction", false);
+    }
+    printResult("cached_ranges", mCache.size(), "ranges", false);
+
+    ANGLEPerfTest::TearDown();
+}
+
+TEST_P(IndexRangeCachePerfTest, Run)
+{
+    run();
+}
+
+IndexRangeCachePerfParams Params(unsigned int distinctRanges, unsigned int subDataInterval)
+{
+    IndexRangeCachePerfParams params;
+    params.distinctRanges = distinctRanges;
+    params.subDataInterval = subDataInterval;
+    return params;
+}
+
+INSTANTIATE_TEST_CASE_P(IndexRangeCachePerf,
+                        IndexRangeCachePerfTest,
+                        ::testing::Values(Params(32, 0),
+                                          Params(32, 16),
+                                          Params(4096, 0),
+                                          Params(4096, 16)));
+
+} // namespace
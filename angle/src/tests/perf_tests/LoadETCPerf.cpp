@@ -0,0 +1,118 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// LoadETCPerf:
+//   Performance test for the ETC2 and EAC decoding load functions of the D3D renderers. It calls
+//   them directly on one thread, without a device, and reports the decoded megabytes per second
+//   of a single core.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <vector>
+
+#include "libANGLE/renderer/d3d/loadimage.h"
+
+namespace
+{
+
+struct LoadETCParams
+{
+    const char *suffix;
+    rx::LoadImageFunction loadFunction;
+    size_t blockBytes;
+    size_t outputPixelBytes;
+};
+
+class LoadETCPerfTest : public ANGLEPerfTest,
+                        public ::testing::WithParamInterface<LoadETCParams>
+{
+  public:
+    LoadETCPerfTest();
+
+    void step(float dt, double totalTime) override;
+    void TearDown() override;
+
+  private:
+    size_t mWidth;
+    size_t mHeight;
+    size_t mDecodedBytes;
+    std::vector<uint8_t> mInput;
+    std::vector<uint8_t> mOutput;
+};
+
+LoadETCPerfTest::LoadETCPerfTest()
+    : ANGLEPerfTest("LoadETC", GetParam().suffix),
+      mWidth(1024),
+      mHeight(1024),
+      mDecodedBytes(0),
+      mInput((mWidth / 4) * (mHeight / 4) * GetParam().blockBytes),
+      mOutput(mWidth * mHeight * GetParam().outputPixelBytes)
+{
+    // Pseudo-random blocks, so that every mode of the color blocks is decoded
+    unsigned int seed = 0x2545F491u;
+    for (size_t i = 0; i < mInput.size(); i++)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        mInput[i] = static_cast<uint8_t>(seed >> 24);
+    }
+}
+
+void LoadETCPerfTest::step(float dt, double totalTime)
+{
+    const auto &params = GetParam();
+    const size_t inputRowPitch = (mWidth / 4) * params.blockBytes;
+    const size_t outputRowPitch = mWidth * params.outputPixelBytes;
+
+    for (unsigned int iteration = 0; iteration < 10; ++iteration)
+    {
+        params.loadFunction(mWidth, mHeight, 1, &mInput[0], inputRowPitch, mInput.size(),
+                            &mOutput[0], outputRowPitch, mOutput.size());
+        mDecodedBytes += mOutput.size();
+    }
+
+    if (mTimer->getElapsedTime() >= 5.0)
+    {
+        mRunning = false;
+    }
+}
+
+void LoadETCPerfTest::TearDown()
+{
+    double elapsedTime = mTimer->getElapsedTime();
+    if (elapsedTime > 0.0)
+    {
+        printResult("decoded_megabytes_per_second", static_cast<double>(mDecodedBytes) / (1024.0 * 1024.0) / elapsedTime,
+                    "MB/s", true);
+    }
+
+    ANGLEPerfTest::TearDown();
+}
+
+TEST_P(LoadETCPerfTest, Run)
+{
+    run();
+}
+
+LoadETCParams MakeParams(const char *suffix, rx::LoadImageFunction loadFunction, size_t blockBytes, size_t outputPixelBytes)
+{
+    LoadETCParams params;
+    params.suffix = suffix;
+    params.loadFunction = loadFunction;
+    params.blockBytes = blockBytes;
+    params.outputPixelBytes = outputPixelBytes;
+    return params;
+}
+
+INSTANTIATE_TEST_CASE_P(LoadETC,
+                        LoadETCPerfTest,
+                        ::testing::Values(
+    MakeParams("_etc2_rgb8_to_rgba8", rx::LoadETC2RGB8ToRGBA8, 8, 4),
+    MakeParams("_etc2_rgb8a1_to_rgba8", rx::LoadETC2RGB8A1ToRGBA8, 8, 4),
+    MakeParams("_etc2_rgba8_to_rgba8", rx::LoadETC2RGBA8ToRGBA8, 16, 4),
+    MakeParams("_eac_r11_to_r16", rx::LoadEACR11ToR16, 8, 2),
+    MakeParams("_eac_rg11_to_rg16", rx::LoadEACRG11ToRG16, 16, 4)));
+
+} // namespace
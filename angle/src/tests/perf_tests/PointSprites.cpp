@@ -181,6 +181,7 @@ void PointSpritesBenchmark::drawBenchmark()
     ASSERT_GL_NO_ERROR();
 }
 
+#if defined(ANGLE_PLATFORM_WINDOWS)
 PointSpritesParams D3D11Params()
 {
     PointSpritesParams params;
@@ -216,6 +217,34 @@ PointSpritesParams D3D9Params()
 
     return params;
 }
+#endif // defined(ANGLE_PLATFORM_WINDOWS)
+
+PointSpritesParams NullParams()
+{
+    PointSpritesParams params;
+
+    params.glesMajorVersion = 2;
+    params.widowWidth = 1280;
+    params.windowHeight = 720;
+    params.requestedRenderer = EGL_PLATFORM_ANGLE_TYPE_NULL_ANGLE;
+    params.deviceType = EGL_PLATFORM_ANGLE_DEVICE_TYPE_HARDWARE_ANGLE;
+
+    params.iterations = 10;
+    params.count = 10;
+    params.size = 3.0f;
+    params.numVaryings = 3;
+
+    return params;
+}
+
+const PointSpritesParams AllParams[] =
+{
+#if defined(ANGLE_PLATFORM_WINDOWS)
+    D3D11Params(),
+    D3D9Params(),
+#endif
+    NullParams(),
+};
 
 } // namespace
 
@@ -226,4 +255,4 @@ TEST_P(PointSpritesBenchmark, Run)
 
 INSTANTIATE_TEST_CASE_P(Render,
                         PointSpritesBenchmark,
-                        ::testing::Values(D3D11Params(), D3D9Params()));
+                        ::testing::ValuesIn(AllParams));
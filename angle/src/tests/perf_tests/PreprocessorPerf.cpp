@@ -0,0 +1,208 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// PreprocessorPerf:
+//   Performance tests for the GLSL preprocessor on its own, using synthetic
+//   sources in the style of generated material shaders.
+//
+
+#include <sstream>
+
+#include "ANGLEPerfTest.h"
+
+#include "DiagnosticsBase.h"
+#include "DirectiveHandlerBase.h"
+#include "Preprocessor.h"
+#include "Token.h"
+
+namespace
+{
+
+class NullDiagnostics : public pp::Diagnostics
+{
+  protected:
+    void print(ID id, const pp::SourceLocation &loc, const std::string &text) override {}
+};
+
+class NullDirectiveHandler : public pp::DirectiveHandler
+{
+  public:
+    void handleError(const pp::SourceLocation &loc, const std::string &msg) override {}
+    void handlePragma(const pp::SourceLocation &loc,
+                      const std::string &name,
+                      const std::string &value,
+                      bool stdgl) override {}
+    void handleExtension(const pp::SourceLocation &loc,
+                         const std::string &name,
+                         const std::string &behavior) override {}
+    void handleVersion(const pp::SourceLocation &loc, int version) override {}
+};
+
+// A handful of nested function-like and object-like macros invoked over and
+// over, which is what generated material shaders look like.
+std::string MacroStressSource(unsigned int lines)
+{
+    std::ostringstream stream;
+    stream << "#define PI 3.14159265\n"
+              "#define EPSILON 0.0001\n"
+              "#define SATURATE(x) clamp(x, 0.0, 1.0)\n"
+              "#define SQ(x) ((x) * (x))\n"
+              "#define LUMA(c) dot((c).rgb, vec3(0.299, 0.587, 0.114))\n"
+              "#define FRESNEL(n, v, f0) ((f0) + (1.0 - (f0)) * SQ(SQ(1.0 - SATURATE(dot(n, v)))))\n"
+              "#define GGX(n, h, a) (SQ(a) / (PI * SQ(SQ(dot(n, h)) * (SQ(a) - 1.0) + 1.0) + EPSILON))\n";
+    for (unsigned int line = 0; line < lines; ++line)
+    {
+        stream << "color += GGX(normal, halfVector, roughness" << line % 8
+               << ") * FRESNEL(normal, viewDir, f0) + LUMA(albedo) * PI * EPSILON;\n";
+    }
+    return stream.str();
+}
+
+// A long shader without macros, to keep an eye on the tokenizer.
+std::string PlainSource(unsigned int lines)
+{
+    std::ostringstream stream;
+    for (unsigned int line = 0; line < lines; ++line)
+    {
+        stream << "    vec4 value" << line << " = texture2D(uTexture, vTexCoord + vec2(" << line
+               << ".0, 0.5) * uTexelSize); // sample " << line << "\n";
+    }
+    return stream.str();
+}
+
+struct PreprocessorPerfParams final
+{
+    std::string suffix() const;
+
+    const char *name;
+    std::string (*generateSource)(unsigned int lines);
+    unsigned int lines;
+};
+
+std::ostream &operator<<(std::ostream &os, const PreprocessorPerfParams &params)
+{
+    os << params.suffix().substr(1);
+    return os;
+}
+
+std::string PreprocessorPerfParams::suffix() const
+{
+    return std::string("_") + name;
+}
+
+class PreprocessorPerfTest : public ANGLEPerfTest,
+                             public ::testing::WithParamInterface<PreprocessorPerfParams>
+{
+  public:
+    PreprocessorPerfTest();
+
+    void step(float dt, double totalTime) override;
+
+  protected:
+    void SetUp() override;
+    void TearDown() override;
+
+  private:
+    size_t preprocess();
+
+    std::string mSource;
+    double mRunTimeSeconds;
+    size_t mNumTokens;
+    size_t mNumSources;
+};
+
+PreprocessorPerfTest::PreprocessorPerfTest()
+    : ANGLEPerfTest("PreprocessorPerf", GetParam().suffix()),
+      mRunTimeSeconds(3.0),
+      mNumTokens(0),
+      mNumSources(0)
+{
+}
+
+void PreprocessorPerfTest::SetUp()
+{
+    const PreprocessorPerfParams &params = GetParam();
+    mSource = params.generateSource(params.lines);
+
+    // Make sure the source preprocesses cleanly before timing it.
+    ASSERT_GT(preprocess(), 0u);
+
+    ANGLEPerfTest::SetUp();
+}
+
+void PreprocessorPerfTest::TearDown()
+{
+    double elapsedTime = mTimer->getElapsedTime();
+    if (elapsedTime > 0.0)
+    {
+        printResult("tokens_per_second", static_cast<double>(mNumTokens) / elapsedTime,
+                    "tokens/s", true);
+        printResult("microseconds_per_source", elapsedTime * 1000000.0 / mNumSources, "us",
+                    false);
+    }
+
+    ANGLEPerfTest::TearDown();
+}
+
+size_t PreprocessorPerfTest::preprocess()
+{
+    NullDiagnostics diagnostics;
+    NullDirectiveHandler directiveHandler;
+    pp::Preprocessor preprocessor(&diagnostics, &directiveHandler);
+
+    const char *source = mSource.c_str();
+    if (!preprocessor.init(1, &source, nullptr))
+    {
+        return 0;
+    }
+
+    size_t numTokens = 0;
+    pp::Token token;
+    for (preprocessor.lex(&token); token.type != pp::Token::LAST; preprocessor.lex(&token))
+    {
+        ++numTokens;
+    }
+    return numTokens;
+}
+
+void PreprocessorPerfTest::step(float dt, double totalTime)
+{
+    mNumTokens += preprocess();
+    ++mNumSources;
+
+    if (mTimer->getElapsedTime() >= mRunTimeSeconds)
+    {
+        mRunning = false;
+    }
+}
+
+PreprocessorPerfParams MacroStressParams()
+{
+    PreprocessorPerfParams params;
+    params.name = "macro_stress";
+    params.generateSource = MacroStressSource;
+    params.lines = 500;
+    return params;
+}
+
+PreprocessorPerfParams PlainParams()
+{
+    PreprocessorPerfParams params;
+    params.name = "plain";
+    params.generateSource = PlainSource;
+    params.lines = 2000;
+    return params;
+}
+
+TEST_P(PreprocessorPerfTest, Run)
+{
+    run();
+}
+
+INSTANTIATE_TEST_CASE_P(PreprocessorPerf,
+                        PreprocessorPerfTest,
+                        ::testing::Values(MacroStressParams(), PlainParams()));
+
+} // namespace
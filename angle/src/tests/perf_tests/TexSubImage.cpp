@@ -248,6 +248,7 @@ void TexSubImageBenchmark::drawBenchmark()
     ASSERT_GL_NO_ERROR();
 }
 
+#if defined(ANGLE_PLATFORM_WINDOWS)
 TexSubImageParams D3D11Params()
 {
     TexSubImageParams params;
@@ -285,6 +286,35 @@ TexSubImageParams D3D9Params()
 
     return params;
 }
+#endif // defined(ANGLE_PLATFORM_WINDOWS)
+
+TexSubImageParams NullParams()
+{
+    TexSubImageParams params;
+
+    params.glesMajorVersion = 2;
+    params.widowWidth = 512;
+    params.windowHeight = 512;
+    params.requestedRenderer = EGL_PLATFORM_ANGLE_TYPE_NULL_ANGLE;
+    params.deviceType = EGL_PLATFORM_ANGLE_DEVICE_TYPE_HARDWARE_ANGLE;
+
+    params.imageWidth = 1024;
+    params.imageHeight = 1024;
+    params.subImageWidth = 64;
+    params.subImageHeight = 64;
+    params.iterations = 3;
+
+    return params;
+}
+
+const TexSubImageParams AllParams[] =
+{
+#if defined(ANGLE_PLATFORM_WINDOWS)
+    D3D11Params(),
+    D3D9Params(),
+#endif
+    NullParams(),
+};
 
 } // namespace
 
@@ -295,4 +325,4 @@ TEST_P(TexSubImageBenchmark, Run)
 
 INSTANTIATE_TEST_CASE_P(TextureUpdates,
                         TexSubImageBenchmark,
-                        ::testing::Values(D3D11Params(), D3D9Params()));
+                        ::testing::ValuesIn(AllParams));
@@ -0,0 +1,183 @@
+//
+// Copyright 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// UniformLocationPerf:
+//   Performance test for looking up uniform and attribute names in programs with many uniforms.
+//
+
+#include <sstream>
+
+#include "ANGLEPerfTest.h"
+#include "shader_utils.h"
+
+namespace
+{
+
+struct UniformLocationParams final : public RenderTestParams
+{
+    std::string suffix() const override
+    {
+        std::stringstream strstr;
+
+        strstr << RenderTestParams::suffix();
+        strstr << "_" << numUniforms << "_uniforms";
+
+        if (arrayElements)
+        {
+            strstr << "_array_elements";
+        }
+
+        return strstr.str();
+    }
+
+    unsigned int iterations;
+    unsigned int numUniforms;
+
+    // Query elements of uniform arrays, like "uArray[3]", instead of plain uniforms
+    bool arrayElements;
+};
+
+class UniformLocationBenchmark : public ANGLERenderTest,
+                                 public ::testing::WithParamInterface<UniformLocationParams>
+{
+  public:
+    UniformLocationBenchmark();
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    GLuint mProgram;
+    std::vector<std::string> mUniformNames;
+};
+
+UniformLocationBenchmark::UniformLocationBenchmark()
+    : ANGLERenderTest("UniformLocation", GetParam()),
+      mProgram(0)
+{
+}
+
+void UniformLocationBenchmark::initializeBenchmark()
+{
+    const auto &params = GetParam();
+
+    ASSERT_TRUE(params.iterations > 0);
+    mDrawIterations = params.iterations;
+
+    // Arrays of four elements, or single floats, that all contribute to the position
+    const unsigned int arraySize = 4;
+    const unsigned int numDeclarations = params.arrayElements ? params.numUniforms / arraySize : params.numUniforms;
+
+    std::stringstream vstrstr;
+    vstrstr << "attribute vec2 vPosition;\n";
+    for (unsigned int declarationIndex = 0; declarationIndex < numDeclarations; declarationIndex++)
+    {
+        vstrstr << "uniform float u" << declarationIndex;
+        if (params.arrayElements)
+        {
+            vstrstr << "[" << arraySize << "]";
+        }
+        vstrstr << ";\n";
+    }
+
+    vstrstr << "void main()\n"
+               "{\n"
+               "    float sum = 0.0;\n";
+    for (unsigned int declarationIndex = 0; declarationIndex < numDeclarations; declarationIndex++)
+    {
+        if (params.arrayElements)
+        {
+            for (unsigned int element = 0; element < arraySize; element++)
+            {
+                vstrstr << "    sum += u" << declarationIndex << "[" << element << "];\n";
+
+                std::stringstream name;
+                name << "u" << declarationIndex << "[" << element << "]";
+                mUniformNames.push_back(name.str());
+            }
+        }
+        else
+        {
+            vstrstr << "    sum += u" << declarationIndex << ";\n";
+
+            std::stringstream name;
+            name << "u" << declarationIndex;
+            mUniformNames.push_back(name.str());
+        }
+    }
+    vstrstr << "    gl_Position = vec4(vPosition, sum, 1.0);\n"
+               "}";
+
+    const std::string fs = "precision mediump float;\n"
+                           "void main() { gl_FragColor = vec4(1.0); }";
+
+    mProgram = CompileProgram(vstrstr.str(), fs);
+    ASSERT_TRUE(mProgram != 0);
+
+    ASSERT_GL_NO_ERROR();
+}
+
+void UniformLocationBenchmark::destroyBenchmark()
+{
+    glDeleteProgram(mProgram);
+}
+
+void UniformLocationBenchmark::drawBenchmark()
+{
+    const auto &params = GetParam();
+
+    for (unsigned int it = 0; it < params.iterations; it++)
+    {
+        // Visit the names out of order, the way applications look up whatever they are about to set
+        const std::string &name = mUniformNames[(it * 7919u) % mUniformNames.size()];
+        glGetUniformLocation(mProgram, name.c_str());
+        glGetAttribLocation(mProgram, "vPosition");
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
+UniformLocationParams UniformLocationD3D11Params(unsigned int numUniforms, bool arrayElements)
+{
+    UniformLocationParams params;
+    params.glesMajorVersion = 2;
+    params.widowWidth = 256;
+    params.windowHeight = 256;
+    params.requestedRenderer = EGL_PLATFORM_ANGLE_TYPE_D3D11_ANGLE;
+    params.deviceType = EGL_PLATFORM_ANGLE_DEVICE_TYPE_HARDWARE_ANGLE;
+    params.iterations = 1000;
+    params.numUniforms = numUniforms;
+    params.arrayElements = arrayElements;
+    return params;
+}
+
+UniformLocationParams UniformLocationNullParams(unsigned int numUniforms, bool arrayElements)
+{
+    UniformLocationParams params = UniformLocationD3D11Params(numUniforms, arrayElements);
+    params.requestedRenderer = EGL_PLATFORM_ANGLE_TYPE_NULL_ANGLE;
+    return params;
+}
+
+TEST_P(UniformLocationBenchmark, Run)
+{
+    run();
+}
+
+const UniformLocationParams UniformLocationAllParams[] =
+{
+#if defined(ANGLE_PLATFORM_WINDOWS)
+    UniformLocationD3D11Params(500, false),
+    UniformLocationD3D11Params(500, true),
+#endif
+    UniformLocationNullParams(500, false),
+    UniformLocationNullParams(1000, true),
+};
+
+INSTANTIATE_TEST_CASE_P(UniformLocation,
+                        UniformLocationBenchmark,
+                        ::testing::ValuesIn(UniformLocationAllParams));
+
+} // namespace
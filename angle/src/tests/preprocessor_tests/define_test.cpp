@@ -891,3 +891,39 @@ TEST_F(DefineTest, Predefined_FILE2)
     EXPECT_EQ(pp::Token::CONST_INT, token.type);
     EXPECT_EQ("21", token.text);
 }
+
+// The expansion of an object-like macro whose replacement names no macro is
+// cached. Defining or undefining macros must invalidate that cache.
+TEST_F(DefineTest, ObjRescanAfterDefine)
+{
+    const char* input = "#define foo bar baz\n"
+                        "foo\n"
+                        "#define bar 1\n"
+                        "foo\n"
+                        "#undef bar\n"
+                        "foo\n";
+    const char* expected = "\n"
+                           "bar baz\n"
+                           "\n"
+                           "1 baz\n"
+                           "\n"
+                           "bar baz\n";
+
+    preprocess(input, expected);
+}
+
+TEST_F(DefineTest, ObjRepeatedExpansion)
+{
+    const char* input = "#define one 1\n"
+                        "#define two one + one\n"
+                        "#define add(x, y) (x + y)\n"
+                        "add(one, two) add(two, add(one, one)) one two\n"
+                        "add(one, two) add(two, add(one, one)) one two\n";
+    const char* expected = "\n"
+                           "\n"
+                           "\n"
+                           "(1 + 1 + 1) (1 + 1 + (1 + 1)) 1 1 + 1\n"
+                           "(1 + 1 + 1) (1 + 1 + (1 + 1)) 1 1 + 1\n";
+
+    preprocess(input, expected);
+}
@@ -0,0 +1,230 @@
+//
+// Copyright (c) 2015 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// Checks that DirectTokenizer produces exactly the same tokens, locations
+// and diagnostics as the flex-generated Tokenizer it replaces.
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "DiagnosticsBase.h"
+#include "DirectTokenizer.h"
+#include "Token.h"
+#include "Tokenizer.h"
+
+namespace
+{
+
+class RecordingDiagnostics : public pp::Diagnostics
+{
+  public:
+    std::string log;
+
+  protected:
+    virtual void print(ID id, const pp::SourceLocation &loc, const std::string &text)
+    {
+        std::ostringstream stream;
+        stream << id << " " << loc.file << ":" << loc.line << " " << text << "\n";
+        log += stream.str();
+    }
+};
+
+std::string Describe(const pp::Token &token)
+{
+    std::ostringstream stream;
+    stream << token.type << " " << token.flags << " " << token.location.file << ":"
+           << token.location.line << " [" << token.text << "]";
+    return stream.str();
+}
+
+// Lexes the input with both tokenizers and compares every token, plus two
+// extra reads past the end of input.
+void ExpectSameTokens(const std::vector<std::string> &strings, size_t maxTokenSize = 256)
+{
+    std::vector<const char *> pointers;
+    std::vector<int> lengths;
+    for (size_t i = 0; i < strings.size(); ++i)
+    {
+        pointers.push_back(strings[i].c_str());
+        lengths.push_back(static_cast<int>(strings[i].size()));
+    }
+    const char *const *string = pointers.empty() ? NULL : &pointers[0];
+    const int *length = lengths.empty() ? NULL : &lengths[0];
+
+    RecordingDiagnostics flexDiagnostics;
+    pp::Tokenizer flexTokenizer(&flexDiagnostics);
+    flexTokenizer.setMaxTokenSize(maxTokenSize);
+    ASSERT_TRUE(flexTokenizer.init(strings.size(), string, length));
+
+    RecordingDiagnostics directDiagnostics;
+    pp::DirectTokenizer directTokenizer(&directDiagnostics);
+    directTokenizer.setMaxTokenSize(maxTokenSize);
+    ASSERT_TRUE(directTokenizer.init(strings.size(), string, length));
+
+    int tokensAfterEnd = 0;
+    for (size_t i = 0; tokensAfterEnd < 2; ++i)
+    {
+        pp::Token expected;
+        pp::Token actual;
+        flexTokenizer.lex(&expected);
+        directTokenizer.lex(&actual);
+        ASSERT_EQ(Describe(expected), Describe(actual)) << "token " << i;
+
+        if (expected.type == pp::Token::LAST)
+            ++tokensAfterEnd;
+    }
+    EXPECT_EQ(flexDiagnostics.log, directDiagnostics.log);
+}
+
+void ExpectSameTokens(const std::string &source)
+{
+    ExpectSameTokens(std::vector<std::string>(1, source));
+}
+
+// Splits the source at every possible point to exercise tokens that straddle
+// string boundaries.
+void ExpectSameTokensWhenSplit(const std::string &source)
+{
+    for (size_t split = 0; split <= source.size(); ++split)
+    {
+        std::vector<std::string> strings;
+        strings.push_back(source.substr(0, split));
+        strings.push_back(source.substr(split));
+        ExpectSameTokens(strings);
+    }
+}
+
+const char *const kSources[] =
+{
+    "",
+    "foo bar_1 _baz\tqux",
+    "a\nb\rc\r\nd\n\re",
+    "#define FOO 1\n  # if FOO\nx # y\n#endif\n",
+    "0 1 07 08 0x 0x1F 0XaBu 12u 12uu 12uuu 0u 0uU",
+    "1.0 .5 5. 1e3 1E+3 1e-3 1e 1e+ 1.5e2f 2f 1.f .5F 3e3F",
+    "1.2.3 1a 0x1g 1e3e3 .1.1 12abc 0.x 1..2",
+    "+ ++ += - -- -= * *= / /= % %= < << <= <<= > >> >= >>= = == ! != "
+    "& && &= ^ ^^ ^= | || |= ~ ( ) [ ] { } . , : ; ?",
+    "<<<==>>>== +++=-- ---=",
+    "a // comment\nb //\n// x\r\nc",
+    "a /* comment */ b /**/c/* multi\nline\r\ncomment\r */d /***/ e /* * / **/",
+    "a /* unterminated\ncomment",
+    "a /*",
+    "a\\\nb \\\r\nc \\\rd \\ e \\",
+    "@ $ ` ' \" \x01 \x7f \x80 \xff",
+    "\f\v \t\t  \t",
+    "x                                              y",
+    "// long comment ....................................................\nx",
+    "/* long comment .....................................................*/x",
+    "/* ****************************************************** ****** **/x",
+    "/*\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n\n*/x",
+    "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789 "
+    "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789 "
+    "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789 "
+    "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789 "
+    "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789",
+    "precision mediump float;\n"
+    "uniform vec4 u_color;\n"
+    "void main()\n"
+    "{\n"
+    "    gl_FragColor = u_color * 0.5 + vec4(1.0e-2, .25, 3., 0x1);\n"
+    "}\n",
+};
+
+class TokenizerTest : public testing::TestWithParam<const char *>
+{
+};
+
+TEST_P(TokenizerTest, SingleString)
+{
+    ExpectSameTokens(GetParam());
+}
+
+TEST_P(TokenizerTest, SplitString)
+{
+    ExpectSameTokensWhenSplit(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(Sources, TokenizerTest, testing::ValuesIn(kSources));
+
+TEST(DirectTokenizerTest, NoStrings)
+{
+    ExpectSameTokens(std::vector<std::string>());
+}
+
+TEST(DirectTokenizerTest, EmptyStrings)
+{
+    std::vector<std::string> strings;
+    strings.push_back("");
+    strings.push_back("a\n");
+    strings.push_back("");
+    strings.push_back("");
+    strings.push_back("b");
+    strings.push_back("");
+    strings.push_back("");
+    ExpectSameTokens(strings);
+
+    ExpectSameTokens(std::vector<std::string>(3, ""));
+}
+
+TEST(DirectTokenizerTest, TokenTooLong)
+{
+    std::vector<std::string> strings;
+    strings.push_back("short loooooooooooooong 123456789 // comment is fine\n");
+    ExpectSameTokens(strings, 5);
+}
+
+TEST(DirectTokenizerTest, NullLengthUsesStrlen)
+{
+    const char *const string[] = {"foo bar", "baz"};
+
+    RecordingDiagnostics diagnostics;
+    pp::DirectTokenizer tokenizer(&diagnostics);
+    ASSERT_TRUE(tokenizer.init(2, string, NULL));
+
+    pp::Token token;
+    tokenizer.lex(&token);
+    EXPECT_EQ("foo", token.text);
+    tokenizer.lex(&token);
+    EXPECT_EQ("barbaz", token.text);
+    EXPECT_EQ(0, token.location.file);
+    tokenizer.lex(&token);
+    EXPECT_EQ(pp::Token::LAST, token.type);
+}
+
+TEST(DirectTokenizerTest, NullString)
+{
+    RecordingDiagnostics diagnostics;
+    pp::DirectTokenizer tokenizer(&diagnostics);
+    EXPECT_FALSE(tokenizer.init(1, NULL, NULL));
+}
+
+// Random soup of the characters the scanner treats specially, cut into a
+// random number of strings.
+TEST(DirectTokenizerTest, RandomInput)
+{
+    const char alphabet[] = "ab_019.eExXuUf+-*/=<>&|^!%#\\ \t\v\f\n\r\n\r@";
+    unsigned int seed = 12345;
+    for (int iteration = 0; iteration < 2000; ++iteration)
+    {
+        std::vector<std::string> strings(1);
+        for (int i = 0; i < 64; ++i)
+        {
+            seed = seed * 1103515245 + 12345;
+            unsigned int random = seed >> 16;
+            if (random % 16 == 0)
+                strings.push_back(std::string());
+            else
+                strings.back().push_back(alphabet[random % (sizeof(alphabet) - 1)]);
+        }
+        ExpectSameTokens(strings);
+    }
+}
+
+}  // namespace
@@ -196,10 +196,23 @@
                         'angle_end2end_tests_main.cpp',
                     ],
                 },
+                {
+                    'target_name': 'angle_compiler_perftests',
+                    'type': 'executable',
+                    'includes':
+                    [
+                        '../../build/common_defines.gypi',
+                        'angle_compiler_perftests.gypi',
+                    ],
+                    'sources':
+                    [
+                        'angle_perftests_main.cpp',
+                    ],
+                },
             ],
             'conditions':
             [
-                ['OS=="win"',
+                ['OS=="win" or OS=="linux"',
                 {
                     'targets':
                     [
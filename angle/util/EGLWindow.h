@@ -31,6 +31,12 @@ class OSWindow;
 #define EGL_PLATFORM_ANGLE_DEVICE_TYPE_NULL_ANGLE 0x6AC0
 #endif
 
+// A hidden define used to init the null renderer, which runs the front-end
+// without rendering anything. Useful for performance testing.
+#ifndef EGL_PLATFORM_ANGLE_TYPE_NULL_ANGLE
+#define EGL_PLATFORM_ANGLE_TYPE_NULL_ANGLE 0x6AC1
+#endif
+
 struct EGLPlatformParameters
 {
     EGLint renderer;
@@ -37,7 +37,9 @@ double LinuxTimer::getElapsedTime() const
         endTime = mStopTime;
     }
 
-    return endTime.tv_sec + (1.0 / 1000000000) * endTime.tv_nsec;
+    double startSeconds = mStartTime.tv_sec + (1.0 / 1000000000) * mStartTime.tv_nsec;
+    double endSeconds = endTime.tv_sec + (1.0 / 1000000000) * endTime.tv_nsec;
+    return endSeconds - startSeconds;
 }
 
 Timer *CreateTimer()